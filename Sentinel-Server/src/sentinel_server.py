@@ -19,23 +19,53 @@ import logging
 import psutil
 import subprocess
 from datetime import datetime, timedelta
-from threading import Thread, Lock
-from flask import Flask, request, jsonify
+from threading import Thread, Lock, Event, Condition
+from flask import Flask, Response, request, jsonify
 from werkzeug.security import check_password_hash, generate_password_hash
 import signal
+import struct
+from collections import deque
 
 
 class SystemMonitor:
     """Core system monitoring functionality"""
     
-    def __init__(self):
+    # Compact little-endian layout served on /metrics.bin for the display.
+    # version, size, flags, cpu, memory, disk (percent * 100), reserved,
+    # uptime seconds, unix timestamp, local UTC offset seconds, sample age ms.
+    # New fields are only ever appended (size grows); the version changes
+    # only if existing fields change meaning.
+    BINARY_VERSION = 1
+    BINARY_FORMAT = '<BBHHHHHIIiI'
+    
+    # /metrics/history?format=bin: version, header size, record size,
+    # reserved, record count; then one record per sample with unix
+    # timestamp and cpu, memory, disk (percent * 100), oldest first.
+    HISTORY_VERSION = 1
+    HISTORY_HEADER_FORMAT = '<BBBBI'
+    HISTORY_RECORD_FORMAT = '<IHHH'
+    
+    def __init__(self, sample_interval=1.0, history_seconds=3600):
         self.network_stats_lock = Lock()
         self.last_network_stats = None
         self.last_network_time = None
         
-    def get_cpu_usage(self):
-        """Get CPU usage percentage"""
-        return psutil.cpu_percent(interval=1)
+        # Background sampler state; snapshot is (metrics, unix time, monotonic time)
+        self.sample_interval = max(0.1, float(sample_interval))
+        self.snapshot_lock = Lock()
+        self.snapshot_cond = Condition(self.snapshot_lock)
+        self.snapshot = None
+        self.snapshot_seq = 0
+        self.sampler_stop = Event()
+        self.sampler_thread = None
+        
+        # Recent samples as (unix time, cpu, memory, disk) for /metrics/history,
+        # so clients can fill the gap after losing connectivity
+        self.history = deque(maxlen=max(1, int(history_seconds / self.sample_interval)))
+        
+    def get_cpu_usage(self, interval=1):
+        """Get CPU usage percentage (interval=None: since the previous call)"""
+        return psutil.cpu_percent(interval=interval)
     
     def get_memory_usage(self):
         """Get RAM usage in GB"""
@@ -95,16 +125,175 @@ class SystemMonitor:
             'boot_time': datetime.fromtimestamp(boot_time).isoformat()
         }
     
-    def get_all_metrics(self):
+    def get_all_metrics(self, cpu_interval=1, now=None):
         """Get all system metrics"""
+        now = time.time() if now is None else now
         return {
-            'timestamp': datetime.now().isoformat(),
-            'cpu': self.get_cpu_usage(),
+            'timestamp': datetime.fromtimestamp(now).isoformat(),
+            'unix_time': int(now),
+            'cpu': self.get_cpu_usage(cpu_interval),
             'memory': self.get_memory_usage(),
             'disk': self.get_disk_usage(),
             'network': self.get_network_usage(),
             'uptime': self.get_uptime()
         }
+    
+    def take_sample(self, cpu_interval=None):
+        """Collect metrics and publish them as the current snapshot"""
+        now = time.time()
+        metrics = self.get_all_metrics(cpu_interval=cpu_interval, now=now)
+        with self.snapshot_cond:
+            self.snapshot = (metrics, now, time.monotonic())
+            self.snapshot_seq += 1
+            self.history.append((now, metrics['cpu'], metrics['memory']['percentage'],
+                                 metrics['disk']['percentage']))
+            self.snapshot_cond.notify_all()
+    
+    def start_sampler(self):
+        """Start the background thread that keeps the snapshot fresh"""
+        if self.sampler_thread is not None:
+            return
+        # First snapshot measures CPU over one interval so it is meaningful;
+        # later ones measure the time since the previous sample without blocking
+        self.take_sample(cpu_interval=min(self.sample_interval, 1.0))
+        self.sampler_thread = Thread(target=self._sampler_loop, name='sampler', daemon=True)
+        self.sampler_thread.start()
+        logging.info(f"Metrics sampler running every {self.sample_interval}s")
+    
+    def stop_sampler(self):
+        """Stop the background sampler"""
+        self.sampler_stop.set()
+        if self.sampler_thread is not None:
+            self.sampler_thread.join(timeout=5)
+            self.sampler_thread = None
+    
+    def _sampler_loop(self):
+        next_run = time.monotonic() + self.sample_interval
+        while not self.sampler_stop.wait(max(0.0, next_run - time.monotonic())):
+            try:
+                self.take_sample()
+            except Exception as e:
+                logging.error(f"Error sampling metrics: {e}")
+            # Keep a fixed cadence; skip ahead rather than burst after a stall
+            next_run += self.sample_interval
+            if next_run < time.monotonic():
+                next_run = time.monotonic() + self.sample_interval
+    
+    def get_snapshot(self):
+        """Get the latest (metrics, unix time, age in ms), sampling now if needed"""
+        with self.snapshot_lock:
+            snapshot = self.snapshot
+        if snapshot is None:
+            self.take_sample(cpu_interval=1)
+            with self.snapshot_lock:
+                snapshot = self.snapshot
+        metrics, unix_time, sampled_at = snapshot
+        age_ms = int((time.monotonic() - sampled_at) * 1000)
+        return metrics, unix_time, age_ms
+    
+    def wait_for_sample(self, last_seq, timeout):
+        """Block until a snapshot newer than last_seq exists; returns (seq, snapshot) or None"""
+        with self.snapshot_cond:
+            if not self.snapshot_cond.wait_for(lambda: self.snapshot_seq != last_seq, timeout):
+                return None
+            return self.snapshot_seq, self.snapshot
+    
+    def stream_metrics(self, compact=False, heartbeat=5.0):
+        """Yield a Server-Sent Event for every new snapshot"""
+        # Let clients reconnect quickly if the stream drops
+        yield 'retry: 2000\n\n'
+        last_seq = -1
+        while True:
+            result = self.wait_for_sample(last_seq, heartbeat)
+            if result is None:
+                # Comment line keeps idle connections (and proxies) alive
+                yield ': ping\n\n'
+                continue
+            last_seq, (metrics, _, sampled_at) = result
+            if compact:
+                metrics = self.compact_metrics(metrics)
+            payload = dict(metrics, sample_age_ms=int((time.monotonic() - sampled_at) * 1000))
+            yield f"data: {json.dumps(payload, separators=(',', ':'))}\n\n"
+    
+    @staticmethod
+    def compact_metrics(metrics):
+        """Reduce a snapshot to the fields the display uses, keeping the /metrics shape"""
+        return {
+            'timestamp': metrics['timestamp'],
+            'unix_time': metrics['unix_time'],
+            'cpu': metrics['cpu'],
+            'memory': {'percentage': metrics['memory']['percentage']},
+            'disk': {'percentage': metrics['disk']['percentage']},
+            'uptime': {'uptime_seconds': metrics['uptime']['uptime_seconds']}
+        }
+    
+    def get_latest_metrics(self):
+        """Get the latest snapshot with its age, for /metrics"""
+        metrics, _, age_ms = self.get_snapshot()
+        return dict(metrics, sample_age_ms=age_ms)
+    
+    def get_history(self, since=0.0, step=0, limit=None):
+        """Samples taken after `since` (unix time), oldest first. With step > 0
+        samples are averaged into step-second buckets, each stamped with the
+        time of its last sample; limit keeps only the newest buckets."""
+        with self.snapshot_lock:
+            samples = [s for s in self.history if s[0] > since]
+        if step > 0:
+            buckets = []
+            for sample in samples:
+                bucket = int(sample[0] // step)
+                if buckets and buckets[-1][0] == bucket:
+                    buckets[-1][1].append(sample)
+                else:
+                    buckets.append((bucket, [sample]))
+            samples = [
+                (group[-1][0],) + tuple(sum(s[i] for s in group) / len(group) for i in (1, 2, 3))
+                for _, group in buckets
+            ]
+        if limit is not None and len(samples) > limit:
+            samples = samples[-limit:]
+        return samples
+    
+    def get_binary_history(self, samples):
+        """Pack get_history() output for /metrics/history?format=bin"""
+        def centi(pct):
+            return max(0, min(10000, int(round(pct * 100))))
+        
+        header = struct.pack(
+            self.HISTORY_HEADER_FORMAT,
+            self.HISTORY_VERSION,
+            struct.calcsize(self.HISTORY_HEADER_FORMAT),
+            struct.calcsize(self.HISTORY_RECORD_FORMAT),
+            0,
+            len(samples)
+        )
+        return header + b''.join(
+            struct.pack(self.HISTORY_RECORD_FORMAT, int(t), centi(cpu), centi(memory), centi(disk))
+            for t, cpu, memory, disk in samples
+        )
+    
+    def get_binary_metrics(self):
+        """Get the latest snapshot packed in BINARY_FORMAT, for /metrics.bin"""
+        metrics, unix_time, age_ms = self.get_snapshot()
+        utc_offset = datetime.fromtimestamp(unix_time).astimezone().utcoffset()
+        
+        def centi(pct):
+            return max(0, min(10000, int(round(pct * 100))))
+        
+        return struct.pack(
+            self.BINARY_FORMAT,
+            self.BINARY_VERSION,
+            struct.calcsize(self.BINARY_FORMAT),
+            0,
+            centi(metrics['cpu']),
+            centi(metrics['memory']['percentage']),
+            centi(metrics['disk']['percentage']),
+            0,
+            metrics['uptime']['uptime_seconds'],
+            int(unix_time),
+            int(utc_offset.total_seconds()) if utc_offset else 0,
+            min(age_ms, 0xFFFFFFFF)
+        )
 
 
 class SystemManager:
@@ -253,7 +442,10 @@ class SentinelServer:
     
     def __init__(self):
         self.config_manager = ConfigManager()
-        self.monitor = SystemMonitor()
+        self.monitor = SystemMonitor(
+            sample_interval=self.config_manager.config.get('sample_interval', 1.0),
+            history_seconds=self.config_manager.config.get('history_seconds', 3600)
+        )
         self.manager = SystemManager()
         self.app = Flask(__name__)
         self.setup_logging()
@@ -306,7 +498,44 @@ class SentinelServer:
         @self.app.route('/metrics', methods=['GET'])
         @self.require_auth
         def get_metrics():
-            return jsonify(self.monitor.get_all_metrics())
+            return jsonify(self.monitor.get_latest_metrics())
+        
+        @self.app.route('/metrics.bin', methods=['GET'])
+        @self.require_auth
+        def get_metrics_binary():
+            return Response(self.monitor.get_binary_metrics(), mimetype='application/octet-stream')
+        
+        @self.app.route('/metrics/stream', methods=['GET'])
+        @self.require_auth
+        def stream_metrics():
+            compact = request.args.get('compact', '0') not in ('0', 'false', '')
+            return Response(
+                self.monitor.stream_metrics(compact=compact),
+                mimetype='text/event-stream',
+                headers={'Cache-Control': 'no-cache'}
+            )
+        
+        @self.app.route('/metrics/history', methods=['GET'])
+        @self.require_auth
+        def get_metrics_history():
+            try:
+                since = float(request.args.get('since', 0))
+                step = max(0, int(request.args.get('step', 0)))
+                limit = request.args.get('limit')
+                limit = max(0, int(limit)) if limit is not None else None
+            except ValueError:
+                return jsonify({'error': 'since, step and limit must be numbers'}), 400
+            samples = self.monitor.get_history(since=since, step=step, limit=limit)
+            if request.args.get('format') == 'bin':
+                return Response(self.monitor.get_binary_history(samples), mimetype='application/octet-stream')
+            return jsonify({
+                'since': since,
+                'sample_interval': self.monitor.sample_interval,
+                'samples': [
+                    {'unix_time': int(t), 'cpu': cpu, 'memory': memory, 'disk': disk}
+                    for t, cpu, memory, disk in samples
+                ]
+            })
         
         @self.app.route('/update', methods=['POST'])
         @self.require_auth
@@ -327,7 +556,7 @@ class SentinelServer:
             return jsonify({
                 'service': 'Sentinel Server',
                 'version': '1.0.0',
-                'endpoints': ['/health', '/metrics', '/update', '/reboot', '/info'],
+                'endpoints': ['/health', '/metrics', '/metrics.bin', '/metrics/stream', '/metrics/history', '/update', '/reboot', '/info'],
                 'authentication': 'Bearer token required for protected endpoints'
             })
     
@@ -339,6 +568,9 @@ class SentinelServer:
         # Save config on startup
         self.config_manager.save_config()
         
+        # Sample in the background so requests never wait on psutil
+        self.monitor.start_sampler()
+        
         # Display connection info if this is the first run
         if hasattr(self.config_manager, 'plain_password'):
             ip = self.config_manager.get_server_ip()
@@ -353,7 +585,9 @@ class SentinelServer:
             # Remove plain password from memory after display
             delattr(self.config_manager, 'plain_password')
         
-        self.app.run(host='0.0.0.0', port=port, debug=False)
+        # threaded=True (one thread per connection) keeps /metrics/stream
+        # subscribers from blocking other requests and enables HTTP/1.1 keep-alive
+        self.app.run(host='0.0.0.0', port=port, debug=False, threaded=True)
 
 
 def signal_handler(signum, frame):
@@ -1,28 +1,239 @@
-# Embed logo_png.png into firmware as a C array and auto-include it
-import os
+# Pre-scale logo_png.png to the panel resolution and embed it as RLE-packed
+# RGB565, so the firmware can blit the boot image without a PNG decoder.
+# Also embeds web/portal.html gzip-compressed for the captive portal.
+# PNG decoding and scaling are done here rather than with Pillow so every
+# host produces the same bytes.
+import gzip
+import struct
+import zlib
 from pathlib import Path
 
-def generate_header(input_path: Path, out_header: Path):
-    data = input_path.read_bytes()
-    with out_header.open('w', newline='\n') as f:
-        f.write('#pragma once\n')
-        f.write('#include <cstddef>\n')
-        f.write('extern const unsigned char g_logo_png[];\n')
-        f.write('extern const size_t g_logo_png_len;\n')
-    cfile = out_header.with_suffix('.c')
-    with cfile.open('w', newline='\n') as f:
-        f.write('#include <stddef.h>\n')
-        f.write('const unsigned char g_logo_png[] = {\n')
-        for i, b in enumerate(data):
-            if i % 12 == 0:
-                f.write('    ')
-            f.write(f'0x{b:02x},')
-            if i % 12 == 11:
-                f.write('\n')
+# Panel resolution in the rotation used by the firmware (setRotation(1))
+PANEL_W = 320
+PANEL_H = 240
+# Longest run/literal a single RLE header word can describe
+RLE_MAX = 0x7FFF
+
+
+def decode_png(data: bytes):
+    """Minimal PNG reader (8-bit, non-interlaced).
+    Returns (width, height, rows) with rows as lists of (r, g, b, a)."""
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('not a PNG file')
+    pos = 8
+    idat = bytearray()
+    palette, trns = [], b''
+    width = height = color_type = 0
+    while pos < len(data):
+        length, ctype = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b'IHDR':
+            width, height, depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+            if depth != 8 or interlace != 0:
+                raise ValueError('only 8-bit non-interlaced PNGs are supported')
+        elif ctype == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif ctype == b'tRNS':
+            trns = chunk
+        elif ctype == b'IDAT':
+            idat += chunk
+        elif ctype == b'IEND':
+            break
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    raw = zlib.decompress(bytes(idat))
+    stride = width * channels
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        base = y * (stride + 1)
+        ftype = raw[base]
+        line = bytearray(raw[base + 1:base + 1 + stride])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        prev = line
+        px = []
+        for x in range(width):
+            v = line[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                px.append((v[0], v[0], v[0], 255))
+            elif color_type == 2:
+                px.append((v[0], v[1], v[2], 255))
+            elif color_type == 3:
+                r, g, b = palette[v[0]]
+                px.append((r, g, b, trns[v[0]] if v[0] < len(trns) else 255))
+            elif color_type == 4:
+                px.append((v[0], v[0], v[0], v[1]))
             else:
-                f.write(' ')
-        f.write('\n};\n')
-        f.write(f'const size_t g_logo_png_len = {len(data)};\n')
+                px.append((v[0], v[1], v[2], v[3]))
+        rows.append(px)
+    return width, height, rows
+
+
+def resample(width, height, rows, dw, dh):
+    """Box-filter downscale (nearest for upscale) to dw x dh, alpha over black."""
+    out = []
+    for y in range(dh):
+        y0 = y * height // dh
+        y1 = max(y0 + 1, (y + 1) * height // dh)
+        line = []
+        for x in range(dw):
+            x0 = x * width // dw
+            x1 = max(x0 + 1, (x + 1) * width // dw)
+            r = g = b = 0
+            n = 0
+            for sy in range(y0, y1):
+                src = rows[sy]
+                for sx in range(x0, x1):
+                    pr, pg, pb, pa = src[sx]
+                    r += pr * pa
+                    g += pg * pa
+                    b += pb * pa
+                    n += 1
+            n *= 255
+            line.append((r // n, g // n, b // n))
+        out.append(line)
+    return out
+
+
+def load_scaled(input_path: Path):
+    """Logo fitted (aspect kept, centred) onto a black PANEL_W x PANEL_H canvas."""
+    sw, sh, rows = decode_png(input_path.read_bytes())
+    scale = min(PANEL_W / sw, PANEL_H / sh)
+    dw, dh = max(1, round(sw * scale)), max(1, round(sh * scale))
+    scaled = resample(sw, sh, rows, dw, dh)
+    ox, oy = (PANEL_W - dw) // 2, (PANEL_H - dh) // 2
+    frame = [[(0, 0, 0)] * PANEL_W for _ in range(PANEL_H)]
+    for y in range(dh):
+        frame[oy + y][ox:ox + dw] = scaled[y]
+    return sw, sh, frame
+
+
+def to_rgb565_be(rgb):
+    """RGB565 with bytes swapped, the order LovyanGFX pushes to the panel."""
+    r, g, b = rgb
+    v = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    return ((v & 0xFF) << 8) | (v >> 8)
+
+
+def rle_encode(pixels):
+    """Header word with bit 15 set: repeat the next word (h & 0x7FFF) times.
+    Otherwise: h literal words follow. Runs shorter than 3 stay literal."""
+    out = []
+    literal = []
+    i, n = 0, len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < RLE_MAX and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 3:
+            if literal:
+                out.append(len(literal))
+                out.extend(literal)
+                literal = []
+            out.append(0x8000 | run)
+            out.append(pixels[i])
+            i += run
+        else:
+            literal.append(pixels[i])
+            i += 1
+            if len(literal) == RLE_MAX:
+                out.append(len(literal))
+                out.extend(literal)
+                literal = []
+    if literal:
+        out.append(len(literal))
+        out.extend(literal)
+    return out
+
+
+def write_if_changed(path: Path, text: str):
+    if path.exists() and path.read_text() == text:
+        return
+    with path.open('w', newline='\n') as f:
+        f.write(text)
+
+
+def generate_logo(input_path: Path, out_dir: Path):
+    sw, sh, frame = load_scaled(input_path)
+    pixels = [to_rgb565_be(p) for row in frame for p in row]
+    words = rle_encode(pixels)
+    header = (
+        '#pragma once\n'
+        '#include <stddef.h>\n'
+        '#include <stdint.h>\n'
+        f'// {input_path.name} ({sw}x{sh}) scaled to the panel at build time by scripts/embed_asset.py.\n'
+        '// RLE over byte-swapped RGB565: a header word with bit 15 set repeats the\n'
+        '// next word (h & 0x7FFF) times, otherwise h literal pixel words follow.\n'
+        f'#define LOGO_RGB565_WIDTH {PANEL_W}\n'
+        f'#define LOGO_RGB565_HEIGHT {PANEL_H}\n'
+        '#ifdef __cplusplus\n'
+        'extern "C" {\n'
+        '#endif\n'
+        'extern const uint16_t g_logo_rle[];\n'
+        'extern const size_t g_logo_rle_len;\n'
+        '#ifdef __cplusplus\n'
+        '}\n'
+        '#endif\n'
+    )
+    body = ['#include "logo_rgb565.h"\n', 'const uint16_t g_logo_rle[] = {\n']
+    for i in range(0, len(words), 12):
+        body.append('    ' + ' '.join(f'0x{w:04x},' for w in words[i:i + 12]) + '\n')
+    body.append('};\n')
+    body.append(f'const size_t g_logo_rle_len = {len(words)};\n')
+    write_if_changed(out_dir / 'logo_rgb565.h', header)
+    write_if_changed(out_dir / 'logo_rgb565.c', ''.join(body))
+    return len(words) * 2
+
+
+def c_bytes(data: bytes):
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append('    ' + ' '.join(f'0x{b:02x},' for b in data[i:i + 12]) + '\n')
+    return ''.join(lines)
+
+
+def generate_portal(input_path: Path, out_dir: Path):
+    # mtime=0 keeps the output byte-identical between builds
+    data = gzip.compress(input_path.read_bytes(), compresslevel=9, mtime=0)
+    header = (
+        '#pragma once\n'
+        '#include <stddef.h>\n'
+        '#include <stdint.h>\n'
+        f'// {input_path.name} gzip-compressed at build time by scripts/embed_asset.py.\n'
+        '// Serve with Content-Encoding: gzip.\n'
+        '#ifdef __cplusplus\n'
+        'extern "C" {\n'
+        '#endif\n'
+        'extern const uint8_t g_portal_html_gz[];\n'
+        'extern const size_t g_portal_html_gz_len;\n'
+        '#ifdef __cplusplus\n'
+        '}\n'
+        '#endif\n'
+    )
+    body = ('#include "portal_html.h"\n'
+            'const uint8_t g_portal_html_gz[] = {\n'
+            + c_bytes(data) +
+            '};\n'
+            f'const size_t g_portal_html_gz_len = {len(data)};\n')
+    write_if_changed(out_dir / 'portal_html.h', header)
+    write_if_changed(out_dir / 'portal_html.c', body)
+    return len(data)
+
+
 from SCons.Script import Import
 Import('env')
 
@@ -32,10 +243,18 @@ input_png = project_dir / 'logo_png.png'
 if input_png.exists():
     out_dir = project_dir / 'src' / 'generated'
     out_dir.mkdir(parents=True, exist_ok=True)
-    header = out_dir / 'logo_png.h'
-    generate_header(input_png, header)
+    size = generate_logo(input_png, out_dir)
     # Ensure compiler can find the header (though src/ is included by default)
     env.Append(CPPPATH=[str(out_dir)])
-    print(f'[embed_asset] Embedded {input_png.name} ({input_png.stat().st_size} bytes)')
+    print(f'[embed_asset] Embedded {input_png.name} as {PANEL_W}x{PANEL_H} RLE RGB565 ({size} bytes)')
 else:
     print('[embed_asset] logo_png.png not found; skipping embed')
+
+portal_html = project_dir / 'web' / 'portal.html'
+if portal_html.exists():
+    out_dir = project_dir / 'src' / 'generated'
+    out_dir.mkdir(parents=True, exist_ok=True)
+    size = generate_portal(portal_html, out_dir)
+    print(f'[embed_asset] Embedded {portal_html.name} gzip-compressed ({portal_html.stat().st_size} -> {size} bytes)')
+else:
+    print('[embed_asset] web/portal.html not found; skipping embed')
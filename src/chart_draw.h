@@ -0,0 +1,134 @@
+#pragma once
+#include <cstdint>
+
+// Chart plotting, shared by the firmware and the native benchmarks. Canvas
+// is anything with LovyanGFX's primitives (fillRect, drawFastHLine,
+// drawFastVLine, drawLine, drawPixel); colors come in already resolved.
+namespace chart
+{
+
+inline int mapValueToY(float pct, int yTop, int height)
+{
+  if (pct < 0) pct = 0;
+  if (pct > 100) pct = 100;
+  return yTop + (int)((100.0f - pct) * (height / 100.0f));
+}
+
+struct Inks
+{
+  uint16_t background, grid, line;
+};
+
+// Plot geometry inside a chart frame. The newest sample sits at the right
+// edge and older ones step left by a fixed whole number of pixels, so an
+// update can scroll the existing plot instead of replotting it.
+struct PlotArea
+{
+  int x, y, w, h;      // scrollable interior (border and title row excluded)
+  int plotY, plotH;    // value range mapped by mapValueToY()
+  int step;            // px between samples
+  int visible;         // samples that fit across the plot
+};
+
+// `samples` is the history length the plot is laid out for
+inline PlotArea plotArea(int x, int y, int w, int h, int samples)
+{
+  PlotArea a;
+  a.x = x + 2; a.w = w - 4;
+  a.y = y + 13; a.h = h - 14;
+  a.plotY = y + 15; a.plotH = h - 20;
+  a.step = samples > 1 ? (a.w - 1) / (samples - 1) : a.w;
+  if (a.step < 1) a.step = 1;
+  a.visible = (a.w - 1) / a.step + 1;
+  if (a.visible > samples) a.visible = samples;
+  return a;
+}
+
+// Grid lines (25%,50%,75%) across columns [x0, x0 + w)
+template <typename Canvas>
+void drawPlotGrid(Canvas& g, const PlotArea& a, int x0, int w, uint16_t grid)
+{
+  for (int p : {25,50,75}) {
+    g.drawFastHLine(x0, mapValueToY((float)p, a.plotY, a.plotH), w, grid);
+  }
+}
+
+// Draw the history line from age `oldest` down to age `newest` (0 = latest).
+// Series provides rawValue(age) as a percentage.
+template <typename Canvas, typename Series>
+void drawPlotSegments(Canvas& g, const PlotArea& a, const Series& data, int oldest, int newest, uint16_t color)
+{
+  int right = a.x + a.w - 1;
+  int prevX = right - oldest * a.step;
+  int prevY = mapValueToY(data.rawValue((size_t)oldest), a.plotY, a.plotH);
+  if (oldest == newest) g.drawPixel(prevX, prevY, color);
+  for (int age = oldest - 1; age >= newest; --age) {
+    int px = right - age * a.step;
+    int py = mapValueToY(data.rawValue((size_t)age), a.plotY, a.plotH);
+    g.drawLine(prevX, prevY, px, py, color);
+    prevX = px; prevY = py;
+  }
+}
+
+// Rows a scroll by `added` samples can change. Grid and background are the
+// same after a shift; only the line moves, so the rows it crosses before
+// or after the scroll (ages 0 .. visible + added) bound what differs. A
+// flat plot only needs a few rows pushed.
+template <typename Series>
+void scrollRowSpan(const PlotArea& a, const Series& data, int added, int& top, int& bottom)
+{
+  int points = a.visible + added;
+  if (points > (int)data.raw().size()) points = (int)data.raw().size();
+  top = a.y + a.h;
+  bottom = a.y - 1;
+  for (int age = 0; age < points; ++age) {
+    int py = mapValueToY(data.rawValue((size_t)age), a.plotY, a.plotH);
+    if (py < top) top = py;
+    if (py > bottom) bottom = py;
+  }
+  if (top < a.y) top = a.y;
+  if (bottom > a.y + a.h - 1) bottom = a.y + a.h - 1;
+}
+
+// Plot interior of a chart: grid lines and the whole visible history
+template <typename Canvas, typename Series>
+void drawChartPlot(Canvas& g, const PlotArea& a, int x, int w, const Series& data, const Inks& inks)
+{
+  g.fillRect(x + 1, a.y, w - 2, a.h, inks.background);
+  drawPlotGrid(g, a, x + 1, w - 2, inks.grid);
+  int points = (int)data.raw().size();
+  if (points > a.visible) points = a.visible;
+  if (points < 1) return;
+  drawPlotSegments(g, a, data, points - 1, 0, inks.line);
+}
+
+// Envelope plot: one column per pixel, newest at the right edge. Each column
+// spans its min..max, stretched to meet its older neighbour so the trace
+// stays connected. Codec turns stored values back into percentages.
+template <typename Codec, typename Canvas, typename Envelope>
+void drawTrendPlot(Canvas& g, const PlotArea& a, int x, int w, const Envelope& env, const Inks& inks)
+{
+  g.fillRect(x + 1, a.y, w - 2, a.h, inks.background);
+  drawPlotGrid(g, a, x + 1, w - 2, inks.grid);
+  int columns = (int)env.size();
+  if (columns > a.w) columns = a.w;
+  int right = a.x + a.w - 1;
+  for (int age = 0; age < columns; ++age) {
+    typename Envelope::Column c = env.column((size_t)age);
+    if (c.empty()) continue;
+    int top = mapValueToY(Codec::decode(c.max), a.plotY, a.plotH);
+    int bottom = mapValueToY(Codec::decode(c.min), a.plotY, a.plotH);
+    if (age + 1 < columns) {
+      typename Envelope::Column older = env.column((size_t)age + 1);
+      if (!older.empty()) {
+        int oTop = mapValueToY(Codec::decode(older.max), a.plotY, a.plotH);
+        int oBottom = mapValueToY(Codec::decode(older.min), a.plotY, a.plotH);
+        if (oBottom < top) top = oBottom;
+        if (oTop > bottom) bottom = oTop;
+      }
+    }
+    g.drawFastVLine(right - age, top, bottom - top + 1, inks.line);
+  }
+}
+
+} // namespace chart
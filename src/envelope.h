@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "ring_series.h"
+
+// Min/max envelope at a fixed time per column, built incrementally as
+// samples arrive. A chart N pixels wide draws one column per pixel, so the
+// rendering cost is bounded by its width however many samples went in, and
+// a one-sample spike still shows up as the top of its column.
+template <typename T, size_t Columns>
+class ColumnEnvelope
+{
+public:
+  struct Column
+  {
+    T min, max; // min > max: no samples fell into this column
+    bool empty() const { return min > max; }
+  };
+
+  explicit ColumnEnvelope(uint32_t column_s) : m_column_s(column_s ? column_s : 1) {}
+
+  // Fold a sample taken at now_s (monotonic seconds) into its column.
+  // Columns skipped by a gap in the samples are kept as empty columns.
+  void add(T v, uint32_t now_s)
+  {
+    uint32_t id = now_s / m_column_s;
+    if (m_has_open && id != m_open_id) {
+      m_cols.push(m_open);
+      uint32_t gap = id > m_open_id ? id - m_open_id - 1 : 0;
+      if (gap > Columns) gap = Columns;
+      for (uint32_t i = 0; i < gap; ++i) m_cols.push(emptyColumn());
+      m_has_open = false;
+    }
+    if (!m_has_open) {
+      m_open.min = v;
+      m_open.max = v;
+      m_open_id = id;
+      m_has_open = true;
+    } else {
+      if (v < m_open.min) m_open.min = v;
+      if (v > m_open.max) m_open.max = v;
+    }
+    ++m_revision;
+  }
+
+  void clear()
+  {
+    m_cols.clear();
+    m_has_open = false;
+    ++m_revision;
+  }
+
+  // Columns available, including the one still filling
+  size_t size() const
+  {
+    size_t n = m_cols.size() + (m_has_open ? 1 : 0);
+    return n > Columns ? Columns : n;
+  }
+  static constexpr size_t capacity() { return Columns; }
+  uint32_t columnSeconds() const { return m_column_s; }
+  // Changes whenever a sample lands; views compare it to skip redraws
+  uint32_t revision() const { return m_revision; }
+
+  // Column `age` steps before the newest (0 = the one still filling)
+  Column column(size_t age) const
+  {
+    if (m_has_open) {
+      if (age == 0) return m_open;
+      --age;
+    }
+    return m_cols.fromNewest(age);
+  }
+
+private:
+  static Column emptyColumn()
+  {
+    Column c;
+    c.min = 1;
+    c.max = 0;
+    return c;
+  }
+
+  RingSeries<Column, Columns> m_cols;
+  Column m_open = {};
+  uint32_t m_open_id = 0;
+  uint32_t m_column_s;
+  uint32_t m_revision = 0;
+  bool m_has_open = false;
+};
@@ -1,4 +0,0 @@
-#pragma once
-#include <cstddef>
-extern const unsigned char g_logo_png[];
-extern const size_t g_logo_png_len;
@@ -0,0 +1,2497 @@
+#include "logo_rgb565.h"
+const uint16_t g_logo_rle[] = {
+    0x0001, 0x7def, 0x800a, 0x7eef, 0x8019, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0xbef7, 0x8003, 0xbff7,
+    0x0004, 0xbef7, 0xbff7, 0xbef7, 0x9ef7, 0x8003, 0xbef7, 0x801c, 0xbff7, 0x0001, 0xdfff, 0x800a,
+    0xbff7, 0x0006, 0xdff7, 0xdfff, 0xbfff, 0xdff7, 0xdfff, 0xbfff, 0x8062, 0xdfff, 0x8004, 0xffff,
+    0x0001, 0xdfff, 0x801a, 0xffff, 0x0001, 0xdfff, 0x805f, 0xffff, 0x0002, 0xdfff, 0x9eef, 0x800a,
+    0x7eef, 0x0003, 0x9eef, 0x9ef7, 0x9eef, 0x800f, 0x9ef7, 0x0005, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7,
+    0x9ef7, 0x8005, 0xbef7, 0x0001, 0xbff7, 0x800a, 0xbef7, 0x0003, 0xbff7, 0xbff7, 0xbef7, 0x8016,
+    0xbff7, 0x0004, 0xdfff, 0xdff7, 0xdfff, 0xdfff, 0x8006, 0xdff7, 0x8035, 0xdfff, 0x0002, 0xffff,
+    0xffff, 0x8004, 0xdfff, 0x8007, 0xffff, 0x0003, 0xdfff, 0xdfff, 0xffff, 0x8003, 0xdfff, 0x0004,
+    0xffff, 0xffff, 0xdfff, 0xdfff, 0x809f, 0xffff, 0x0001, 0x9eef, 0x8005, 0x7eef, 0x0002, 0x9eef,
+    0x9eef, 0x8003, 0x7eef, 0x0001, 0x9eef, 0x8011, 0x9ef7, 0x0008, 0xbef7, 0x9ef7, 0xbef7, 0xbef7,
+    0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x800d, 0xbef7, 0x0004, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8005,
+    0xbef7, 0x0002, 0xbff7, 0xbef7, 0x8004, 0xbff7, 0x0001, 0xdff7, 0x8009, 0xbff7, 0x8032, 0xdfff,
+    0x0001, 0xffff, 0x800c, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff, 0x8008, 0xffff, 0x0001, 0xdfff,
+    0x8007, 0xffff, 0x0001, 0xdfff, 0x809f, 0xffff, 0x8006, 0x7eef, 0x0002, 0x9eef, 0x9eef, 0x8004,
+    0x7eef, 0x8010, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0xbff7, 0x8006,
+    0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8005, 0xbef7, 0x0001, 0xdef7,
+    0x8004, 0xbef7, 0x8004, 0xbff7, 0x0001, 0xdff7, 0x8005, 0xbff7, 0x8005, 0xdff7, 0x8004, 0xdfff,
+    0x0001, 0xdff7, 0x8028, 0xdfff, 0x0002, 0xffff, 0xdfff, 0x8003, 0xffff, 0x800c, 0xdfff, 0x0001,
+    0xffff, 0x8005, 0xdfff, 0x0004, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x8005, 0xffff, 0x8005, 0xdfff,
+    0x8003, 0xffff, 0x0001, 0xdfff, 0x809e, 0xffff, 0x8007, 0x7eef, 0x0005, 0x9eef, 0x7eef, 0x9eef,
+    0x7eef, 0x7eef, 0x800e, 0x9ef7, 0x8004, 0xbef7, 0x0002, 0x9ef7, 0x9ef7, 0x8009, 0xbef7, 0x0002,
+    0xbff7, 0xbff7, 0x800a, 0xbef7, 0x8003, 0xbff7, 0x0004, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0x8006,
+    0xbff7, 0x0001, 0xdff7, 0x8004, 0xbff7, 0x8004, 0xdff7, 0x0002, 0xbff7, 0xdff7, 0x8003, 0xdfff,
+    0x0001, 0xdff7, 0x8028, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x0001, 0xffff, 0x800c, 0xdfff,
+    0x0001, 0xffff, 0x8006, 0xdfff, 0x8005, 0xffff, 0x0007, 0xdfff, 0xdfff, 0xffff, 0xffff, 0xdfff,
+    0xffff, 0xdfff, 0x8004, 0xffff, 0x0001, 0xdfff, 0x809e, 0xffff, 0x8003, 0x7eef, 0x0001, 0x9eef,
+    0x8003, 0x7eef, 0x8004, 0x9eef, 0x8011, 0x9ef7, 0x0004, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8009,
+    0xbef7, 0x0001, 0xbff7, 0x800b, 0xbef7, 0x8003, 0xbff7, 0x0002, 0xbef7, 0xdef7, 0x8004, 0xbff7,
+    0x0005, 0xbef7, 0xbff7, 0xdff7, 0xbff7, 0xdff7, 0x8004, 0xbff7, 0x8003, 0xdff7, 0x0002, 0xdfff,
+    0xdfff, 0x8003, 0xdff7, 0x800c, 0xdfff, 0x0001, 0xdff7, 0x8020, 0xdfff, 0x0004, 0xffff, 0xdfff,
+    0xdfff, 0xffff, 0x800a, 0xdfff, 0x000d, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0xffff,
+    0xdfff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x8005, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff,
+    0x0002, 0xffff, 0xdfff, 0x809e, 0xffff, 0x0001, 0x7def, 0x8003, 0x7eef, 0x0002, 0x9eef, 0x7eef,
+    0x8003, 0x9eef, 0x0002, 0x9ef7, 0x9eef, 0x8010, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8016,
+    0xbef7, 0x0005, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0x8006, 0xbff7, 0x0001, 0xdff7, 0x8005,
+    0xbff7, 0x8006, 0xdfff, 0x8003, 0xdff7, 0x802e, 0xdfff, 0x0001, 0xffff, 0x8013, 0xdfff, 0x0001,
+    0xffff, 0x800a, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x0002, 0xffff, 0xdfff, 0x809e, 0xffff,
+    0x0001, 0x9def, 0x8003, 0x7eef, 0x0004, 0x9eef, 0x7eef, 0x9eef, 0x7eef, 0x8003, 0x9eef, 0x8010,
+    0x9ef7, 0x8008, 0xbef7, 0x0001, 0xbff7, 0x800c, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x0005,
+    0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xdff7, 0x8007, 0xbff7, 0x0001, 0xdff7, 0x8005, 0xbff7, 0x8007,
+    0xdfff, 0x0002, 0xdef7, 0xdff7, 0x802c, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xffff, 0x8003, 0xdfff,
+    0x0001, 0xffff, 0x8004, 0xdfff, 0x0001, 0xffff, 0x8012, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff,
+    0x0005, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x809d, 0xffff, 0x0001, 0x7def, 0x8004, 0x7eef,
+    0x0007, 0x7ef7, 0x7eef, 0x7eef, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x800d, 0x9ef7, 0x0003, 0xbef7,
+    0x9ef7, 0x9ef7, 0x801b, 0xbef7, 0x8003, 0xbff7, 0x0002, 0xbef7, 0xdef7, 0x8004, 0xbff7, 0x0002,
+    0xdff7, 0xdff7, 0x8004, 0xbff7, 0x8006, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8032, 0xdfff, 0x0008,
+    0xffff, 0xdfff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0x8018, 0xdfff, 0x80a0, 0xffff,
+    0x0004, 0x7eef, 0x7eef, 0x9eef, 0x9eef, 0x8003, 0x7eef, 0x8005, 0x9eef, 0x800a, 0x9ef7, 0x0006,
+    0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7, 0x800d, 0xbef7, 0x0001, 0xbff7, 0x8008, 0xbef7,
+    0x0001, 0xdef7, 0x8004, 0xbef7, 0x8004, 0xbff7, 0x000b, 0xdef7, 0xbff7, 0xbff7, 0xbef7, 0xdef7,
+    0xdff7, 0xdff7, 0xdfff, 0xbff7, 0xbff7, 0xdff7, 0x8006, 0xdfff, 0x0001, 0xdff7, 0x802e, 0xdfff,
+    0x0001, 0xffff, 0x8003, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8005, 0xdfff, 0x0005, 0xffff, 0xffff,
+    0xdfff, 0xdfff, 0xffff, 0x8018, 0xdfff, 0x809d, 0xffff, 0x8003, 0x7eef, 0x0007, 0x9eef, 0x7eef,
+    0x9ef7, 0x9eef, 0x9ef7, 0x7eef, 0x7eef, 0x800c, 0x9ef7, 0x0005, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7,
+    0x9ef7, 0x8012, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x0006, 0xbff7, 0xbff7, 0xbef7, 0xbff7,
+    0xdef7, 0xbef7, 0x8005, 0xbff7, 0x8003, 0xdff7, 0x8003, 0xbff7, 0x0004, 0xdff7, 0xdfff, 0xdfff,
+    0xbff7, 0x8005, 0xdfff, 0x0001, 0xdff7, 0x802e, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x0001,
+    0xffff, 0x8003, 0xdfff, 0x0006, 0xffff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x8015, 0xdfff,
+    0x0002, 0xffff, 0xffff, 0x8003, 0xdfff, 0x809b, 0xffff, 0x0005, 0x7def, 0x7eef, 0x9eef, 0x9eef,
+    0x7eef, 0x8006, 0x9eef, 0x800b, 0x9ef7, 0x0005, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x801a,
+    0xbef7, 0x8003, 0xbff7, 0x0001, 0xdef7, 0x8004, 0xbff7, 0x0008, 0xdff7, 0xbff7, 0xbff7, 0xdfff,
+    0xdff7, 0xbef7, 0xbff7, 0xbff7, 0x8003, 0xdfff, 0x0001, 0xbff7, 0x803a, 0xdfff, 0x8003, 0xffff,
+    0x800c, 0xdfff, 0x0001, 0xffff, 0x800a, 0xdfff, 0x0003, 0xffff, 0xffff, 0xdfff, 0x80a0, 0xffff,
+    0x000b, 0x7def, 0x7eef, 0x7eef, 0x9ef7, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x7eef,
+    0x800b, 0x9ef7, 0x0006, 0xbef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x8016, 0xbef7, 0x0003,
+    0xdef7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x000e, 0xbef7, 0xbff7, 0xbff7, 0xdff7, 0xbff7, 0xdff7,
+    0xbff7, 0xbff7, 0xdfff, 0xdff7, 0xdff7, 0xbff7, 0xbff7, 0xdff7, 0x8006, 0xdfff, 0x0001, 0xdff7,
+    0x8032, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x8003, 0xffff, 0x8010, 0xdfff, 0x0001, 0xffff,
+    0x8007, 0xdfff, 0x8016, 0xffff, 0x0001, 0xdfff, 0x808b, 0xffff, 0x0002, 0x7def, 0x7eef, 0x8003,
+    0x9ef7, 0x0003, 0x7eef, 0x9eef, 0x9eef, 0x8004, 0x9ef7, 0x0001, 0x9eef, 0x8009, 0x9ef7, 0x8003,
+    0xbef7, 0x0002, 0x9ef7, 0x9ef7, 0x8006, 0xbef7, 0x0001, 0xbff7, 0x8009, 0xbef7, 0x0002, 0xbff7,
+    0xbff7, 0x8007, 0xbef7, 0x0012, 0xbff7, 0xbff7, 0xdef7, 0xdff7, 0xbff7, 0xdff7, 0xdef7, 0xdff7,
+    0xdff7, 0xbff7, 0xbff7, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xbff7, 0xbff7, 0xdef7, 0x8005, 0xdff7,
+    0x8033, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xffff, 0x8004, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8004,
+    0xdfff, 0x0007, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x8007, 0xdfff, 0x0001,
+    0xffff, 0x8003, 0xdfff, 0x8005, 0xffff, 0x0001, 0xdfff, 0x8016, 0xffff, 0x0001, 0xdfff, 0x8086,
+    0xffff, 0x0005, 0x7def, 0x7eef, 0x7eef, 0x7ef7, 0x9ef7, 0x8003, 0x9eef, 0x8004, 0x9ef7, 0x0002,
+    0x9eef, 0x9eef, 0x8008, 0x9ef7, 0x8016, 0xbef7, 0x0001, 0xbff7, 0x8009, 0xbef7, 0x8005, 0xdef7,
+    0x8003, 0xdff7, 0x0002, 0xbff7, 0xbfff, 0x8004, 0xdff7, 0x0004, 0xbff7, 0xdff7, 0xdff7, 0xdfff,
+    0x8003, 0xdff7, 0x8034, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8003, 0xdfff, 0x8004, 0xffff, 0x0003,
+    0xdfff, 0xdfff, 0xffff, 0x8005, 0xdfff, 0x0003, 0xffff, 0xffff, 0xdfff, 0x8006, 0xffff, 0x0004,
+    0xdfff, 0xdfff, 0xffff, 0xdfff, 0x80a3, 0xffff, 0x0008, 0x7def, 0x7eef, 0x7eef, 0x9ef7, 0x9ef7,
+    0x7eef, 0x9eef, 0x9eef, 0x8004, 0x9ef7, 0x0002, 0x9eef, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0xbef7,
+    0x8004, 0x9ef7, 0x8012, 0xbef7, 0x8003, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7,
+    0x0002, 0xdef7, 0xdff7, 0x8003, 0xbef7, 0x0011, 0xdfff, 0xdff7, 0xdef7, 0xdff7, 0xdef7, 0xdfff,
+    0xdfff, 0xdff7, 0xbff7, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0x8017,
+    0xdfff, 0x0001, 0xffff, 0x8015, 0xdfff, 0x0001, 0xffff, 0x800a, 0xdfff, 0x8004, 0xffff, 0x8009,
+    0xdfff, 0x0002, 0xffff, 0xdfff, 0x8008, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x8014, 0xffff, 0x0001,
+    0xdfff, 0x808f, 0xffff, 0x0007, 0x7eef, 0x7eef, 0x9ef7, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x8005,
+    0x9ef7, 0x0001, 0x9eef, 0x8003, 0x9ef7, 0x0002, 0xbef7, 0xbef7, 0x8005, 0x9ef7, 0x8004, 0xbef7,
+    0x0002, 0x9ef7, 0x9ef7, 0x800a, 0xbef7, 0x0005, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0x8003,
+    0xbff7, 0x8005, 0xbef7, 0x0013, 0xbff7, 0xdef7, 0xdff7, 0xdef7, 0xdfff, 0xbef7, 0xdfff, 0xbef7,
+    0xdff7, 0xdfff, 0xdff7, 0xbeff, 0xdfff, 0xdff7, 0xbff7, 0xdff7, 0xbff7, 0xbff7, 0xdff7, 0x8003,
+    0xdfff, 0x8003, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x8031, 0xdfff, 0x8004, 0xffff, 0x8004,
+    0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x8008, 0xffff, 0x0004, 0xdfff, 0xdfff, 0xffff, 0xdfff,
+    0x801d, 0xffff, 0x0001, 0xdfff, 0x8088, 0xffff, 0x0007, 0x7eef, 0x7eef, 0x9ef7, 0x9ef7, 0x7eef,
+    0x9ef7, 0x7eef, 0x8005, 0x9ef7, 0x0001, 0x9eef, 0x800a, 0x9ef7, 0x8004, 0xbef7, 0x0002, 0x9ef7,
+    0x9ef7, 0x8006, 0xbef7, 0x0001, 0xbff7, 0x8007, 0xbef7, 0x8003, 0xbff7, 0x8006, 0xbef7, 0x0007,
+    0xbff7, 0xbef7, 0xdef7, 0xdff7, 0xbff7, 0xbff7, 0xdef7, 0x8004, 0xdff7, 0x8003, 0xdfff, 0x0001,
+    0xbff7, 0x8003, 0xdff7, 0x0003, 0xdfff, 0xdff7, 0xdff7, 0x8019, 0xdfff, 0x0001, 0xffff, 0x801e,
+    0xdfff, 0x8005, 0xffff, 0x8004, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8004, 0xdfff, 0x0003, 0xffff,
+    0xffff, 0xdfff, 0x8004, 0xffff, 0x0001, 0xdfff, 0x8004, 0xffff, 0x0001, 0xdfff, 0x801b, 0xffff,
+    0x0002, 0xdfff, 0xdfff, 0x8086, 0xffff, 0x8003, 0x7eef, 0x0004, 0x9ef7, 0x9eef, 0x9eef, 0x7eef,
+    0x8010, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8010, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x0001,
+    0xbff7, 0x8003, 0xbef7, 0x0006, 0xbff7, 0xbef7, 0xbeff, 0xdff7, 0xbff7, 0xbff7, 0x8005, 0xdff7,
+    0x8004, 0xdfff, 0x8003, 0xdff7, 0x0003, 0xbff7, 0xdff7, 0xdff7, 0x8005, 0xdfff, 0x0001, 0xdff7,
+    0x8032, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8007, 0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x800c,
+    0xffff, 0x0001, 0xdfff, 0x801d, 0xffff, 0x8003, 0xdfff, 0x8085, 0xffff, 0x0002, 0x9eef, 0x7eef,
+    0x8003, 0x9eef, 0x0003, 0x9ef7, 0x7eef, 0x9eef, 0x800d, 0x9ef7, 0x801e, 0xbef7, 0x0007, 0xbff7,
+    0xdff7, 0xbef7, 0xbef7, 0xdff7, 0xbff7, 0xbff7, 0x8004, 0xdff7, 0x0009, 0xbff7, 0xdff7, 0xdfff,
+    0xdff7, 0xdfff, 0xdff7, 0xdfff, 0xdff7, 0xdff7, 0x8005, 0xdfff, 0x0001, 0xdff7, 0x8034, 0xdfff,
+    0x0001, 0xffff, 0x8006, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff, 0x8008, 0xffff, 0x0003, 0xdfff,
+    0xffff, 0xdfff, 0x8022, 0xffff, 0x0001, 0xdfff, 0x8084, 0xffff, 0x0008, 0x7eef, 0x7eef, 0x9eef,
+    0x7eef, 0x9ef7, 0x9eef, 0x7eef, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x800b, 0x9ef7, 0x8007,
+    0xbef7, 0x0002, 0x9ef7, 0xbff7, 0x800a, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8007, 0xbef7, 0x0005,
+    0xdef7, 0xbef7, 0xbef7, 0xdef7, 0xdff7, 0x8004, 0xbff7, 0x0004, 0xdff7, 0xbff7, 0xbff7, 0xdfff,
+    0x8003, 0xdff7, 0x0001, 0xbff7, 0x803d, 0xdfff, 0x8003, 0xffff, 0x8003, 0xdfff, 0x0007, 0xffff,
+    0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0x800b, 0xffff, 0x0001, 0xdfff, 0x80a6, 0xffff,
+    0x8003, 0x7eef, 0x0005, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x800f, 0x9ef7, 0x8007, 0xbef7,
+    0x0001, 0x9ef7, 0x800c, 0xbef7, 0x0005, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8003, 0xbef7,
+    0x0001, 0xdef7, 0x8003, 0xbef7, 0x000d, 0xdff7, 0xdff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7,
+    0xbff7, 0xbff7, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0x800a, 0xdfff, 0x0001, 0xdff7, 0x8030, 0xdfff,
+    0x0005, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0x8003, 0xdfff, 0x8003, 0xffff, 0x8003, 0xdfff,
+    0x800b, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x80a6, 0xffff, 0x8003, 0x7eef, 0x0005, 0x9eef, 0x9ef7,
+    0x9ef7, 0x9eef, 0x9eef, 0x800f, 0x9ef7, 0x8017, 0xbef7, 0x0006, 0xbff7, 0xbff7, 0xdef7, 0xbef7,
+    0xbef7, 0xdef7, 0x8003, 0xbef7, 0x0007, 0xdff7, 0xdef7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7,
+    0x8003, 0xbff7, 0x0008, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0xdfff, 0xbfff, 0x8005,
+    0xdfff, 0x0001, 0xdff7, 0x802f, 0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x8003, 0xffff, 0x0007,
+    0xdfff, 0xdfff, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x80b4, 0xffff, 0x0002, 0x7eef, 0x7eef,
+    0x8004, 0x9eef, 0x8011, 0x9ef7, 0x8006, 0xbef7, 0x0001, 0x9ef7, 0x8008, 0xbef7, 0x0001, 0xbff7,
+    0x800a, 0xbef7, 0x0001, 0xdef7, 0x8005, 0xbef7, 0x0012, 0xdff7, 0xdef7, 0xbef7, 0xbef7, 0xbff7,
+    0xbef7, 0xbef7, 0xbff7, 0xdfff, 0xbff7, 0xdef7, 0xdff7, 0xdff7, 0xdfff, 0xdfff, 0xbff7, 0xdff7,
+    0xdff7, 0x8032, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x8003, 0xffff, 0x8004, 0xdfff, 0x0005,
+    0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x80b4, 0xffff, 0x0002, 0x7eef, 0x7eef, 0x8004, 0x9eef,
+    0x0002, 0x9ef7, 0x9eef, 0x8010, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8011, 0xbef7, 0x0001, 0xbff7,
+    0x8003, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x000e, 0xdef7, 0xdff7, 0xdef7, 0xbff7, 0xbef7,
+    0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbff7, 0xbff7, 0xdff7, 0xdfff, 0xdfff, 0x8005, 0xdff7, 0x8032,
+    0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x8004, 0xffff, 0x0009, 0xdfff, 0xdfff, 0xffff, 0xdfff,
+    0xdfff, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x8007, 0xffff, 0x0001, 0xdfff, 0x80ac, 0xffff, 0x0005,
+    0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x8003, 0x9eef, 0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8003,
+    0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8011, 0xbef7, 0x0001, 0xbff7, 0x800a, 0xbef7, 0x000f, 0xdef7,
+    0xdff7, 0xdef7, 0xbff7, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xdff7, 0xdfff,
+    0xdfff, 0xdff7, 0x801b, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x0001, 0xffff, 0x8016, 0xdfff,
+    0x0006, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xffff, 0x8003, 0xdfff, 0x0001, 0xffff, 0x8003,
+    0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x80b4, 0xffff, 0x0002, 0x9eef, 0x7eef, 0x8003, 0x9eef,
+    0x0001, 0x9ef7, 0x8003, 0x9eef, 0x800d, 0x9ef7, 0x800c, 0xbef7, 0x0001, 0xbff7, 0x8005, 0xbef7,
+    0x8004, 0xbff7, 0x8008, 0xbef7, 0x8003, 0xdef7, 0x0004, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8003,
+    0xbef7, 0x8003, 0xbff7, 0x0004, 0xdef7, 0xdff7, 0xdfff, 0xdff7, 0x8031, 0xdfff, 0x0001, 0xffff,
+    0x8005, 0xdfff, 0x0007, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0x8005, 0xffff,
+    0x8003, 0xdfff, 0x0003, 0xffff, 0xffff, 0xdfff, 0x80b2, 0xffff, 0x8003, 0x7eef, 0x0001, 0x9ef7,
+    0x8003, 0x9eef, 0x0002, 0x7eef, 0x7eef, 0x8007, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x0003,
+    0xbef7, 0x9ef7, 0x9ef7, 0x8014, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x000c, 0xdef7, 0xbef7,
+    0xbef7, 0xdef7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdff7, 0xbef7, 0xdff7, 0xdff7, 0x8003, 0xbef7,
+    0x0007, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0xdff7, 0x8031, 0xdfff, 0x0001, 0xffff,
+    0x8009, 0xdfff, 0x0006, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x8003, 0xffff, 0x0002,
+    0xdfff, 0xdfff, 0x80b5, 0xffff, 0x8003, 0x7eef, 0x8003, 0x9ef7, 0x0003, 0x9eef, 0x7eef, 0x7eef,
+    0x800b, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8016, 0xbef7, 0x0017, 0xbff7, 0xbef7, 0xbef7, 0xdef7,
+    0xdff7, 0xdef7, 0xbff7, 0xbff7, 0xbef7, 0xdef7, 0xbff7, 0xdff7, 0xdef7, 0xbef7, 0xdef7, 0xbef7,
+    0xbff7, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0x8003, 0xdfff, 0x0002, 0xdff7, 0xdff7,
+    0x8018, 0xdfff, 0x0001, 0xffff, 0x8022, 0xdfff, 0x8004, 0xffff, 0x8003, 0xdfff, 0x80b6, 0xffff,
+    0x0002, 0x7eef, 0x7eef, 0x8003, 0x9eef, 0x0001, 0x9ef7, 0x8003, 0x9eef, 0x0003, 0x9ef7, 0x9eef,
+    0x9eef, 0x800a, 0x9ef7, 0x8012, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x0001, 0xdef7, 0x8003,
+    0xbef7, 0x000f, 0xbff7, 0xbef7, 0xdef7, 0xbff7, 0xdff7, 0xbef7, 0xdff7, 0xdef7, 0xbef7, 0xbff7,
+    0xdff7, 0xdff7, 0xdef7, 0xbff7, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x801a, 0xdfff, 0x0001,
+    0xffff, 0x801c, 0xdfff, 0x0001, 0xffff, 0x8006, 0xdfff, 0x0007, 0xffff, 0xdfff, 0xffff, 0xdfff,
+    0xdfff, 0xffff, 0xdfff, 0x80b5, 0xffff, 0x000a, 0x9eef, 0x7eef, 0x9eef, 0x9ef7, 0x9eef, 0x9eef,
+    0x9ef7, 0x9ef7, 0x9eef, 0x7eef, 0x800a, 0x9ef7, 0x8013, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x800a,
+    0xbef7, 0x0003, 0xdef7, 0xbef7, 0xbef7, 0x8003, 0xdef7, 0x0001, 0xdff7, 0x8003, 0xdef7, 0x000a,
+    0xbef7, 0xbef7, 0xdef7, 0xbff7, 0xdff7, 0xdfff, 0xdff7, 0xdff7, 0xbff7, 0xdff7, 0x8031, 0xdfff,
+    0x0001, 0xffff, 0x8007, 0xdfff, 0x8003, 0xffff, 0x8003, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff,
+    0x80b6, 0xffff, 0x0006, 0x7eef, 0x7eef, 0x7ef7, 0x9ef7, 0x9ef7, 0x9eef, 0x8003, 0x9ef7, 0x0002,
+    0x9eef, 0x9eef, 0x8009, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x8013, 0xbef7, 0x0001, 0xbff7,
+    0x8005, 0xbef7, 0x8003, 0xdef7, 0x0002, 0xbff7, 0xbef7, 0x8003, 0xdef7, 0x000a, 0xdff7, 0xdef7,
+    0xdef7, 0xdff7, 0xdff7, 0xdfff, 0xbff7, 0xbff7, 0xdff7, 0xdfff, 0x8003, 0xdff7, 0x0001, 0xbff7,
+    0x8019, 0xdfff, 0x0001, 0xffff, 0x8017, 0xdfff, 0x0004, 0xffff, 0xdfff, 0xffff, 0xffff, 0x8005,
+    0xdfff, 0x0002, 0xffff, 0xffff, 0x8003, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x8003, 0xffff,
+    0x0001, 0xdfff, 0x80b2, 0xffff, 0x0003, 0x7eef, 0x7eef, 0x9eef, 0x8004, 0x9ef7, 0x0001, 0x7ef7,
+    0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x8013, 0xbef7, 0x0001, 0xbff7, 0x8007, 0xbef7,
+    0x0009, 0xdef7, 0xdef7, 0xbef7, 0xdef7, 0xdff7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x8005, 0xdff7,
+    0x8004, 0xdfff, 0x0003, 0xdff7, 0xbff7, 0xdff7, 0x8006, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8011,
+    0xdfff, 0x0001, 0xffff, 0x800a, 0xdfff, 0x0001, 0xffff, 0x8011, 0xdfff, 0x0002, 0xffff, 0xffff,
+    0x8005, 0xdfff, 0x8003, 0xffff, 0x0003, 0xdfff, 0xdfff, 0xffff, 0x8003, 0xdfff, 0x80b2, 0xffff,
+    0x8003, 0x7eef, 0x0001, 0x9eef, 0x8013, 0x9ef7, 0x801d, 0xbef7, 0x0006, 0xdef7, 0xbef7, 0xbef7,
+    0xdef7, 0xdef7, 0xdff7, 0x8004, 0xbef7, 0x0002, 0xdff7, 0xbef7, 0x8005, 0xdfff, 0x8003, 0xdff7,
+    0x8036, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8005, 0xdfff, 0x8003, 0xffff, 0x0006, 0xdfff, 0xdfff,
+    0xffff, 0xffff, 0xdfff, 0xdfff, 0x80b2, 0xffff, 0x8003, 0x7eef, 0x0003, 0x9eef, 0x9ef7, 0x9ef7,
+    0x8004, 0x9eef, 0x800b, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8018, 0xbef7, 0x0002, 0xdef7, 0xdef7,
+    0x8003, 0xbef7, 0x0001, 0xdef7, 0x8003, 0xbef7, 0x8003, 0xdef7, 0x0004, 0xbef7, 0xbef7, 0xdfff,
+    0xbfff, 0x8003, 0xdfff, 0x0003, 0xdff7, 0xdfff, 0xdfff, 0x8003, 0xdff7, 0x0005, 0xdfff, 0xdff7,
+    0xdfff, 0xdfff, 0xdff7, 0x801e, 0xdfff, 0x0001, 0xffff, 0x8016, 0xdfff, 0x0004, 0xffff, 0xffff,
+    0xdfff, 0xffff, 0x8004, 0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x80b2, 0xffff, 0x000a, 0x9eef,
+    0x7eef, 0x7eef, 0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x800a, 0x9ef7, 0x0003,
+    0x9ff7, 0x9ef7, 0x9ef7, 0x800f, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x0004, 0xbff7, 0xbff7,
+    0xdef7, 0xdef7, 0x8003, 0xbef7, 0x0008, 0xdef7, 0xbef7, 0xbeff, 0xbef7, 0xbef7, 0xdef7, 0xdff7,
+    0xdff7, 0x8003, 0xdfff, 0x0008, 0xbef7, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0xdfff, 0xdfff,
+    0x8003, 0xdff7, 0x8004, 0xdfff, 0x0001, 0xdff7, 0x801d, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff,
+    0x0001, 0xffff, 0x800e, 0xdfff, 0x8004, 0xffff, 0x8003, 0xdfff, 0x8005, 0xffff, 0x0001, 0xdfff,
+    0x80b2, 0xffff, 0x0004, 0x9eef, 0x7eef, 0x9eef, 0x9ef7, 0x8003, 0x9eef, 0x0001, 0x7eef, 0x800f,
+    0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x8015, 0xbef7, 0x0001, 0xdef7, 0x8003, 0xbef7, 0x0016,
+    0xdef7, 0xdff7, 0xbef7, 0xdef7, 0xbef7, 0xdff7, 0xdff7, 0xdef7, 0xdff7, 0xdff7, 0xdfff, 0xdff7,
+    0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0xdff7, 0xbfff, 0xdff7, 0xdff7, 0x8029, 0xdfff,
+    0x0001, 0xffff, 0x8010, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8004, 0xdfff, 0x8004, 0xffff, 0x0001,
+    0xdfff, 0x80b2, 0xffff, 0x8003, 0x7eef, 0x0006, 0x9ef7, 0x9ef7, 0x9eef, 0x7eef, 0x7eef, 0x7ef7,
+    0x800a, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8012, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7,
+    0x0011, 0xdef7, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0xdfff, 0xdef7, 0xbef7, 0xdff7, 0xdef7,
+    0xbef7, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0xbff7, 0x8004, 0xdff7, 0x0003, 0xdef7, 0xdff7, 0xdfff,
+    0x8003, 0xdff7, 0x803a, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8003, 0xdfff, 0x80b7, 0xffff, 0x8003,
+    0x7eef, 0x0005, 0x9eef, 0x9ef7, 0x9ef7, 0x7eef, 0x7eef, 0x800d, 0x9ef7, 0x8010, 0xbef7, 0x0001,
+    0xbff7, 0x800c, 0xbef7, 0x0001, 0xdef7, 0x8004, 0xbef7, 0x0010, 0xdef7, 0xdff7, 0xbef7, 0xbef7,
+    0xbff7, 0xbfff, 0xbff7, 0xbff7, 0xdfff, 0xbff7, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdfff,
+    0x8003, 0xdff7, 0x8021, 0xdfff, 0x0001, 0xffff, 0x8006, 0xdfff, 0x0001, 0xffff, 0x8011, 0xdfff,
+    0x0002, 0xffff, 0xffff, 0x8003, 0xdfff, 0x8004, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x80b1, 0xffff,
+    0x0001, 0x9eef, 0x8003, 0x7eef, 0x0004, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x800d, 0x9ef7, 0x0002,
+    0xbef7, 0x9ef7, 0x800e, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8008, 0xbef7, 0x0001, 0xbff7, 0x8006,
+    0xbef7, 0x8003, 0xdef7, 0x0004, 0xdff7, 0xdef7, 0xdef7, 0xdfff, 0x8003, 0xbff7, 0x8004, 0xdfff,
+    0x0007, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0x8006, 0xdfff, 0x0001, 0xdff7,
+    0x8033, 0xdfff, 0x0004, 0xffff, 0xffff, 0xdfff, 0xdfff, 0x8004, 0xffff, 0x0001, 0xdfff, 0x80b2,
+    0xffff, 0x8004, 0x7eef, 0x8003, 0x9eef, 0x8010, 0x9ef7, 0x801f, 0xbef7, 0x0005, 0xdef7, 0xdef7,
+    0xbef7, 0xdef7, 0xdef7, 0x8003, 0xdff7, 0x0002, 0xbff7, 0xbef7, 0x8007, 0xdfff, 0x0004, 0xdff7,
+    0xdff7, 0xdfff, 0xdff7, 0x800a, 0xdfff, 0x0001, 0xdff7, 0x802f, 0xdfff, 0x8003, 0xffff, 0x0001,
+    0xdfff, 0x80b7, 0xffff, 0x0002, 0x7eef, 0x7eef, 0x8003, 0x9eef, 0x0005, 0x7eef, 0x7eef, 0x9ef7,
+    0x9ef7, 0x9eef, 0x800c, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x800b, 0xbef7, 0x0001, 0xbff7,
+    0x800d, 0xbef7, 0x0009, 0xdef7, 0xdef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbeff, 0xbeff, 0xdfff,
+    0x8003, 0xdff7, 0x0002, 0xbff7, 0xbff7, 0x8013, 0xdfff, 0x0001, 0xdff7, 0x802c, 0xdfff, 0x0004,
+    0xffff, 0xffff, 0xdfff, 0xdfff, 0x8003, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x80b6, 0xffff, 0x8004,
+    0x7eef, 0x0006, 0x9ef7, 0x7ef7, 0x7eef, 0x9ef7, 0x9eef, 0x9eef, 0x800c, 0x9ef7, 0x8003, 0xbef7,
+    0x0001, 0x9ef7, 0x800b, 0xbef7, 0x0001, 0xbff7, 0x800b, 0xbef7, 0x000d, 0xdef7, 0xbef7, 0xdef7,
+    0xdef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xdfff, 0xbef7, 0xbef7, 0xdfff, 0xdfff, 0x8003, 0xbff7,
+    0x8040, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0004, 0xffff, 0xffff, 0xdfff, 0xdfff, 0x80b6,
+    0xffff, 0x8004, 0x7eef, 0x0007, 0x9ef7, 0x9ef7, 0x7eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x800c,
+    0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0xbff7, 0x8009, 0xbef7, 0x0004,
+    0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8004, 0xbef7, 0x8004, 0xdef7, 0x000d, 0xbef7, 0xbef7, 0xdef7,
+    0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0xdfff, 0xdfff, 0xbef7, 0xbff7, 0xdff7, 0x8003, 0xdfff,
+    0x0002, 0xdff7, 0xbfff, 0x803c, 0xdfff, 0x0001, 0xffff, 0x8006, 0xdfff, 0x80b6, 0xffff, 0x8003,
+    0x7eef, 0x0002, 0x9eef, 0x9ef7, 0x8004, 0x9eef, 0x8008, 0x9ef7, 0x0001, 0xbef7, 0x8005, 0x9ef7,
+    0x8015, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x8004, 0xdef7, 0x8005, 0xbef7, 0x0006, 0xbff7,
+    0xbff7, 0xbef7, 0xdfff, 0xdfff, 0xbfff, 0x8003, 0xdfff, 0x0007, 0xbef7, 0xdfff, 0xdff7, 0xbff7,
+    0xbff7, 0xdfff, 0xbff7, 0x8034, 0xdfff, 0x000c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0xffff,
+    0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0x80b6, 0xffff, 0x0002, 0x7eef, 0x7eef, 0x8005,
+    0x9eef, 0x8003, 0x7eef, 0x8007, 0x9ef7, 0x0001, 0xbef7, 0x8005, 0x9ef7, 0x801b, 0xbef7, 0x000e,
+    0xdef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xbff7, 0xdef7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xdef7,
+    0xdff7, 0xbfff, 0x8003, 0xdff7, 0x0004, 0xdeff, 0xdfff, 0xdff7, 0xbff7, 0x8003, 0xdff7, 0x800a,
+    0xdfff, 0x0001, 0xdff7, 0x802a, 0xdfff, 0x0001, 0xffff, 0x8008, 0xdfff, 0x0003, 0xffff, 0xdfff,
+    0xdfff, 0x80b5, 0xffff, 0x8003, 0x7eef, 0x8004, 0x9eef, 0x0003, 0x7ef7, 0x7eef, 0x7eef, 0x8003,
+    0x9ef7, 0x0001, 0xbef7, 0x800a, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0x9ef7, 0x8012, 0xbef7, 0x8004,
+    0xdef7, 0x0001, 0xbef7, 0x8003, 0xdef7, 0x000c, 0xbff7, 0xdef7, 0xbef7, 0xbef7, 0xdef7, 0xbef7,
+    0xdef7, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0x8007, 0xdff7, 0x0003, 0xdfff, 0xdfff, 0xdff7,
+    0x8018, 0xdfff, 0x0001, 0xffff, 0x8017, 0xdfff, 0x0001, 0xffff, 0x800a, 0xdfff, 0x0003, 0xffff,
+    0xdfff, 0xdfff, 0x80b5, 0xffff, 0x8003, 0x7eef, 0x8007, 0x9eef, 0x8006, 0x9ef7, 0x0001, 0xbef7,
+    0x8004, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x8019, 0xbef7, 0x8005, 0xdef7, 0x0011, 0xbff7,
+    0xdef7, 0xdef7, 0xbff7, 0xdff7, 0xdef7, 0xdef7, 0xdff7, 0xdef7, 0xbfff, 0xbef7, 0xdff7, 0xdfff,
+    0xdfff, 0xdff7, 0xbff7, 0xbff7, 0x8003, 0xdff7, 0x0005, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7,
+    0x8034, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x0002, 0xffff,
+    0xdfff, 0x80b2, 0xffff, 0x0007, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x7eef, 0x9ef7, 0x9eef, 0x8003,
+    0x7eef, 0x800a, 0x9ef7, 0x0004, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7,
+    0x8007, 0xbef7, 0x0001, 0xbff7, 0x8005, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x0003, 0xdef7,
+    0xbef7, 0xbef7, 0x8003, 0xdef7, 0x8003, 0xbef7, 0x0014, 0xdef7, 0xdef7, 0xbff7, 0xdff7, 0xdef7,
+    0xbef7, 0xdef7, 0xdff7, 0xbef7, 0xdef7, 0xdff7, 0xdff7, 0xdfff, 0xdfff, 0xbff7, 0xbff7, 0xdff7,
+    0xdfff, 0xdfff, 0xbff7, 0x8004, 0xdff7, 0x8004, 0xdfff, 0x0001, 0xdff7, 0x802f, 0xdfff, 0x0001,
+    0xffff, 0x8008, 0xdfff, 0x80b4, 0xffff, 0x8003, 0x7eef, 0x8003, 0x9eef, 0x0005, 0x7ef7, 0x7ef7,
+    0x7eef, 0x7eef, 0x9eef, 0x800a, 0x9ef7, 0x0006, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7,
+    0x8003, 0xbef7, 0x0001, 0x9ef7, 0x800f, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8005, 0xbef7, 0x0006,
+    0xdef7, 0xbef7, 0xdef7, 0xbef7, 0xbff7, 0xbff7, 0x8003, 0xbef7, 0x0003, 0xdfff, 0xbef7, 0xbef7,
+    0x8004, 0xdff7, 0x0006, 0xbff7, 0xbff7, 0xdff7, 0xdff7, 0xdfff, 0xbff7, 0x8004, 0xdff7, 0x802f,
+    0xdfff, 0x0001, 0xffff, 0x8010, 0xdfff, 0x80b1, 0xffff, 0x0008, 0x9eef, 0x7eef, 0x9eef, 0x9eef,
+    0x7eef, 0x9eef, 0x9ef7, 0x7eef, 0x8004, 0x9eef, 0x8009, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7,
+    0x8005, 0xbef7, 0x0001, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0xbff7, 0x8007, 0xbef7, 0x0007, 0xbff7,
+    0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0x8003, 0xbef7, 0x0006, 0xbff7, 0xbef7, 0xdef7,
+    0xbef7, 0xdef7, 0xdef7, 0x8004, 0xbef7, 0x8003, 0xbff7, 0x000a, 0xdfff, 0xbff7, 0xdff7, 0xbff7,
+    0xdfff, 0xbfff, 0xbff7, 0xdff7, 0xdfff, 0xdfff, 0x8003, 0xdff7, 0x0001, 0xdef7, 0x8006, 0xdfff,
+    0x0001, 0xdff7, 0x803a, 0xdfff, 0x80b0, 0xffff, 0x000b, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x7eef,
+    0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x800d, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0x9ef7,
+    0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8009, 0xbef7, 0x0004, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8006,
+    0xbef7, 0x0006, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xdef7, 0xdff7, 0x8004, 0xbef7, 0x0001, 0xdff7,
+    0x8003, 0xbff7, 0x0006, 0xdff7, 0xbff7, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0x8004, 0xbff7, 0x8003,
+    0xdff7, 0x8003, 0xdfff, 0x0001, 0xbff7, 0x803d, 0xdfff, 0x80b0, 0xffff, 0x0009, 0x9eef, 0x9eef,
+    0x7eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x7eef, 0x800e, 0x9ef7, 0x0005, 0xbef7, 0x9ef7,
+    0xbef7, 0xbef7, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0x9ef7, 0x8005, 0xbef7, 0x0001, 0x9ef7, 0x8005,
+    0xbef7, 0x0001, 0xbff7, 0x8008, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xdef7, 0x0006, 0xbef7, 0xbef7,
+    0xdef7, 0xbef7, 0xbfff, 0xbef7, 0x8003, 0xbff7, 0x0009, 0xdfff, 0xdfff, 0xbff7, 0xdff7, 0xbff7,
+    0xbff7, 0xdfff, 0xdff7, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7,
+    0x8039, 0xdfff, 0x8007, 0xffff, 0x8006, 0xdfff, 0x800a, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x8098,
+    0xffff, 0x8004, 0x7eef, 0x0003, 0x9ef7, 0x7eef, 0x7eef, 0x8003, 0x9eef, 0x8010, 0x9ef7, 0x800e,
+    0xbef7, 0x0002, 0xbff7, 0xbff7, 0x800b, 0xbef7, 0x0014, 0xbff7, 0xbef7, 0xbef7, 0xdef7, 0xdef7,
+    0xbef7, 0xdef7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xdfff, 0xbef7, 0xbff7, 0xdff7, 0xbff7, 0xdfff,
+    0xdff7, 0xdfff, 0xbff7, 0x8003, 0xdfff, 0x0002, 0xdff7, 0xbff7, 0x8003, 0xdfff, 0x0001, 0xdff7,
+    0x8003, 0xdfff, 0x0001, 0xdff7, 0x8033, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x0004, 0xffff,
+    0xdfff, 0xffff, 0xffff, 0x8004, 0xdfff, 0x80ab, 0xffff, 0x8003, 0x7eef, 0x0008, 0x9eef, 0x9ef7,
+    0x7ef7, 0x7eef, 0x7eef, 0x9eef, 0x9ef7, 0x7eef, 0x8010, 0x9ef7, 0x8004, 0xbef7, 0x0003, 0x9ef7,
+    0xbef7, 0x9ef7, 0x8009, 0xbef7, 0x0001, 0xbff7, 0x8009, 0xbef7, 0x8003, 0xdef7, 0x8008, 0xbef7,
+    0x0002, 0xbff7, 0xbef7, 0x8003, 0xbff7, 0x0006, 0xdff7, 0xbff7, 0xdfff, 0xbff7, 0xbff7, 0xdfff,
+    0x8003, 0xdff7, 0x0003, 0xdfff, 0xdfff, 0xdff7, 0x8037, 0xdfff, 0x8004, 0xffff, 0x0004, 0xdfff,
+    0xdfff, 0xdff7, 0xdfff, 0x8005, 0xffff, 0x0017, 0xdff7, 0x7ddf, 0x1bc7, 0xb9ae, 0x378e, 0xf575,
+    0x9465, 0x5255, 0xf13c, 0x725d, 0xbcf7, 0x9cf7, 0x9cf7, 0xbcf7, 0x7ae7, 0x17d7, 0xd5c6, 0x73b6,
+    0xb5c6, 0xf7ce, 0x5adf, 0x9cef, 0xdef7, 0x8094, 0xffff, 0x8004, 0x7eef, 0x0001, 0x9ef7, 0x8003,
+    0x7eef, 0x0003, 0x9eef, 0x7eef, 0x9eef, 0x8011, 0x9ef7, 0x0005, 0xbef7, 0x9ef7, 0xbef7, 0xbef7,
+    0x9ef7, 0x8016, 0xbef7, 0x0001, 0xdef7, 0x8004, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8004, 0xbef7,
+    0x8003, 0xbff7, 0x0001, 0xdff7, 0x8003, 0xdfff, 0x0002, 0xbfff, 0xbff7, 0x8003, 0xdff7, 0x0001,
+    0xdfff, 0x8004, 0xdff7, 0x8035, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x8004, 0xffff, 0x0021,
+    0xdef7, 0x3ccf, 0x789e, 0xb475, 0x114d, 0x8f24, 0x4d0c, 0x0c04, 0xeb03, 0xeb03, 0xcb03, 0xcb03,
+    0xec03, 0xcb03, 0x4d2c, 0x9aef, 0x7aef, 0x7aef, 0x9bf7, 0x17df, 0x92be, 0xed9d, 0x8454, 0xa55c,
+    0xc664, 0xc764, 0x0875, 0x4a85, 0xce9d, 0x31ae, 0xd6c6, 0x5ae7, 0xdef7, 0x808f, 0xffff, 0x8005,
+    0x7eef, 0x0008, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x8004, 0x9ef7,
+    0x0001, 0x9eef, 0x8006, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x0005, 0xbef7, 0x9ef7, 0xbef7,
+    0xbef7, 0x9ef7, 0x8011, 0xbef7, 0x0001, 0xdef7, 0x8005, 0xbef7, 0x8007, 0xbff7, 0x0003, 0xdff7,
+    0xbef7, 0xbef7, 0x8003, 0xbff7, 0x0009, 0xdff7, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xbff7,
+    0xdfff, 0xdfff, 0x8005, 0xdff7, 0x8036, 0xdfff, 0x8003, 0xffff, 0x000a, 0xdff7, 0x5ccf, 0x5796,
+    0x935d, 0xcf24, 0x4d04, 0x0c04, 0xeb03, 0xcb03, 0x0c04, 0x8004, 0x2c04, 0x0012, 0x0c04, 0xec03,
+    0x0c04, 0xab03, 0x6e24, 0x9aef, 0x7aef, 0x7bef, 0x9bf7, 0x17df, 0x73be, 0x51b6, 0xa65c, 0xe764,
+    0xe764, 0xe76c, 0x076d, 0x066d, 0x8003, 0xe66c, 0x0006, 0x0775, 0x6a85, 0xce9d, 0x93be, 0x39df,
+    0xdef7, 0x8003, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x8086, 0xffff, 0x0001, 0x7def, 0x8003, 0x7eef,
+    0x0001, 0x9ef7, 0x8005, 0x9eef, 0x0001, 0x9ef7, 0x8003, 0x9eef, 0x8008, 0x9ef7, 0x0001, 0xbef7,
+    0x8004, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8019, 0xbef7, 0x0002, 0xdef7, 0xbff7, 0x8004,
+    0xbef7, 0x0008, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xdfff, 0xdff7, 0x8003, 0xdfff,
+    0x0005, 0xdff7, 0xdef7, 0xbff7, 0xdfff, 0xdfff, 0x8005, 0xdff7, 0x801c, 0xdfff, 0x0001, 0xffff,
+    0x8013, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x8003, 0xffff, 0x002f, 0x9de7, 0xb99e, 0x935d,
+    0xaf24, 0x4c04, 0x2b04, 0x4c04, 0x4c04, 0x6d04, 0x4c04, 0x2c04, 0xeb03, 0xeb03, 0xcb03, 0xeb03,
+    0x2c04, 0x6d14, 0xaf24, 0xf034, 0x314d, 0x5255, 0xd47d, 0xbcf7, 0xbcf7, 0xbdf7, 0xbdf7, 0x7aef,
+    0xf7d6, 0xf7d6, 0x6d8d, 0xe874, 0xc76c, 0xc66c, 0xc664, 0xc564, 0xe56c, 0x066d, 0x276d, 0x2775,
+    0x076d, 0xe664, 0xe66c, 0x0775, 0x6a85, 0x10a6, 0xf7ce, 0xdef7, 0x8003, 0xffff, 0x0001, 0xdfff,
+    0x8084, 0xffff, 0x8003, 0x7eef, 0x0006, 0x9eef, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x9eef, 0x8005,
+    0x9ef7, 0x0001, 0x9eef, 0x8007, 0x9ef7, 0x0006, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7,
+    0x800b, 0xbef7, 0x0004, 0x9ef7, 0xbef7, 0xbef7, 0xbff7, 0x800e, 0xbef7, 0x0002, 0xdef7, 0xbef7,
+    0x8005, 0xbff7, 0x0005, 0xdff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8003, 0xdfff, 0x0006, 0xbff7,
+    0xbff7, 0xdff7, 0xbff7, 0xdfff, 0xdfff, 0x8003, 0xdff7, 0x0002, 0xbff7, 0xdff7, 0x8031, 0xdfff,
+    0x0017, 0xffff, 0xffff, 0xbeef, 0xd9ae, 0xb455, 0x8e0c, 0x0c04, 0xeb03, 0x4c04, 0x6d04, 0x8c04,
+    0x4c04, 0x4b04, 0x4b04, 0x4c04, 0xaf24, 0x314d, 0xd47d, 0x789e, 0xfabe, 0x5cd7, 0x9de7, 0xdff7,
+    0x800c, 0xffff, 0x0014, 0xbef7, 0x9cef, 0x39df, 0xd6ce, 0x53b6, 0xefa5, 0x8b8d, 0x287d, 0x066d,
+    0xc664, 0x0665, 0x477d, 0x687d, 0x477d, 0x2675, 0x2675, 0xe96c, 0x0e85, 0x97c6, 0xbef7, 0x8085,
+    0xffff, 0x8003, 0x7eef, 0x8003, 0x9eef, 0x0002, 0x7eef, 0x9eef, 0x800e, 0x9ef7, 0x0001, 0xbef7,
+    0x8005, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8017, 0xbef7, 0x0005, 0xbff7, 0xbef7, 0xdef7,
+    0xdef7, 0xbef7, 0x8003, 0xbff7, 0x0004, 0xdfff, 0xdff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x000c,
+    0xdfff, 0xbff7, 0xbff7, 0xdfff, 0xdff7, 0xbff7, 0xbff7, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7,
+    0x802c, 0xdfff, 0x0016, 0xffff, 0xdfff, 0xdff7, 0xdfff, 0xffff, 0xffff, 0x5ccf, 0x3676, 0x301d,
+    0x4d04, 0x0c04, 0x4c04, 0x4d04, 0x4c04, 0x0b04, 0x0b04, 0x6d0c, 0xf034, 0xd46d, 0xb9a6, 0x5cd7,
+    0xdff7, 0x801a, 0xffff, 0x000f, 0x9cef, 0x39df, 0x74be, 0xee9d, 0x4985, 0xe674, 0x2675, 0xe66c,
+    0x054c, 0x4433, 0x032b, 0x0433, 0xc853, 0x508d, 0x1adf, 0x8003, 0xffff, 0x0001, 0xdfff, 0x807f,
+    0xffff, 0x8004, 0x7eef, 0x8004, 0x9eef, 0x0002, 0x9ef7, 0x9eef, 0x8005, 0x9ef7, 0x0002, 0x9eef,
+    0x7eef, 0x8004, 0x9ef7, 0x0007, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x8006,
+    0xbef7, 0x0001, 0x9ef7, 0x8006, 0xbef7, 0x0001, 0xbff7, 0x800c, 0xbef7, 0x0003, 0xdef7, 0xbef7,
+    0xbef7, 0x8003, 0xdef7, 0x0009, 0xbef7, 0xbef7, 0xbff7, 0xbfff, 0xdff7, 0xbff7, 0xbef7, 0xdef7,
+    0xbef7, 0x8003, 0xbff7, 0x0009, 0xdfff, 0xdfff, 0xbef7, 0xbff7, 0xdfff, 0xbff7, 0xdef7, 0xdff7,
+    0xdff7, 0x802d, 0xdfff, 0x0011, 0xdff7, 0xdfff, 0xffff, 0xffff, 0xfaae, 0x9245, 0xce04, 0xcd04,
+    0x6d04, 0x6d04, 0x4c04, 0x2b04, 0x0b04, 0x6d1c, 0x5255, 0x789e, 0x5ddf, 0x8006, 0xffff, 0x0003,
+    0xdfff, 0xdff7, 0xdff7, 0x801a, 0xffff, 0x000d, 0xbdf7, 0xf8d6, 0xd1a5, 0x6964, 0x2433, 0x032b,
+    0x2433, 0x653b, 0x653b, 0x2433, 0x653b, 0xcd74, 0xb8c6, 0x8003, 0xffff, 0x0001, 0xdfff, 0x807d,
+    0xffff, 0x8005, 0x7eef, 0x0002, 0x9eef, 0x9ef7, 0x8003, 0x9eef, 0x800e, 0x9ef7, 0x0003, 0xbef7,
+    0xbef7, 0x9ef7, 0x800d, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8010, 0xbef7, 0x0005, 0xdef7, 0xbef7,
+    0xbef7, 0xdef7, 0xbff7, 0x8003, 0xbef7, 0x0002, 0xdef7, 0xdef7, 0x8005, 0xbff7, 0x8003, 0xdfff,
+    0x0001, 0xbff7, 0x8005, 0xdff7, 0x0004, 0xdfff, 0xdff7, 0xdfff, 0xdff7, 0x8028, 0xdfff, 0x000e,
+    0xffff, 0xdff7, 0xb99e, 0x5135, 0xad04, 0xad04, 0xee04, 0x8d04, 0x6c04, 0x4c04, 0xae14, 0x9355,
+    0xd9ae, 0xbeef, 0x8004, 0xffff, 0x0003, 0xdfff, 0xdff7, 0xdfff, 0x8008, 0xffff, 0x000a, 0xdff7,
+    0x9ee7, 0x7edf, 0x5dcf, 0x3dcf, 0x3dcf, 0x3dd7, 0x7ddf, 0x9ee7, 0xbeef, 0x800a, 0xffff, 0x0001,
+    0xdfff, 0x8005, 0xffff, 0x000c, 0xdfff, 0xf9d6, 0x929d, 0x095c, 0x2433, 0x0333, 0x853b, 0x8543,
+    0x4433, 0x643b, 0x0a5c, 0x16b6, 0x8003, 0xffff, 0x0001, 0xdfff, 0x807b, 0xffff, 0x0009, 0x7eef,
+    0x7eef, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x8013, 0x9ef7, 0x0003, 0xbef7,
+    0xbef7, 0x9ef7, 0x8005, 0xbef7, 0x0001, 0x9ef7, 0x800e, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7,
+    0x0001, 0xdef7, 0x800a, 0xbef7, 0x0002, 0xdef7, 0xbef7, 0x8003, 0xbff7, 0x0006, 0xbef7, 0xdff7,
+    0xdff7, 0xdfff, 0xdff7, 0xdfff, 0x8004, 0xdff7, 0x0003, 0xdfff, 0xdff7, 0xdff7, 0x8027, 0xdfff,
+    0x000d, 0xffff, 0xffff, 0xb99e, 0x512d, 0x8d04, 0x8d04, 0xce04, 0xce04, 0x6c04, 0x6c04, 0x313d,
+    0x7796, 0x9de7, 0x8004, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x8005, 0xffff, 0x0019, 0xbeef, 0x3dcf,
+    0x9cae, 0xfa85, 0x5865, 0xd744, 0x762c, 0x351c, 0xd50b, 0x9403, 0x7303, 0x5303, 0x3303, 0x3303,
+    0x5303, 0x530b, 0xb31b, 0xd423, 0x353c, 0x964c, 0x176d, 0xd985, 0x7bae, 0x1ccf, 0x9eef, 0x8006,
+    0xffff, 0x0001, 0xdfff, 0x8004, 0xffff, 0x000e, 0xdfff, 0x98c6, 0xee84, 0x8643, 0x0333, 0x6543,
+    0x253b, 0x441a, 0x241a, 0x8a53, 0x36be, 0xffff, 0xffff, 0xdfff, 0x807a, 0xffff, 0x0002, 0x7eef,
+    0x7eef, 0x8004, 0x9eef, 0x0003, 0x9ef7, 0x7eef, 0x7eef, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x8008,
+    0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0xbef7, 0x8004, 0x9ef7, 0x0002,
+    0xbef7, 0xbff7, 0x8009, 0xbef7, 0x0009, 0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7,
+    0xbff7, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xdef7, 0x800a, 0xbef7, 0x0002, 0xdef7, 0xdef7, 0x8003,
+    0xbff7, 0x0001, 0xbef7, 0x8004, 0xdff7, 0x0002, 0xdfff, 0xdfff, 0x8003, 0xdff7, 0x0003, 0xdfff,
+    0xdfff, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x8021, 0xdfff, 0x000c, 0xffff, 0xffff, 0xfab6,
+    0x7235, 0xae04, 0xce04, 0xef0c, 0xce04, 0x8d04, 0xae04, 0xb35d, 0x1abf, 0x8004, 0xffff, 0x0002,
+    0xdff7, 0xdfff, 0x8004, 0xffff, 0x0007, 0x5dd7, 0x7c9e, 0x9965, 0xb734, 0x1614, 0x9403, 0x7403,
+    0x8003, 0x5403, 0x0004, 0x7503, 0x5403, 0x3403, 0x3403, 0x8003, 0x1403, 0x0010, 0x1303, 0xf302,
+    0xf302, 0x1303, 0xf302, 0xd202, 0xb202, 0x9102, 0xb102, 0xd202, 0xf102, 0x3013, 0xce3b, 0xd174,
+    0xf6a5, 0x1bdf, 0x800a, 0xffff, 0x000d, 0x5ce7, 0xb29d, 0x884b, 0x231a, 0x251a, 0x862a, 0x4522,
+    0x4422, 0xcb5b, 0x99ce, 0xffff, 0xffff, 0xdfff, 0x8078, 0xffff, 0x8003, 0x7eef, 0x8003, 0x9eef,
+    0x0004, 0x9ef7, 0x9ef7, 0x7eef, 0x9eef, 0x8005, 0x9ef7, 0x0001, 0x9eef, 0x8005, 0x9ef7, 0x0001,
+    0xbef7, 0x8005, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8013, 0xbef7, 0x0001, 0xbff7, 0x800a,
+    0xbef7, 0x0002, 0xdef7, 0xdef7, 0x8003, 0xbef7, 0x000b, 0xbff7, 0xbff7, 0xdef7, 0xbef7, 0xbef7,
+    0xdff7, 0xbff7, 0xbef7, 0xbef7, 0xdeff, 0xdff7, 0x8003, 0xdfff, 0x8006, 0xdff7, 0x8003, 0xdfff,
+    0x0001, 0xdff7, 0x8020, 0xdfff, 0x000b, 0xffff, 0x9ce7, 0xb35d, 0x8e04, 0xae04, 0xef04, 0xae04,
+    0x8d04, 0xce0c, 0xf56d, 0x5cd7, 0x8003, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x8003, 0xffff, 0x000a,
+    0xdff7, 0xfdbe, 0xd975, 0xb734, 0x1604, 0xd503, 0xd503, 0xb503, 0xd503, 0x9403, 0x8004, 0x7403,
+    0x0001, 0x3403, 0x8003, 0xf302, 0x0006, 0xd202, 0xd202, 0xb202, 0xb202, 0x9102, 0x9102, 0x8003,
+    0xb202, 0x000e, 0xb102, 0xd202, 0xf202, 0x1203, 0xf202, 0xd002, 0xac02, 0x6412, 0x4312, 0x6522,
+    0x4943, 0x9074, 0x58be, 0xbef7, 0x8008, 0xffff, 0x000d, 0xbef7, 0xf5ad, 0x494b, 0x031a, 0x2422,
+    0xa62a, 0x4422, 0x652a, 0x4e74, 0x3ce7, 0xffff, 0xffff, 0xdfff, 0x8076, 0xffff, 0x8004, 0x7eef,
+    0x0006, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x7eef, 0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8008,
+    0x9ef7, 0x801e, 0xbef7, 0x0001, 0xdff7, 0x8005, 0xbef7, 0x0007, 0xbfff, 0xbef7, 0xdef7, 0xdff7,
+    0xbef7, 0xbef7, 0xbff7, 0x8003, 0xdff7, 0x0008, 0xdfff, 0xdfff, 0xdeff, 0xdff7, 0xdfff, 0xdfff,
+    0xdff7, 0xbff7, 0x8022, 0xdfff, 0x000b, 0xffff, 0xffff, 0xf2b6, 0x2b35, 0x6e04, 0xcf04, 0xcf04,
+    0x8d04, 0xce0c, 0xf56d, 0x7cd7, 0x8003, 0xffff, 0x0001, 0xdfff, 0x8003, 0xffff, 0x0007, 0xdfff,
+    0xfdbe, 0xb965, 0x7724, 0xd503, 0xb503, 0xd603, 0x8003, 0x1604, 0x0025, 0xb503, 0xb503, 0x9403,
+    0x3303, 0x3303, 0x7403, 0x940b, 0xb513, 0xf51b, 0x5724, 0x5724, 0x972c, 0xb82c, 0xd834, 0xd83c,
+    0xb83c, 0x973c, 0x5634, 0x362c, 0xf523, 0xb41b, 0x530b, 0xf202, 0xd202, 0xb102, 0x8f02, 0x6f02,
+    0x8a0a, 0x8522, 0x4522, 0x0412, 0xc309, 0xc309, 0xea1a, 0xd45c, 0x7ab6, 0xbef7, 0x8007, 0xffff,
+    0x000c, 0xdfff, 0xf6b5, 0x694b, 0x2422, 0x6522, 0x852a, 0x241a, 0xc632, 0x739d, 0xdff7, 0xffff,
+    0xdfff, 0x8075, 0xffff, 0x8004, 0x7eef, 0x0007, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x7eef,
+    0x9eef, 0x800f, 0x9ef7, 0x0008, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7,
+    0x800f, 0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbff7, 0x8010, 0xbef7, 0x0005, 0xdff7, 0xdff7, 0xdfff,
+    0xbff7, 0xbff7, 0x8005, 0xdff7, 0x0007, 0xdfff, 0xdff7, 0xbff7, 0xdfff, 0xdff7, 0xdff7, 0xbff7,
+    0x8003, 0xdff7, 0x8018, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff, 0x000e, 0xffff, 0x7ae7, 0x6b96,
+    0x247e, 0x0b2d, 0x6e04, 0x4d04, 0x6d04, 0xd35d, 0x7cd7, 0xffff, 0xffff, 0xdfff, 0xdfff, 0x8003,
+    0xffff, 0x0006, 0x7edf, 0xfa85, 0xb72c, 0x1604, 0xf603, 0x1604, 0x8003, 0xf603, 0x002a, 0xb503,
+    0x9503, 0xd603, 0xf603, 0x7724, 0xf83c, 0x9b5d, 0x1c76, 0x9d8e, 0xbe86, 0xbe7e, 0xff86, 0xff8e,
+    0xff86, 0xdf7e, 0xff8e, 0x3f9f, 0x5fa7, 0x7fb7, 0x7fbf, 0x5fb7, 0x7fbf, 0x5fbf, 0x3fb7, 0xfeae,
+    0x7d96, 0x1c86, 0x5965, 0x7644, 0x9323, 0xb102, 0x0a02, 0xe309, 0xc309, 0x041a, 0x0412, 0xed02,
+    0x3003, 0x0f03, 0x921b, 0x547d, 0x3bdf, 0x8007, 0xffff, 0x0009, 0xdfff, 0x539d, 0xc73a, 0x241a,
+    0xa62a, 0x852a, 0x2322, 0xaa53, 0xfad6, 0x8076, 0xffff, 0x8003, 0x7eef, 0x0004, 0x9eef, 0x9ef7,
+    0x9eef, 0x7eef, 0x8004, 0x9eef, 0x0003, 0x9ef7, 0x9ef7, 0x9eef, 0x800c, 0x9ef7, 0x0008, 0xbef7,
+    0x9ef7, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0xbff7, 0x800d,
+    0xbef7, 0x0002, 0xbff7, 0xbff7, 0x800f, 0xbef7, 0x0003, 0xbfff, 0xdfff, 0xdff7, 0x8004, 0xbff7,
+    0x8005, 0xdff7, 0x0003, 0xbff7, 0xdff7, 0xbff7, 0x8004, 0xdff7, 0x801c, 0xdfff, 0x000e, 0xffff,
+    0xffff, 0xd4be, 0xe77d, 0x257e, 0x298e, 0x6b14, 0x2c04, 0x3035, 0xfab6, 0xffff, 0xffff, 0xdfff,
+    0xdfff, 0x8003, 0xffff, 0x0037, 0x1dc7, 0x795d, 0x560c, 0xf603, 0x1604, 0x3704, 0x5704, 0xf603,
+    0xb503, 0xb503, 0xd603, 0x7724, 0x7a4d, 0x3c76, 0xbe96, 0x3faf, 0x7fc7, 0x7fc7, 0x7fbf, 0x3fa7,
+    0xdf8e, 0xbf7e, 0xff96, 0xde8e, 0xde96, 0xdf96, 0xff9e, 0x1fa7, 0x1faf, 0x1eaf, 0x1fb7, 0x1fb7,
+    0x3fbf, 0x3fbf, 0x5fbf, 0x7fc7, 0x7fc7, 0x9fcf, 0xbfcf, 0xbfcf, 0x7fc7, 0xfeae, 0x1a8e, 0xd264,
+    0x6b3b, 0x2612, 0x0702, 0x3103, 0x5103, 0x1003, 0x8c1b, 0x254c, 0x8764, 0x6e8d, 0xf9d6, 0x8007,
+    0xffff, 0x0008, 0x5ce7, 0x8f7c, 0x842a, 0x6422, 0xc632, 0x832a, 0xe432, 0xd39d, 0x8075, 0xffff,
+    0x8004, 0x7eef, 0x8003, 0x9eef, 0x0005, 0x7eef, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x800e, 0x9ef7,
+    0x0002, 0xbef7, 0xbef7, 0x8003, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x8011, 0xbef7, 0x0002,
+    0xbff7, 0xbff7, 0x8010, 0xbef7, 0x000b, 0xdfff, 0xdff7, 0xdef7, 0xbff7, 0xbef7, 0xbff7, 0xbff7,
+    0xbef7, 0xbff7, 0xbff7, 0xdff7, 0x8003, 0xbff7, 0x0002, 0xdff7, 0xdff7, 0x801c, 0xdfff, 0x000a,
+    0xdeff, 0xffff, 0xbcef, 0x4da6, 0xc475, 0x067e, 0x2786, 0xe64c, 0x0c14, 0x578e, 0x8003, 0xffff,
+    0x001d, 0xdfff, 0xdfff, 0xffff, 0xffff, 0xfcbe, 0x384d, 0x1504, 0xf503, 0x1604, 0x5704, 0x3604,
+    0xf503, 0xb503, 0xd503, 0xb82c, 0xbb5d, 0x9d8e, 0x3faf, 0x5fb7, 0x5fb7, 0x3fb7, 0x1fb7, 0x1eaf,
+    0x1faf, 0xde9e, 0xbe7e, 0x9e76, 0xbe7e, 0xde8e, 0x8003, 0xff9e, 0x0003, 0x1fa7, 0x1faf, 0x1faf,
+    0x8003, 0x3fb7, 0x0003, 0x3fbf, 0x5fbf, 0x5fc7, 0x8003, 0x5fbf, 0x8003, 0x5fc7, 0x0010, 0x7fcf,
+    0xbfd7, 0xdfdf, 0xbfd7, 0xbbb6, 0x9775, 0x1334, 0x0f03, 0xa733, 0xa464, 0xc66c, 0xa664, 0x655c,
+    0x6664, 0x2c8d, 0xb7ce, 0x8007, 0xffff, 0x0008, 0x98c6, 0x8953, 0x4322, 0xc52a, 0x653b, 0x0344,
+    0x8c8d, 0x9def, 0x8073, 0xffff, 0x0001, 0x7def, 0x8004, 0x7eef, 0x8006, 0x9eef, 0x0001, 0x7eef,
+    0x800d, 0x9ef7, 0x0007, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x8003, 0x9ef7,
+    0x8004, 0xbef7, 0x0001, 0xbff7, 0x800e, 0xbef7, 0x0001, 0xbff7, 0x8007, 0xbef7, 0x0004, 0xdef7,
+    0xdef7, 0xbef7, 0xdfff, 0x8004, 0xbef7, 0x000d, 0xdfff, 0xdff7, 0xdef7, 0xbff7, 0xdff7, 0xdff7,
+    0xdef7, 0xbef7, 0xbff7, 0xbff7, 0xdff7, 0xbff7, 0xbff7, 0x8003, 0xdff7, 0x801c, 0xdfff, 0x001e,
+    0xffff, 0x79df, 0x0896, 0xc485, 0x0886, 0x077e, 0x225d, 0x6d6d, 0x5cdf, 0xffff, 0xffff, 0xdfff,
+    0xdfff, 0xffff, 0xffff, 0x3dc7, 0x584d, 0x3504, 0xf503, 0x3604, 0x5604, 0x3604, 0xf503, 0xf503,
+    0x971c, 0x9a55, 0x7d86, 0x1fa7, 0x3fb7, 0x3faf, 0x8005, 0x1eaf, 0x0010, 0x3fb7, 0x1fa7, 0xbe86,
+    0x9e7e, 0xbe86, 0xbe86, 0xde8e, 0xfe9e, 0xff9e, 0xffa6, 0x1faf, 0x1eaf, 0x1eaf, 0x3fb7, 0x3fb7,
+    0x1fb7, 0x8003, 0x5fbf, 0x8006, 0x5fc7, 0x0012, 0x7fcf, 0x5fcf, 0x7fcf, 0x7fd7, 0xdfdf, 0xffe7,
+    0xbfdf, 0xfcb6, 0x1496, 0xea64, 0x6454, 0x445c, 0x8664, 0xa664, 0x645c, 0x6564, 0x4b85, 0xf8ce,
+    0x8006, 0xffff, 0x0008, 0xdeff, 0x108d, 0x453b, 0x845c, 0xc464, 0xc264, 0x477d, 0x18d7, 0x8072,
+    0xffff, 0x0004, 0x7def, 0x7def, 0x7eef, 0x7eef, 0x8006, 0x9eef, 0x0004, 0x7eef, 0x9eef, 0x9ef7,
+    0x9eef, 0x8011, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x800f, 0xbef7, 0x0001, 0xbff7, 0x8004,
+    0xbef7, 0x0005, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8009, 0xbef7, 0x0001, 0xdef7, 0x8003,
+    0xbef7, 0x0002, 0xdef7, 0xbff7, 0x8003, 0xdff7, 0x0001, 0xbef7, 0x8003, 0xbff7, 0x0004, 0xdff7,
+    0xdfff, 0xdff7, 0xdff7, 0x801c, 0xdfff, 0x0008, 0xffff, 0x14c7, 0x058e, 0xc47d, 0x288e, 0x078e,
+    0x6575, 0x93b6, 0x8006, 0xffff, 0x0010, 0x9edf, 0x9865, 0x3504, 0x1504, 0x5604, 0x5604, 0x1604,
+    0xf503, 0x1504, 0xd82c, 0x3c76, 0xff9e, 0x1fa7, 0x1fa7, 0xfea6, 0xfea6, 0x8005, 0x1eaf, 0x000e,
+    0x1faf, 0xfe9e, 0xbe86, 0x9e7e, 0xbe86, 0xde8e, 0xff96, 0xfe96, 0x1fa7, 0xffa6, 0xfea6, 0x3faf,
+    0x1faf, 0x3faf, 0x8003, 0x3fb7, 0x8004, 0x5fbf, 0x8003, 0x5fc7, 0x8004, 0x7fcf, 0x0012, 0x7fd7,
+    0x7fd7, 0x9fd7, 0x9fdf, 0x9fdf, 0xbfdf, 0xbfdf, 0x9fcf, 0xb8ae, 0x4c7d, 0x8664, 0x645c, 0x8564,
+    0xa664, 0x645c, 0x8564, 0xae9d, 0x5be7, 0x8006, 0xffff, 0x0007, 0x19df, 0x0875, 0xa25c, 0x4575,
+    0x246d, 0x046d, 0x93be, 0x8071, 0xffff, 0x8005, 0x7eef, 0x000a, 0x9eef, 0x7eef, 0x7eef, 0x9eef,
+    0x7eef, 0x7eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8008, 0x9ef7,
+    0x8008, 0xbef7, 0x8004, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x0002, 0xbff7,
+    0xdef7, 0x8005, 0xbef7, 0x0001, 0xdef7, 0x800b, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x0007,
+    0xdef7, 0xbff7, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0x800a, 0xdfff, 0x0001, 0xdff7, 0x8010,
+    0xdfff, 0x0008, 0xffff, 0xb0be, 0xe485, 0xe585, 0x2796, 0x0596, 0xe995, 0x59df, 0x8003, 0xffff,
+    0x001b, 0xdfff, 0xffff, 0xffff, 0x5a96, 0x9514, 0x1504, 0x5604, 0x5604, 0x3604, 0xf503, 0x1504,
+    0x393d, 0x9d86, 0x1fa7, 0x1fa7, 0xde9e, 0xde9e, 0xfe9e, 0xfea6, 0x1ea7, 0x1eaf, 0x1faf, 0x1fb7,
+    0x3fb7, 0x1faf, 0xde8e, 0x9e7e, 0x8003, 0xbe86, 0x0009, 0xde8e, 0xde8e, 0xde96, 0xfe9e, 0xfea6,
+    0x1ea7, 0x3faf, 0x1eaf, 0x3eaf, 0x8003, 0x3fb7, 0x0004, 0x3fbf, 0x5fbf, 0x5fc7, 0x5fbf, 0x8003,
+    0x5fc7, 0x8004, 0x7fcf, 0x0002, 0x7fd7, 0x9fd7, 0x8004, 0x9fdf, 0x000e, 0x9fd7, 0xbfdf, 0xdfdf,
+    0xdfdf, 0x1ac7, 0x8f95, 0xa76c, 0xc564, 0xc564, 0x0775, 0xc56c, 0x087d, 0x72b6, 0xdef7, 0x8005,
+    0xffff, 0x0007, 0xbdf7, 0xcd9d, 0xe36c, 0x2575, 0x046d, 0xe36c, 0x30ae, 0x8070, 0xffff, 0x8004,
+    0x7eef, 0x0004, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x8003, 0x7eef, 0x8003, 0x9ef7, 0x0001, 0x9eef,
+    0x800c, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x800f, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7,
+    0x0001, 0xbff7, 0x8006, 0xbef7, 0x0007, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xbff7, 0xdef7, 0xdef7,
+    0x8006, 0xbef7, 0x0002, 0xdef7, 0xbfff, 0x8004, 0xbef7, 0x0008, 0xbff7, 0xbef7, 0xdff7, 0xdff7,
+    0xdfff, 0xbff7, 0xdff7, 0xdff7, 0x801b, 0xdfff, 0x0008, 0xdeff, 0x8eb6, 0xe385, 0x058e, 0x479e,
+    0x0596, 0x6dae, 0xddf7, 0x8005, 0xffff, 0x0019, 0x3dcf, 0x173d, 0xf403, 0x3504, 0x5604, 0x3604,
+    0xf503, 0x1504, 0x193d, 0x7d7e, 0xff9e, 0x1fa7, 0xde9e, 0xde9e, 0xfe9e, 0xfea6, 0xfe9e, 0xfea6,
+    0x1eaf, 0x1eaf, 0x3faf, 0x1fa7, 0xde9e, 0xde8e, 0x9e7e, 0x8004, 0xbe86, 0x0004, 0xbe8e, 0xde8e,
+    0xde96, 0x1ea7, 0x8004, 0x1eaf, 0x8003, 0x3fb7, 0x8003, 0x5fbf, 0x8006, 0x5fc7, 0x8003, 0x7fcf,
+    0x0002, 0x9fd7, 0x9fd7, 0x8007, 0x9fdf, 0x000c, 0x9fd7, 0xdfdf, 0xfff7, 0x3bdf, 0xcf9d, 0x466d,
+    0x667d, 0xc995, 0xa995, 0x878d, 0xab95, 0x38df, 0x8006, 0xffff, 0x0007, 0x72b6, 0x0475, 0x247d,
+    0x257d, 0xa364, 0xad9d, 0xdef7, 0x806e, 0xffff, 0x8006, 0x7eef, 0x8005, 0x9eef, 0x0002, 0x7ef7,
+    0x9eef, 0x800a, 0x9ef7, 0x0004, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x8003, 0x9ef7, 0x800f, 0xbef7,
+    0x0001, 0xbff7, 0x8005, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8004, 0xbef7, 0x0002, 0xdef7, 0xdef7,
+    0x800a, 0xbef7, 0x0006, 0xdef7, 0xdef7, 0xdfff, 0xdef7, 0xbef7, 0xdeff, 0x8004, 0xbff7, 0x000b,
+    0xdff7, 0xdfff, 0xbff7, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0xdfff, 0xdff7, 0xdfff, 0xdff7, 0x8014,
+    0xdfff, 0x0007, 0xdef7, 0x8cae, 0x048e, 0x0596, 0x469e, 0x26a6, 0xd0c6, 0x8003, 0xffff, 0x0025,
+    0xdfff, 0xffff, 0xffff, 0x5a8e, 0x5404, 0x1404, 0x5504, 0x3504, 0xf503, 0x1504, 0x7955, 0x1db7,
+    0x3fbf, 0x1eaf, 0xfea6, 0xde9e, 0xfea6, 0x1faf, 0x1ea7, 0xfea6, 0x1ea7, 0x3faf, 0x1fa7, 0xfe9e,
+    0xde96, 0xbe8e, 0x9e7e, 0xbe86, 0xbe86, 0xbe8e, 0xde8e, 0xbe86, 0xbe86, 0xde8e, 0xde8e, 0xde96,
+    0x1ea7, 0x8004, 0x1eaf, 0x0003, 0x1faf, 0x3fb7, 0x3fbf, 0x8003, 0x5fbf, 0x8005, 0x5fc7, 0x0006,
+    0x7fc7, 0x7fcf, 0x7fcf, 0x7fd7, 0x9fdf, 0x9fd7, 0x8003, 0x9fdf, 0x0001, 0xbfdf, 0x8003, 0x9fdf,
+    0x000e, 0x9fd7, 0x9fdf, 0xbfef, 0xfff7, 0xffff, 0x39d7, 0xcd95, 0x8685, 0xc895, 0xea9d, 0xc995,
+    0x888d, 0x72be, 0xdeff, 0x8005, 0xffff, 0x0007, 0xf6d6, 0x057d, 0x2475, 0x267d, 0x8364, 0x6b8d,
+    0xdef7, 0x806d, 0xffff, 0x0003, 0x7def, 0x7eef, 0x7def, 0x8004, 0x7eef, 0x0007, 0x9eef, 0x7eef,
+    0x7eef, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x8008, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8003,
+    0xbef7, 0x0002, 0x9ef7, 0x9ef7, 0x8005, 0xbef7, 0x0001, 0x9ef7, 0x800a, 0xbef7, 0x0001, 0xbff7,
+    0x800b, 0xbef7, 0x0018, 0xdff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xdef7, 0xdef7,
+    0xdff7, 0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xdff7, 0xdfff, 0xbef7, 0xdfff, 0xbef7, 0xbef7, 0xdef7,
+    0xdff7, 0xdfff, 0xbff7, 0x8003, 0xdfff, 0x8004, 0xdff7, 0x8014, 0xdfff, 0x0007, 0xdef7, 0x8bb6,
+    0x2496, 0x2696, 0x46a6, 0x26a6, 0x14d7, 0x8005, 0xffff, 0x0009, 0xbee7, 0x564d, 0xf203, 0x1304,
+    0x3504, 0x3504, 0xf403, 0xd73c, 0x1dc7, 0x8003, 0xffff, 0x0007, 0xdff7, 0xffff, 0x5ec7, 0xfea6,
+    0xfea6, 0xde96, 0xbe86, 0x8003, 0xde8e, 0x000f, 0xbe86, 0xbe86, 0xde8e, 0xbe86, 0xbe8e, 0xbe8e,
+    0xde8e, 0xde96, 0xde8e, 0xbe8e, 0x9e86, 0x9e7e, 0xde8e, 0xfe9e, 0x1eaf, 0x8003, 0x1faf, 0x000b,
+    0x3faf, 0x3fb7, 0x3fbf, 0x5fbf, 0x5fbf, 0x5fc7, 0x7fc7, 0x5fc7, 0x7fcf, 0x5fc7, 0x5fc7, 0x8003,
+    0x7fcf, 0x0001, 0x9fd7, 0x8005, 0x9fdf, 0x0003, 0xbfdf, 0x9fdf, 0xbfdf, 0x8003, 0x9fdf, 0x000d,
+    0xdfef, 0xdff7, 0xdfef, 0xfff7, 0xdff7, 0xb6be, 0x898d, 0x878d, 0xea9d, 0xc99d, 0x878d, 0x0ea6,
+    0x9cef, 0x8005, 0xffff, 0x0007, 0x39df, 0x067d, 0xc36c, 0xc574, 0x8364, 0x4a85, 0xbdf7, 0x806c,
+    0xffff, 0x0001, 0x7def, 0x8004, 0x7eef, 0x8006, 0x9eef, 0x0002, 0x7eef, 0x7ef7, 0x8003, 0x9ef7,
+    0x0001, 0x9eef, 0x800d, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x800c, 0xbef7, 0x0001, 0xbff7,
+    0x8003, 0xbef7, 0x0005, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xbff7,
+    0x8003, 0xbef7, 0x8003, 0xdef7, 0x0006, 0xdfff, 0xdef7, 0xdef7, 0xbef7, 0xbff7, 0xdff7, 0x8003,
+    0xbef7, 0x0003, 0xbff7, 0xdfff, 0xdff7, 0x8005, 0xbef7, 0x8004, 0xdfff, 0x8003, 0xdff7, 0x8013,
+    0xdfff, 0x0007, 0xdef7, 0xabb6, 0x249e, 0x0596, 0x459e, 0x26a6, 0x37df, 0x8003, 0xffff, 0x000d,
+    0xdfff, 0xffff, 0x1cc7, 0xb324, 0x1204, 0x3304, 0x3404, 0x3504, 0x350c, 0x1a8e, 0xffff, 0xffff,
+    0xdfff, 0x8004, 0xffff, 0x0012, 0xbfef, 0xfea6, 0xde96, 0x9e86, 0xbe86, 0xbe7e, 0x9e7e, 0xbe86,
+    0xde8e, 0xde8e, 0xbe8e, 0xbe86, 0xbe8e, 0xde96, 0xbe8e, 0xbe8e, 0xfe9e, 0x1eaf, 0x8003, 0x3ebf,
+    0x000f, 0x1eb7, 0x1eaf, 0x3faf, 0x3fb7, 0x3faf, 0x1faf, 0x3fb7, 0x3fbf, 0x5fbf, 0x5fbf, 0x5fc7,
+    0x5fc7, 0x7fcf, 0x5fcf, 0x5fcf, 0x8003, 0x7fcf, 0x0005, 0x9fd7, 0x9fdf, 0x9fd7, 0x9fdf, 0x9fdf,
+    0x8003, 0xbfdf, 0x0013, 0x9fdf, 0xbfdf, 0xbfdf, 0x9fdf, 0x9fdf, 0xbfe7, 0xdff7, 0xdff7, 0xdfef,
+    0xdff7, 0xffff, 0x7cdf, 0x2fa6, 0xa795, 0xc99d, 0xca9d, 0xc895, 0xca9d, 0x18d7, 0x8005, 0xffff,
+    0x0007, 0x5be7, 0xe774, 0x8364, 0xa56c, 0x6364, 0x4a85, 0xbef7, 0x806b, 0xffff, 0x0001, 0x7def,
+    0x8004, 0x7eef, 0x0002, 0x9ef7, 0x9ef7, 0x8004, 0x9eef, 0x0005, 0x7eef, 0x7eef, 0x9ef7, 0x9ef7,
+    0x9eef, 0x800f, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8006,
+    0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8004, 0xbef7, 0x0005, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7,
+    0x8007, 0xbef7, 0x0002, 0xdef7, 0xdef7, 0x8003, 0xbef7, 0x000d, 0xdef7, 0xbef7, 0xbff7, 0xdff7,
+    0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xdfff, 0xdff7, 0xdff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x8004,
+    0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8004, 0xdfff, 0x0001, 0xdff7, 0x800e, 0xdfff, 0x0006, 0xacb6,
+    0x249e, 0x0696, 0x259e, 0x46a6, 0x57df, 0x8005, 0xffff, 0x0008, 0xbaa6, 0x5104, 0x3204, 0x3304,
+    0x3304, 0xf303, 0xf734, 0x5dcf, 0x8009, 0xffff, 0x0003, 0x3ebf, 0x9e86, 0x9e7e, 0x8004, 0xbe86,
+    0x0009, 0xde8e, 0xde8e, 0xbe86, 0xbe86, 0x9e86, 0xbe86, 0xfea6, 0x7fd7, 0xdff7, 0x8005, 0xffff,
+    0x0008, 0x9fdf, 0x5fc7, 0x1fb7, 0x3fb7, 0x3fb7, 0x3fbf, 0x5fbf, 0x5fbf, 0x8003, 0x5fc7, 0x8006,
+    0x7fcf, 0x0001, 0x9fd7, 0x8003, 0x9fdf, 0x8004, 0xbfdf, 0x0014, 0xbfe7, 0xbfe7, 0xbfdf, 0x9fdf,
+    0x9fdf, 0xbfdf, 0xdfef, 0xdff7, 0xdff7, 0xdfef, 0xbfef, 0xdff7, 0xfff7, 0xd6c6, 0xaa95, 0xa895,
+    0xea9d, 0xc99d, 0xa88d, 0xb4c6, 0x8005, 0xffff, 0x0007, 0x7cef, 0xe87c, 0x6364, 0xc574, 0x6264,
+    0x6a85, 0xdef7, 0x806a, 0xffff, 0x0001, 0x7def, 0x8006, 0x7eef, 0x0003, 0x9eef, 0x9eef, 0x9ef7,
+    0x8005, 0x9eef, 0x0001, 0x7eef, 0x8008, 0x9ef7, 0x0002, 0xbef7, 0xbef7, 0x8005, 0x9ef7, 0x0003,
+    0xbef7, 0x9ef7, 0x9ef7, 0x800b, 0xbef7, 0x0001, 0xbff7, 0x8007, 0xbef7, 0x0002, 0xbff7, 0xbff7,
+    0x8006, 0xbef7, 0x0006, 0xbff7, 0xdff7, 0xbef7, 0xbef7, 0xbeff, 0xbff7, 0x8003, 0xbef7, 0x000b,
+    0xdef7, 0xdef7, 0xbef7, 0xdfff, 0xdef7, 0xdef7, 0xbef7, 0xdff7, 0xdef7, 0xdff7, 0xdfff, 0x8003,
+    0xbff7, 0x8016, 0xdfff, 0x0007, 0xffff, 0xcebe, 0x2396, 0x0596, 0x2596, 0x259e, 0x57df, 0x8005,
+    0xffff, 0x000a, 0x388e, 0x3004, 0x5104, 0x3204, 0xf203, 0xd203, 0xb875, 0xdff7, 0xffff, 0xdff7,
+    0x8005, 0xffff, 0x0010, 0xdfff, 0x9fe7, 0x9fe7, 0x1ebf, 0xde9e, 0xde96, 0x9e7e, 0x9e7e, 0xbe86,
+    0xbe86, 0xbe8e, 0xbe86, 0xbe86, 0x9e86, 0xde9e, 0x9fd7, 0x800a, 0xffff, 0x0009, 0xbfef, 0x5ec7,
+    0x3fbf, 0x5fbf, 0x5fbf, 0x5fc7, 0x5fc7, 0x5fcf, 0x5fc7, 0x8004, 0x7fcf, 0x0002, 0x7fd7, 0x9fd7,
+    0x8003, 0x9fdf, 0x0002, 0xbfdf, 0xbfdf, 0x8005, 0xbfe7, 0x8004, 0xbfdf, 0x0002, 0xbfe7, 0xdfef,
+    0x8003, 0xdff7, 0x000b, 0xdfef, 0xbff7, 0xfff7, 0x5bdf, 0x0d9e, 0xa895, 0xea9d, 0xe99d, 0xa895,
+    0x72be, 0xdfff, 0x8004, 0xffff, 0x0006, 0x7cef, 0xe87c, 0x8364, 0xa56c, 0x8364, 0x8c95, 0x806a,
+    0xffff, 0x8007, 0x7eef, 0x0005, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x7eef, 0x8004, 0x9eef, 0x800f,
+    0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8010, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x0002,
+    0xbff7, 0xbff7, 0x8006, 0xbef7, 0x0005, 0xdff7, 0xbef7, 0xbef7, 0xdfff, 0xbff7, 0x8004, 0xbef7,
+    0x0009, 0xdef7, 0xdef7, 0xbef7, 0xdef7, 0xdef7, 0xbeff, 0xbff7, 0xdff7, 0xdef7, 0x8003, 0xbff7,
+    0x0007, 0xbef7, 0xbff7, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0x800e, 0xdfff, 0x0008, 0xdeff,
+    0xffff, 0x11cf, 0x229e, 0x049e, 0x249e, 0x259e, 0x36d7, 0x8005, 0xffff, 0x0007, 0x176e, 0x3004,
+    0x5104, 0x5104, 0x1004, 0x1214, 0xbbae, 0x800a, 0xffff, 0x000e, 0xdff7, 0xbfef, 0xdff7, 0xffff,
+    0xffff, 0x7fcf, 0xde96, 0xde96, 0xbe8e, 0xde96, 0xbe96, 0xbe8e, 0x1eb7, 0xfff7, 0x800d, 0xffff,
+    0x0008, 0x7ed7, 0x3fbf, 0x5fbf, 0x5fc7, 0x5fc7, 0x7fc7, 0x7fc7, 0x5fcf, 0x8003, 0x7fcf, 0x0001,
+    0x9fd7, 0x8003, 0x9fdf, 0x0003, 0xbfdf, 0xbfe7, 0xbfdf, 0x8006, 0xbfe7, 0x0002, 0xbfdf, 0xbfdf,
+    0x8003, 0xbfe7, 0x0001, 0xdfef, 0x8004, 0xdff7, 0x000a, 0xbfef, 0xfff7, 0xbeef, 0x50ae, 0xa895,
+    0x2aa6, 0x4aa6, 0xe89d, 0x70b6, 0xfeff, 0x8004, 0xffff, 0x0006, 0x7cef, 0x087d, 0x0475, 0x467d,
+    0xe36c, 0x0fa6, 0x8069, 0xffff, 0x0003, 0x7def, 0x7eef, 0x9eef, 0x8003, 0x7eef, 0x8003, 0x9ef7,
+    0x0005, 0x9eef, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x8014, 0x9ef7, 0x8004, 0xbef7, 0x0006, 0xbff7,
+    0x9ef7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8006, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x0003,
+    0xbff7, 0xbff7, 0xdff7, 0x8004, 0xbef7, 0x000a, 0xdef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xbfff,
+    0xbef7, 0xbef7, 0xbff7, 0xdef7, 0x8004, 0xbef7, 0x0001, 0xdef7, 0x8003, 0xdff7, 0x000b, 0xbff7,
+    0xbff7, 0xdff7, 0xbff7, 0xdfff, 0xbff7, 0xdfff, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0x800c, 0xdfff,
+    0x0009, 0xdff7, 0xffff, 0x35d7, 0x43a6, 0x449e, 0x449e, 0x439e, 0x14cf, 0xffff, 0x8003, 0xdfff,
+    0x0013, 0xffff, 0xd565, 0x4f04, 0x7104, 0x5104, 0xef03, 0x3214, 0xbd9e, 0x9fd7, 0x5ec7, 0x5ecf,
+    0x7fd7, 0x9fdf, 0x7fdf, 0x9fd7, 0x9fdf, 0xbfe7, 0xbfef, 0xdff7, 0x8005, 0xffff, 0x0007, 0xdff7,
+    0xbfe7, 0x9fdf, 0x7fdf, 0x9fe7, 0xdfef, 0xdff7, 0x8010, 0xffff, 0x0006, 0x7fd7, 0x5fbf, 0x5fc7,
+    0x7fc7, 0x7fcf, 0x7fcf, 0x8003, 0x5fcf, 0x0002, 0x7fcf, 0x9fd7, 0x8003, 0x9fdf, 0x0001, 0xbfe7,
+    0x8003, 0xbfdf, 0x8007, 0xbfe7, 0x0001, 0xbfdf, 0x8003, 0xbfe7, 0x0002, 0xdfef, 0xdfef, 0x8003,
+    0xdff7, 0x000a, 0xbfef, 0xdff7, 0xdff7, 0x73b6, 0xa76c, 0xe874, 0xe87c, 0xc774, 0x4d8d, 0xdef7,
+    0x8004, 0xffff, 0x0006, 0x3ae7, 0xa553, 0x8343, 0x6464, 0xa46c, 0x74be, 0x8068, 0xffff, 0x0001,
+    0x7def, 0x8004, 0x7eef, 0x8004, 0x9eef, 0x0004, 0x9ef7, 0x9eef, 0x9eef, 0x7eef, 0x800a, 0x9ef7,
+    0x0001, 0x9eef, 0x800b, 0x9ef7, 0x8003, 0xbef7, 0x0005, 0x9ef7, 0xbef7, 0xbef7, 0xbff7, 0xbff7,
+    0x8008, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xdef7, 0x8005, 0xbef7, 0x000b,
+    0xdef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xdfff, 0xbef7, 0xbff7, 0xbff7, 0xdef7, 0xdff7, 0x8003,
+    0xbef7, 0x0004, 0xdef7, 0xdfff, 0xbff7, 0xdfff, 0x8007, 0xbff7, 0x8005, 0xdff7, 0x800b, 0xdfff,
+    0x0008, 0xffff, 0x79e7, 0x049e, 0x0496, 0x249e, 0x439e, 0xf1ce, 0xffff, 0x8003, 0xdfff, 0x0009,
+    0xffff, 0xd45d, 0x4e04, 0x5004, 0x2f04, 0x0f04, 0x511c, 0xdd9e, 0x5fbf, 0x8006, 0x1eb7, 0x0002,
+    0x1eaf, 0x1eaf, 0x8003, 0xfeae, 0x0008, 0xfea6, 0x1eaf, 0x1eb7, 0x1eb7, 0xfea6, 0x1eb7, 0x7edf,
+    0xdff7, 0x8014, 0xffff, 0x0001, 0xdff7, 0x8003, 0x5fc7, 0x8004, 0x7fcf, 0x0006, 0x7fd7, 0x9fd7,
+    0x9fdf, 0x9fdf, 0xbfe7, 0xbfe7, 0x8003, 0xbfdf, 0x800e, 0xbfe7, 0x0001, 0xbfef, 0x8003, 0xdff7,
+    0x000a, 0xdfef, 0xbfef, 0xdff7, 0x749d, 0x4422, 0x642a, 0xc532, 0xe332, 0x4b6c, 0xdff7, 0x8004,
+    0xffff, 0x0006, 0x38be, 0xe43a, 0xa46c, 0xe474, 0x6364, 0xf7ce, 0x8067, 0xffff, 0x0001, 0x7def,
+    0x8006, 0x7eef, 0x0006, 0x9eef, 0x7eef, 0x9ef7, 0x9ef7, 0x9eef, 0x7eef, 0x8016, 0x9ef7, 0x0002,
+    0xbef7, 0x9ef7, 0x8005, 0xbef7, 0x8003, 0xbff7, 0x8004, 0xbef7, 0x0001, 0xbff7, 0x800c, 0xbef7,
+    0x0002, 0xdff7, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xdfff, 0x8003, 0xbef7, 0x0001, 0xdff7, 0x8003,
+    0xbef7, 0x0008, 0xdef7, 0xbef7, 0xbff7, 0xbff7, 0xdfff, 0xbff7, 0xbff7, 0xdff7, 0x8003, 0xbff7,
+    0x0002, 0xdff7, 0xdef7, 0x8003, 0xdff7, 0x800c, 0xdfff, 0x0007, 0xbdf7, 0x089e, 0xe495, 0xe495,
+    0x239e, 0xcdc6, 0xffff, 0x8003, 0xdfff, 0x000a, 0xffff, 0x156e, 0x4d04, 0x6f04, 0x6f04, 0x0e04,
+    0x9224, 0xfea6, 0x5fbf, 0x1eb7, 0x8004, 0x3ebf, 0x0002, 0x3ec7, 0x3fc7, 0x8004, 0x3ebf, 0x0007,
+    0x1eaf, 0xfe9e, 0xde96, 0xfe9e, 0xde9e, 0xfeae, 0xdff7, 0x8017, 0xffff, 0x000b, 0x7fd7, 0x5fc7,
+    0x5fc7, 0x7fc7, 0x7fcf, 0x7fcf, 0x7fd7, 0x9fdf, 0x9fd7, 0x9fd7, 0x9fdf, 0x800c, 0xbfe7, 0x0002,
+    0xbfef, 0xdfef, 0x8006, 0xbfe7, 0x0001, 0xbfef, 0x8003, 0xdff7, 0x0009, 0xdfef, 0xdfef, 0xffff,
+    0xb5a5, 0x842a, 0x043b, 0x4543, 0xc232, 0x6c74, 0x8005, 0xffff, 0x0006, 0xb5ce, 0xa36c, 0xe46c,
+    0xc364, 0xe674, 0x9def, 0x8066, 0xffff, 0x8007, 0x7eef, 0x0006, 0x9ef7, 0x7ef7, 0x7eef, 0x9eef,
+    0x9eef, 0x7eef, 0x8016, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8003, 0xbef7, 0x0002, 0xbff7,
+    0x9ef7, 0x8014, 0xbef7, 0x0001, 0xdff7, 0x8007, 0xbef7, 0x0002, 0xdef7, 0xbef7, 0x8003, 0xdef7,
+    0x0007, 0xbef7, 0xbff7, 0xbef7, 0xdfff, 0xbef7, 0xbff7, 0xdff7, 0x8003, 0xbff7, 0x0001, 0xdff7,
+    0x8004, 0xdfff, 0x0001, 0xdeff, 0x8009, 0xdfff, 0x0026, 0xdff7, 0xffff, 0x6eae, 0xc385, 0xe48d,
+    0x0396, 0x89ae, 0xdeff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x567e, 0x4c04, 0x8e04, 0x8e04, 0x4e04,
+    0xb22c, 0x1eb7, 0x5fc7, 0x3ebf, 0x5fc7, 0x5ec7, 0x5fbf, 0x5fc7, 0x5ec7, 0x5ec7, 0x3ec7, 0x5fc7,
+    0x3fc7, 0x3ebf, 0x3ebf, 0x3fbf, 0x1eaf, 0x1ea7, 0x1ea7, 0x1eb7, 0xdff7, 0x8018, 0xffff, 0x0001,
+    0xbfef, 0x8003, 0x5fc7, 0x0002, 0x7fc7, 0x9fd7, 0x8006, 0x9fdf, 0x0001, 0xbfdf, 0x8007, 0xbfe7,
+    0x0001, 0xbfef, 0x8005, 0xdfef, 0x0002, 0xbfef, 0xdfef, 0x8004, 0xbfe7, 0x0001, 0xdfef, 0x8004,
+    0xdff7, 0x0008, 0xbfef, 0xffff, 0xf5a5, 0xc432, 0x243b, 0x4543, 0xc332, 0xcf84, 0x8005, 0xffff,
+    0x0005, 0xefad, 0xa264, 0xe474, 0xa26c, 0x6b8d, 0x8066, 0xffff, 0x8006, 0x7eef, 0x0004, 0x7ef7,
+    0x7ef7, 0x7eef, 0x7eef, 0x8005, 0x9eef, 0x8014, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x801a, 0xbef7,
+    0x0004, 0xbff7, 0xdef7, 0xbef7, 0xdff7, 0x8003, 0xbef7, 0x0009, 0xdef7, 0xdef7, 0xdfff, 0xdff7,
+    0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0x8003, 0xbff7, 0x0007, 0xdff7, 0xdff7, 0xbff7, 0xbff7,
+    0xdff7, 0xdfff, 0xdff7, 0x800b, 0xdfff, 0x0015, 0xdff7, 0xffff, 0xf5ce, 0xa37d, 0xc485, 0xe495,
+    0x26a6, 0x9aef, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xb9a6, 0x8c04, 0x8d04, 0x8e04, 0x2c04, 0xd124,
+    0x3eb7, 0x5fc7, 0x3ebf, 0x8007, 0x5fc7, 0x8005, 0x5ec7, 0x0005, 0x3fbf, 0x1eaf, 0x1ea7, 0x3eb7,
+    0xbfef, 0x8019, 0xffff, 0x0001, 0xdff7, 0x8003, 0x5fc7, 0x000d, 0x7fcf, 0x9fcf, 0x9fdf, 0x9fdf,
+    0xbfdf, 0xffef, 0xdfe7, 0xbfe7, 0xbfe7, 0x9fdf, 0x9fe7, 0xbfe7, 0xbfe7, 0x8004, 0xbfef, 0x0003,
+    0xdfef, 0xdfef, 0xbfef, 0x8005, 0xdfef, 0x0005, 0xbfef, 0xbfe7, 0xdfe7, 0xdfe7, 0xdfef, 0x8004,
+    0xdff7, 0x0008, 0xbff7, 0xffff, 0xb4a5, 0xc332, 0x2543, 0x4543, 0xa332, 0x729d, 0x8004, 0xffff,
+    0x0006, 0xdfff, 0x4a8d, 0xa264, 0xa46c, 0x6264, 0x31b6, 0x8065, 0xffff, 0x8009, 0x7eef, 0x0003,
+    0x9eef, 0x7eef, 0x7eef, 0x8003, 0x9eef, 0x0005, 0x9ef7, 0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x8010,
+    0x9ef7, 0x801e, 0xbef7, 0x0001, 0xdef7, 0x8003, 0xbef7, 0x0002, 0xdff7, 0xdef7, 0x8006, 0xbef7,
+    0x0005, 0xbff7, 0xdfff, 0xdfff, 0xdeff, 0xbff7, 0x8010, 0xdfff, 0x0016, 0xdff7, 0xffff, 0x7be7,
+    0xc685, 0xa37d, 0xc485, 0x039e, 0x34df, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x3bcf, 0xad0c, 0x6c04,
+    0x8d04, 0x6d04, 0xaf1c, 0x3dbf, 0x7fcf, 0x5ec7, 0x5fcf, 0x8003, 0x5fc7, 0x000d, 0x5fcf, 0x5fc7,
+    0x5fc7, 0x5fcf, 0x5ec7, 0x5ecf, 0x5ecf, 0x5ec7, 0x5ecf, 0x5ec7, 0x3ebf, 0xfeae, 0x7fd7, 0x801b,
+    0xffff, 0x0002, 0x7ed7, 0x5fc7, 0x8003, 0x7fcf, 0x000e, 0x9fdf, 0xbfe7, 0x1cbf, 0xf78d, 0xdbb6,
+    0x5ecf, 0xbfdf, 0xffef, 0xfff7, 0xfff7, 0xbfe7, 0xbfe7, 0xbfef, 0xbfef, 0x8003, 0xdfef, 0x8009,
+    0xbfef, 0x0002, 0xdfef, 0xdfef, 0x8005, 0xdff7, 0x0008, 0xbff7, 0xffff, 0x7395, 0xc432, 0x4543,
+    0x2543, 0xe43a, 0x36be, 0x8004, 0xffff, 0x0006, 0x5be7, 0xa56c, 0x825c, 0xa46c, 0x846c, 0x59e7,
+    0x8064, 0xffff, 0x8006, 0x7eef, 0x0004, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x8003, 0x7eef, 0x0002,
+    0x9ef7, 0x9eef, 0x8004, 0x9ef7, 0x0001, 0x9eef, 0x800a, 0x9ef7, 0x0001, 0xbef7, 0x8006, 0x9ef7,
+    0x0001, 0xbef7, 0x8003, 0xbff7, 0x0003, 0xbef7, 0xbff7, 0xbff7, 0x8012, 0xbef7, 0x0017, 0xdef7,
+    0xdff7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xdff7, 0xbef7, 0xbef7, 0xdff7, 0xdef7, 0xbef7, 0xdff7,
+    0xdfff, 0xbef7, 0xbef7, 0xdef7, 0xbff7, 0xbff7, 0xdfff, 0xbff7, 0xdff7, 0xdff7, 0x800e, 0xdfff,
+    0x0014, 0xdef7, 0xdfff, 0x0b9e, 0x8275, 0xa47d, 0xe38d, 0x8dbe, 0xffff, 0xdfff, 0xdfff, 0xffff,
+    0xbeef, 0x0e2d, 0x8c04, 0xad04, 0xad04, 0x8e0c, 0x1caf, 0xbfe7, 0x7ecf, 0x8005, 0x7fcf, 0x0003,
+    0x7fd7, 0x7ecf, 0x7fd7, 0x8003, 0x9fdf, 0x0007, 0x9fd7, 0x7fd7, 0x7ed7, 0x7fd7, 0x5fc7, 0x5ec7,
+    0xdfff, 0x801c, 0xffff, 0x0001, 0x9fdf, 0x8003, 0x7fcf, 0x0013, 0x9fd7, 0xbfdf, 0x7ed7, 0xd264,
+    0xe702, 0x2803, 0xcc23, 0x8f4c, 0x9475, 0xbaae, 0xbfe7, 0xfff7, 0xdfef, 0xbfef, 0xdfef, 0xbfef,
+    0xbfef, 0xdfef, 0xfff7, 0x8004, 0xffff, 0x0006, 0xfff7, 0xfff7, 0xdff7, 0xdfef, 0xbfef, 0xdfef,
+    0x8006, 0xdff7, 0x0007, 0xffff, 0xd084, 0xe33a, 0x654b, 0x4543, 0x4543, 0x3adf, 0x8004, 0xffff,
+    0x0005, 0xb6ce, 0x8264, 0xc36c, 0x8264, 0x498d, 0x8064, 0xffff, 0x8006, 0x7eef, 0x0008, 0x9eef,
+    0x7eef, 0x7eef, 0x9ef7, 0x7ef7, 0x9eef, 0x9eef, 0x9ef7, 0x8003, 0x9eef, 0x8012, 0x9ef7, 0x0005,
+    0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x8004, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xbff7, 0x800c,
+    0xbef7, 0x000f, 0xbff7, 0xbef7, 0xbef7, 0xdef7, 0xdff7, 0xbef7, 0xbef7, 0xdef7, 0xdff7, 0xdff7,
+    0xdef7, 0xbff7, 0xdef7, 0xdef7, 0xdff7, 0x8004, 0xdef7, 0x0007, 0xbff7, 0xbff7, 0xdfff, 0xbff7,
+    0xbff7, 0xdff7, 0xdef7, 0x8005, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8005, 0xdfff, 0x001b, 0xdef7,
+    0xffff, 0xf4ce, 0x4275, 0x847d, 0xc485, 0x26a6, 0xbcf7, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xd265,
+    0x6b04, 0xac04, 0xcd04, 0x6c04, 0xb99e, 0xdfef, 0x7edf, 0x9fdf, 0x7fd7, 0x7ed7, 0x9fd7, 0x9fdf,
+    0x9fdf, 0x9fe7, 0x8006, 0xbfe7, 0x0005, 0x9fe7, 0x9fdf, 0x9fdf, 0x7ed7, 0xbfef, 0x801e, 0xffff,
+    0x0020, 0x9fdf, 0x7fcf, 0x7fcf, 0x9fd7, 0xbfdf, 0xbfdf, 0xdfe7, 0xbaae, 0x904c, 0xe702, 0x6502,
+    0x8602, 0x0703, 0xab23, 0x757d, 0xbfe7, 0xfff7, 0xbfef, 0xfff7, 0xffff, 0x9ee7, 0xfbc6, 0xb9b6,
+    0x99ae, 0xb9b6, 0xdabe, 0x1bcf, 0x3cd7, 0x9ee7, 0xdfef, 0xfff7, 0xfff7, 0x8008, 0xdff7, 0x0006,
+    0x2c6c, 0x233b, 0x654b, 0x2443, 0x0964, 0xbef7, 0x8004, 0xffff, 0x0005, 0xcea5, 0x815c, 0xe36c,
+    0x8164, 0x73be, 0x8063, 0xffff, 0x800a, 0x7eef, 0x0005, 0x9ef7, 0x9ef7, 0x9eef, 0x9ef7, 0x9ef7,
+    0x8003, 0x9eef, 0x0002, 0x9ef7, 0x9eef, 0x800d, 0x9ef7, 0x0002, 0xbef7, 0xbef7, 0x8005, 0x9ef7,
+    0x0001, 0xbef7, 0x8003, 0xbff7, 0x8008, 0xbef7, 0x0001, 0xbff7, 0x8008, 0xbef7, 0x0015, 0xbff7,
+    0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xdff7, 0xdef7, 0xbff7, 0xdef7, 0xdff7, 0xbff7, 0xdef7, 0xdef7,
+    0xbef7, 0xdff7, 0xdff7, 0xbff7, 0xdef7, 0xbff7, 0xbff7, 0xdff7, 0x8003, 0xbff7, 0x0001, 0xdff7,
+    0x800d, 0xdfff, 0x0013, 0x9cef, 0xa585, 0x6275, 0xe58d, 0xe28d, 0x35df, 0xffff, 0xdfff, 0xdfff,
+    0xffff, 0x969e, 0x8a04, 0xcc0c, 0xcd04, 0x6b04, 0x366e, 0xdfef, 0x9edf, 0x9fe7, 0x8003, 0x9fdf,
+    0x0001, 0xbfe7, 0x800a, 0xbfef, 0x8003, 0xbfe7, 0x801f, 0xffff, 0x0018, 0xdff7, 0x7fcf, 0x7fcf,
+    0x9fd7, 0x9fd7, 0x9fcf, 0x7fcf, 0xbfdf, 0xdfe7, 0xbaae, 0x8f44, 0x0703, 0xe702, 0xe702, 0xa602,
+    0xed33, 0x5dd7, 0xffff, 0x5ddf, 0x526d, 0x0b2c, 0xc91b, 0xa813, 0xc813, 0x8004, 0xe81b, 0x0006,
+    0xe92b, 0x2b3c, 0x6d54, 0x947d, 0x7ddf, 0xdfff, 0x8005, 0xdff7, 0x0007, 0xffff, 0x5de7, 0xa74b,
+    0x4443, 0x854b, 0x033b, 0xef84, 0x8004, 0xffff, 0x0006, 0xbdf7, 0xe674, 0xe26c, 0xe36c, 0xc46c,
+    0x9cef, 0x8062, 0xffff, 0x800a, 0x7eef, 0x0003, 0x9eef, 0x9ef7, 0x9ef7, 0x8005, 0x9eef, 0x0002,
+    0x9ef7, 0x9eef, 0x800e, 0x9ef7, 0x0009, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7,
+    0xbef7, 0x9ef7, 0x8012, 0xbef7, 0x0005, 0xbff7, 0xbef7, 0xdef7, 0xbef7, 0xdef7, 0x8003, 0xbef7,
+    0x0002, 0xdef7, 0xbef7, 0x8004, 0xdef7, 0x000a, 0xdff7, 0xdff7, 0xdef7, 0xbff7, 0xdff7, 0xbff7,
+    0xdff7, 0xdff7, 0xbff7, 0xbff7, 0x800c, 0xdfff, 0x0013, 0xdef7, 0xffff, 0x8fb6, 0x4175, 0x847d,
+    0xa285, 0x4aae, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x7cdf, 0x2c35, 0xab04, 0xcc0c, 0x6b04, 0x5145,
+    0xbfef, 0x9ee7, 0x8004, 0x9fe7, 0x0002, 0xbfef, 0xdff7, 0x800c, 0xbfef, 0x0001, 0xdff7, 0x800a,
+    0xffff, 0x0001, 0xdfff, 0x8015, 0xffff, 0x001f, 0x7fd7, 0x7fcf, 0x7fd7, 0x7fcf, 0x9fd7, 0x9fd7,
+    0x7fcf, 0x7fd7, 0xdfe7, 0xffe7, 0x589e, 0xcb1b, 0xe602, 0x280b, 0xa602, 0xab2b, 0x37a6, 0xeb23,
+    0x4703, 0xa913, 0xe91b, 0xc813, 0xa70b, 0xc713, 0xe81b, 0x4a34, 0x8c44, 0x5175, 0xf595, 0xd9be,
+    0x7de7, 0x8008, 0xdff7, 0x0007, 0xffff, 0x78be, 0x2443, 0x654b, 0x654b, 0x0343, 0x77c6, 0x8004,
+    0xffff, 0x0005, 0xb5c6, 0x8264, 0xe46c, 0xa264, 0xad95, 0x8062, 0xffff, 0x800b, 0x7eef, 0x8004,
+    0x9eef, 0x0004, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x8012, 0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7,
+    0x8015, 0xbef7, 0x0002, 0xdef7, 0xbef7, 0x8003, 0xdef7, 0x0001, 0xbef7, 0x8004, 0xdef7, 0x0008,
+    0xbef7, 0xdff7, 0xdff7, 0xbff7, 0xbef7, 0xbff7, 0xdff7, 0xdff7, 0x8004, 0xbff7, 0x800b, 0xdfff,
+    0x0014, 0xbef7, 0xdfff, 0x7ae7, 0x847d, 0x827d, 0x8385, 0x838d, 0x79e7, 0xffff, 0xdfff, 0xdfff,
+    0xffff, 0x1076, 0xea1c, 0xcc0c, 0xab04, 0xcd1c, 0x7dd7, 0xbfef, 0x9ee7, 0x8005, 0x9fe7, 0x0006,
+    0xbfe7, 0xbfe7, 0x9fe7, 0xbfe7, 0x9fdf, 0x9fdf, 0x8006, 0x9fe7, 0x0002, 0x7fdf, 0xdff7, 0x8009,
+    0xffff, 0x0002, 0xdfff, 0xdfff, 0x8015, 0xffff, 0x001b, 0x9fdf, 0x9fd7, 0x9fd7, 0x7fcf, 0x9fd7,
+    0x9fd7, 0x7fcf, 0x7fcf, 0x9fd7, 0x9fdf, 0xffef, 0x7ed7, 0x8f3c, 0xe702, 0x0803, 0xc702, 0xe602,
+    0x8803, 0x880b, 0x4703, 0x8813, 0x4c3c, 0x717d, 0x77ae, 0xface, 0x7de7, 0xdff7, 0x8004, 0xffff,
+    0x8009, 0xdff7, 0x0007, 0xffff, 0x518d, 0x033b, 0x854b, 0x4443, 0xc863, 0x9def, 0x8004, 0xffff,
+    0x0005, 0x8a8d, 0x8264, 0xc46c, 0x8364, 0x18d7, 0x8061, 0xffff, 0x8009, 0x7eef, 0x000a, 0x7ef7,
+    0x7eef, 0x9ef7, 0x9ef7, 0x7eef, 0x7eef, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x800b, 0x9ef7, 0x0001,
+    0xbff7, 0x8006, 0x9ef7, 0x0005, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x8014, 0xbef7, 0x0005,
+    0xdef7, 0xdef7, 0xbef7, 0xbef7, 0xdff7, 0x8006, 0xdef7, 0x0001, 0xbff7, 0x8003, 0xdff7, 0x000b,
+    0xbef7, 0xbff7, 0xbff7, 0xdfff, 0xbef7, 0xbff7, 0xdfff, 0xdfff, 0xbff7, 0xdff7, 0xbff7, 0x8003,
+    0xdff7, 0x8005, 0xdfff, 0x0014, 0xdff7, 0xffff, 0x2da6, 0x6175, 0xa27d, 0x607d, 0x6db6, 0xffff,
+    0xdfff, 0xdfff, 0xffff, 0xd7b6, 0x2b2d, 0x0b15, 0xcb04, 0x6b04, 0xb8a6, 0xffff, 0x9ee7, 0xbfef,
+    0x8003, 0xbfe7, 0x0002, 0xbfef, 0xbfe7, 0x8004, 0x9fdf, 0x000a, 0x9fd7, 0x9fd7, 0x7fd7, 0x7fd7,
+    0x9fd7, 0x9fd7, 0x7ed7, 0x7ed7, 0x5ecf, 0xdff7, 0x8020, 0xffff, 0x0016, 0x9fdf, 0x9fcf, 0x9fd7,
+    0x7fcf, 0x9fdf, 0x9fd7, 0x9fdf, 0x7fd7, 0x7fcf, 0x9fd7, 0x9fdf, 0xdfe7, 0xdfe7, 0x8f4c, 0xe602,
+    0x2803, 0x0703, 0x4803, 0x470b, 0x4d4c, 0x98be, 0xdfff, 0x8004, 0xffff, 0x0002, 0xdff7, 0xdfef,
+    0x800c, 0xdff7, 0x0007, 0xdfff, 0xbef7, 0x0a64, 0x444b, 0x854b, 0x2343, 0x0f8d, 0x8004, 0xffff,
+    0x0005, 0x39df, 0xa364, 0xc46c, 0x8264, 0x4a85, 0x8061, 0xffff, 0x800c, 0x7eef, 0x0004, 0x9eef,
+    0x7eef, 0x9eef, 0x7eef, 0x800e, 0x9ef7, 0x0001, 0xbff7, 0x8007, 0x9ef7, 0x800a, 0xbef7, 0x0001,
+    0xbff7, 0x8010, 0xbef7, 0x0004, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x8003, 0xdef7, 0x0011, 0xdff7,
+    0xdff7, 0xbff7, 0xdff7, 0xdef7, 0xbef7, 0xbff7, 0xbff7, 0xdfff, 0xbef7, 0xbff7, 0xdfff, 0xdfff,
+    0xbef7, 0xbff7, 0xdfff, 0xbff7, 0x8006, 0xdfff, 0x0015, 0xdeff, 0xffff, 0x59df, 0x427d, 0x827d,
+    0x807d, 0xc38d, 0x9bef, 0xffff, 0xdfff, 0xffff, 0xbdef, 0xae5d, 0x4c2d, 0xeb0c, 0x8a04, 0x9155,
+    0xffff, 0xdff7, 0xbfef, 0xbfef, 0x8003, 0xbfe7, 0x0003, 0xbfef, 0xbfef, 0xbfe7, 0x8004, 0x9fe7,
+    0x0001, 0x9fdf, 0x8003, 0x9fe7, 0x8004, 0x9fdf, 0x0001, 0xdfff, 0x8020, 0xffff, 0x0002, 0x9fdf,
+    0x9fd7, 0x8006, 0x9fdf, 0x000c, 0x9fd7, 0x7fcf, 0x9fd7, 0xbfdf, 0x9fdf, 0xcd3b, 0xa502, 0x4803,
+    0x2803, 0xe702, 0xe80a, 0x5cdf, 0x8007, 0xffff, 0x800e, 0xdff7, 0x0007, 0xffff, 0xd9ce, 0x654b,
+    0x8553, 0x8553, 0x444b, 0xd9d6, 0x8004, 0xffff, 0x0005, 0xeda5, 0xa264, 0xc46c, 0x625c, 0xf7ce,
+    0x8060, 0xffff, 0x8007, 0x7eef, 0x0009, 0x9eef, 0x7eef, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x9eef,
+    0x9ef7, 0x9eef, 0x8006, 0x9ef7, 0x0001, 0x9eef, 0x800f, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0x9ef7,
+    0x8015, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xdef7, 0x0001, 0xbef7, 0x8003, 0xdef7, 0x0003, 0xbef7,
+    0xdff7, 0xdff7, 0x8003, 0xdef7, 0x000b, 0xdff7, 0xbef7, 0xbef7, 0xbff7, 0xdfff, 0xdff7, 0xbef7,
+    0xbef7, 0xdff7, 0xdff7, 0xbff7, 0x8005, 0xdfff, 0x0014, 0xbef7, 0xffff, 0x2ca6, 0x4075, 0x827d,
+    0x807d, 0x8dbe, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x7396, 0x6a35, 0x4c2d, 0xab04, 0xab14, 0x7cdf,
+    0xffff, 0xdfff, 0xdff7, 0x8005, 0xbfef, 0x0003, 0x9fe7, 0x9fe7, 0xbfe7, 0x8004, 0x9fe7, 0x0003,
+    0xbfe7, 0x9fe7, 0xbfe7, 0x8004, 0x9fe7, 0x0001, 0xdfff, 0x801f, 0xffff, 0x0006, 0xdff7, 0x9fd7,
+    0x9fdf, 0xbfe7, 0xbfdf, 0x9fe7, 0x8004, 0x9fdf, 0x000b, 0x7fcf, 0x5fc7, 0x7fd7, 0x5fcf, 0x589e,
+    0x4d3c, 0xe602, 0x2803, 0x0803, 0x4a23, 0xf7ad, 0x8008, 0xffff, 0x800b, 0xdff7, 0x8003, 0xdfff,
+    0x0007, 0xffff, 0x2f8d, 0x2343, 0x8553, 0x434b, 0x296c, 0xdfff, 0x8003, 0xffff, 0x0005, 0x7bef,
+    0xe46c, 0xa364, 0x625c, 0x2a85, 0x8060, 0xffff, 0x8008, 0x7eef, 0x0001, 0x9eef, 0x8004, 0x7eef,
+    0x0002, 0x9eef, 0x9eef, 0x8005, 0x9ef7, 0x0001, 0x9eef, 0x8006, 0x9ef7, 0x0001, 0x9eef, 0x8008,
+    0x9ef7, 0x0008, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8011, 0xbef7,
+    0x0001, 0xdef7, 0x8004, 0xbef7, 0x0004, 0xdff7, 0xdef7, 0xdef7, 0xbef7, 0x8003, 0xdef7, 0x0003,
+    0xbef7, 0xdef7, 0xdff7, 0x8004, 0xdef7, 0x000a, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xdfff, 0xdef7,
+    0xdff7, 0xbff7, 0xdff7, 0xdff7, 0x8004, 0xdfff, 0x0012, 0xbef7, 0xdfff, 0x5ae7, 0x617d, 0xa285,
+    0x827d, 0x427d, 0x7aef, 0xffff, 0xdfff, 0xffff, 0x9de7, 0xae5d, 0x6d4d, 0x2e3d, 0xcc1c, 0x5596,
+    0xffff, 0x8003, 0xdfff, 0x8004, 0xbfef, 0x0010, 0xbfe7, 0x9fe7, 0xbfe7, 0xbfe7, 0xbfef, 0xbfe7,
+    0x9fe7, 0x9fe7, 0xbfe7, 0x9fe7, 0xbfe7, 0x9fe7, 0xbfe7, 0x9fe7, 0x9fe7, 0xdfff, 0x8020, 0xffff,
+    0x0013, 0xdfef, 0xdfef, 0x9fe7, 0xbfe7, 0xbfe7, 0x9fdf, 0xbfdf, 0x9fdf, 0x9fdf, 0x9fd7, 0x5fc7,
+    0x3fbf, 0x9fd7, 0xffff, 0xffff, 0xb9be, 0x57ae, 0xb9c6, 0xdef7, 0x800b, 0xffff, 0x8008, 0xdff7,
+    0x0002, 0xffff, 0xdfff, 0x8003, 0xffff, 0x0006, 0x7cef, 0x296c, 0xc75b, 0xe863, 0xa65b, 0x77c6,
+    0x8004, 0xffff, 0x0005, 0xeea5, 0x815c, 0xa46c, 0x4364, 0xf8d6, 0x805f, 0xffff, 0x0001, 0x7def,
+    0x8005, 0x7eef, 0x0002, 0x9eef, 0x9eef, 0x8004, 0x7eef, 0x0004, 0x9eef, 0x7eef, 0x7eef, 0x9eef,
+    0x8004, 0x9ef7, 0x0001, 0x9eef, 0x800f, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8004, 0xbef7, 0x0002,
+    0x9ef7, 0x9ef7, 0x8015, 0xbef7, 0x0005, 0xdef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0x8007, 0xdef7,
+    0x8003, 0xbef7, 0x8003, 0xbff7, 0x0017, 0xbef7, 0xdfff, 0xbef7, 0xdff7, 0xdfff, 0xdff7, 0xdff7,
+    0xdfff, 0xbff7, 0xdfff, 0xdfff, 0xbef7, 0xffff, 0x0ea6, 0x2075, 0x2275, 0x4054, 0x8b95, 0xffff,
+    0xdfff, 0xffff, 0xffff, 0xdef7, 0x8003, 0xbef7, 0x0002, 0xbeef, 0xffff, 0x8004, 0xdfff, 0x0001,
+    0xdff7, 0x8006, 0xbfef, 0x0001, 0xbfe7, 0x8006, 0xbfef, 0x8005, 0xbfe7, 0x0001, 0xdff7, 0x801f,
+    0xffff, 0x0004, 0xdca6, 0x5a7e, 0x5ec7, 0xdfef, 0x8003, 0xbfe7, 0x0006, 0x9fdf, 0x9fdf, 0xbfdf,
+    0x9fdf, 0x7fcf, 0x9fd7, 0x8013, 0xffff, 0x8006, 0xdff7, 0x0001, 0xfff7, 0x8006, 0xffff, 0x0002,
+    0xdeff, 0xbdf7, 0x8003, 0xdef7, 0x8004, 0xffff, 0x0005, 0x5ae7, 0xa464, 0xa464, 0x6264, 0x4b8d,
+    0x805f, 0xffff, 0x0001, 0x7def, 0x8005, 0x7eef, 0x0003, 0x9eef, 0x7eef, 0x9eef, 0x8003, 0x7eef,
+    0x0005, 0x9ef7, 0x7eef, 0x7eef, 0x9eef, 0x9eef, 0x800d, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7,
+    0x0002, 0xbef7, 0x9ef7, 0x8006, 0xbef7, 0x0005, 0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x8009,
+    0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8006, 0xbef7, 0x0005, 0xdef7, 0xdef7, 0xbef7, 0xdef7, 0xbef7,
+    0x8006, 0xdef7, 0x0002, 0xdff7, 0xdef7, 0x8003, 0xbef7, 0x0017, 0xbfff, 0xbff7, 0xbef7, 0xbef7,
+    0xdfff, 0xbfff, 0xbff7, 0xdef7, 0xdff7, 0xbff7, 0xbfff, 0xbef7, 0xdfff, 0xdef7, 0xdfff, 0x7cef,
+    0xa364, 0x4054, 0x004c, 0x0054, 0x18d7, 0xffff, 0xdfff, 0x8007, 0xffff, 0x8006, 0xdfff, 0x8007,
+    0xbfef, 0x0003, 0xbff7, 0xdff7, 0xdff7, 0x8003, 0xffff, 0x0002, 0xdff7, 0xbfef, 0x8003, 0xbfe7,
+    0x0001, 0xdff7, 0x8015, 0xffff, 0x0002, 0xdeef, 0xfff7, 0x8005, 0xffff, 0x0008, 0xdfef, 0xbee7,
+    0xfcae, 0x930c, 0x7304, 0x930c, 0x5a76, 0xdfef, 0x8004, 0xbfe7, 0x0003, 0x9fdf, 0x7fd7, 0xbfe7,
+    0x8014, 0xffff, 0x8006, 0xdff7, 0x8011, 0xffff, 0x0005, 0x8c95, 0x425c, 0x836c, 0x435c, 0x3ad7,
+    0x805e, 0xffff, 0x800c, 0x7eef, 0x0007, 0x9ef7, 0x7eef, 0x7eef, 0x9ef7, 0x7eef, 0x7eef, 0x7ef7,
+    0x800b, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x0008, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7,
+    0x9ef7, 0xbef7, 0x9ef7, 0x8008, 0xbef7, 0x0001, 0x9ef7, 0x8009, 0xbef7, 0x000a, 0xbff7, 0xbff7,
+    0xbef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0xdef7, 0xdef7, 0xbef7, 0x8005, 0xdef7, 0x0001, 0xdff7,
+    0x8003, 0xbef7, 0x0016, 0xbff7, 0xdff7, 0xbff7, 0xbff7, 0xbef7, 0xdfff, 0xbef7, 0xdff7, 0xdef7,
+    0xdef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xffff, 0xb6c6, 0xa66c, 0x077d, 0xa674, 0x8c95,
+    0xffff, 0x8003, 0xdfff, 0x0002, 0xffff, 0xffff, 0x800a, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdff7,
+    0x0002, 0xdfff, 0xdfff, 0x8009, 0xffff, 0x0004, 0xdff7, 0xbfe7, 0x9fe7, 0xdff7, 0x8014, 0xffff,
+    0x0016, 0xdfff, 0x7ccf, 0x5bbf, 0x5cbf, 0x9dcf, 0x9ddf, 0x9dd7, 0x7cc7, 0x1aa7, 0x3b9f, 0xb30c,
+    0x9304, 0xd404, 0x9404, 0x7304, 0x9a86, 0xdff7, 0xbfe7, 0xbfef, 0x9fe7, 0x9fdf, 0xdfef, 0x8015,
+    0xffff, 0x0002, 0xdff7, 0xdfff, 0x8003, 0xffff, 0x0001, 0xdff7, 0x8011, 0xffff, 0x0005, 0xf7d6,
+    0xc87c, 0x0985, 0x8774, 0xf2ad, 0x805e, 0xffff, 0x800d, 0x7eef, 0x8003, 0x9eef, 0x8003, 0x7eef,
+    0x800b, 0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7, 0x0001, 0xbef7, 0x8006, 0x9ef7, 0x0003, 0xbef7,
+    0xbef7, 0x9ef7, 0x800e, 0xbef7, 0x8004, 0xbff7, 0x0002, 0xbef7, 0xdef7, 0x8003, 0xbef7, 0x000a,
+    0xdef7, 0xdef7, 0xbef7, 0xdef7, 0xdef7, 0xdff7, 0xdef7, 0xdef7, 0xbef7, 0xbef7, 0x8005, 0xbff7,
+    0x8004, 0xbef7, 0x0009, 0xdef7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xdff7, 0xbff7, 0xdff7,
+    0x8003, 0xdfff, 0x0001, 0xffff, 0x8011, 0xdfff, 0x8004, 0xffff, 0x0001, 0xdfff, 0x800a, 0xffff,
+    0x0003, 0xdff7, 0x9fe7, 0xdfef, 0x8016, 0xffff, 0x0002, 0xbee7, 0x7bbf, 0x8004, 0x5aaf, 0x000d,
+    0x9caf, 0x7966, 0x7304, 0x9404, 0xb504, 0xd504, 0x9404, 0x7735, 0xdfef, 0xbfe7, 0x9fe7, 0x9fdf,
+    0xdff7, 0x8090, 0xffff, 0x800c, 0x7eef, 0x8003, 0x9eef, 0x0001, 0x7eef, 0x8004, 0x9eef, 0x8016,
+    0x9ef7, 0x8007, 0xbef7, 0x0001, 0x9ef7, 0x800e, 0xbef7, 0x0001, 0xdef7, 0x8006, 0xbef7, 0x0007,
+    0xdef7, 0xdff7, 0xdef7, 0xdef7, 0xdff7, 0xdef7, 0xbef7, 0x8004, 0xbff7, 0x8004, 0xbef7, 0x0001,
+    0xdef7, 0x8003, 0xbef7, 0x0007, 0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xdff7, 0xdff7, 0xdeff, 0x8015,
+    0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x800b, 0xffff, 0x0002, 0xdff7, 0xdff7, 0x8018, 0xffff,
+    0x000c, 0x9ddf, 0x7cc7, 0x7cc7, 0x5bb7, 0x9db7, 0xf855, 0x3204, 0x7304, 0x7304, 0x9304, 0xb304,
+    0x396e, 0x8003, 0xbfef, 0x0001, 0xdff7, 0x8091, 0xffff, 0x800d, 0x7eef, 0x0002, 0x9eef, 0x9eef,
+    0x8003, 0x7eef, 0x0003, 0x9ef7, 0x9ef7, 0x7ef7, 0x8015, 0x9ef7, 0x8007, 0xbef7, 0x8005, 0x9ef7,
+    0x0004, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0x8004, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0xdef7, 0x8004,
+    0xbef7, 0x0001, 0xdef7, 0x8019, 0xbef7, 0x0001, 0xdef7, 0x8004, 0xdfff, 0x0001, 0xdef7, 0x8006,
+    0xbef7, 0x8006, 0xdfff, 0x0001, 0xffff, 0x8008, 0xdfff, 0x0002, 0xffff, 0xdfff, 0x8008, 0xffff,
+    0x0006, 0xdfff, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0x8004, 0xdfff, 0x0003, 0xffff, 0xffff,
+    0xdfff, 0x8010, 0xffff, 0x0008, 0xdff7, 0xdff7, 0x3dcf, 0x3cc7, 0x3cbf, 0x3cbf, 0x7dd7, 0xbeef,
+    0x8095, 0xffff, 0x0001, 0x7def, 0x8011, 0x7eef, 0x0001, 0x9eef, 0x800c, 0x9ef7, 0x0001, 0xbef7,
+    0x800a, 0x9ef7, 0x0009, 0xbff7, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x7eef, 0xbff7,
+    0x8003, 0xffff, 0x0004, 0xbef7, 0x7eef, 0x9eef, 0xbef7, 0x8004, 0xffff, 0x0002, 0xbef7, 0x9ef7,
+    0x8003, 0xbef7, 0x0001, 0xdef7, 0x8003, 0xbef7, 0x801b, 0xffff, 0x0003, 0xdff7, 0xdfff, 0xdfff,
+    0x8008, 0xffff, 0x8006, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff, 0x80c7, 0xffff, 0x0001, 0x7def,
+    0x800e, 0x7eef, 0x0004, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x8018, 0x9ef7, 0x0001, 0xbff7, 0x8003,
+    0x9ef7, 0x0025, 0x7eef, 0xdfff, 0xffff, 0x3ce7, 0x75ad, 0xcf73, 0x8a4a, 0xc731, 0x8629, 0x8629,
+    0xc631, 0x4942, 0x4d63, 0xb294, 0x59ce, 0xbef7, 0xffff, 0xffff, 0x9ef7, 0xbef7, 0xbef7, 0xdef7,
+    0xbef7, 0xdfff, 0x3ce7, 0x99be, 0xd9c6, 0xb9c6, 0xd9c6, 0xb9c6, 0xd9c6, 0xb9c6, 0x99c6, 0x17be,
+    0xb7b5, 0x17be, 0x38be, 0x8003, 0x18be, 0x0016, 0x38be, 0x38c6, 0x38be, 0x38be, 0x18be, 0x38be,
+    0x38be, 0x38c6, 0x38c6, 0x17be, 0xbad6, 0xdfff, 0xdef7, 0xdfff, 0x79ce, 0xf7bd, 0xf7bd, 0x18be,
+    0x59c6, 0x58c6, 0x38be, 0x79c6, 0x800b, 0xdfff, 0x0016, 0xffff, 0x9de7, 0x3acf, 0x5bd7, 0x5bd7,
+    0x5acf, 0x3acf, 0x5bd7, 0x3acf, 0x9de7, 0xffff, 0xffff, 0x7cdf, 0x5bcf, 0x5bd7, 0x5bd7, 0x7bd7,
+    0x7bd7, 0x5bd7, 0x5bd7, 0x7bdf, 0x7bdf, 0x8006, 0x7cdf, 0x8009, 0x9cdf, 0x0003, 0x9ce7, 0x7cdf,
+    0x9def, 0x8003, 0xffff, 0x0009, 0x7ce7, 0x5bdf, 0x5bdf, 0x5cdf, 0x7cdf, 0x7cdf, 0x5bdf, 0x5bd7,
+    0x9def, 0x8005, 0xffff, 0x0003, 0x5bdf, 0x3ad7, 0x5adf, 0x8004, 0x5bdf, 0x0002, 0x5adf, 0x9def,
+    0x800d, 0xffff, 0x0001, 0xdeff, 0x8003, 0x5ae7, 0x0001, 0x5adf, 0x8003, 0x5ae7, 0x0002, 0x5adf,
+    0xdef7, 0x8004, 0xffff, 0x0002, 0xdeff, 0x39df, 0x8006, 0x59df, 0x0015, 0x39df, 0x19df, 0x3ae7,
+    0x3ae7, 0x3adf, 0x3adf, 0x39df, 0x39df, 0x59df, 0x59df, 0x39df, 0x58df, 0x58df, 0x79e7, 0x19df,
+    0xf9d6, 0xf9d6, 0xf8d6, 0xf9d6, 0xd8ce, 0x9def, 0x8004, 0xffff, 0x000a, 0x9cef, 0x58df, 0x79e7,
+    0x79e7, 0x79ef, 0x78e7, 0x78ef, 0x79ef, 0x78e7, 0xdeff, 0x8040, 0xffff, 0x0001, 0x7def, 0x8009,
+    0x7eef, 0x0001, 0x9eef, 0x8003, 0x7eef, 0x0001, 0x9eef, 0x8003, 0x7eef, 0x0002, 0x9eef, 0x7eef,
+    0x8014, 0x9ef7, 0x0002, 0xbef7, 0xbef7, 0x8005, 0x9ef7, 0x0007, 0xffff, 0xdbd6, 0x8d6b, 0x2419,
+    0x2000, 0x0000, 0x0000, 0x8003, 0x2100, 0x0001, 0x2000, 0x8003, 0x0000, 0x0006, 0x6100, 0xa629,
+    0x5084, 0xdbde, 0xffff, 0xdfff, 0x8003, 0xbef7, 0x0006, 0xffff, 0x7395, 0xa60a, 0x271b, 0x481b,
+    0x471b, 0x8003, 0x671b, 0x0009, 0x871b, 0x0713, 0x0201, 0x0000, 0x6100, 0x8100, 0xa100, 0x6100,
+    0x8100, 0x8003, 0xa200, 0x0015, 0xa100, 0xc200, 0xa100, 0xa200, 0xc200, 0x2000, 0xad6b, 0xffff,
+    0xbef7, 0xdfff, 0x0832, 0x4000, 0xa100, 0x8100, 0xa100, 0x4309, 0xa411, 0x0101, 0xb5ad, 0xffff,
+    0xbef7, 0x8007, 0xdfff, 0x0005, 0xdff7, 0xffff, 0x3496, 0xca1c, 0x2c2d, 0x8004, 0x2b2d, 0x0009,
+    0xaa14, 0x7596, 0xffff, 0xdeff, 0x8f5d, 0x2b35, 0x4c3d, 0x6c3d, 0x6c35, 0x8004, 0x6c3d, 0x0003,
+    0x4c45, 0x6c45, 0x8d4d, 0x8003, 0xad4d, 0x0019, 0xcd55, 0xce55, 0xee5d, 0xee5d, 0xcd5d, 0xad55,
+    0xac4d, 0xcd55, 0xce5d, 0x6e55, 0x4e5d, 0x8b3c, 0x7285, 0xffff, 0xffff, 0xdfff, 0xec54, 0x8734,
+    0x683c, 0x693c, 0x6934, 0x4934, 0x4934, 0x0724, 0xd28d, 0x8004, 0xffff, 0x000b, 0xdfff, 0x6954,
+    0xe52b, 0x463c, 0x4644, 0x4644, 0x464c, 0x664c, 0x4544, 0xc964, 0xdef7, 0x800c, 0xffff, 0x0002,
+    0x5be7, 0xc464, 0x8006, 0xc364, 0x0002, 0xe364, 0x7be7, 0x8004, 0xffff, 0x001d, 0x7bef, 0xe464,
+    0x0365, 0x0365, 0xc35c, 0xa45c, 0xc35c, 0xe364, 0x456c, 0xa87b, 0xe87b, 0xc773, 0xc66b, 0x855c,
+    0x845c, 0x835c, 0xa364, 0xc364, 0x036d, 0x4375, 0x2375, 0x636c, 0x844b, 0x6443, 0x643b, 0xa343,
+    0xc443, 0x433b, 0xb7ce, 0x8004, 0xffff, 0x000a, 0xb2c6, 0x818d, 0x03a6, 0x03a6, 0x23a6, 0x22a6,
+    0x22ae, 0x02a6, 0xc2a5, 0x79ef, 0x8040, 0xffff, 0x8010, 0x7eef, 0x0005, 0x9ef7, 0x9ef7, 0x9eef,
+    0x7eef, 0x9eef, 0x8013, 0x9ef7, 0x0001, 0xbef7, 0x8005, 0x9ef7, 0x0007, 0xffff, 0xb294, 0xc210,
+    0x0000, 0x4100, 0x6200, 0x8200, 0x8003, 0x6200, 0x0002, 0x6100, 0x6100, 0x8003, 0x6200, 0x0032,
+    0x6100, 0x4100, 0x2000, 0xe308, 0xae6b, 0x3ce7, 0xffff, 0xbef7, 0xbef7, 0xffff, 0x7495, 0x0713,
+    0x6823, 0x6823, 0x8823, 0x881b, 0x8823, 0xa823, 0xc923, 0xe923, 0xc92b, 0xc411, 0x4000, 0x8100,
+    0xc200, 0xa200, 0x8200, 0xa200, 0xc300, 0xc200, 0xe200, 0xe200, 0xa200, 0xa200, 0xe308, 0x8100,
+    0xee73, 0xffff, 0x9ef7, 0xdfff, 0x493a, 0x6100, 0xc200, 0xe300, 0xa200, 0x8100, 0x2311, 0x8411,
+    0x062a, 0x5def, 0x8009, 0xdfff, 0x0010, 0xffff, 0x3596, 0xca1c, 0x2c2d, 0x2c2d, 0x4c35, 0x6c35,
+    0x6c3d, 0x0a1d, 0x969e, 0xffff, 0xdef7, 0x8f55, 0x4b35, 0x2c35, 0x4c35, 0x8003, 0x6c35, 0x0021,
+    0x8c35, 0x8c3d, 0x8c45, 0x8c45, 0xad45, 0xcd4d, 0xcd4d, 0xed55, 0xed55, 0x0e56, 0xee55, 0xed55,
+    0x2e5e, 0x2e5e, 0xed55, 0x2e5e, 0x6e55, 0x2e4d, 0x2e55, 0x8b3c, 0x307d, 0xffff, 0xffff, 0xbfff,
+    0xaa4c, 0x8734, 0x4734, 0x4834, 0x6834, 0x6834, 0x6934, 0x0624, 0xd28d, 0x8004, 0xffff, 0x000b,
+    0xbeff, 0x4a54, 0xe52b, 0x2634, 0x2634, 0x263c, 0x4644, 0x654c, 0x654c, 0x233c, 0xd095, 0x800c,
+    0xffff, 0x000a, 0x5ae7, 0xc364, 0xe364, 0xe364, 0xe264, 0xe264, 0xe26c, 0xe36c, 0xc364, 0x7bef,
+    0x8004, 0xffff, 0x001d, 0x9cef, 0x246d, 0x436d, 0x0365, 0x835c, 0xc464, 0xe46c, 0x046d, 0x656c,
+    0x2b94, 0xea8b, 0x887b, 0xe563, 0xc45c, 0xa45c, 0xa35c, 0xe36c, 0x4375, 0x2375, 0x235c, 0x6343,
+    0x4443, 0x243b, 0x243b, 0x643b, 0xe443, 0xe44b, 0x433b, 0xb7c6, 0x8004, 0xffff, 0x000a, 0xf4d6,
+    0xe29d, 0x43ae, 0x43ae, 0x42ae, 0x42ae, 0x63b6, 0x23ae, 0x04ae, 0x99ef, 0x8040, 0xffff, 0x0001,
+    0x7def, 0x8012, 0x7eef, 0x8003, 0x9eef, 0x8005, 0x9ef7, 0x0001, 0xbef7, 0x800c, 0x9ef7, 0x0001,
+    0xbef7, 0x8004, 0x9ef7, 0x0005, 0xbef7, 0x6d63, 0x0000, 0x4100, 0x6208, 0x8004, 0x6100, 0x0003,
+    0x4100, 0x6100, 0x6100, 0x8005, 0x4100, 0x001e, 0x8200, 0xc200, 0xa200, 0x2000, 0x0419, 0xb294,
+    0xdfff, 0xbef7, 0xffff, 0x738d, 0xc60a, 0x281b, 0x071b, 0x8823, 0x881b, 0x681b, 0x8823, 0x8823,
+    0xa823, 0xe92b, 0x0a2c, 0x4612, 0x4100, 0x8100, 0xa200, 0x8100, 0x8200, 0x8200, 0xa200, 0xe200,
+    0x8003, 0xa200, 0x0012, 0xc200, 0x8100, 0xce6b, 0xffff, 0x9ef7, 0xdfff, 0x6942, 0x8000, 0x2301,
+    0xc200, 0xe200, 0xa200, 0x4100, 0xc208, 0x0201, 0xcd6b, 0xffff, 0xbef7, 0x8006, 0xdfff, 0x001a,
+    0xdff7, 0xffff, 0x559e, 0xe924, 0x2b2d, 0x0b25, 0x2b2d, 0x4b35, 0x6c3d, 0x0a25, 0x959e, 0xffff,
+    0xdef7, 0x6f55, 0x0b2d, 0x0b2d, 0x2c2d, 0x4c35, 0x6c35, 0x8c35, 0x8c3d, 0x8c3d, 0xac45, 0xac45,
+    0xcd4d, 0xcd45, 0x8004, 0xcd4d, 0x0012, 0xee55, 0x4e5e, 0x2b45, 0x2c45, 0x0f5e, 0x2d4d, 0xee4c,
+    0xee4c, 0x0e55, 0xac44, 0x9285, 0xffff, 0xffff, 0xbef7, 0x283b, 0x462c, 0x6734, 0x4734, 0x8003,
+    0x6834, 0x0002, 0x0624, 0xf28d, 0x8004, 0xffff, 0x000c, 0xdfff, 0x6a54, 0xc523, 0x062c, 0x0534,
+    0x253c, 0x453c, 0x4544, 0x6544, 0x654c, 0x033c, 0xb7c6, 0x800b, 0xffff, 0x000a, 0x7ae7, 0xc364,
+    0xe364, 0xe364, 0xe264, 0xe264, 0xe36c, 0xc264, 0xe364, 0x7bef, 0x8004, 0xffff, 0x001d, 0x9bef,
+    0xa464, 0x8354, 0x6354, 0xc364, 0x0365, 0x0365, 0x246d, 0x856c, 0x0a8c, 0xeb93, 0x2663, 0x445c,
+    0xe45c, 0xe364, 0x036d, 0x4375, 0xc46c, 0x4343, 0xa332, 0xe432, 0x243b, 0x233b, 0x6443, 0x8343,
+    0x0354, 0xe44b, 0x0233, 0xb7c6, 0x8004, 0xffff, 0x000a, 0x15df, 0x029e, 0x43ae, 0x42ae, 0x42ae,
+    0x63ae, 0x63b6, 0x43ae, 0x24ae, 0x9aef, 0x8040, 0xffff, 0x0002, 0x7def, 0x7def, 0x8012, 0x7eef,
+    0x0005, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x8012, 0x9ef7, 0x0005, 0x9eef, 0xffff, 0xae6b,
+    0x0000, 0x8208, 0x800b, 0x6100, 0x001e, 0x4100, 0x6100, 0x4100, 0x6100, 0xa200, 0xa200, 0xe308,
+    0x0000, 0xce73, 0xffff, 0x9ef7, 0xffff, 0x7395, 0x850a, 0xe71a, 0xc712, 0x271b, 0x8823, 0x6823,
+    0x8823, 0xa923, 0xa823, 0x8823, 0xa823, 0x2a34, 0x661a, 0x4100, 0x8200, 0x8200, 0x6100, 0x8003,
+    0x8200, 0x8003, 0xa200, 0x0008, 0xc200, 0x6100, 0xce6b, 0xffff, 0xbef7, 0xdfff, 0x8942, 0xc100,
+    0x8003, 0x4301, 0x0008, 0x2301, 0xa200, 0x4100, 0x8200, 0xe200, 0xd6b5, 0xffff, 0xbef7, 0x8005,
+    0xdfff, 0x0035, 0xdef7, 0xffff, 0x148e, 0xe92c, 0x4b35, 0x2b2d, 0x2b2d, 0x0b25, 0x6c35, 0x0a2d,
+    0x96a6, 0xffff, 0xdef7, 0x6e55, 0xab1c, 0xeb24, 0x0b2d, 0x4c3d, 0x6c3d, 0x8c3d, 0x8c3d, 0x8c35,
+    0xac45, 0xac45, 0xcc45, 0xcd45, 0xcd4d, 0xac45, 0xcd4d, 0xed4d, 0x6c45, 0xe92b, 0x6301, 0xc509,
+    0xcd44, 0xee54, 0xce4c, 0xad44, 0x8d44, 0xcc44, 0x349e, 0xffff, 0xffff, 0xdfff, 0x072a, 0x8412,
+    0xc844, 0x4734, 0x4734, 0x6834, 0x6834, 0x0624, 0xf28d, 0x8004, 0xffff, 0x0007, 0xdeff, 0x6a54,
+    0x851b, 0xe623, 0x052c, 0x463c, 0x453c, 0x8003, 0x4544, 0x0003, 0x654c, 0x6754, 0x9def, 0x800a,
+    0xffff, 0x000a, 0x7be7, 0xc364, 0xe364, 0xe364, 0xe26c, 0x036d, 0xe36c, 0xc264, 0xc364, 0x7be7,
+    0x8004, 0xffff, 0x0004, 0x9cef, 0xa45c, 0xa35c, 0xe464, 0x8003, 0x236d, 0x0016, 0x046d, 0xa46c,
+    0x0a8c, 0x086b, 0xe44a, 0xe46c, 0xa35c, 0x836c, 0x236c, 0x845b, 0xc43a, 0x842a, 0xe43a, 0x043b,
+    0x0333, 0x633b, 0x8343, 0xe34b, 0x4454, 0xa343, 0x4333, 0xb7c6, 0x8004, 0xffff, 0x000a, 0x14d7,
+    0x22a6, 0x63ae, 0x63b6, 0x63b6, 0x63ae, 0x63ae, 0x23ae, 0x24ae, 0x9aef, 0x8040, 0xffff, 0x8003,
+    0x7def, 0x0002, 0x7eef, 0x7def, 0x800c, 0x7eef, 0x0009, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x9eef,
+    0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x8010, 0x9ef7, 0x0005, 0x7eef, 0xffff, 0x95ad, 0x2000, 0x8200,
+    0x8005, 0x6100, 0x0002, 0x4100, 0x6200, 0x8004, 0x8200, 0x8004, 0x6100, 0x001a, 0x4100, 0x8200,
+    0xc300, 0x6100, 0x483a, 0xffff, 0xdff7, 0xbef7, 0xffff, 0x5395, 0x6512, 0xe71a, 0xc712, 0xc712,
+    0x2823, 0x8823, 0x6823, 0xa923, 0xc92b, 0xa823, 0x8823, 0xe92b, 0x4a2c, 0x6512, 0x6100, 0xa200,
+    0x8003, 0x8200, 0x8003, 0xa200, 0x0013, 0xc200, 0xc300, 0x6100, 0xce6b, 0xffff, 0x9ef7, 0xdfff,
+    0xa93a, 0xe100, 0x6301, 0x8301, 0xc301, 0x2402, 0xc401, 0xe200, 0x2100, 0x4100, 0x8521, 0x7def,
+    0x8006, 0xdfff, 0x0035, 0xbef7, 0xffff, 0xb37d, 0xc803, 0x8a1c, 0x2b2d, 0xeb24, 0x0b25, 0x4c35,
+    0x0a2d, 0x96a6, 0xffff, 0xdef7, 0x4e4d, 0xeb1c, 0xeb24, 0x0b2d, 0x4c35, 0x6c3d, 0x8c3d, 0x8c3d,
+    0xac3d, 0x8c3d, 0xac3d, 0xcd45, 0xcd45, 0xcd4d, 0xee4d, 0x6c45, 0xe923, 0x4502, 0x6401, 0x6401,
+    0x2301, 0x291b, 0xee4c, 0x4c34, 0xcb23, 0x6c3c, 0xac3c, 0x359e, 0xffff, 0xffff, 0xdfff, 0x4732,
+    0x2201, 0xe733, 0xa83c, 0x4734, 0x6834, 0x6834, 0x2724, 0xd28d, 0x8004, 0xffff, 0x000d, 0xdfff,
+    0x8b5c, 0x650b, 0x8613, 0xe62b, 0x0534, 0x263c, 0x4544, 0x4644, 0x4544, 0x654c, 0x2444, 0x6d85,
+    0x800a, 0xffff, 0x0003, 0x7be7, 0xc364, 0xe364, 0x8004, 0xe36c, 0x0003, 0xc264, 0xc364, 0x5be7,
+    0x8004, 0xffff, 0x001d, 0x9cef, 0xe464, 0xe364, 0x246d, 0x236d, 0x036d, 0x4375, 0x0475, 0x467c,
+    0xe662, 0xa431, 0x255b, 0x8374, 0xa35b, 0x034b, 0xe34a, 0xe33a, 0xa432, 0xe432, 0x043b, 0x243b,
+    0x633b, 0x833b, 0xe343, 0x4454, 0x0454, 0xc443, 0x6333, 0xb7c6, 0x8004, 0xffff, 0x0003, 0x14d7,
+    0x22a6, 0x64b6, 0x8003, 0x63b6, 0x0004, 0x64b6, 0x44ae, 0x45b6, 0x9aef, 0x8040, 0xffff, 0x8003,
+    0x7def, 0x800f, 0x7eef, 0x8004, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x8010, 0x9ef7, 0x0005,
+    0x9eef, 0x9ef7, 0xc631, 0x2000, 0x6200, 0x8003, 0x6100, 0x0004, 0x4100, 0x6100, 0x6200, 0x4100,
+    0x8004, 0x0000, 0x0014, 0x2100, 0x6100, 0x6200, 0x6100, 0x4100, 0x6200, 0xa200, 0xc208, 0x9ace,
+    0xffff, 0xbef7, 0xbef7, 0xffff, 0x5395, 0x450a, 0xc71a, 0xa71a, 0xc71a, 0x071b, 0x6823, 0x8003,
+    0x8823, 0x000a, 0xc823, 0xc81b, 0xa81b, 0xc81b, 0x0824, 0x0402, 0x4100, 0x6100, 0x6100, 0x4100,
+    0x8003, 0x6100, 0x0015, 0x8100, 0xa200, 0x4000, 0x8d63, 0xffff, 0x9ef7, 0xdfff, 0x893a, 0xe100,
+    0x6301, 0x6301, 0xa301, 0x2402, 0x8402, 0x4402, 0x2301, 0x4100, 0x0000, 0xce73, 0xffff, 0xbef7,
+    0x8004, 0xdfff, 0x0035, 0xbef7, 0xffff, 0x737d, 0x0703, 0x6803, 0xa803, 0x290c, 0x8a14, 0xeb24,
+    0x8914, 0x96a6, 0xffff, 0xdef7, 0x4e4d, 0x2b25, 0x2b25, 0x2b2d, 0x4b2d, 0x6c35, 0x6c35, 0x8c3d,
+    0x8c3d, 0xac45, 0xac45, 0xcd45, 0xcd4d, 0xcd4d, 0x6a24, 0x060b, 0xc602, 0x660a, 0x4401, 0x4401,
+    0x2301, 0xe509, 0x0c2c, 0xeb23, 0x2c2c, 0xcd44, 0xab3c, 0x1496, 0xffff, 0xffff, 0xdff7, 0x272a,
+    0xe100, 0x0312, 0xa744, 0x873c, 0x4734, 0x6834, 0x272c, 0xd295, 0x8004, 0xffff, 0x0008, 0xbef7,
+    0x8b54, 0xe623, 0x660b, 0x6613, 0xe62b, 0x0534, 0x0534, 0x8003, 0x2544, 0x0005, 0x664c, 0x043c,
+    0x95be, 0xffff, 0xdfff, 0x8007, 0xffff, 0x0002, 0x7be7, 0xe46c, 0x8003, 0x036d, 0x0005, 0xe26c,
+    0xe36c, 0xc364, 0xc464, 0x5be7, 0x8004, 0xffff, 0x001d, 0x7bef, 0xe46c, 0x0365, 0x046d, 0x6475,
+    0x6475, 0xe46c, 0x045b, 0x244a, 0xe339, 0x0332, 0x8342, 0xe242, 0x0243, 0xe342, 0x0343, 0xa232,
+    0xc432, 0x043b, 0x0333, 0x4333, 0x833b, 0xc243, 0xe24b, 0x034c, 0xc343, 0x843b, 0x032b, 0xb7c6,
+    0x8004, 0xffff, 0x000a, 0x15d7, 0x23a6, 0x64ae, 0x64b6, 0x83b6, 0xa4be, 0xa5be, 0x85b6, 0x66b6,
+    0x9aef, 0x8040, 0xffff, 0x0002, 0x7def, 0x7def, 0x800d, 0x7eef, 0x0002, 0x9eef, 0x7ef7, 0x8003,
+    0x7eef, 0x0006, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x800c, 0x9ef7, 0x0008, 0xbef7,
+    0x9ef7, 0x9ef7, 0x7eef, 0xdfff, 0xb6b5, 0x2000, 0x8200, 0x8006, 0x6100, 0x0026, 0x0000, 0x4521,
+    0xcb52, 0x6d6b, 0x4d63, 0xaa52, 0x8529, 0x6100, 0x0000, 0x2100, 0x6208, 0x8200, 0x4000, 0xb28c,
+    0xffff, 0x9ef7, 0xbff7, 0xbef7, 0xffff, 0x5395, 0x0502, 0x871a, 0x6612, 0xc712, 0xe71a, 0x271b,
+    0x4823, 0x892b, 0x2b44, 0x4c44, 0x4c44, 0x4b4c, 0x4b44, 0x4c4c, 0x4b4c, 0x4732, 0xa621, 0xc629,
+    0x8003, 0xa629, 0x0017, 0xc629, 0xa621, 0xe729, 0x6421, 0x5084, 0xffff, 0x9ef7, 0xdfff, 0xa942,
+    0xe100, 0x4301, 0x8301, 0x8301, 0xe301, 0x6402, 0x8402, 0x8502, 0x2301, 0x4100, 0x6100, 0xf7bd,
+    0xffff, 0xdef7, 0x8003, 0xdfff, 0x0017, 0xbef7, 0xffff, 0x537d, 0xc602, 0xa903, 0x8903, 0xa903,
+    0xc903, 0x2904, 0xc803, 0x569e, 0xffff, 0xdff7, 0x6f5d, 0xeb2c, 0x0c35, 0x2c35, 0x4c3d, 0x6d3d,
+    0x6d45, 0x6d45, 0x8d4d, 0xad45, 0x8003, 0xcd45, 0x001b, 0xef5d, 0xcf65, 0x1066, 0x2c34, 0x6b2b,
+    0xc501, 0x6501, 0x4401, 0xe609, 0xeb2b, 0x4c34, 0xad44, 0xed4c, 0x8b3c, 0xd38d, 0xffff, 0xffff,
+    0xdeff, 0x4732, 0x4201, 0x4201, 0x452b, 0xe84c, 0x673c, 0x683c, 0x272c, 0xd295, 0x8004, 0xffff,
+    0x000f, 0xbef7, 0xab5c, 0x062c, 0xc71b, 0x460b, 0xa61b, 0x0634, 0x2634, 0x0534, 0x053c, 0x063c,
+    0x063c, 0x053c, 0x474c, 0x9cef, 0x8008, 0xffff, 0x000a, 0x5be7, 0xe464, 0xe364, 0xe364, 0xe464,
+    0xc45c, 0xc45c, 0x8354, 0x6454, 0x5be7, 0x8004, 0xffff, 0x001d, 0x7bef, 0x046d, 0x436d, 0x446d,
+    0x845c, 0x0343, 0x4442, 0xe439, 0x033a, 0x4442, 0xe752, 0x4753, 0xa75b, 0x6553, 0x6553, 0xa75b,
+    0x8753, 0xe85b, 0xe85b, 0xe75b, 0x275c, 0x4764, 0xa76c, 0x876c, 0x876c, 0x475c, 0x285c, 0xa74b,
+    0xb8ce, 0x8004, 0xffff, 0x000a, 0x15df, 0x43a6, 0xa5be, 0xa5b6, 0x45a6, 0xe595, 0x6575, 0x4575,
+    0x056d, 0x59df, 0x8040, 0xffff, 0x0001, 0x7def, 0x8005, 0x7eef, 0x0001, 0x7def, 0x8008, 0x7eef,
+    0x0004, 0x9eef, 0x9eef, 0x7eef, 0x7eef, 0x8003, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x800f,
+    0x9ef7, 0x0005, 0x7eef, 0xffff, 0x8d6b, 0x0000, 0x8208, 0x8005, 0x6100, 0x0003, 0x4100, 0x5184,
+    0x7def, 0x8004, 0xffff, 0x001a, 0x9ef7, 0x59c6, 0xaf73, 0x0419, 0x0000, 0x0000, 0xa94a, 0xffff,
+    0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xffff, 0x538d, 0xc401, 0x4612, 0x260a, 0x660a, 0xc612, 0x271b,
+    0x061b, 0x0c4c, 0xdef7, 0xbef7, 0xbef7, 0xdef7, 0x8004, 0xbef7, 0x8006, 0x9ef7, 0x0015, 0x9eef,
+    0x9ef7, 0x9ef7, 0xbef7, 0xbff7, 0xbef7, 0xdfff, 0x683a, 0xc100, 0x4301, 0x6301, 0x8301, 0xa301,
+    0xe301, 0x4402, 0x4402, 0x6502, 0x6301, 0x2100, 0xa629, 0x9ef7, 0x8004, 0xdfff, 0x0035, 0xbef7,
+    0xffff, 0x327d, 0x2402, 0xc702, 0xa903, 0xea03, 0x8903, 0xe903, 0xa803, 0x369e, 0xffff, 0xdfff,
+    0x7de7, 0x5ce7, 0x7de7, 0x7de7, 0x9de7, 0x9de7, 0x7ce7, 0x7de7, 0x9de7, 0x116e, 0xac45, 0xee55,
+    0xae4d, 0x916d, 0x716d, 0x6e4c, 0xcd33, 0xad33, 0x6b2b, 0xad3b, 0x4f4c, 0xd064, 0x3bd7, 0x7ce7,
+    0x7cdf, 0x7ce7, 0x7cdf, 0xbdef, 0xffff, 0xffff, 0xdef7, 0x4632, 0x2201, 0x4201, 0xa309, 0x673c,
+    0xa744, 0x8844, 0x262c, 0xd295, 0x8004, 0xffff, 0x000f, 0xdef7, 0xab5c, 0xe623, 0x072c, 0xa613,
+    0x8613, 0xe623, 0x0634, 0x0634, 0x0534, 0x0634, 0x0634, 0x263c, 0xe433, 0x0c6d, 0x8008, 0xffff,
+    0x000a, 0x5be7, 0x053c, 0x0534, 0xe533, 0x0434, 0x0434, 0xe433, 0x053c, 0x0544, 0x5bdf, 0x8004,
+    0xffff, 0x0013, 0x9cef, 0xa56c, 0xe453, 0xa33a, 0xe331, 0x8329, 0x2542, 0x043a, 0xa231, 0x0a63,
+    0x1ce7, 0xdade, 0xb9d6, 0x9def, 0xdef7, 0xbef7, 0xdeff, 0xdeff, 0xdef7, 0x8008, 0xdeff, 0x0001,
+    0xdef7, 0x8005, 0xffff, 0x000a, 0x15df, 0x65ae, 0xe695, 0x066d, 0x654c, 0x253c, 0x643c, 0xa54c,
+    0xa554, 0x59df, 0x8040, 0xffff, 0x0004, 0x9def, 0x7def, 0x7eef, 0x7def, 0x800b, 0x7eef, 0x000c,
+    0x9eef, 0x9eef, 0x9ef7, 0x7eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x7eef, 0x9eef, 0x9eef,
+    0x8003, 0x9ef7, 0x0004, 0x9eef, 0x9ef7, 0x9ef7, 0xbef7, 0x8007, 0x9ef7, 0x0005, 0x7eef, 0xdfff,
+    0x6942, 0x2000, 0x8200, 0x8003, 0x6100, 0x0005, 0x8200, 0x0000, 0x4d63, 0xffff, 0xbef7, 0x8004,
+    0x9ef7, 0x0017, 0xbff7, 0xffff, 0xffff, 0x5de7, 0xef7b, 0x6521, 0xdbde, 0xdfff, 0xbef7, 0xbef7,
+    0xdef7, 0xbef7, 0xffff, 0x338d, 0xc401, 0x6612, 0x260a, 0x460a, 0xa612, 0xc612, 0xc612, 0x0d54,
+    0xffff, 0x8011, 0xdfff, 0x0022, 0xdff7, 0xbff7, 0xffff, 0xcb5b, 0xa000, 0x6301, 0x4201, 0x4301,
+    0x8301, 0xc301, 0x2402, 0x4402, 0x4402, 0xa502, 0xc401, 0x0000, 0x0f7c, 0xffff, 0xbef7, 0xdfff,
+    0xdfff, 0xbef7, 0xffff, 0x9385, 0xa602, 0xc702, 0xc702, 0x4803, 0xea03, 0x0a04, 0x6703, 0x169e,
+    0xffff, 0xdff7, 0x8009, 0xffff, 0x000e, 0x527e, 0xac45, 0xef55, 0x8e44, 0x6c33, 0x6c33, 0x8c33,
+    0xad3b, 0xad33, 0x2f44, 0xd054, 0x3165, 0xf05c, 0x1bd7, 0x8007, 0xffff, 0x000a, 0xdff7, 0x4732,
+    0x4201, 0x8309, 0x0201, 0xe522, 0xa744, 0x8744, 0x262c, 0xd295, 0x8004, 0xffff, 0x0010, 0xbef7,
+    0xcb64, 0x062c, 0x272c, 0xe723, 0xa613, 0xa61b, 0x062c, 0x0634, 0x2634, 0x0634, 0x0634, 0x263c,
+    0x463c, 0xe42b, 0x34ae, 0x8007, 0xffff, 0x0003, 0x5be7, 0x063c, 0xe62b, 0x8003, 0xe52b, 0x0004,
+    0xc52b, 0xc533, 0xc533, 0x5bdf, 0x8004, 0xffff, 0x000f, 0xfade, 0xe331, 0x6329, 0x6329, 0xa431,
+    0x8329, 0xe439, 0x043a, 0xa331, 0x4a6b, 0xb1ac, 0xe972, 0xa86a, 0xad83, 0xbad6, 0x8012, 0xffff,
+    0x000a, 0xd5c6, 0x8554, 0x063c, 0xe533, 0x263c, 0x6544, 0x854c, 0xa554, 0xc55c, 0x59df, 0x8040,
+    0xffff, 0x0001, 0x7def, 0x8010, 0x7eef, 0x000a, 0x9ef7, 0x7ef7, 0x7ef7, 0x7eef, 0x9eef, 0x9ef7,
+    0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x8010, 0x9ef7, 0x000b, 0xc631, 0x2100, 0x8208, 0x6100, 0x6100,
+    0x6200, 0x8208, 0x0000, 0x139d, 0xdfff, 0x7eef, 0x8005, 0xbef7, 0x001d, 0x9ef7, 0x9eef, 0xdfff,
+    0xffff, 0x5def, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xffff, 0x128d, 0xc401, 0x4612,
+    0x2612, 0x450a, 0x660a, 0x8612, 0x8612, 0x0c54, 0xffff, 0xbff7, 0xdff7, 0xbff7, 0xdff7, 0xdef7,
+    0xdff7, 0xdff7, 0x800a, 0xbff7, 0x001a, 0xdff7, 0xbef7, 0xbfff, 0x6f75, 0x030a, 0x0201, 0x4201,
+    0x6301, 0xa301, 0xa301, 0xe401, 0x2402, 0x8502, 0x6402, 0xe502, 0xe401, 0xa208, 0x59ce, 0xffff,
+    0xbef7, 0xdfff, 0xbef7, 0xffff, 0x1285, 0xa602, 0x2803, 0x8003, 0xe702, 0x0004, 0x6903, 0x6703,
+    0x359e, 0xffff, 0x8006, 0xdfff, 0x8004, 0xffff, 0x000e, 0x327e, 0xce4d, 0x8e44, 0xea22, 0xad33,
+    0xcd3b, 0xed3b, 0xee3b, 0x2e44, 0xb054, 0xb054, 0x105d, 0xf05c, 0xd495, 0x8007, 0xffff, 0x001f,
+    0xdfff, 0x4732, 0x2201, 0x4201, 0x4201, 0xa309, 0x473c, 0xa844, 0x262c, 0xf295, 0xffff, 0xdfff,
+    0xffff, 0xffff, 0xbef7, 0xab64, 0x0634, 0x072c, 0xe623, 0xc61b, 0xc623, 0x0734, 0x2634, 0x4634,
+    0x463c, 0x263c, 0x263c, 0x463c, 0x463c, 0x2644, 0x3bdf, 0x8006, 0xffff, 0x0004, 0x5be7, 0x063c,
+    0xe52b, 0xe52b, 0x8003, 0xc52b, 0x0003, 0xe533, 0xe533, 0x5be7, 0x8003, 0xffff, 0x0004, 0xb5bd,
+    0x8852, 0x6329, 0x8429, 0x8004, 0xa431, 0x0008, 0x8329, 0x4021, 0x6a6b, 0x1be7, 0x57d6, 0x57d6,
+    0x54b5, 0xd6bd, 0x8012, 0xffff, 0x000a, 0x54ae, 0xa42b, 0x4644, 0x4644, 0x6544, 0x854c, 0xa54c,
+    0xc65c, 0xc55c, 0x59df, 0x8040, 0xffff, 0x0002, 0x7def, 0x7def, 0x8010, 0x7eef, 0x000b, 0x9eef,
+    0x7eef, 0x7ef7, 0x7eef, 0x7eef, 0x9ef7, 0x7eef, 0x9eef, 0x9ef7, 0x7eef, 0x7eef, 0x800d, 0x9ef7,
+    0x000f, 0x9eef, 0xe731, 0x2100, 0x6108, 0x6100, 0x6100, 0x8200, 0xa208, 0x4000, 0xae6b, 0xffff,
+    0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x8005, 0xbef7, 0x0016, 0x9ef7, 0xbff7, 0xbef7, 0xbef7, 0xbff7,
+    0xbff7, 0xbef7, 0x9ef7, 0xffff, 0x128d, 0xc401, 0x4612, 0x2512, 0x250a, 0x450a, 0x4612, 0x660a,
+    0xec53, 0xffff, 0xbef7, 0xbff7, 0xbff7, 0x8007, 0xdff7, 0x8005, 0xbff7, 0x0024, 0xdff7, 0xdff7,
+    0xbff7, 0xbef7, 0xdfff, 0x7075, 0x082c, 0x4201, 0x2201, 0x6301, 0xe301, 0x0302, 0xc301, 0xe401,
+    0x4402, 0x8502, 0xa502, 0x0603, 0xa301, 0xe731, 0xbef7, 0xdfff, 0xdfff, 0xbef7, 0xffff, 0x3084,
+    0x0201, 0x280b, 0x6903, 0x2803, 0xe702, 0x2803, 0xc602, 0xf595, 0xffff, 0xdff7, 0x8006, 0xdfff,
+    0x0007, 0xffff, 0xdfff, 0xffff, 0x537e, 0xce4c, 0x6c3b, 0x4c33, 0x8003, 0xcd3b, 0x0008, 0x2e44,
+    0x9054, 0xf05c, 0xf05c, 0x3165, 0x1165, 0x1175, 0xdef7, 0x8006, 0xffff, 0x0020, 0xdff7, 0x472a,
+    0x2201, 0x4301, 0x6301, 0x2201, 0xe622, 0xe84c, 0x262c, 0xf295, 0xffff, 0xdfff, 0xffff, 0xffff,
+    0xbef7, 0xcb64, 0x0634, 0x262c, 0x272c, 0xe623, 0xe623, 0x062c, 0x4634, 0x463c, 0x463c, 0x263c,
+    0x263c, 0x6644, 0x6644, 0x253c, 0xeb6c, 0xfeff, 0x8005, 0xffff, 0x0018, 0x7be7, 0x2644, 0x052c,
+    0xe52b, 0xc523, 0xa523, 0xa523, 0xc52b, 0x053c, 0x5ae7, 0xffff, 0xdfff, 0x93c5, 0xe872, 0xe541,
+    0x6329, 0xa431, 0x8431, 0x4321, 0x4229, 0xe539, 0x6b6b, 0x12a5, 0x1be7, 0x8017, 0xffff, 0x000a,
+    0x75b6, 0x4544, 0x664c, 0x4644, 0x6544, 0xa54c, 0x854c, 0xe664, 0xc55c, 0x59df, 0x8040, 0xffff,
+    0x0002, 0x7def, 0x7def, 0x8004, 0x7eef, 0x0001, 0x7def, 0x800a, 0x7eef, 0x0008, 0x9eef, 0x7eef,
+    0x7eef, 0x9ef7, 0x9ef7, 0x7eef, 0x9eef, 0x7eef, 0x8003, 0x9ef7, 0x0003, 0x9eef, 0x9ef7, 0x9eef,
+    0x800b, 0x9ef7, 0x0004, 0xbef7, 0x6942, 0x6100, 0xa208, 0x8003, 0x8200, 0x000a, 0xa200, 0xc200,
+    0xc200, 0xf39c, 0xdfff, 0xffff, 0xdfff, 0x9ef7, 0x9eef, 0x9ef7, 0x800a, 0xbef7, 0x0005, 0x9ef7,
+    0xffff, 0x128d, 0x8301, 0x2612, 0x8003, 0x250a, 0x0005, 0x6612, 0x450a, 0xcc53, 0xdfff, 0x9ef7,
+    0x8005, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8006, 0xbef7, 0x0025, 0xbff7, 0xdff7, 0xdff7, 0xbff7,
+    0xbef7, 0xdfff, 0x6f7d, 0xca44, 0x851a, 0xe200, 0x8301, 0xe301, 0x6302, 0xe301, 0xc301, 0x4402,
+    0x8402, 0x6402, 0xa502, 0x0603, 0x0101, 0x5084, 0xffff, 0xbef7, 0xbef7, 0xffff, 0x5184, 0x0000,
+    0xe300, 0x6702, 0x6903, 0x0803, 0x2803, 0xa602, 0xb595, 0xffff, 0xdff7, 0x8008, 0xdfff, 0x0012,
+    0xffff, 0x1386, 0x4c33, 0x6d3b, 0x6c33, 0x8d33, 0x8d33, 0x0e3c, 0xb054, 0xd05c, 0xf05c, 0x1165,
+    0x3165, 0x9275, 0x0e54, 0xd7ad, 0xffff, 0xdfff, 0x8004, 0xffff, 0x0003, 0xbef7, 0x462a, 0x4201,
+    0x8003, 0x6309, 0x000c, 0x8309, 0x483c, 0x6634, 0xf295, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7,
+    0xcb64, 0x062c, 0x262c, 0x8003, 0x2634, 0x0002, 0x4634, 0x4634, 0x8003, 0x463c, 0x0006, 0x263c,
+    0x463c, 0x6644, 0x874c, 0x443c, 0xf095, 0x8005, 0xffff, 0x0018, 0x7be7, 0x6644, 0x463c, 0x2534,
+    0x0534, 0x0534, 0xe533, 0x053c, 0x664c, 0x5ae7, 0xffff, 0x12ad, 0x265a, 0xa762, 0x264a, 0x4321,
+    0x2219, 0x6329, 0x2b63, 0xb5b5, 0x7def, 0xffff, 0xffff, 0x3be7, 0x8005, 0xdfff, 0x8012, 0xffff,
+    0x000a, 0x75b6, 0x4544, 0x864c, 0x6544, 0x8544, 0xa54c, 0xa54c, 0xc65c, 0xc45c, 0x59df, 0x8040,
+    0xffff, 0x0001, 0x7def, 0x8005, 0x7eef, 0x0001, 0x7def, 0x800a, 0x7eef, 0x000a, 0x9eef, 0x7eef,
+    0x7eef, 0x7ef7, 0x7ef7, 0x9ef7, 0x9eef, 0x7eef, 0x9ef7, 0x9eef, 0x8003, 0x9ef7, 0x8003, 0x9eef,
+    0x8008, 0x9ef7, 0x0012, 0x7eef, 0xffff, 0xce6b, 0x6000, 0xe308, 0xc200, 0xe300, 0xe200, 0xc200,
+    0xc200, 0xe200, 0xa100, 0x483a, 0xf394, 0xbad6, 0xdfff, 0xffff, 0xffff, 0x8003, 0x9ef7, 0x8006,
+    0xbef7, 0x000c, 0xbff7, 0x9ef7, 0xffff, 0x128d, 0x8301, 0x050a, 0xe509, 0x0502, 0x2502, 0x660a,
+    0x450a, 0xac4b, 0x8010, 0xffff, 0x0024, 0xdff7, 0xdfff, 0xdef7, 0xbef7, 0xdfff, 0x4e75, 0xca4c,
+    0xe943, 0x0201, 0x8301, 0xe301, 0x8402, 0x4302, 0xe301, 0x4402, 0x6402, 0x8402, 0xa502, 0xa502,
+    0x040a, 0x2311, 0x9ace, 0xffff, 0x9ef7, 0xffff, 0x718c, 0x0000, 0x8200, 0x6200, 0x2401, 0x8702,
+    0x4803, 0xc602, 0xd59d, 0xffff, 0xdef7, 0x8008, 0xdfff, 0x0012, 0xffff, 0xd06c, 0x0b2b, 0x4c33,
+    0x6c2b, 0x8d33, 0xcd3b, 0x4f4c, 0xd05c, 0xf164, 0xf164, 0x1165, 0x3165, 0xb375, 0xad43, 0x8e5b,
+    0xffff, 0xdfff, 0x8004, 0xffff, 0x0003, 0xbef7, 0x462a, 0x4201, 0x8003, 0x8309, 0x001b, 0x2201,
+    0xa522, 0x4734, 0x1296, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdef7, 0xab5c, 0x2634, 0x2734, 0x2634,
+    0x473c, 0x473c, 0x463c, 0x463c, 0x2634, 0x463c, 0x663c, 0x263c, 0x0634, 0x063c, 0x6644, 0x6644,
+    0x2544, 0x19d7, 0x8004, 0xffff, 0x0018, 0x7ce7, 0x664c, 0x4544, 0x6644, 0x864c, 0x6544, 0x4544,
+    0x664c, 0x454c, 0x7be7, 0x5bef, 0x297b, 0xc541, 0xe541, 0xa431, 0x4321, 0xea5a, 0x58c6, 0xffff,
+    0xffff, 0x3be7, 0x6f95, 0xa443, 0x2f8d, 0x8017, 0xffff, 0x000a, 0x74b6, 0x4544, 0x864c, 0x864c,
+    0xa54c, 0xa54c, 0xc654, 0xe65c, 0xa454, 0x39df, 0x8040, 0xffff, 0x0002, 0x7def, 0x7def, 0x8003,
+    0x7eef, 0x0002, 0x7def, 0x7def, 0x800e, 0x7eef, 0x0003, 0x9ef7, 0x9eef, 0x9eef, 0x8003, 0x9ef7,
+    0x0005, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x8009, 0x9ef7, 0x0017, 0x7eef, 0xdfff, 0xf7bd,
+    0x8100, 0xc208, 0xc200, 0xc200, 0xe300, 0xe300, 0xc200, 0xe300, 0x0301, 0xa200, 0x8100, 0x0309,
+    0x8942, 0x918c, 0x79ce, 0xdfff, 0xffff, 0xdfff, 0x9ef7, 0x9ef7, 0x8005, 0xbef7, 0x0036, 0x9ef7,
+    0xffff, 0xf284, 0x6301, 0x050a, 0xe501, 0xe501, 0x0502, 0x2502, 0x660a, 0xa722, 0x4942, 0x894a,
+    0x6942, 0x6c53, 0x3075, 0xce64, 0xaf64, 0xcf6c, 0xaf6c, 0x8c53, 0x8c53, 0x6c53, 0x0b4b, 0x0b4b,
+    0x8942, 0x54a5, 0xffff, 0xbef7, 0xdff7, 0xbff7, 0xdfff, 0x4e75, 0x8944, 0x0b5d, 0xe411, 0x2201,
+    0xc301, 0x8402, 0x0613, 0x040a, 0x4402, 0x6402, 0x8402, 0x8402, 0x6402, 0x850a, 0x0209, 0x8942,
+    0xdef7, 0xbef7, 0xffff, 0x718c, 0x0000, 0x8003, 0x6200, 0x001f, 0xa300, 0x6501, 0x2502, 0xd59d,
+    0xffff, 0xbef7, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x2f5c,
+    0xeb2a, 0x0b2b, 0x4c2b, 0x4c2b, 0x2f44, 0x9054, 0xb054, 0xf15c, 0xd05c, 0x115d, 0x315d, 0x3165,
+    0x2b33, 0xc819, 0x3ce7, 0x8005, 0xffff, 0x0022, 0xbef7, 0x462a, 0x4201, 0x8309, 0x8309, 0x6309,
+    0x8309, 0x8309, 0x862b, 0x139e, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdef7, 0xcb64, 0x0634, 0x2734,
+    0x2634, 0x2734, 0x0734, 0x2734, 0x4634, 0xea5c, 0x6744, 0x663c, 0x463c, 0x2634, 0xe533, 0x263c,
+    0x453c, 0x4544, 0xc964, 0xbef7, 0x8003, 0xffff, 0x0022, 0x7cef, 0x6654, 0x6544, 0x864c, 0x4544,
+    0x6544, 0x654c, 0x454c, 0x854c, 0x38df, 0x13de, 0x2873, 0xa439, 0xa439, 0xe639, 0x95b5, 0xffff,
+    0xffff, 0xf9d6, 0xab7c, 0x633b, 0x422b, 0x422b, 0x285c, 0xb19d, 0x9095, 0xb09d, 0xb095, 0xb09d,
+    0xb09d, 0x9095, 0xb09d, 0x9095, 0x7095, 0x8004, 0x508d, 0x0003, 0x518d, 0x508d, 0x9def, 0x8006,
+    0xffff, 0x000a, 0x74b6, 0x654c, 0xa64c, 0x854c, 0xc654, 0xa554, 0xa554, 0xc654, 0xc55c, 0x59df,
+    0x8040, 0xffff, 0x0006, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x800b, 0x7eef, 0x0006,
+    0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x9eef, 0x7eef, 0x8003, 0x9eef, 0x0006, 0x9ef7, 0x9eef, 0x9eef,
+    0x9ef7, 0x9eef, 0x9eef, 0x800a, 0x9ef7, 0x0017, 0x7eef, 0xbff7, 0x8942, 0x6100, 0xe308, 0xa200,
+    0xc200, 0xe200, 0xc200, 0xe200, 0x0301, 0x0301, 0xc300, 0xc200, 0x6100, 0x4100, 0xc308, 0x283a,
+    0x718c, 0xfbde, 0xffff, 0xdfff, 0x9ef7, 0x8004, 0xbef7, 0x0036, 0x9ef7, 0xffff, 0xf28c, 0x4301,
+    0xc501, 0xc401, 0xc501, 0xe501, 0x0502, 0x460a, 0xa712, 0xe200, 0x0000, 0x0000, 0x8100, 0xe933,
+    0xe61a, 0x6823, 0x8823, 0x8723, 0x8201, 0x0101, 0x2101, 0xa100, 0x6100, 0x0000, 0x107c, 0xffff,
+    0x9ef7, 0xdfff, 0xbff7, 0xdfff, 0x6f7d, 0xa954, 0x2b5d, 0xa733, 0xe100, 0xc301, 0x6302, 0xea3b,
+    0xd17c, 0xe201, 0x8402, 0x8402, 0x6402, 0x6402, 0x4402, 0xa411, 0xe100, 0xd28c, 0xffff, 0xffff,
+    0x718c, 0x2100, 0x8003, 0x6200, 0x0006, 0x8300, 0xc400, 0x4100, 0x349d, 0xffff, 0xbef7, 0x8008,
+    0xdfff, 0x0009, 0xffff, 0xce53, 0x8922, 0x4c33, 0x2c2b, 0x2c2b, 0xee3b, 0xb054, 0xd05c, 0x8003,
+    0xf05c, 0x0007, 0x5165, 0x1065, 0x4922, 0x8709, 0x759d, 0xffff, 0xdfff, 0x8003, 0xffff, 0x000a,
+    0xbef7, 0x472a, 0x4201, 0x8309, 0x6309, 0x6309, 0x8309, 0x4309, 0x4412, 0x74a6, 0x8004, 0xffff,
+    0x0014, 0xdeff, 0xab5c, 0x062c, 0x2734, 0x2634, 0x0734, 0x0734, 0x2734, 0x052c, 0x95b6, 0xb08d,
+    0x0534, 0x663c, 0x463c, 0x263c, 0x263c, 0x253c, 0x6644, 0x243c, 0xb08d, 0x8003, 0xffff, 0x001a,
+    0x7ce7, 0x6654, 0x864c, 0x654c, 0x454c, 0x654c, 0x854c, 0xc554, 0x654c, 0x6d8c, 0x2d9c, 0x6ca4,
+    0xc439, 0x0642, 0x9ad6, 0xffff, 0xdef7, 0x2f8d, 0x633b, 0x4233, 0x833b, 0x843b, 0x843b, 0x4333,
+    0x012b, 0x8233, 0x8003, 0xa23b, 0x000c, 0x823b, 0x623b, 0x8233, 0x622b, 0x2223, 0x031b, 0xe312,
+    0xa20a, 0xc212, 0x231b, 0x6423, 0x3bdf, 0x8006, 0xffff, 0x0004, 0x74b6, 0x644c, 0xa64c, 0xa54c,
+    0x8003, 0xa554, 0x0003, 0x065d, 0xe55c, 0x39df, 0x8040, 0xffff, 0x0008, 0x7def, 0x7eef, 0x7def,
+    0x7def, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x800f, 0x7eef, 0x0001, 0x9eef, 0x8003, 0x7eef, 0x8004,
+    0x9eef, 0x0002, 0x9ef7, 0x9eef, 0x8009, 0x9ef7, 0x000d, 0x7eef, 0xdfff, 0x39c6, 0xc208, 0xa200,
+    0xc308, 0xc300, 0xe300, 0xe200, 0xc200, 0xc200, 0xe300, 0xa200, 0x8003, 0xc200, 0x0008, 0xa200,
+    0x6100, 0x4000, 0x0411, 0x6d63, 0xdbde, 0xffff, 0x9ef7, 0x8003, 0xbef7, 0x0004, 0x9ef7, 0xffff,
+    0xd284, 0x2301, 0x8003, 0x8401, 0x0024, 0xa401, 0xe501, 0x2602, 0x8712, 0x871a, 0x8208, 0x4100,
+    0xa208, 0x0a3c, 0xe61a, 0xa61a, 0x2a34, 0x2a34, 0x4512, 0x4201, 0xa301, 0x6301, 0xc308, 0x6100,
+    0x707c, 0xffff, 0xbef7, 0xbff7, 0xbff7, 0xdfff, 0x6f7d, 0xa954, 0xca54, 0x0b65, 0xc311, 0x8201,
+    0x6402, 0x882b, 0x7def, 0x693b, 0x0202, 0x8004, 0x4402, 0x0008, 0xa311, 0x4311, 0x6419, 0xbad6,
+    0xffff, 0x928c, 0x2000, 0x8200, 0x8003, 0x6200, 0x0005, 0xa300, 0x4200, 0x149d, 0xffff, 0xbef7,
+    0x8008, 0xdfff, 0x0009, 0xffff, 0x6c4b, 0xc711, 0x6d33, 0x0b23, 0x2b2b, 0x2e44, 0x6f4c, 0xd05c,
+    0x8003, 0x105d, 0x0005, 0x916d, 0x8f54, 0xe819, 0xc811, 0x8e53, 0x8005, 0xffff, 0x0003, 0xdef7,
+    0x472a, 0x2201, 0x8005, 0x6309, 0x000a, 0x4201, 0x9295, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdff7,
+    0xab5c, 0x2634, 0x4734, 0x8003, 0x2734, 0x0039, 0x483c, 0xc523, 0x13a6, 0xdeff, 0x6954, 0x463c,
+    0x4644, 0x263c, 0x063c, 0x263c, 0x453c, 0x6644, 0x253c, 0xb6be, 0xffff, 0xffff, 0x7cef, 0x6654,
+    0x654c, 0x454c, 0x654c, 0x654c, 0xc554, 0xe543, 0x4311, 0x8fa4, 0xec93, 0x4c9c, 0xe76a, 0xd6bd,
+    0xffff, 0xb8ce, 0x0854, 0x222b, 0x833b, 0x843b, 0x833b, 0x633b, 0x833b, 0x833b, 0xa443, 0x244c,
+    0xe34b, 0xe34b, 0xe443, 0xc343, 0xc443, 0xc443, 0x8433, 0x652b, 0x2523, 0x051b, 0x4523, 0xa62b,
+    0xe633, 0x452b, 0x3bdf, 0x8006, 0xffff, 0x000a, 0x94be, 0x6444, 0xa654, 0xa64c, 0xc554, 0xc554,
+    0xe55c, 0x055d, 0xe55c, 0x39df, 0x8040, 0xffff, 0x8003, 0x7def, 0x8007, 0x7eef, 0x0002, 0x7def,
+    0x7def, 0x800d, 0x7eef, 0x8007, 0x9eef, 0x0003, 0x9ef7, 0x9eef, 0x9eef, 0x8008, 0x9ef7, 0x000e,
+    0x7eef, 0xffff, 0x349d, 0x8100, 0x8200, 0xe308, 0xe200, 0xe200, 0xe300, 0xc200, 0xe300, 0xc200,
+    0xc200, 0xe200, 0x8003, 0xa200, 0x0006, 0xc300, 0x8200, 0x2000, 0xe410, 0x149d, 0xffff, 0x8003,
+    0xbef7, 0x0037, 0x9ef7, 0xffff, 0xd284, 0x0201, 0x8401, 0x8401, 0x6401, 0x8401, 0xc501, 0xe501,
+    0x460a, 0xa71a, 0xa509, 0x2000, 0x4100, 0x6833, 0x0934, 0x4209, 0x682b, 0x4a34, 0xc61a, 0xe200,
+    0x8301, 0x8301, 0x4301, 0x4000, 0x507c, 0xffff, 0x9ef7, 0xbff7, 0xbef7, 0xdfff, 0x4f7d, 0xc954,
+    0x694c, 0x4c6d, 0xe953, 0x2101, 0xc50a, 0x6833, 0xbef7, 0x99c6, 0x440a, 0x2302, 0xe301, 0x0302,
+    0x4402, 0xa309, 0x6311, 0x2201, 0x0a4b, 0xffff, 0x928c, 0x2100, 0x8200, 0x8003, 0x6200, 0x0005,
+    0xa308, 0x2100, 0x149d, 0xffff, 0xbef7, 0x8008, 0xdfff, 0x0012, 0xffff, 0xce53, 0x8509, 0x0b33,
+    0x6c33, 0xea22, 0xce3b, 0x6f4c, 0xb054, 0xf05c, 0xf05c, 0x3065, 0x716d, 0x8e4c, 0x081a, 0xe819,
+    0x6a2a, 0x5de7, 0x8004, 0xffff, 0x0003, 0xdef7, 0x472a, 0x2201, 0x8004, 0x6309, 0x0031, 0x8411,
+    0x0101, 0x907c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdff7, 0xab5c, 0x062c, 0x2734, 0x272c, 0x2734,
+    0x2734, 0x473c, 0xe52b, 0xf295, 0xffff, 0xb7c6, 0x063c, 0x4744, 0x4644, 0x263c, 0x263c, 0x463c,
+    0x664c, 0x4644, 0x6854, 0x9cef, 0xffff, 0x5be7, 0x6654, 0x654c, 0x454c, 0x454c, 0xa54c, 0x653b,
+    0xc210, 0xa310, 0x31d6, 0xf1d5, 0x6a83, 0xf5c5, 0xffff, 0xdeff, 0xe75b, 0x022b, 0x843b, 0x643b,
+    0x8003, 0x633b, 0x0013, 0x833b, 0xa33b, 0xc343, 0xe343, 0xc343, 0xe343, 0xe343, 0xa343, 0x833b,
+    0x642b, 0x4423, 0x0423, 0xe41a, 0x4523, 0x862b, 0x652b, 0xc422, 0xa422, 0x3bdf, 0x8006, 0xffff,
+    0x000a, 0x74b6, 0x844c, 0xc654, 0xc654, 0xc554, 0xe554, 0xc554, 0xe55c, 0xe55c, 0x39df, 0x8040,
+    0xffff, 0x8003, 0x7def, 0x8007, 0x7eef, 0x0001, 0x7def, 0x800e, 0x7eef, 0x0008, 0x9eef, 0x9ef7,
+    0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x9ef7, 0x8003, 0x9eef, 0x8008, 0x9ef7, 0x0008, 0x7eef,
+    0xffff, 0xd7b5, 0x8621, 0x6000, 0xc200, 0x0301, 0xe300, 0x8003, 0xe200, 0x004d, 0xc200, 0xe200,
+    0xc200, 0x8200, 0x8200, 0xa200, 0xa200, 0xc300, 0x8200, 0x6100, 0x307c, 0xffff, 0x9ef7, 0xbef7,
+    0x9ef7, 0xffff, 0xd38c, 0x0201, 0xa501, 0x8401, 0x6401, 0x6401, 0x8401, 0xa401, 0xe501, 0x660a,
+    0x8712, 0xa200, 0x0000, 0xc72a, 0x6a3c, 0x8309, 0x0412, 0x6a3c, 0xa82b, 0x8301, 0x0201, 0x8301,
+    0xa401, 0x6000, 0x2f74, 0xffff, 0xbef7, 0xbff7, 0xbef7, 0xdfff, 0x4f7d, 0xea54, 0x6944, 0xcb5c,
+    0x8d85, 0xa201, 0xc50a, 0x883b, 0x3be7, 0xffff, 0x6f6c, 0xe201, 0xe301, 0x0302, 0xc512, 0x851a,
+    0x4209, 0x8311, 0xe100, 0x74a5, 0x75ad, 0x0000, 0x8200, 0x6200, 0x6300, 0x6200, 0x6200, 0x0100,
+    0x349d, 0xffff, 0xbef7, 0x8008, 0xdfff, 0x0019, 0xffff, 0x5375, 0x8609, 0xca2a, 0x4c2b, 0x0b2b,
+    0x2b23, 0x0e3c, 0xd054, 0xd05c, 0x3165, 0x7175, 0xf064, 0x4d44, 0xca22, 0x081a, 0x081a, 0x18b6,
+    0xffff, 0xdfff, 0xffff, 0xffff, 0xdef7, 0x472a, 0x4301, 0x8004, 0x6309, 0x0016, 0x8411, 0x0201,
+    0x707c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7, 0xab5c, 0x0634, 0x2734, 0x2734, 0x4734, 0x4734,
+    0x473c, 0xe52b, 0xf29d, 0xffff, 0xffff, 0x9095, 0xe533, 0x4744, 0x8003, 0x263c, 0x002e, 0x4644,
+    0x464c, 0x2544, 0x4d85, 0xffff, 0x7cef, 0x6654, 0x654c, 0xa654, 0x864c, 0xc42a, 0xa310, 0x8208,
+    0x2421, 0x0fd6, 0x0fde, 0x72bd, 0xffff, 0xffff, 0xdeff, 0xe753, 0x4333, 0x643b, 0x4333, 0x633b,
+    0x633b, 0x833b, 0xc343, 0xe34b, 0xe34b, 0xc343, 0xe343, 0xe343, 0xe443, 0xa343, 0x442b, 0x0423,
+    0x041b, 0x041b, 0x4523, 0x652b, 0xc422, 0x6322, 0xa422, 0xe52a, 0x3bdf, 0x8006, 0xffff, 0x0004,
+    0x74b6, 0xa34c, 0xc65c, 0xc554, 0x8004, 0xe55c, 0x0002, 0xc55c, 0x39df, 0x8040, 0xffff, 0x8003,
+    0x7def, 0x800f, 0x7eef, 0x0001, 0x9eef, 0x8006, 0x7eef, 0x8004, 0x9ef7, 0x0001, 0x9eef, 0x8003,
+    0x9ef7, 0x0001, 0x9eef, 0x800b, 0x9ef7, 0x001c, 0x7eef, 0xffff, 0x3de7, 0x0f74, 0x4411, 0x6000,
+    0x8100, 0xc200, 0x0301, 0x0301, 0xe300, 0xe300, 0xc200, 0xa200, 0x8200, 0x8200, 0xa200, 0xc200,
+    0xc200, 0xe300, 0x8100, 0x1395, 0xffff, 0x9ef7, 0x9ef7, 0xffff, 0xf38c, 0x0201, 0x8004, 0x8401,
+    0x0037, 0x6401, 0x8401, 0xe501, 0x460a, 0xc712, 0x8409, 0x0000, 0x2522, 0x4a3c, 0x661a, 0x2301,
+    0xea33, 0x4a3c, 0x6823, 0xa301, 0x6301, 0xe409, 0xe100, 0x2f74, 0xffff, 0x9ef7, 0xdff7, 0xbef7,
+    0xdfff, 0x2f75, 0x2a5d, 0x8a4c, 0x694c, 0x4fa6, 0xc52a, 0x6402, 0x8833, 0x5ce7, 0xffff, 0x5cef,
+    0x661a, 0xe301, 0xa512, 0x4623, 0xe622, 0x041a, 0x6309, 0x2201, 0x052a, 0xb294, 0x4200, 0x8300,
+    0x6200, 0x4200, 0x4100, 0xc611, 0x460a, 0x749d, 0xffff, 0xbef7, 0x8009, 0xdfff, 0x0018, 0xb47d,
+    0x8609, 0x6a22, 0xce43, 0x2c2b, 0x2c2b, 0x6c2b, 0xcd33, 0x316d, 0x559e, 0x4f54, 0xed43, 0x0d3c,
+    0x4b33, 0x081a, 0xe711, 0xd284, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x4732, 0x2309, 0x8004,
+    0x6309, 0x0035, 0x8411, 0x0201, 0x707c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7, 0x6a54, 0xe62b,
+    0x473c, 0x4734, 0x273c, 0x673c, 0x4744, 0xe52b, 0xf29d, 0xffff, 0xffff, 0xbef7, 0x8a5c, 0x263c,
+    0x2644, 0x263c, 0x463c, 0x4644, 0x664c, 0x8654, 0x2444, 0x95be, 0xdef7, 0x454c, 0x654c, 0x464c,
+    0xe319, 0x8208, 0xa310, 0xc310, 0xc318, 0x10d6, 0xefd5, 0x3bef, 0xffff, 0xffff, 0xdeff, 0xe753,
+    0x2333, 0x443b, 0x2333, 0x633b, 0x8443, 0xa343, 0xe34b, 0x8003, 0x034c, 0x000f, 0xe34b, 0xe44b,
+    0xc443, 0x843b, 0x452b, 0x2523, 0x051b, 0xe41a, 0xe522, 0xa41a, 0xc422, 0x052b, 0x252b, 0x2633,
+    0x5ce7, 0x8006, 0xffff, 0x000a, 0x94be, 0xa454, 0xe55c, 0xe55c, 0x0565, 0x0465, 0x055d, 0x055d,
+    0xa55c, 0x39df, 0x8040, 0xffff, 0x0004, 0x7def, 0x7def, 0x7eef, 0x7def, 0x8003, 0x7eef, 0x0001,
+    0x7def, 0x800a, 0x7eef, 0x0001, 0x9eef, 0x8003, 0x7eef, 0x0008, 0x9eef, 0x9eef, 0x7eef, 0x9eef,
+    0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x8010, 0x9ef7, 0x0056, 0x7eef, 0xbef7, 0xffff, 0x1cdf, 0xd294,
+    0x6942, 0xe308, 0x4000, 0x8100, 0x0201, 0x0301, 0xe300, 0xc200, 0xa200, 0xa200, 0xc200, 0xc200,
+    0xa200, 0xe300, 0x0301, 0x4409, 0xdbd6, 0xdfff, 0x9ef7, 0xffff, 0xf38c, 0x2301, 0x8401, 0x6401,
+    0x6401, 0x8401, 0xa501, 0xc501, 0xc509, 0xe401, 0x4502, 0x050a, 0x0000, 0x4209, 0xa72b, 0x271b,
+    0x0201, 0x8512, 0xe92b, 0xc82b, 0xe612, 0x6201, 0x8201, 0x0001, 0x9074, 0xffff, 0xbef7, 0xbff7,
+    0xdef7, 0xdfff, 0xb085, 0x6b6d, 0x6a4c, 0x4944, 0x6fa6, 0xc85b, 0x0302, 0x682b, 0x3ce7, 0xffff,
+    0xffff, 0xd5ad, 0xe301, 0x872b, 0xc733, 0xa522, 0xc522, 0x8522, 0x0412, 0x8209, 0x062a, 0x8200,
+    0x4200, 0x4200, 0x4409, 0x692b, 0xee44, 0x6502, 0x7495, 0xffff, 0xbef7, 0x8009, 0xdfff, 0x0018,
+    0x158e, 0xaa22, 0xa400, 0xce43, 0x2f4c, 0x2c2b, 0x6c33, 0x2b2b, 0xed43, 0x937d, 0xcd3b, 0x8c33,
+    0xcc33, 0x2b2b, 0x281a, 0x0812, 0xef63, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x6732, 0x2201,
+    0x8004, 0x6309, 0x000a, 0x8411, 0x0201, 0x707c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdeff, 0x0a4c,
+    0xc523, 0x8003, 0x473c, 0x001c, 0x6744, 0x473c, 0xe52b, 0xf29d, 0xffff, 0xdfff, 0xffff, 0xf9ce,
+    0x063c, 0x273c, 0x263c, 0x4644, 0x664c, 0x664c, 0x864c, 0x654c, 0x6754, 0x3adf, 0xe964, 0x042b,
+    0x2211, 0x6208, 0xa310, 0xc310, 0xc310, 0xa310, 0xb09c, 0x9bf7, 0x8003, 0xffff, 0x001b, 0xdeff,
+    0x0754, 0x2433, 0x643b, 0x643b, 0x843b, 0xc343, 0xe343, 0x4354, 0x4254, 0xe14b, 0xe14b, 0xa143,
+    0x6233, 0x022b, 0xe222, 0xa312, 0xa30a, 0x4202, 0x420a, 0x220a, 0x620a, 0x8212, 0x8212, 0xa312,
+    0xc422, 0x3be7, 0x8006, 0xffff, 0x000a, 0x94be, 0xa354, 0x0565, 0x0465, 0x0465, 0x2565, 0x0565,
+    0x8554, 0x244c, 0x19d7, 0x8040, 0xffff, 0x0006, 0x7def, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7def,
+    0x8008, 0x7eef, 0x0001, 0x7def, 0x8007, 0x7eef, 0x8006, 0x9eef, 0x8006, 0x9ef7, 0x8003, 0x9eef,
+    0x800b, 0x9ef7, 0x000c, 0x7eef, 0xbff7, 0xffff, 0xdfff, 0xbbd6, 0xb394, 0xcb4a, 0x6411, 0x8100,
+    0x8100, 0xc200, 0xe300, 0x8004, 0xc200, 0x0019, 0xe300, 0x4301, 0xc100, 0x0f74, 0xffff, 0x7def,
+    0xffff, 0xf38c, 0x2301, 0x8401, 0x4301, 0x6401, 0x8401, 0x4401, 0xe200, 0x2732, 0x17b6, 0x17b6,
+    0x38be, 0xb6b5, 0xd7b5, 0x57be, 0x77be, 0x16b6, 0x17b6, 0x8003, 0x78be, 0x0028, 0x17b6, 0xf7b5,
+    0xd7b5, 0xfbd6, 0xdfff, 0xbef7, 0xbff7, 0xdef7, 0xdfff, 0xb08d, 0xc954, 0x2944, 0x2944, 0xee8d,
+    0x0b7d, 0x0302, 0x0723, 0x1bdf, 0xffff, 0xbef7, 0xffff, 0x6e6c, 0xe72b, 0x2944, 0xa522, 0xc622,
+    0xc522, 0x441a, 0x6412, 0x4201, 0x8100, 0x6409, 0x4923, 0xac3c, 0x4e4d, 0x8923, 0xc301, 0xb59d,
+    0xffff, 0xdef7, 0x8009, 0xdfff, 0x0011, 0x148e, 0x2e44, 0xe500, 0x4609, 0xd164, 0x6f54, 0x4c2b,
+    0x6c33, 0x0b2b, 0x4f44, 0xed3b, 0xea22, 0xca22, 0x491a, 0x2922, 0x281a, 0xae53, 0x8004, 0xffff,
+    0x0003, 0xdef7, 0x6732, 0x2201, 0x8004, 0x6309, 0x0011, 0x8411, 0x0201, 0x707c, 0xffff, 0xdfff,
+    0xffff, 0xffff, 0xdfff, 0x8a3b, 0x2513, 0x2734, 0x673c, 0x673c, 0x473c, 0x473c, 0x052c, 0xf29d,
+    0x8004, 0xffff, 0x000d, 0xd195, 0xc52b, 0x273c, 0x273c, 0x473c, 0x6744, 0x6644, 0x874c, 0x8644,
+    0xeb6c, 0xe742, 0x6100, 0xa210, 0x8003, 0xa310, 0x0003, 0xe310, 0xe310, 0x18c6, 0x8004, 0xffff,
+    0x001b, 0xdeff, 0xe753, 0x643b, 0x8543, 0x843b, 0xc343, 0xe343, 0x244c, 0x234c, 0xc874, 0x12b6,
+    0xf2ad, 0xd2a5, 0xd2a5, 0xb29d, 0x929d, 0x7295, 0x5295, 0x5295, 0x739d, 0x529d, 0x729d, 0x5295,
+    0x5295, 0x7295, 0x729d, 0x9df7, 0x8006, 0xffff, 0x000a, 0x73b6, 0x8254, 0x0565, 0xe564, 0xe564,
+    0xa45c, 0x444c, 0x044c, 0x044c, 0x19df, 0x8040, 0xffff, 0x0002, 0x7def, 0x7def, 0x8003, 0x7eef,
+    0x0001, 0x7def, 0x8008, 0x7eef, 0x0002, 0x7def, 0x7def, 0x8008, 0x7eef, 0x8004, 0x9eef, 0x8004,
+    0x9ef7, 0x0004, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x800e, 0x9ef7, 0x001e, 0x7eef, 0x9ef7, 0xdfff,
+    0xffff, 0xffff, 0x1cdf, 0x55a5, 0x2c5b, 0x0309, 0xa200, 0x0301, 0xc200, 0xc200, 0xe300, 0x0301,
+    0x6401, 0x2301, 0x282a, 0x9ef7, 0x9ef7, 0xffff, 0xf38c, 0x2301, 0x8401, 0x6401, 0x6401, 0x2301,
+    0xa200, 0x8100, 0x693a, 0x8010, 0xffff, 0x0024, 0xdff7, 0xdfff, 0xdfff, 0xdeff, 0xdfff, 0xee6c,
+    0xe733, 0x293c, 0x2944, 0x4c6d, 0xee95, 0x4402, 0x6512, 0x1cdf, 0xffff, 0xdef7, 0xffff, 0x7def,
+    0xab54, 0xa733, 0xa522, 0xc622, 0xa522, 0x441a, 0x6512, 0xc61a, 0xc92b, 0x0c3d, 0x4d3d, 0x2d3d,
+    0xea2b, 0x2502, 0x0402, 0xb5a5, 0xffff, 0xdef7, 0x8009, 0xdfff, 0x0011, 0xf48d, 0x105d, 0xe909,
+    0xa500, 0x8709, 0x9375, 0x0e44, 0x2c2b, 0x4c33, 0x6d33, 0xb15c, 0x0e4c, 0x2e4c, 0x6c3b, 0x081a,
+    0x081a, 0xae53, 0x8004, 0xffff, 0x0003, 0xdef7, 0x6732, 0x4201, 0x8004, 0x6309, 0x0011, 0x8411,
+    0x2201, 0x707c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x493b, 0x4402, 0x8623, 0x4734, 0x6844,
+    0x673c, 0x6744, 0x052c, 0xf29d, 0x8004, 0xffff, 0x0003, 0xdef7, 0x8a5c, 0x0634, 0x8003, 0x473c,
+    0x000d, 0x6744, 0x6744, 0x2533, 0x2209, 0x8208, 0xc308, 0xa208, 0xa308, 0xa308, 0xa310, 0xc310,
+    0x0419, 0xfbde, 0x8004, 0xffff, 0x000a, 0xdeff, 0x0754, 0x633b, 0xa443, 0xc343, 0x0344, 0x444c,
+    0x4454, 0xc243, 0x6e8d, 0x8017, 0xffff, 0x000a, 0x73be, 0x8254, 0x0565, 0x0565, 0xa55c, 0x444c,
+    0x0444, 0x254c, 0x044c, 0x19d7, 0x8040, 0xffff, 0x0004, 0x7def, 0x7def, 0x7eef, 0x7def, 0x8003,
+    0x7eef, 0x8003, 0x7def, 0x800f, 0x7eef, 0x8003, 0x9eef, 0x0001, 0x7eef, 0x8003, 0x9ef7, 0x0004,
+    0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x800a, 0x9ef7, 0x0002, 0x7eef, 0x9eef, 0x8005, 0x9ef7, 0x001c,
+    0x9eef, 0x9eef, 0xbff7, 0xffff, 0xffff, 0x9ace, 0x2832, 0xa200, 0xe300, 0xe200, 0xe300, 0x0301,
+    0x6301, 0x4301, 0x6401, 0xbad6, 0xdfff, 0xffff, 0xf38c, 0x4301, 0xc501, 0x8501, 0x2301, 0x8100,
+    0xa200, 0x6100, 0x483a, 0xbef7, 0x8004, 0x9ef7, 0x800b, 0xbef7, 0x8003, 0xdfff, 0x0021, 0xdef7,
+    0xdfff, 0xad64, 0x0734, 0x283c, 0x093c, 0xaa54, 0x70a6, 0xe411, 0x6309, 0x1cdf, 0xffff, 0xdfff,
+    0xbef7, 0xffff, 0x36b6, 0xa41a, 0xc622, 0x851a, 0x4412, 0x450a, 0x650a, 0x0d3d, 0x6e3d, 0x2d3d,
+    0x0d3d, 0xa923, 0x2402, 0x4502, 0x0302, 0xb59d, 0xffff, 0xbef7, 0x8009, 0xdfff, 0x0011, 0xf48d,
+    0x7065, 0x0b23, 0xe600, 0xa500, 0x2f54, 0xf7a6, 0x8c33, 0xeb2a, 0x0c2b, 0xf164, 0x1586, 0x5696,
+    0x2f54, 0xe811, 0x0812, 0xae53, 0x8004, 0xffff, 0x0003, 0xbef7, 0x472a, 0x4201, 0x8004, 0x6309,
+    0x0011, 0x8411, 0x0201, 0x707c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbeff, 0x293b, 0x2402, 0x6402,
+    0x8623, 0x673c, 0x673c, 0x8844, 0x0534, 0xf295, 0x8005, 0xffff, 0x0012, 0xf9ce, 0xe633, 0x273c,
+    0x673c, 0x873c, 0xc63b, 0xc419, 0xa208, 0xa208, 0xc208, 0xa208, 0xa208, 0xa308, 0xa308, 0xc310,
+    0xc310, 0x0419, 0xdad6, 0x8004, 0xffff, 0x000c, 0xdef7, 0x075c, 0x833b, 0xc443, 0xe343, 0x244c,
+    0x044c, 0xc343, 0x623b, 0x4d85, 0xffff, 0xdfff, 0x8015, 0xffff, 0x000a, 0x73b6, 0x2244, 0xc55c,
+    0xa554, 0x2444, 0xe343, 0x0444, 0x244c, 0xa343, 0xf9d6, 0x8040, 0xffff, 0x0003, 0x7def, 0x7eef,
+    0x7def, 0x8005, 0x7eef, 0x0003, 0x7def, 0x7eef, 0x7def, 0x800c, 0x7eef, 0x0009, 0x9eef, 0x7eef,
+    0x9eef, 0x7eef, 0x9eef, 0x7eef, 0x9eef, 0x9ef7, 0x9eef, 0x800d, 0x9ef7, 0x0004, 0x9eef, 0xffff,
+    0xbef7, 0x7eef, 0x8007, 0x9ef7, 0x001a, 0x7eef, 0x7def, 0xffff, 0xfbde, 0x6411, 0xc200, 0x0301,
+    0x0301, 0x6301, 0x6301, 0x6401, 0x2301, 0x17be, 0xffff, 0xffff, 0xf28c, 0x2301, 0xc501, 0x8401,
+    0x0301, 0x8100, 0xa200, 0x4000, 0x483a, 0xdff7, 0x9ef7, 0x8003, 0xbef7, 0x8006, 0xbff7, 0x0004,
+    0xdef7, 0xbff7, 0xdff7, 0xbff7, 0x8004, 0xdfff, 0x0021, 0xdef7, 0xdfff, 0xed6c, 0x073c, 0x083c,
+    0xe833, 0x283c, 0x6c75, 0x6522, 0x6309, 0x3ce7, 0xffff, 0xdfff, 0xdfff, 0xdef7, 0xdfff, 0xec5b,
+    0x240a, 0x850a, 0x2402, 0x0402, 0xe401, 0xc612, 0xc923, 0x891b, 0xa60a, 0x0402, 0x4402, 0x8502,
+    0xa301, 0x959d, 0xffff, 0xbef7, 0x8009, 0xdfff, 0x0018, 0xd385, 0x9065, 0x0e3c, 0x2701, 0x2701,
+    0xc909, 0x18af, 0xf58d, 0x2c2b, 0xab22, 0x691a, 0xca22, 0x2b2b, 0x8922, 0xe819, 0xc711, 0xef63,
+    0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7, 0x462a, 0x4209, 0x8004, 0x6309, 0x0011, 0x8411, 0x0201,
+    0x7084, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdeff, 0x4943, 0x2402, 0x4502, 0x4402, 0x661b, 0x473c,
+    0x683c, 0x052c, 0xf29d, 0x8006, 0xffff, 0x0007, 0xd295, 0x052c, 0xa844, 0xc52a, 0x0311, 0xa208,
+    0xe310, 0x8004, 0xc310, 0x0006, 0xa308, 0xa308, 0xc310, 0xc310, 0x0419, 0xfbde, 0x8004, 0xffff,
+    0x000a, 0xdef7, 0x075c, 0x8343, 0xc443, 0xe343, 0xa343, 0x833b, 0x8343, 0x6233, 0x4d8d, 0x8017,
+    0xffff, 0x000a, 0x73b6, 0x2344, 0x244c, 0x0444, 0x0444, 0x044c, 0x044c, 0x8443, 0x433b, 0xf9d6,
+    0x8040, 0xffff, 0x0004, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x8004, 0x7eef, 0x8003, 0x7def, 0x8010,
+    0x7eef, 0x0002, 0x9eef, 0x9eef, 0x8003, 0x9ef7, 0x0004, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x8009,
+    0x9ef7, 0x0006, 0x7def, 0xcf73, 0xfcde, 0xffff, 0x9eef, 0x9eef, 0x8007, 0x9ef7, 0x001a, 0x7def,
+    0xffff, 0xea4a, 0x6100, 0xe300, 0x2301, 0x4301, 0x4301, 0x6401, 0x0201, 0xf7bd, 0xffff, 0xffff,
+    0xd28c, 0xc200, 0xc501, 0x6401, 0xc200, 0x6100, 0x8200, 0x4000, 0x2732, 0xbff7, 0x9ef7, 0xbef7,
+    0xbff7, 0x8003, 0xbef7, 0x8008, 0xbff7, 0x8004, 0xdff7, 0x0021, 0xbef7, 0xdfff, 0xcd64, 0xc733,
+    0xe83b, 0xc833, 0xe83b, 0x283c, 0xa51a, 0x8309, 0x3cdf, 0xffff, 0xdfff, 0xdfff, 0xdef7, 0xffff,
+    0xfbde, 0xa409, 0xc301, 0x2402, 0x4402, 0x4402, 0x0402, 0xe301, 0xc301, 0x4502, 0x6502, 0x6502,
+    0x2502, 0x8201, 0x57be, 0xffff, 0xdff7, 0x8009, 0xdfff, 0x0019, 0xd385, 0x4f5d, 0xcf4c, 0x8801,
+    0x6801, 0xc600, 0x0f4c, 0x7ac7, 0xf58d, 0xd164, 0x2f54, 0x2c33, 0x4c33, 0x4922, 0xc819, 0x8609,
+    0x1495, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7, 0x462a, 0x6209, 0x8309, 0x8003, 0x6309, 0x0011,
+    0x6311, 0x0101, 0x707c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdeff, 0x493b, 0x2402, 0x4502, 0x2402,
+    0x4402, 0x0513, 0x861b, 0xc51b, 0xf295, 0x8007, 0xffff, 0x0005, 0x2c64, 0x6211, 0xc310, 0xc310,
+    0xe310, 0x8005, 0xc310, 0x0006, 0xa308, 0xc310, 0xc310, 0xa308, 0x2319, 0x1bdf, 0x8004, 0xffff,
+    0x000a, 0xdeff, 0xe753, 0x633b, 0xa443, 0x633b, 0x433b, 0x433b, 0x8343, 0x4233, 0x0d85, 0x8017,
+    0xffff, 0x000a, 0x33b6, 0xe343, 0x054c, 0x054c, 0x6443, 0x433b, 0x643b, 0x043b, 0x6343, 0xf9d6,
+    0x8040, 0xffff, 0x8005, 0x7def, 0x8003, 0x7eef, 0x0001, 0x7def, 0x8009, 0x7eef, 0x0001, 0x9eef,
+    0x8008, 0x7eef, 0x0004, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x800b, 0x9ef7, 0x000c, 0x7ef7, 0x7eef,
+    0xffff, 0x717c, 0x0000, 0xa629, 0x96b5, 0xffff, 0xffff, 0x9ef7, 0x7eef, 0x9eef, 0x8003, 0x9ef7,
+    0x0018, 0x7def, 0x7eef, 0xdfff, 0x4832, 0x8100, 0xc200, 0xe200, 0x4401, 0x4301, 0x4301, 0x2301,
+    0x38c6, 0xffff, 0xffff, 0xd28c, 0x8100, 0x8401, 0x4301, 0x8100, 0x8100, 0x8200, 0x2000, 0x273a,
+    0xbef7, 0x8006, 0x9ef7, 0x8008, 0xbef7, 0x0025, 0xbff7, 0xbff7, 0xbef7, 0xdff7, 0xbef7, 0xdfff,
+    0xee6c, 0xc733, 0xe83b, 0xc83b, 0xe83b, 0x083c, 0x0623, 0xa411, 0x3ce7, 0xffff, 0xdef7, 0xdfff,
+    0xdfff, 0xbef7, 0xffff, 0x3395, 0xe100, 0xc401, 0x0402, 0x4502, 0x6502, 0x6402, 0x4402, 0x4402,
+    0x4502, 0x4502, 0x4301, 0x2723, 0x59d7, 0xffff, 0xdef7, 0x8008, 0xdfff, 0x001a, 0xffff, 0xb385,
+    0x0f55, 0x7165, 0x2912, 0x4801, 0x2701, 0x8a1a, 0xb79e, 0xd8b6, 0x1abf, 0x3abf, 0x168e, 0x7054,
+    0xe819, 0x4609, 0x2922, 0x5de7, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xbef7, 0x462a, 0x4209, 0x8311,
+    0x8003, 0x6309, 0x0011, 0x8411, 0x0101, 0x7084, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbeff, 0xca3b,
+    0x6402, 0x8502, 0x4502, 0x2502, 0x4502, 0x8502, 0x0403, 0xd39d, 0x8007, 0xffff, 0x0006, 0xbbde,
+    0x2421, 0xe310, 0x0311, 0xe310, 0xe310, 0x8007, 0xc310, 0x0003, 0xa310, 0x6421, 0x1adf, 0x8004,
+    0xffff, 0x000c, 0xdeff, 0xe753, 0x433b, 0x433b, 0x2333, 0x2333, 0x433b, 0x8343, 0x2233, 0x0d85,
+    0xffff, 0xdfff, 0x8015, 0xffff, 0x000a, 0x53b6, 0x044c, 0x8443, 0x4443, 0xc332, 0x043b, 0x233b,
+    0x2343, 0x6443, 0xf9d6, 0x8040, 0xffff, 0x8003, 0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x8003,
+    0x7eef, 0x0001, 0x7def, 0x8014, 0x7eef, 0x0005, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x8007,
+    0x9ef7, 0x0026, 0x7eef, 0xffff, 0xd6ad, 0x8100, 0xa308, 0x8200, 0x6100, 0x8a4a, 0x17be, 0xbff7,
+    0xffff, 0xffff, 0xdfff, 0xdff7, 0xbff7, 0xffff, 0xffff, 0xd28c, 0x8100, 0xc200, 0x8200, 0xc200,
+    0x2301, 0x4401, 0x4401, 0x6411, 0xfbde, 0xbff7, 0xffff, 0xf38c, 0x8100, 0x4301, 0x0301, 0x6100,
+    0x6100, 0x8200, 0x2000, 0x283a, 0x8012, 0xffff, 0x0021, 0xdff7, 0xbef7, 0xdfff, 0xee6c, 0xc733,
+    0xc83b, 0xe83b, 0x083c, 0x8733, 0xe522, 0xc419, 0xfce6, 0xffff, 0xdff7, 0xdfff, 0xdfff, 0xdff7,
+    0xbef7, 0xffff, 0x2a4b, 0xe100, 0xa301, 0xc301, 0x0402, 0x2402, 0x4402, 0x4402, 0x0402, 0x6301,
+    0x8301, 0x2d5d, 0x19cf, 0xffff, 0x800a, 0xdfff, 0x0019, 0xb385, 0xee54, 0x9165, 0x2b2b, 0x0701,
+    0x0701, 0x6a12, 0xd375, 0x98b6, 0x57a6, 0xd58d, 0x704c, 0x8a12, 0x4601, 0x2922, 0x38be, 0xffff,
+    0xdfff, 0xffff, 0xdfff, 0xffff, 0xbef7, 0x262a, 0x2201, 0x6309, 0x8003, 0x4309, 0x0013, 0x8411,
+    0x0101, 0x707c, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbeff, 0x4943, 0xc301, 0x050a, 0x0502, 0x4502,
+    0x4502, 0x450a, 0xa201, 0xf294, 0xffff, 0xdfff, 0x8006, 0xffff, 0x0005, 0x139d, 0x6100, 0x0319,
+    0xe310, 0xe310, 0x8007, 0xc310, 0x0003, 0xa310, 0x8321, 0x3bdf, 0x8004, 0xffff, 0x000a, 0xdef7,
+    0xe653, 0x433b, 0x433b, 0x633b, 0x633b, 0x8343, 0x8443, 0x2233, 0x2e8d, 0x8017, 0xffff, 0x000a,
+    0xf2ad, 0xe132, 0x2343, 0xe363, 0xe25b, 0xe35b, 0xe45b, 0x6453, 0x644b, 0x5be7, 0x8040, 0xffff,
+    0x0004, 0x7def, 0x7eef, 0x7def, 0x7def, 0x8018, 0x7eef, 0x8003, 0x9eef, 0x0005, 0x7eef, 0x9ef7,
+    0x9ef7, 0x9eef, 0x9eef, 0x8005, 0x9ef7, 0x0004, 0x7eef, 0xbff7, 0xfcde, 0x6419, 0x8003, 0xa200,
+    0x001c, 0xc200, 0x4000, 0x6100, 0x083a, 0x307c, 0x96ad, 0x79ce, 0xbad6, 0x99ce, 0xb6ad, 0x2c53,
+    0xc200, 0xc200, 0xe200, 0xa200, 0xe200, 0x4301, 0x6401, 0x2201, 0x6832, 0xbef7, 0x9eef, 0xffff,
+    0xf38c, 0xa100, 0x0301, 0xc200, 0x4100, 0x8003, 0x6100, 0x0003, 0xe310, 0xaa4a, 0xea52, 0x8003,
+    0xea4a, 0x0003, 0x0a4b, 0xac5b, 0x2d64, 0x8003, 0x0c5c, 0x0028, 0xec5b, 0xac53, 0xac53, 0xcc53,
+    0xcc5b, 0x8b4b, 0xd184, 0xffff, 0xbef7, 0xdfff, 0xee6c, 0xc733, 0xc83b, 0x2944, 0xe83b, 0x0523,
+    0xa51a, 0x2522, 0x1ce7, 0xffff, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0xbef7, 0xffff, 0xfbde, 0x8409,
+    0x8301, 0xa301, 0xa301, 0xe401, 0x2402, 0x0402, 0xc401, 0x0201, 0x482b, 0xef7d, 0xd8c6, 0xffff,
+    0x8009, 0xdfff, 0x0012, 0xffff, 0x9385, 0xee54, 0x915d, 0x4e44, 0x2701, 0xe700, 0xca1a, 0x3055,
+    0x5cdf, 0xbef7, 0x1bdf, 0xf69d, 0xd16c, 0x138d, 0x9eef, 0xffff, 0xdfff, 0x8004, 0xffff, 0x0003,
+    0xbef7, 0x0732, 0xe200, 0x8004, 0x4309, 0x0013, 0x6411, 0x0101, 0x7084, 0xffff, 0xdfff, 0xffff,
+    0xffff, 0xdfff, 0x6842, 0xc208, 0x0311, 0x0209, 0x6309, 0x8409, 0x6411, 0xa100, 0x918c, 0xffff,
+    0xdfff, 0x8005, 0xffff, 0x0005, 0xdfff, 0xffff, 0x0b5b, 0x8108, 0xe310, 0x8006, 0xc310, 0x0005,
+    0xa310, 0xc310, 0xa310, 0xc321, 0x5bdf, 0x8004, 0xffff, 0x000b, 0xdeff, 0xe75b, 0x433b, 0x8443,
+    0x6343, 0x6343, 0x8343, 0xa443, 0x623b, 0xab74, 0x96c6, 0x8003, 0x76be, 0x0005, 0x56be, 0x56be,
+    0x77be, 0x57be, 0x76be, 0x8004, 0x56be, 0x0006, 0x76be, 0x77be, 0x56be, 0x57be, 0x36b6, 0x3bdf,
+    0x8004, 0xffff, 0x001b, 0xb1ad, 0x6153, 0x4474, 0x4274, 0xc284, 0xc38c, 0xc363, 0x0464, 0xe45b,
+    0x14b6, 0xb8ce, 0xb8ce, 0x97ce, 0xf8d6, 0xf8d6, 0x97ce, 0xd8d6, 0xf8d6, 0xd8ce, 0xb8ce, 0xd8ce,
+    0xd8ce, 0xb8ce, 0xd8ce, 0xb8ce, 0xb8ce, 0xbef7, 0x802f, 0xffff, 0x8003, 0x7def, 0x8003, 0x7eef,
+    0x0001, 0x7def, 0x8014, 0x7eef, 0x0006, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x8007,
+    0x9ef7, 0x002a, 0x7eef, 0x9ef7, 0xdfff, 0xaa42, 0xa100, 0xe300, 0xa200, 0x8200, 0xa200, 0xa200,
+    0x8200, 0x0000, 0x0000, 0x4100, 0xa200, 0xe308, 0x0301, 0xa100, 0x8100, 0xe300, 0xe300, 0xe200,
+    0x0301, 0x0301, 0x4301, 0x8401, 0xc100, 0x507c, 0xffff, 0x7def, 0xffff, 0xf38c, 0xc200, 0x2301,
+    0x6200, 0x4100, 0x6100, 0x6100, 0x8200, 0x6100, 0x2000, 0x2000, 0x8003, 0x4000, 0x002e, 0x6000,
+    0x6000, 0x6201, 0x8412, 0xa412, 0x8312, 0x6412, 0x030a, 0xc301, 0xc201, 0x030a, 0xa101, 0x6b4b,
+    0xffff, 0xbef7, 0xdfff, 0x8d64, 0x251b, 0x862b, 0x8733, 0xe51a, 0xc51a, 0xc51a, 0xc62a, 0xfbde,
+    0xffff, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xbef7, 0xffff, 0xf28c, 0x0101, 0xa401, 0xa301,
+    0xc301, 0xe401, 0xa301, 0x6301, 0x4301, 0xed5c, 0xae75, 0xd8c6, 0xffff, 0x8009, 0xdfff, 0x000a,
+    0xffff, 0xb385, 0xce4c, 0x505d, 0x5055, 0x6a12, 0x0601, 0x4b23, 0x0f45, 0x98b6, 0x8003, 0xffff,
+    0x0004, 0x3acf, 0xdef7, 0xffff, 0xdfff, 0x8005, 0xffff, 0x0004, 0xbef7, 0xe729, 0xc200, 0x2309,
+    0x8003, 0x4309, 0x0013, 0x6411, 0xe100, 0x7084, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7, 0x6842,
+    0x0211, 0x2311, 0x0211, 0xe210, 0x0311, 0x2319, 0xa100, 0x918c, 0xffff, 0xdfff, 0x8007, 0xffff,
+    0x0003, 0x3ce7, 0x6529, 0xa208, 0x8003, 0xc310, 0x0001, 0xa310, 0x8003, 0xc310, 0x0004, 0xe310,
+    0xc310, 0x2322, 0x5be7, 0x8004, 0xffff, 0x0004, 0xdef7, 0xe75b, 0x8343, 0x834b, 0x8003, 0x8343,
+    0x0006, 0xa343, 0xc443, 0x833b, 0x833b, 0x6433, 0x4433, 0x8003, 0x242b, 0x0002, 0x042b, 0xe42a,
+    0x8003, 0xc422, 0x0008, 0xe422, 0xe422, 0xc422, 0xa322, 0xa322, 0xc42a, 0x621a, 0xd4a5, 0x8004,
+    0xffff, 0x001b, 0xf0bd, 0xc163, 0x4374, 0xc38c, 0x637c, 0x6253, 0x0364, 0x236c, 0xe35b, 0x624b,
+    0x624b, 0x4243, 0xa253, 0xe363, 0xa35b, 0xe363, 0x4274, 0xa353, 0xc32a, 0x2333, 0x233b, 0x4333,
+    0x433b, 0x643b, 0x643b, 0x443b, 0x3adf, 0x802f, 0xffff, 0x8003, 0x7def, 0x8003, 0x7eef, 0x0001,
+    0x7def, 0x8016, 0x7eef, 0x0004, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x8007, 0x9ef7, 0x0011, 0x7eef,
+    0xdfff, 0x1074, 0x8100, 0x2309, 0x0301, 0xc200, 0xa200, 0xa200, 0x6200, 0x6200, 0x6100, 0x6208,
+    0x8200, 0x8200, 0xc200, 0xe300, 0x8006, 0x0301, 0x000b, 0x4401, 0x6401, 0x4301, 0x6411, 0xfbde,
+    0xdfff, 0x9eef, 0xffff, 0x3495, 0xc100, 0x2301, 0x8006, 0x6100, 0x8003, 0xa200, 0x8004, 0xc200,
+    0x0022, 0xa100, 0x6309, 0x062b, 0x262b, 0xe522, 0xc522, 0x6412, 0x0412, 0x641a, 0x030a, 0xcc5b,
+    0xffff, 0xbef7, 0xffff, 0x2c5c, 0x830a, 0xa412, 0xa41a, 0xc522, 0xe622, 0xc51a, 0x0633, 0x3ce7,
+    0xffff, 0xdeff, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdef7, 0xbef7, 0xdfff, 0xc93a, 0x0101, 0x8004,
+    0x8301, 0x0007, 0x4301, 0x4612, 0x1086, 0x6d75, 0xf9ce, 0xffff, 0xdff7, 0x8008, 0xdfff, 0x000f,
+    0xffff, 0x927d, 0xee54, 0x305d, 0x5055, 0x2e3c, 0x2601, 0x2d3c, 0xee44, 0x36a6, 0xffff, 0xffff,
+    0x5bd7, 0xd9be, 0xdfff, 0x8005, 0xffff, 0x001c, 0xdfff, 0xffff, 0xbef7, 0xe731, 0xc200, 0x0309,
+    0x2309, 0x4309, 0x4309, 0x6411, 0xe100, 0x7084, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7, 0x6742,
+    0xe208, 0x2311, 0x0311, 0x0211, 0x2311, 0x2311, 0xa100, 0x918c, 0xffff, 0xdfff, 0x8006, 0xffff,
+    0x0005, 0xdfff, 0xffff, 0xb6b5, 0x8108, 0xe410, 0x8007, 0xc310, 0x0003, 0x4319, 0xa332, 0x3adf,
+    0x8004, 0xffff, 0x0002, 0xdef7, 0x075c, 0x8005, 0x8343, 0x0016, 0xc343, 0xc443, 0xc443, 0xe543,
+    0xa53b, 0x6533, 0x4533, 0x8533, 0xa53b, 0x8533, 0x6533, 0x2533, 0x052b, 0x052b, 0x2533, 0x252b,
+    0x252b, 0x052b, 0x052b, 0x2633, 0xc322, 0xf4a5, 0x8004, 0xffff, 0x001b, 0xd0b5, 0x0174, 0xe494,
+    0xe36b, 0x8253, 0x6374, 0x2364, 0x0364, 0xe35b, 0x834b, 0x035c, 0x636c, 0x236c, 0x036c, 0x847c,
+    0xc384, 0x0364, 0x043b, 0x243b, 0x8443, 0x8443, 0xa443, 0x8443, 0xa543, 0xa443, 0xa443, 0x3adf,
+    0x802f, 0xffff, 0x8003, 0x7def, 0x0002, 0x7eef, 0x7def, 0x8007, 0x7eef, 0x0001, 0x7def, 0x8010,
+    0x7eef, 0x0002, 0x9eef, 0x7eef, 0x8003, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x8003, 0x9ef7,
+    0x0008, 0x7def, 0x283a, 0x2000, 0xc200, 0x2309, 0x0301, 0xc200, 0xa200, 0x8004, 0x4100, 0x0017,
+    0x6100, 0x8200, 0x0301, 0xe300, 0xe200, 0xe300, 0x0301, 0x0301, 0x2301, 0x4301, 0x8401, 0x8401,
+    0xc100, 0xd28c, 0xffff, 0x9ef7, 0x9ef7, 0xffff, 0x3495, 0xe100, 0x6401, 0x8200, 0x6200, 0x8004,
+    0x6100, 0x0003, 0x8100, 0x8200, 0x8200, 0x8003, 0xa100, 0x0019, 0xc200, 0xc200, 0x8100, 0x0201,
+    0xa522, 0x262b, 0xc522, 0x841a, 0x4412, 0x2412, 0xe201, 0xcc5b, 0xffff, 0x9ef7, 0xffff, 0x2c5c,
+    0x8312, 0xc522, 0xe522, 0xc522, 0xc522, 0xc51a, 0xe632, 0x3ce7, 0xffff, 0x8004, 0xdfff, 0x0010,
+    0xdff7, 0xdff7, 0xbef7, 0xffff, 0xdbde, 0x4311, 0xe200, 0x4301, 0x4301, 0x6301, 0x0201, 0xea43,
+    0x5196, 0x4d6d, 0xd8c6, 0xffff, 0x8009, 0xdfff, 0x000e, 0xffff, 0x927d, 0xce4c, 0x105d, 0x0f55,
+    0x104d, 0x490a, 0xaf44, 0xee3c, 0x1596, 0xffff, 0xffff, 0x9de7, 0xbdef, 0x8004, 0xffff, 0x0016,
+    0xdfff, 0xffff, 0xdfff, 0xffff, 0xbef7, 0xe731, 0xc208, 0xe308, 0x0309, 0x2309, 0x6309, 0x8411,
+    0x0201, 0x9184, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7, 0x4742, 0xe208, 0x2311, 0x8003, 0x0311,
+    0x0005, 0x2311, 0xa100, 0x718c, 0xffff, 0xdfff, 0x8007, 0xffff, 0x0008, 0xdfff, 0xffff, 0xce73,
+    0x6108, 0xe310, 0xa310, 0xc310, 0xa310, 0x8003, 0xc310, 0x0003, 0x4321, 0x6432, 0x3bdf, 0x8004,
+    0xffff, 0x000f, 0xbef7, 0x075c, 0x6343, 0x8443, 0xa443, 0xa34b, 0xe44b, 0xc34b, 0xc443, 0xa443,
+    0xa543, 0x6433, 0x452b, 0x452b, 0x6533, 0x8003, 0x8533, 0x0004, 0x6533, 0x252b, 0x252b, 0x452b,
+    0x8003, 0x252b, 0x0004, 0x042b, 0x052b, 0xa31a, 0xd4a5, 0x8004, 0xffff, 0x0013, 0x31c6, 0x0174,
+    0x625b, 0xe263, 0x6374, 0xe35b, 0x2364, 0xe45b, 0x634b, 0x8374, 0x238d, 0x837c, 0x637c, 0xc384,
+    0xc284, 0x436c, 0xe43a, 0x043b, 0x843b, 0x8004, 0xa443, 0x0004, 0xc44b, 0xa443, 0xa33b, 0x3adf,
+    0x802f, 0xffff, 0x8003, 0x7def, 0x0005, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x7def, 0x8004, 0x7eef,
+    0x0001, 0x7def, 0x800a, 0x7eef, 0x0001, 0x9ef7, 0x8005, 0x7eef, 0x0002, 0x9eef, 0x9ef7, 0x8003,
+    0x9eef, 0x8006, 0x9ef7, 0x0009, 0x9eef, 0xbef7, 0x7def, 0xef73, 0xa208, 0x6100, 0xe300, 0xe308,
+    0xa200, 0x8005, 0x4100, 0x0033, 0xc200, 0x0201, 0xa200, 0xa200, 0xc200, 0xe300, 0x0301, 0x2301,
+    0x8401, 0xa401, 0xc100, 0x6d5b, 0xffff, 0x9ef7, 0xbef7, 0x9ef7, 0xffff, 0x1395, 0xe100, 0xa401,
+    0xe200, 0x6200, 0x6100, 0x6100, 0x8100, 0x8100, 0x8200, 0x8200, 0xa200, 0x8100, 0xa100, 0xa100,
+    0xa200, 0xc200, 0xc200, 0xa100, 0xc100, 0x651a, 0x0523, 0xc522, 0x851a, 0x0412, 0xe309, 0xac5b,
+    0xffff, 0x9ef7, 0xffff, 0x2c64, 0xa31a, 0xc522, 0xe522, 0x8003, 0xc522, 0x0003, 0xc62a, 0x3be7,
+    0xffff, 0x8007, 0xdfff, 0x000e, 0xbef7, 0xffff, 0xf394, 0x6000, 0xe300, 0xe300, 0x0301, 0x2301,
+    0x4e75, 0xf085, 0x4d65, 0xd8c6, 0xffff, 0xdff7, 0x8008, 0xdfff, 0x0010, 0xffff, 0x727d, 0xce4c,
+    0xef54, 0xef54, 0xef4c, 0x6e3c, 0x0f4d, 0xae34, 0xf58d, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff,
+    0xffff, 0x8005, 0xdfff, 0x0012, 0xffff, 0xbef7, 0xe731, 0xe208, 0x0311, 0xe308, 0xe208, 0x2309,
+    0x6311, 0xc100, 0x9184, 0xffff, 0xdfff, 0xffff, 0xffff, 0x9ef7, 0x4742, 0xe208, 0x8004, 0x0311,
+    0x0005, 0x2311, 0x8100, 0x7184, 0xffff, 0xdfff, 0x8009, 0xffff, 0x000c, 0x9ef7, 0xe739, 0xa208,
+    0xe310, 0xc310, 0xc310, 0xa310, 0xa310, 0xc310, 0xa310, 0x4421, 0x1bdf, 0x8004, 0xffff, 0x0005,
+    0xdeff, 0xc753, 0x0333, 0x243b, 0x8443, 0x8003, 0xc34b, 0x0009, 0x8343, 0x643b, 0x6433, 0x6433,
+    0x6533, 0x8533, 0x6533, 0x452b, 0x652b, 0x8003, 0x6533, 0x0004, 0x8533, 0x6533, 0x652b, 0x452b,
+    0x8003, 0x252b, 0x0002, 0xc31a, 0xd4a5, 0x8004, 0xffff, 0x001b, 0xb0ad, 0x204b, 0x4374, 0x236c,
+    0x834b, 0x446c, 0xe35b, 0x434b, 0x8484, 0x239d, 0xe294, 0xa27c, 0xc284, 0xa384, 0x446c, 0x033b,
+    0xe332, 0x0333, 0x633b, 0xc443, 0xa443, 0xc443, 0xc44b, 0xc44b, 0xa443, 0xa43b, 0x5adf, 0x802f,
+    0xffff, 0x0001, 0x5def, 0x8003, 0x7def, 0x8003, 0x7eef, 0x8003, 0x7def, 0x8013, 0x7eef, 0x0005,
+    0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x7eef, 0x8007, 0x9ef7, 0x0025, 0x9eef, 0x9ef7, 0xffff, 0x59c6,
+    0xaa4a, 0x8100, 0x6000, 0x8200, 0x6200, 0x6208, 0x6100, 0x4100, 0x4100, 0xc200, 0xe200, 0xa200,
+    0xa200, 0xc200, 0xc200, 0x4401, 0x6401, 0x2301, 0xe200, 0xef6b, 0xbff7, 0xbef7, 0x9ef7, 0xbef7,
+    0x9ef7, 0xffff, 0x1395, 0x0201, 0xa409, 0x6401, 0xa200, 0xa200, 0x8200, 0x8004, 0xa200, 0x0002,
+    0xc200, 0xa200, 0x8005, 0xc200, 0x000f, 0xe200, 0xc200, 0xc100, 0x6522, 0x462b, 0x851a, 0xe411,
+    0xe309, 0xcc5b, 0xffff, 0x9ef7, 0xffff, 0x2c64, 0xc41a, 0x062b, 0x8003, 0xc522, 0x0005, 0xe622,
+    0xe732, 0x3be7, 0xffff, 0xdeff, 0x8006, 0xdfff, 0x000d, 0xdff7, 0xbef7, 0xffff, 0xa93a, 0x8200,
+    0x0309, 0xc200, 0x2522, 0x318e, 0xaf7d, 0x4d6d, 0xd8c6, 0xffff, 0x8009, 0xdfff, 0x000d, 0xffff,
+    0x927d, 0xce4c, 0x0f55, 0x0f55, 0xef4c, 0x0f55, 0x0f4d, 0xce34, 0xf58d, 0xffff, 0xdfff, 0xffff,
+    0x8008, 0xdfff, 0x001b, 0xffff, 0xbef7, 0xe731, 0xe308, 0x0311, 0xe310, 0xe308, 0xe308, 0x2311,
+    0xa100, 0x7184, 0xffff, 0xdfff, 0xffff, 0xffff, 0x9ef7, 0x473a, 0xc208, 0x0311, 0xe310, 0xc310,
+    0xe310, 0xe310, 0x8100, 0x7084, 0xffff, 0xdfff, 0x8008, 0xffff, 0x0008, 0xdfff, 0xffff, 0x38c6,
+    0xc310, 0xe410, 0xc310, 0xc310, 0xa310, 0x8003, 0xc310, 0x0002, 0x2319, 0x1bdf, 0x8004, 0xffff,
+    0x001d, 0xbef7, 0xa74b, 0xe32a, 0x0433, 0x8443, 0x8343, 0x8343, 0xa443, 0x8443, 0x843b, 0x6433,
+    0x8533, 0x8533, 0xa53b, 0x6533, 0x6533, 0x8533, 0x8533, 0x652b, 0x652b, 0x8533, 0x452b, 0x452b,
+    0x4533, 0x452b, 0x4533, 0x4533, 0xe322, 0x14ae, 0x8004, 0xffff, 0x001b, 0x8fad, 0x216c, 0xc35b,
+    0x834b, 0x846c, 0x834b, 0x424b, 0x44a5, 0xa38c, 0xe26b, 0x038d, 0xc284, 0xa27c, 0x446c, 0x2343,
+    0x033b, 0x6443, 0x643b, 0x8443, 0xa443, 0xc343, 0xc443, 0xc44b, 0xc44b, 0xa443, 0xa443, 0x5adf,
+    0x802f, 0xffff, 0x0004, 0x5def, 0x5def, 0x7def, 0x7def, 0x8003, 0x7eef, 0x8003, 0x7def, 0x8011,
+    0x7eef, 0x000b, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x9ef7,
+    0x9eef, 0x8003, 0x9ef7, 0x000e, 0x9eef, 0x9eef, 0x7eef, 0xdfff, 0xdfff, 0xd6b5, 0xeb52, 0xe310,
+    0x0000, 0x0000, 0x2000, 0x4100, 0x6100, 0xc300, 0x8003, 0xc200, 0x0012, 0xa200, 0xa100, 0xc200,
+    0xe200, 0x282a, 0x96ad, 0xffff, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9eef, 0xffff, 0xd28c, 0x8000,
+    0x0101, 0x2101, 0x8000, 0x8003, 0x2000, 0x8003, 0x4000, 0x800a, 0x6000, 0x000c, 0x8000, 0x2312,
+    0x6312, 0xa201, 0x2001, 0x8b53, 0xffff, 0x9ef7, 0xffff, 0xca53, 0x420a, 0x831a, 0x8003, 0x6312,
+    0x0005, 0x8312, 0xa422, 0x3bdf, 0xffff, 0xdef7, 0x8007, 0xdfff, 0x000c, 0xbef7, 0xffff, 0xbace,
+    0xe200, 0x6100, 0x2000, 0x8943, 0xef7d, 0x6d6d, 0xeb54, 0xb7be, 0xffff, 0x8009, 0xdfff, 0x0004,
+    0xffff, 0x5175, 0x8c3c, 0xad44, 0x8003, 0xad3c, 0x0004, 0xce3c, 0x6c24, 0xb47d, 0xffff, 0x800a,
+    0xdfff, 0x0004, 0xffff, 0xbef7, 0xa629, 0x6100, 0x8004, 0xa200, 0x0013, 0xc200, 0x2000, 0x5084,
+    0xffff, 0xdfff, 0xffff, 0xffff, 0x9ef7, 0xc531, 0x8100, 0xa208, 0x8200, 0x8208, 0x8200, 0xa208,
+    0x2000, 0x3084, 0xffff, 0xdfff, 0x8009, 0xffff, 0x000c, 0xdfff, 0xffff, 0xef7b, 0x4100, 0xa308,
+    0xa308, 0x8308, 0x8308, 0x8208, 0xa210, 0xe210, 0xfbde, 0x8004, 0xffff, 0x000b, 0xbef7, 0x8643,
+    0xe32a, 0x0333, 0x2333, 0x6343, 0x8343, 0x6343, 0x8443, 0x643b, 0x6533, 0x8003, 0x8533, 0x0006,
+    0x6533, 0x8533, 0x8533, 0xa533, 0xa533, 0x642b, 0x8003, 0x652b, 0x8004, 0x452b, 0x0002, 0x2323,
+    0x14ae, 0x8004, 0xffff, 0x0011, 0xd0ad, 0x2043, 0x045c, 0x656c, 0x6443, 0x6253, 0x64a5, 0xc28c,
+    0xc163, 0xc384, 0x2395, 0xa27c, 0x436c, 0x4343, 0x033b, 0x6443, 0x6443, 0x8003, 0x8443, 0x0007,
+    0xa343, 0xc44b, 0xa443, 0xa44b, 0xa443, 0xa443, 0x3adf, 0x802f, 0xffff, 0x0002, 0x5def, 0x5def,
+    0x8006, 0x7def, 0x0003, 0x7eef, 0x7def, 0x7def, 0x8011, 0x7eef, 0x000b, 0x9eef, 0x9eef, 0x9ef7,
+    0x9ef7, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x8005, 0x9ef7, 0x0016, 0x9eef,
+    0x9eef, 0xffff, 0xffff, 0xfbde, 0xf39c, 0x0c5b, 0xa629, 0xc310, 0x6100, 0xc200, 0xa200, 0xa200,
+    0xc300, 0x2411, 0x282a, 0x8d5b, 0x96ad, 0x9ef7, 0xffff, 0x9ef7, 0x9ef7, 0x8003, 0xbef7, 0x0009,
+    0x9ef7, 0xdfff, 0x17b6, 0x8d5b, 0xee63, 0xee63, 0xee6b, 0x8e6b, 0xae6b, 0x8003, 0x8e6b, 0x0002,
+    0xae6b, 0xae6b, 0x8003, 0x8d63, 0x0002, 0xad63, 0xae63, 0x8004, 0xad63, 0x000d, 0x8c63, 0xcd6b,
+    0x8e7c, 0x8f7c, 0x0d6c, 0x339d, 0xdfff, 0xbef7, 0xdfff, 0xb4a5, 0xcf7c, 0xf07c, 0xf084, 0x8003,
+    0xd084, 0x0004, 0xf08c, 0x7def, 0xffff, 0xdef7, 0x8004, 0xdfff, 0x000f, 0xbef7, 0xbef7, 0xdfff,
+    0xdfff, 0xbef7, 0xffff, 0x549d, 0xae6b, 0xee6b, 0x34a6, 0x95ae, 0x54ae, 0x139e, 0x3ad7, 0xffff,
+    0x8009, 0xdfff, 0x000b, 0xffff, 0x77ae, 0xf48d, 0x1596, 0xf595, 0xf48d, 0xf58d, 0xf595, 0xb385,
+    0x98b6, 0xffff, 0x800b, 0xdfff, 0x001a, 0xbef7, 0x6d6b, 0xca52, 0xeb52, 0x0b53, 0xeb52, 0xeb52,
+    0xea52, 0x6842, 0x34a5, 0xffff, 0xdfff, 0xffff, 0xffff, 0xbef7, 0x2c63, 0x4842, 0x894a, 0x6942,
+    0x6942, 0x694a, 0x8a4a, 0xe739, 0xf39c, 0xffff, 0xdfff, 0x800b, 0xffff, 0x000a, 0x9ef7, 0x494a,
+    0xc731, 0xe739, 0xe739, 0xc739, 0xe739, 0xe739, 0x073a, 0x3ce7, 0x8004, 0xffff, 0x000a, 0xbef7,
+    0x2a5c, 0x864b, 0xa753, 0xc653, 0xe75b, 0xc653, 0xc653, 0xe753, 0xc74b, 0x8005, 0xe84b, 0x0001,
+    0x084c, 0x8003, 0xe84b, 0x000a, 0xc743, 0xc743, 0xe743, 0xc743, 0xc743, 0xa743, 0x873b, 0xa743,
+    0xa643, 0x35b6, 0x8004, 0xffff, 0x000f, 0x90a5, 0xe45b, 0xc77c, 0xa553, 0xc55b, 0x2595, 0xe48c,
+    0xc363, 0xc584, 0x2374, 0x0495, 0x6474, 0x8553, 0x4543, 0x8543, 0x8004, 0xa54b, 0x8004, 0xc54b,
+    0x0004, 0xc44b, 0xc44b, 0xc34b, 0x3adf, 0x802f, 0xffff, 0x0002, 0x7def, 0x5def, 0x8005, 0x7def,
+    0x0001, 0x7eef, 0x8003, 0x7def, 0x8012, 0x7eef, 0x0005, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x7eef,
+    0x8003, 0x9eef, 0x8009, 0x9ef7, 0x0012, 0x7eef, 0x7eef, 0xbff7, 0xffff, 0xffff, 0x9eef, 0xdbd6,
+    0x38c6, 0xd7b5, 0x96ad, 0xd6b5, 0x59c6, 0xfbde, 0x9ef7, 0xffff, 0xffff, 0xbef7, 0x9ef7, 0x8005,
+    0xbef7, 0x0003, 0x9ef7, 0x9ef7, 0xdfff, 0x801a, 0xffff, 0x0003, 0xbff7, 0xdff7, 0xdff7, 0x8008,
+    0xffff, 0x800c, 0xdfff, 0x0001, 0xbef7, 0x8008, 0xffff, 0x800b, 0xdfff, 0x8009, 0xffff, 0x800d,
+    0xdfff, 0x8025, 0xffff, 0x0008, 0xdfff, 0xbfff, 0xdfff, 0xdeff, 0xbef7, 0xdef7, 0xdef7, 0xbef7,
+    0x8006, 0xffff, 0x8004, 0xbef7, 0x8007, 0xbdf7, 0x0004, 0xbef7, 0xbef7, 0xbdf7, 0xbdef, 0x8009,
+    0x9def, 0x0004, 0x7def, 0x9def, 0x9def, 0xdef7, 0x8004, 0xffff, 0x000e, 0xbef7, 0x9cef, 0x7ce7,
+    0x5ce7, 0xbcf7, 0x7bef, 0x7cef, 0x9cef, 0x9cf7, 0x5cef, 0x9cef, 0x7cef, 0x5ce7, 0x5ce7, 0x8003,
+    0x5be7, 0x0001, 0x7be7, 0x8006, 0x5be7, 0x0003, 0x7be7, 0x3adf, 0xdeff, 0x802f, 0xffff, 0x0002,
+    0x7def, 0x5def, 0x8003, 0x7def, 0x0005, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7def, 0x8010, 0x7eef,
+    0x0005, 0x9ef7, 0x7eef, 0x9eef, 0x7eef, 0x9eef, 0x8005, 0x9ef7, 0x0003, 0x9eef, 0x9ef7, 0x9eef,
+    0x800a, 0x9ef7, 0x0005, 0x7eef, 0x9eef, 0x9ef7, 0xbff7, 0xdfff, 0x8003, 0xffff, 0x0006, 0xdfff,
+    0xdfff, 0x9ef7, 0x9eef, 0x9ef7, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0x9ef7, 0x8003, 0xbef7, 0x0004,
+    0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x8005, 0x9ef7, 0x0001, 0x9eef, 0x800d, 0x9ef7, 0x8003, 0xbef7,
+    0x0001, 0xbff7, 0x8003, 0xdff7, 0x8008, 0xbef7, 0x0001, 0xdff7, 0x8003, 0xdfff, 0x0004, 0xbff7,
+    0xdfff, 0xdfff, 0xbef7, 0x8005, 0xdfff, 0x0004, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8003, 0xdff7,
+    0x800d, 0xdfff, 0x0001, 0xdff7, 0x801c, 0xdfff, 0x8095, 0xffff, 0x0003, 0x7def, 0x5def, 0x5def,
+    0x8008, 0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x800c, 0x7eef, 0x0006, 0x9ef7, 0x7eef, 0x7eef,
+    0x9eef, 0x7eef, 0x7eef, 0x8005, 0x9eef, 0x0001, 0x9ef7, 0x8003, 0x9eef, 0x800d, 0x9ef7, 0x0004,
+    0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x8003, 0x9ef7, 0x0007, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7,
+    0xbef7, 0x9ef7, 0x8003, 0xbef7, 0x0005, 0x9ef7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8011, 0xbef7,
+    0x0002, 0xbff7, 0xbff7, 0x8004, 0xbef7, 0x0003, 0xbff7, 0xdff7, 0xdff7, 0x800b, 0xdfff, 0x0004,
+    0xdff7, 0xdff7, 0xdfff, 0xdeff, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x8030, 0xdfff, 0x0003, 0xffff,
+    0xffff, 0xdfff, 0x8032, 0xffff, 0x8003, 0xdfff, 0x805f, 0xffff, 0x0004, 0x7def, 0x7def, 0x5def,
+    0x5def, 0x8009, 0x7def, 0x800e, 0x7eef, 0x0002, 0x9eef, 0x7eef, 0x8004, 0x9eef, 0x0002, 0x7eef,
+    0x9ef7, 0x8003, 0x9eef, 0x0003, 0x9ef7, 0x9eef, 0x9eef, 0x8012, 0x9ef7, 0x0001, 0xbef7, 0x8004,
+    0x9ef7, 0x0009, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8015,
+    0xbef7, 0x0001, 0xbff7, 0x8004, 0xffff, 0x0004, 0xdfff, 0xdef7, 0xdff7, 0xdff7, 0x8007, 0xdfff,
+    0x0001, 0xbef7, 0x8003, 0xdfff, 0x0003, 0xdeff, 0xdfff, 0xbef7, 0x8003, 0xdfff, 0x0001, 0xdff7,
+    0x8034, 0xdfff, 0x8093, 0xffff, 0x8008, 0x7def, 0x0002, 0x7eef, 0x9def, 0x8003, 0x7def, 0x0003,
+    0x7eef, 0x7eef, 0x7def, 0x800d, 0x7eef, 0x000a, 0x9eef, 0x9ef7, 0x7ef7, 0x9ef7, 0x7eef, 0x7eef,
+    0x9ef7, 0x7eef, 0x9eef, 0x9eef, 0x800e, 0x9ef7, 0x0001, 0xbef7, 0x8009, 0x9ef7, 0x0002, 0xbef7,
+    0x9ef7, 0x8003, 0xbef7, 0x0005, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8004, 0xbef7, 0x0001,
+    0xbff7, 0x8007, 0xbef7, 0x0001, 0xbff7, 0x8007, 0xbef7, 0x000b, 0xdfff, 0x1bdf, 0x6c6b, 0x8d6b,
+    0x8d6b, 0x6d6b, 0x3ce7, 0xdfff, 0xbef7, 0xbff7, 0xdfff, 0x8003, 0xdff7, 0x8004, 0xdfff, 0x0006,
+    0xbef7, 0xbfff, 0xdff7, 0xdff7, 0xdfff, 0xbff7, 0x8033, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff,
+    0x8030, 0xffff, 0x0006, 0xbef7, 0x76ad, 0x96ad, 0x76a5, 0x96ad, 0xdfff, 0x805d, 0xffff, 0x8008,
+    0x7def, 0x0004, 0x7eef, 0x7eef, 0x7def, 0x7def, 0x8003, 0x7eef, 0x0001, 0x7def, 0x800c, 0x7eef,
+    0x0003, 0x9eef, 0x7eef, 0x9ef7, 0x8004, 0x7eef, 0x0006, 0x9eef, 0x9eef, 0x7eef, 0x7eef, 0x9eef,
+    0x9eef, 0x800f, 0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7, 0x0006, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7,
+    0xbef7, 0x9ef7, 0x8011, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8005, 0xbef7, 0x000e, 0xbff7, 0xbef7,
+    0xbef7, 0x9ef7, 0x062a, 0x0000, 0x4100, 0x0000, 0xb294, 0xffff, 0xbef7, 0xbef7, 0xdfff, 0xdff7,
+    0x8007, 0xbef7, 0x0001, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xbff7, 0x8003, 0xdfff, 0x0003, 0xbfff,
+    0xbff7, 0xdff7, 0x800a, 0xdfff, 0x0002, 0xbef7, 0xdff7, 0x8020, 0xdfff, 0x0001, 0xffff, 0x8005,
+    0xdfff, 0x0002, 0xffff, 0xdfff, 0x802e, 0xffff, 0x0005, 0x76ad, 0x4300, 0xa500, 0x2300, 0xac4a,
+    0x805e, 0xffff, 0x0002, 0x7def, 0x5def, 0x8006, 0x7def, 0x0005, 0x7eef, 0x7eef, 0x7def, 0x7eef,
+    0x7eef, 0x8003, 0x7def, 0x8009, 0x7eef, 0x0003, 0x9eef, 0x7eef, 0x9eef, 0x8005, 0x7eef, 0x0003,
+    0x9eef, 0x7eef, 0x7eef, 0x8004, 0x9eef, 0x8010, 0x9ef7, 0x0001, 0xbef7, 0x8009, 0x9ef7, 0x0002,
+    0xbef7, 0x9ef7, 0x8010, 0xbef7, 0x8004, 0xbff7, 0x8005, 0xbef7, 0x000c, 0x9ef7, 0xffff, 0x539d,
+    0x6000, 0xc308, 0x4100, 0xc731, 0xbef7, 0xdff7, 0xbff7, 0xbfff, 0xdef7, 0x8004, 0xffff, 0x0004,
+    0xdfff, 0xdfff, 0xffff, 0xbef7, 0x8003, 0xdfff, 0x0007, 0xbff7, 0xdfff, 0xdff7, 0xdfff, 0xdff7,
+    0xdfff, 0xffff, 0x8008, 0xdfff, 0x0005, 0xbef7, 0xdfff, 0xffff, 0xdfff, 0xbef7, 0x8025, 0xdfff,
+    0x8017, 0xffff, 0x0001, 0xdfff, 0x8018, 0xffff, 0x0007, 0xac42, 0xa500, 0x2609, 0x8500, 0xd7b5,
+    0xffff, 0xdfff, 0x805c, 0xffff, 0x000c, 0x7def, 0x5def, 0x5def, 0x7def, 0x7def, 0x7eef, 0x7def,
+    0x7def, 0x7eef, 0x7eef, 0x7def, 0x7eef, 0x8003, 0x7def, 0x0002, 0x7eef, 0x7def, 0x8008, 0x7eef,
+    0x0004, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x8004, 0x7eef, 0x0003, 0x9eef, 0x7eef, 0x7eef, 0x8003,
+    0x9eef, 0x8004, 0x9ef7, 0x8003, 0x9eef, 0x8012, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8003,
+    0xbef7, 0x8004, 0xbff7, 0x8009, 0xbef7, 0x8003, 0xbff7, 0x0004, 0xbef7, 0xbff7, 0xbef7, 0xbff7,
+    0x8003, 0xbef7, 0x001f, 0xbff7, 0x7def, 0xc519, 0xa100, 0xc200, 0x2000, 0x75ad, 0xffff, 0xbef7,
+    0xbff7, 0xdfff, 0x1cdf, 0xfbde, 0x1bdf, 0xfbde, 0x9ef7, 0x7def, 0xfbde, 0xffff, 0xbef7, 0xdfff,
+    0xdfff, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0xdfff, 0x7def, 0x9ace, 0xffff, 0xbff7, 0x8004, 0xdfff,
+    0x0008, 0xbff7, 0xbef7, 0xffff, 0xffff, 0xb6b5, 0x79ce, 0xffff, 0xffff, 0x8025, 0xdfff, 0x0002,
+    0xffff, 0xdfff, 0x802c, 0xffff, 0x0006, 0x7ace, 0xc500, 0x0601, 0xa500, 0xea29, 0xdff7, 0x805e,
+    0xffff, 0x0002, 0x5def, 0x5def, 0x8003, 0x7def, 0x0001, 0x7eef, 0x8003, 0x7def, 0x8004, 0x7eef,
+    0x0004, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x800a, 0x7eef, 0x8003, 0x9eef, 0x8006, 0x7eef, 0x8003,
+    0x9eef, 0x8006, 0x9ef7, 0x0001, 0x9eef, 0x8010, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8006,
+    0xbef7, 0x0003, 0xbff7, 0xbef7, 0x9ef7, 0x8007, 0xbef7, 0x0002, 0xbff7, 0xbef7, 0x8003, 0xbff7,
+    0x001c, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0x9eef, 0xffff, 0x2e74, 0xe100,
+    0x2309, 0x6000, 0x483a, 0xdfff, 0xbef7, 0xbef7, 0xffff, 0x307c, 0xc100, 0x4411, 0x4311, 0x483a,
+    0xc739, 0xe318, 0x1cdf, 0xffff, 0xbef7, 0x8003, 0xdfff, 0x0007, 0xbeff, 0xbef7, 0xffff, 0x18b6,
+    0xef6b, 0xffff, 0xbef7, 0x8003, 0xdfff, 0x000a, 0xbff7, 0xffff, 0xffff, 0xd6b5, 0xeb4a, 0x149d,
+    0x3ce7, 0x55a5, 0x9ace, 0xffff, 0x8024, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8003, 0xdfff, 0x8011,
+    0xffff, 0x0004, 0x19be, 0xdff7, 0xffff, 0xdfff, 0x800a, 0xffff, 0x0006, 0xbef7, 0xec5a, 0x6a4a,
+    0x8b4a, 0x2a42, 0x18c6, 0x8004, 0xffff, 0x0007, 0x4e5b, 0x6300, 0x0609, 0x6300, 0xf494, 0xffff,
+    0xdfff, 0x805d, 0xffff, 0x0002, 0x5def, 0x5def, 0x8003, 0x7def, 0x0001, 0x7eef, 0x8004, 0x7def,
+    0x8003, 0x7eef, 0x0004, 0x7def, 0x7eef, 0x7def, 0x7def, 0x8011, 0x7eef, 0x8003, 0x9eef, 0x8003,
+    0x9ef7, 0x0002, 0x9eef, 0x9eef, 0x800a, 0x9ef7, 0x0001, 0xbef7, 0x800a, 0x9ef7, 0x0001, 0xbef7,
+    0x8003, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x8005, 0xbef7, 0x8003, 0xbff7, 0x8008, 0xbef7,
+    0x8003, 0xbff7, 0x8005, 0xbef7, 0x0016, 0x9ef7, 0xdfff, 0xdad6, 0xa309, 0x6301, 0x4301, 0xa100,
+    0x17be, 0xffff, 0x9ef7, 0xdfff, 0x1cdf, 0x2311, 0xa100, 0x0201, 0x8100, 0x4100, 0x4100, 0xe629,
+    0x3ce7, 0xdfff, 0xbef7, 0x8003, 0xdfff, 0x0012, 0xbef7, 0xffff, 0x759d, 0xeb4a, 0xbef7, 0xdfff,
+    0xffff, 0xdfff, 0xbef7, 0xffff, 0xdad6, 0x4a53, 0x672a, 0x58be, 0xf394, 0x493a, 0x75a5, 0x7def,
+    0x8025, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff, 0x800c, 0xffff, 0x0009, 0xdfff, 0xffff, 0xdfff,
+    0x988d, 0x6901, 0xee4a, 0x7eef, 0xffff, 0xdfff, 0x8007, 0xffff, 0x0008, 0xdfff, 0xffff, 0xb394,
+    0x0100, 0x8308, 0x0100, 0xe831, 0xbef7, 0x8003, 0xffff, 0x0006, 0xbbd6, 0xe508, 0xc500, 0xa500,
+    0xa821, 0x9ef7, 0x805f, 0xffff, 0x0002, 0x5def, 0x5def, 0x8004, 0x7def, 0x0001, 0x7eef, 0x8003,
+    0x7def, 0x8012, 0x7eef, 0x0001, 0x9eef, 0x8005, 0x7eef, 0x0008, 0x9eef, 0x7eef, 0x7eef, 0x9ef7,
+    0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x800a, 0x9ef7, 0x0001, 0xbef7, 0x800a, 0x9ef7, 0x8003, 0xbef7,
+    0x0009, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0xbff7, 0xbff7, 0x9ef7, 0x8003, 0xbff7,
+    0x8007, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xbff7, 0x8005, 0xbef7, 0x002a, 0x9ef7,
+    0xffff, 0xed63, 0x2101, 0xa409, 0x0201, 0xea42, 0xffff, 0xbef7, 0x9ef7, 0xffff, 0xb28c, 0x6000,
+    0xe200, 0xc200, 0x2309, 0x8200, 0x2000, 0x2c63, 0xffff, 0xdfff, 0xffff, 0x38c6, 0xfbde, 0xffff,
+    0x9ef7, 0x6d53, 0x4509, 0x9ace, 0xffff, 0x3ce7, 0x9ef7, 0xffff, 0xd6ad, 0xe311, 0x4833, 0x37b6,
+    0x483a, 0x2411, 0x9ace, 0xffff, 0xffff, 0x8017, 0xdfff, 0x0001, 0xffff, 0x8011, 0xdfff, 0x0002,
+    0xffff, 0xdfff, 0x800b, 0xffff, 0x000b, 0xdfff, 0xffff, 0x9eef, 0xd664, 0xf01a, 0xe600, 0xa600,
+    0x4c2a, 0xfcd6, 0xffff, 0xdfff, 0x8005, 0xffff, 0x0008, 0xdfff, 0xffff, 0xfcde, 0x0519, 0xa408,
+    0xe510, 0x6300, 0xf8bd, 0x8004, 0xffff, 0x0007, 0x6e63, 0x6300, 0x0609, 0x6300, 0xb38c, 0xffff,
+    0xdfff, 0x805e, 0xffff, 0x0009, 0x7def, 0x5def, 0x7def, 0x7def, 0x5def, 0x7def, 0x7eef, 0x7eef,
+    0x7def, 0x8017, 0x7eef, 0x0004, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0x9eef,
+    0x800d, 0x9ef7, 0x0001, 0xbef7, 0x800a, 0x9ef7, 0x0002, 0xbef7, 0xbef7, 0x8003, 0x9ef7, 0x0004,
+    0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x0009, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7,
+    0xbff7, 0xbef7, 0xbff7, 0xbef7, 0x8003, 0xbff7, 0x0003, 0xbef7, 0xbef7, 0xdef7, 0x8005, 0xbef7,
+    0x002f, 0xdfff, 0xdad6, 0xc409, 0x8301, 0x8401, 0xe200, 0xf7b5, 0xffff, 0x9ef7, 0xbef7, 0xbef7,
+    0x0732, 0xe100, 0xe100, 0xe411, 0x4309, 0x4100, 0x083a, 0xd394, 0x4d63, 0xffff, 0x79ce, 0x149d,
+    0xffff, 0x7def, 0xea3a, 0xa619, 0x5de7, 0x9def, 0xb28c, 0xffff, 0x37be, 0x6209, 0x2412, 0x7074,
+    0x0309, 0x8521, 0x3de7, 0xffff, 0xbef7, 0xdfff, 0xffff, 0xdfff, 0xbef7, 0xbff7, 0xdfff, 0xbef7,
+    0x8023, 0xdfff, 0x800c, 0xffff, 0x000e, 0xdfff, 0xffff, 0x7ee7, 0x544c, 0xb31b, 0x511b, 0xe700,
+    0x0701, 0x2801, 0xaa11, 0xb8a5, 0xffff, 0xffff, 0xdfff, 0x8003, 0xffff, 0x0007, 0xdfff, 0xffff,
+    0xec5a, 0x4200, 0xe510, 0x4200, 0x0d63, 0x8004, 0xffff, 0x0006, 0x7ace, 0xa408, 0xe508, 0xa400,
+    0x6719, 0x7def, 0x8060, 0xffff, 0x0004, 0x5def, 0x5def, 0x7def, 0x7eef, 0x8003, 0x7def, 0x0002,
+    0x7eef, 0x7def, 0x8003, 0x7eef, 0x0001, 0x7def, 0x8003, 0x7eef, 0x0002, 0x7def, 0x7def, 0x8006,
+    0x7eef, 0x0001, 0x9eef, 0x800b, 0x7eef, 0x0001, 0x9eef, 0x8003, 0x9ef7, 0x0002, 0x9eef, 0x9eef,
+    0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x8003, 0xbef7,
+    0x8003, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x0007, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7,
+    0xbff7, 0xbff7, 0x8004, 0xbef7, 0x0005, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8007, 0xbef7,
+    0x0030, 0x9ef7, 0xffff, 0x4f6c, 0x4201, 0x8301, 0x0101, 0x4832, 0xdfff, 0xbef7, 0xbef7, 0xffff,
+    0x38c6, 0xc100, 0x2101, 0xe309, 0xa412, 0x8100, 0xa200, 0x0000, 0x483a, 0x3ce7, 0xbef7, 0xcb52,
+    0x1ce7, 0x9def, 0x8932, 0x6519, 0x9eef, 0x149d, 0x0c53, 0x1cdf, 0x4411, 0xc309, 0x8722, 0x2000,
+    0x0832, 0x9eef, 0xffff, 0xdef7, 0xffff, 0xdff7, 0xdef7, 0xdfff, 0xffff, 0xffff, 0xbef7, 0xffff,
+    0xbef7, 0x8022, 0xdfff, 0x800b, 0xffff, 0x0019, 0xdfff, 0xffff, 0x7ee7, 0x344c, 0xb323, 0xf423,
+    0x1524, 0x2d12, 0xc600, 0x4901, 0x2801, 0x0801, 0xf263, 0x7eef, 0xffff, 0xdfff, 0xffff, 0xdfff,
+    0xffff, 0x35a5, 0x4200, 0xc410, 0x8308, 0x2619, 0x5de7, 0x8004, 0xffff, 0x0007, 0xac4a, 0x6300,
+    0x0509, 0x4300, 0xd394, 0xffff, 0xdfff, 0x805f, 0xffff, 0x0002, 0x7def, 0x5def, 0x8004, 0x7def,
+    0x8007, 0x7eef, 0x0004, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x8011, 0x7eef, 0x0003, 0x9eef, 0x7eef,
+    0x7eef, 0x801a, 0x9ef7, 0x8005, 0xbef7, 0x8003, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8006,
+    0xbef7, 0x0008, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8008, 0xbef7,
+    0x0031, 0xdfff, 0x1cdf, 0xe511, 0x4201, 0x4301, 0x6000, 0xf49c, 0xffff, 0x9ef7, 0xbef7, 0xffff,
+    0x8c63, 0x2000, 0x2209, 0xe412, 0x8201, 0x6100, 0xe308, 0x0311, 0x283a, 0xffff, 0xeb5a, 0x2d5b,
+    0x79c6, 0x8511, 0x8619, 0xdbd6, 0xcb4a, 0x8e5b, 0x8e63, 0x6000, 0x451a, 0x4409, 0x083a, 0xfbde,
+    0xffff, 0xbef7, 0xdff7, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x18be, 0x4d6b, 0x0842, 0x75ad, 0xffff,
+    0xdfff, 0xbef7, 0x8012, 0xdfff, 0x0001, 0xffff, 0x800a, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff,
+    0x8009, 0xffff, 0x0010, 0xdfff, 0xffff, 0x7ee7, 0x344c, 0x931b, 0xf42b, 0x3524, 0xf41b, 0xcb09,
+    0xc600, 0x2801, 0x2801, 0x6a01, 0x0801, 0x2c22, 0xf9b5, 0x8003, 0xffff, 0x0006, 0xfcde, 0x0519,
+    0x8308, 0xe410, 0x4200, 0x34a5, 0x8004, 0xffff, 0x0006, 0x96ad, 0x6300, 0xe508, 0x8400, 0x0932,
+    0xbef7, 0x8061, 0xffff, 0x8005, 0x5def, 0x8005, 0x7def, 0x8003, 0x7eef, 0x0004, 0x7def, 0x7eef,
+    0x7eef, 0x7def, 0x8006, 0x7eef, 0x0002, 0x9eef, 0x9eef, 0x8009, 0x7eef, 0x0007, 0x9eef, 0x7eef,
+    0x7eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x8006, 0x9ef7, 0x0001, 0x9eef, 0x8010, 0x9ef7, 0x0007,
+    0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x8007, 0xbef7, 0x0003, 0xbff7, 0xbef7,
+    0xbff7, 0x8005, 0xbef7, 0x8003, 0xbff7, 0x0001, 0xdef7, 0x8007, 0xbef7, 0x0024, 0x9ef7, 0xffff,
+    0xb284, 0xe000, 0x4201, 0xa100, 0x4519, 0x5def, 0xdfff, 0xbef7, 0xdfff, 0x7def, 0xa532, 0xc219,
+    0x232b, 0xa32b, 0x6209, 0x6200, 0x6100, 0x4521, 0x95ad, 0x6a4a, 0x2100, 0x317c, 0xa619, 0x6519,
+    0x59c6, 0xaa42, 0x4411, 0x6200, 0xe411, 0x2309, 0x0732, 0x18be, 0xfbde, 0x9def, 0x8003, 0xffff,
+    0x000b, 0xbad6, 0xb394, 0x2942, 0x6208, 0xa310, 0xe418, 0xc318, 0x1084, 0x7df7, 0xffff, 0xbef7,
+    0x8011, 0xdfff, 0x0001, 0xffff, 0x800a, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x8009, 0xffff,
+    0x0019, 0xdfff, 0xffff, 0x7ee7, 0x544c, 0x921b, 0xf433, 0x152c, 0xb31b, 0x6901, 0x6400, 0xc600,
+    0xe700, 0x2801, 0x2801, 0x6901, 0x2901, 0x2901, 0xb15b, 0x3de7, 0xffff, 0x4a42, 0x4200, 0xe410,
+    0x4300, 0x0c5b, 0x8004, 0xffff, 0x0008, 0x7def, 0x8721, 0x8400, 0xe508, 0x8300, 0xd7b5, 0xffff,
+    0xdfff, 0x8060, 0xffff, 0x8005, 0x5def, 0x0001, 0x7eef, 0x8004, 0x7def, 0x8004, 0x7eef, 0x0002,
+    0x7def, 0x7def, 0x8003, 0x7eef, 0x0001, 0x9eef, 0x800e, 0x7eef, 0x0007, 0x7ef7, 0x7eef, 0x9eef,
+    0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x8006, 0x9ef7, 0x0001, 0x9eef, 0x800c, 0x9ef7, 0x0002, 0xbef7,
+    0x9ef7, 0x8005, 0xbef7, 0x0001, 0x9ef7, 0x8006, 0xbef7, 0x0002, 0x9ef7, 0xbff7, 0x8004, 0xbef7,
+    0x000a, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8009,
+    0xbef7, 0x0032, 0x9ef7, 0x472a, 0xe100, 0x0201, 0x4000, 0x8e6b, 0xffff, 0xbef7, 0xbef7, 0xffff,
+    0x96c6, 0x444c, 0xc45c, 0xe35c, 0x244c, 0x6211, 0x8200, 0xa208, 0x6100, 0x4100, 0x6208, 0xe729,
+    0xe621, 0x6519, 0xec5a, 0xe621, 0x8100, 0xe308, 0xc519, 0xc308, 0x2c5b, 0x76ad, 0x35a5, 0xbef7,
+    0x9ad6, 0x728c, 0x6a4a, 0xc318, 0x4108, 0x6208, 0xa210, 0x6529, 0xa631, 0x0419, 0xc318, 0x8a52,
+    0x58ce, 0xffff, 0xffff, 0xdef7, 0x800f, 0xdfff, 0x0001, 0xffff, 0x8008, 0xdfff, 0x0005, 0xffff,
+    0xdfff, 0xffff, 0xdfff, 0xdfff, 0x8007, 0xffff, 0x001b, 0xdfff, 0xffff, 0xffff, 0x7ee7, 0x344c,
+    0x721b, 0xf42b, 0x1534, 0x763c, 0xef12, 0xe700, 0x8500, 0x8500, 0xe700, 0x2801, 0x0701, 0x2801,
+    0x4901, 0x6901, 0xe800, 0x4d22, 0xac4a, 0x6300, 0xc408, 0x6300, 0x8729, 0x5def, 0x8004, 0xffff,
+    0x0005, 0xaf6b, 0x4300, 0x0511, 0x6300, 0x0c53, 0x8063, 0xffff, 0x8005, 0x5def, 0x0002, 0x5eef,
+    0x5def, 0x8003, 0x7def, 0x8004, 0x7eef, 0x0001, 0x7def, 0x8005, 0x7eef, 0x0004, 0x7def, 0x7def,
+    0x7eef, 0x7def, 0x800c, 0x7eef, 0x8004, 0x9eef, 0x8014, 0x9ef7, 0x8007, 0xbef7, 0x0001, 0x9ef7,
+    0x8007, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8003, 0xbef7, 0x0002,
+    0xbff7, 0xbff7, 0x8004, 0xbef7, 0x0001, 0xbff7, 0x8007, 0xbef7, 0x0014, 0x9ef7, 0xffff, 0x17be,
+    0xe100, 0x0201, 0xe200, 0x2100, 0x96b5, 0xffff, 0xbef7, 0xbef7, 0xffff, 0xd19d, 0x424c, 0xc45c,
+    0xc35c, 0x8454, 0x6211, 0xc208, 0xe210, 0x8003, 0x4100, 0x001d, 0x441a, 0x641a, 0x4209, 0x2311,
+    0x8208, 0xa519, 0xc208, 0x8208, 0x8a4a, 0xb394, 0x2d63, 0x2942, 0xa310, 0x4108, 0x4208, 0xa310,
+    0xa318, 0xa310, 0xe318, 0x8631, 0xc739, 0xa631, 0xe418, 0x6529, 0x484a, 0x518c, 0x7def, 0xffff,
+    0xbef7, 0x8006, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xffff, 0x8005, 0xdfff, 0x8003, 0xffff, 0x8007,
+    0xdfff, 0x0003, 0xffff, 0xffff, 0xdfff, 0x8007, 0xffff, 0x001b, 0xdfff, 0xffff, 0x1cdf, 0x3aae,
+    0x9554, 0xb223, 0xd32b, 0xf42b, 0x353c, 0xb74c, 0x7223, 0x0c02, 0x8a01, 0x4801, 0xc600, 0xe700,
+    0x0701, 0x4901, 0x4801, 0x6901, 0xab01, 0xe700, 0x4200, 0xc408, 0xa408, 0x8408, 0x39c6, 0x8004,
+    0xffff, 0x0006, 0xf8bd, 0xa400, 0xe508, 0xc408, 0x2619, 0x1cdf, 0x8063, 0xffff, 0x8005, 0x5def,
+    0x0001, 0x5eef, 0x8004, 0x7def, 0x8004, 0x7eef, 0x0001, 0x7def, 0x8003, 0x7eef, 0x0001, 0x7def,
+    0x8013, 0x7eef, 0x8003, 0x9eef, 0x0003, 0x9ef7, 0x9ef7, 0x9eef, 0x8010, 0x9ef7, 0x0004, 0xbef7,
+    0x9ef7, 0xbef7, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x800b, 0xbef7, 0x0001, 0xbff7, 0x8004,
+    0xbef7, 0x0002, 0xbff7, 0xbff7, 0x800d, 0xbef7, 0x001a, 0x9ef7, 0xffff, 0xad63, 0x8000, 0xa200,
+    0x2000, 0xc629, 0x9def, 0xdfff, 0xbef7, 0xdfff, 0xdfff, 0xeb74, 0x824c, 0xa35c, 0xc35c, 0x034c,
+    0x6311, 0x8208, 0xa108, 0xe311, 0xa208, 0x4312, 0x0313, 0x6633, 0xa421, 0x8003, 0xc208, 0x0006,
+    0xe308, 0x6521, 0xc310, 0x0000, 0x2108, 0x8310, 0x8004, 0xa310, 0x000c, 0x0421, 0xe318, 0x6529,
+    0xa639, 0xe739, 0x8629, 0xe318, 0x2742, 0xe641, 0x284a, 0x58ce, 0xffff, 0x800d, 0xdfff, 0x0001,
+    0xffff, 0x8003, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x8008,
+    0xffff, 0x0005, 0xdfff, 0xffff, 0xfcce, 0x512b, 0x511b, 0x8003, 0xf433, 0x0013, 0x1534, 0x563c,
+    0x9644, 0x553c, 0x0c02, 0x0c02, 0xec01, 0x2801, 0xc600, 0xe700, 0x4901, 0x6901, 0x8a01, 0x0701,
+    0x8300, 0xc408, 0xc408, 0x4200, 0xd394, 0x8004, 0xffff, 0x0008, 0x7def, 0x8721, 0x8400, 0xe510,
+    0x4300, 0x349d, 0xffff, 0xdfff, 0x8062, 0xffff, 0x8008, 0x5def, 0x8005, 0x7def, 0x8004, 0x7eef,
+    0x0004, 0x7def, 0x7def, 0x7eef, 0x7def, 0x8004, 0x7eef, 0x0001, 0x9eef, 0x8006, 0x7eef, 0x0001,
+    0x7ef7, 0x8006, 0x7eef, 0x0006, 0x9ef7, 0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x8003, 0x9ef7,
+    0x0001, 0x9eef, 0x800c, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x800e, 0xbef7, 0x0004, 0xbff7,
+    0xbef7, 0xbef7, 0xbff7, 0x8003, 0xbef7, 0x0004, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x800b, 0xbef7,
+    0x0034, 0xbff7, 0x7def, 0xc521, 0x4201, 0x650a, 0x6402, 0x2d5c, 0xffff, 0xbef7, 0xdef7, 0xffff,
+    0x7def, 0xa764, 0xa24c, 0xa354, 0x2465, 0x433b, 0xa100, 0x8312, 0x8312, 0xe311, 0xc312, 0x831a,
+    0x2311, 0xa208, 0x0311, 0xa208, 0xc208, 0xc308, 0xa208, 0x4411, 0x2311, 0xa310, 0xa310, 0x8310,
+    0xa310, 0xa318, 0xc318, 0x0421, 0x0421, 0x8631, 0xc639, 0xc739, 0xc639, 0x4529, 0x2421, 0xe95a,
+    0xc639, 0xc318, 0x518c, 0xffff, 0xffff, 0x8003, 0xdfff, 0x0001, 0xbef7, 0x8005, 0xdfff, 0x0003,
+    0xffff, 0xdfff, 0xffff, 0x8003, 0xdfff, 0x0008, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xffff,
+    0xdfff, 0xdfff, 0x8006, 0xffff, 0x001c, 0xdfff, 0xffff, 0xffff, 0x1aae, 0xd33b, 0x7223, 0xd333,
+    0x143c, 0x1434, 0x353c, 0x553c, 0x7644, 0x7644, 0xd854, 0x101b, 0xab01, 0xec01, 0xec01, 0x8a01,
+    0xe600, 0x0701, 0x8a01, 0x6901, 0x8300, 0xa400, 0xc408, 0x4200, 0xcf73, 0x8005, 0xffff, 0x0007,
+    0x2d53, 0x4300, 0x0611, 0x6300, 0xcc52, 0xffff, 0xdfff, 0x8063, 0xffff, 0x0007, 0x5def, 0x5def,
+    0x7def, 0x5def, 0x5def, 0x5eef, 0x5eef, 0x8003, 0x5def, 0x0003, 0x7def, 0x7def, 0x7eef, 0x8003,
+    0x7def, 0x0006, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7def, 0x7def, 0x8011, 0x7eef, 0x0002, 0x9ef7,
+    0x9ef7, 0x8003, 0x9eef, 0x8004, 0x9ef7, 0x0001, 0x9eef, 0x8008, 0x9ef7, 0x0001, 0xbef7, 0x8003,
+    0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8006, 0xbef7, 0x0003, 0x9ef7, 0xbef7, 0xbff7, 0x8005,
+    0xbef7, 0x0004, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8004, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x800d,
+    0xbef7, 0x0021, 0xffff, 0x58be, 0x8402, 0x0503, 0xe502, 0x8201, 0x3395, 0xffff, 0xbef7, 0xbef7,
+    0xffff, 0x1adf, 0x6554, 0x6244, 0xc35c, 0xe464, 0xc33b, 0x4212, 0xc309, 0xc312, 0x0212, 0x2100,
+    0xc308, 0xe310, 0x0311, 0x2419, 0x8208, 0x8208, 0xc208, 0x4100, 0xc208, 0xa419, 0x4319, 0x8003,
+    0xa310, 0x0011, 0xa210, 0x0421, 0x0421, 0x8531, 0xc739, 0xa739, 0xc739, 0x8631, 0x0421, 0x6529,
+    0xc95a, 0xe639, 0x6208, 0x0c63, 0x5def, 0xffff, 0xdff7, 0x8003, 0xffff, 0x0001, 0xbff7, 0x8005,
+    0xdfff, 0x0002, 0xffff, 0xffff, 0x8005, 0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x8004, 0xffff,
+    0x001e, 0xdfff, 0xdfff, 0xffff, 0xffff, 0x7ee7, 0x177d, 0x922b, 0xf433, 0x143c, 0x143c, 0x343c,
+    0x353c, 0x553c, 0x553c, 0x7644, 0x7644, 0xd74c, 0x7644, 0x143c, 0x922b, 0x0d02, 0x0d02, 0xab01,
+    0xab01, 0x4801, 0x8400, 0x8300, 0xc508, 0x4200, 0xcc52, 0x8003, 0xffff, 0x0008, 0xdfff, 0xffff,
+    0xb38c, 0x4300, 0xe508, 0xa408, 0x2619, 0x1ce7, 0x8065, 0xffff, 0x0003, 0x5def, 0x5def, 0x7def,
+    0x8003, 0x5def, 0x0001, 0x7eef, 0x8004, 0x5def, 0x000b, 0x7def, 0x7def, 0x7eef, 0x7def, 0x7def,
+    0x7eef, 0x7def, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x8011, 0x7eef, 0x0005, 0x9eef, 0x9ef7, 0x9eef,
+    0x9ef7, 0x9eef, 0x8012, 0x9ef7, 0x0005, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x8005, 0xbef7,
+    0x0001, 0xbff7, 0x8007, 0xbef7, 0x0001, 0xbff7, 0x800e, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7,
+    0x0026, 0xbff7, 0x9ef7, 0xffff, 0xf174, 0x4302, 0x6502, 0x8301, 0xc409, 0x79c6, 0xffff, 0xbef7,
+    0xbef7, 0xffff, 0xb8ce, 0x234c, 0xa354, 0xa354, 0xc45c, 0xc222, 0xc212, 0xa322, 0x0100, 0x0309,
+    0x2311, 0xc308, 0x6419, 0x6419, 0xe310, 0x8208, 0xa208, 0xa208, 0x2311, 0x2311, 0xe421, 0xe310,
+    0xa310, 0xc318, 0xa210, 0x8003, 0xe318, 0x0011, 0x6529, 0x8631, 0xc739, 0x0742, 0x4529, 0xe418,
+    0x4529, 0xc952, 0x684a, 0xc318, 0xa631, 0xf8bd, 0xffff, 0x7def, 0xb7bd, 0x7def, 0xffff, 0x800d,
+    0xdfff, 0x0002, 0xffff, 0xffff, 0x8005, 0xdfff, 0x000a, 0xffff, 0xffff, 0x9eef, 0xf99d, 0x1444,
+    0xb32b, 0xf43b, 0xf433, 0x1434, 0x343c, 0x8003, 0x353c, 0x0011, 0x553c, 0x563c, 0x5644, 0x9744,
+    0xb74c, 0x1855, 0x1955, 0x7634, 0xf51b, 0xb413, 0x4e02, 0xa300, 0x8400, 0xc508, 0x4300, 0x293a,
+    0x9ef7, 0x8004, 0xffff, 0x0006, 0xd7b5, 0xa400, 0xc508, 0xe508, 0x8400, 0xb7b5, 0x8066, 0xffff,
+    0x0008, 0x5de7, 0x5def, 0x5def, 0x7def, 0x7def, 0x5def, 0x5def, 0x7def, 0x8003, 0x5def, 0x8004,
+    0x7def, 0x0002, 0x7eef, 0x7def, 0x8004, 0x7eef, 0x0001, 0x7def, 0x8004, 0x7eef, 0x0001, 0x9eef,
+    0x8006, 0x7eef, 0x0001, 0x9eef, 0x8005, 0x7eef, 0x0007, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9ef7,
+    0x9ef7, 0x9eef, 0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7, 0x8019, 0xbef7, 0x0002, 0xbff7,
+    0xbff7, 0x800d, 0xbef7, 0x0024, 0xdfff, 0x0b44, 0x0202, 0xc401, 0xa301, 0x8722, 0x5ce7, 0xffff,
+    0xbef7, 0xbef7, 0xffff, 0x56be, 0xe243, 0x8354, 0x8354, 0xa354, 0x0344, 0x2101, 0x8209, 0x4312,
+    0x6311, 0x041a, 0xe208, 0xe208, 0x8108, 0xc208, 0xa208, 0xc208, 0xa208, 0xc310, 0x4419, 0xe318,
+    0xa310, 0xc318, 0xa310, 0xa310, 0x8003, 0xc318, 0x0014, 0xe318, 0x8631, 0xc739, 0x0842, 0x8631,
+    0xe418, 0xe418, 0xc639, 0xa631, 0xe418, 0x4529, 0x0c63, 0xa731, 0x6208, 0xe839, 0x14a5, 0xbef7,
+    0xffff, 0xffff, 0xdef7, 0x8009, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x8003, 0xffff, 0x0005,
+    0x7ee7, 0xd99d, 0x544c, 0xd333, 0xf43b, 0x8003, 0x143c, 0x0015, 0x3544, 0x353c, 0x353c, 0x5544,
+    0x5544, 0x553c, 0x553c, 0x563c, 0x9644, 0xb74c, 0xb74c, 0x7634, 0xf513, 0xf513, 0x4d0a, 0x8400,
+    0x8300, 0xc400, 0x4200, 0xe931, 0x5def, 0x8004, 0xffff, 0x0008, 0xdbd6, 0x2611, 0xa400, 0xe508,
+    0x4200, 0x317c, 0xffff, 0xdfff, 0x8065, 0xffff, 0x8003, 0x5def, 0x0006, 0x7def, 0x7def, 0x5def,
+    0x5def, 0x7def, 0x7def, 0x8003, 0x5def, 0x8003, 0x7def, 0x8014, 0x7eef, 0x000b, 0x9eef, 0x9eef,
+    0x7eef, 0x7ef7, 0x9ef7, 0x9ef7, 0x7eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x800f, 0x9ef7, 0x0005,
+    0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x8012, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x0002,
+    0xbff7, 0xdef7, 0x8003, 0xbef7, 0x0001, 0xdef7, 0x8008, 0xbef7, 0x0020, 0xdfff, 0x5ce7, 0xa61a,
+    0xc301, 0x0502, 0xa301, 0x0a3b, 0xbef7, 0xdfff, 0xbef7, 0xbef7, 0xffff, 0x35b6, 0xc243, 0x6354,
+    0x6454, 0x8212, 0xa30a, 0xe209, 0xe211, 0x841a, 0xe208, 0x6108, 0xa208, 0xc210, 0x8208, 0x6200,
+    0xa208, 0xc208, 0x0311, 0xc310, 0xa310, 0x8003, 0xc318, 0x0001, 0xa310, 0x8003, 0xc318, 0x0015,
+    0xa210, 0xa210, 0x4529, 0xa631, 0x2842, 0xe639, 0x6529, 0xc531, 0x2642, 0x6529, 0x6529, 0x0421,
+    0x0419, 0x0421, 0x8310, 0x4208, 0xc839, 0x35ad, 0xbef7, 0xffff, 0xffff, 0x8009, 0xdfff, 0x8003,
+    0xffff, 0x001f, 0x7ee7, 0x9bbe, 0x788d, 0x5554, 0xf43b, 0x153c, 0x3544, 0x3544, 0x143c, 0x343c,
+    0x353c, 0x3544, 0x5544, 0x353c, 0x553c, 0x553c, 0x9644, 0x9744, 0xb74c, 0xb744, 0xd74c, 0x7634,
+    0xd40b, 0x730b, 0xeb09, 0x8300, 0x8300, 0xc500, 0x4300, 0xe931, 0x5def, 0x8004, 0xffff, 0x0006,
+    0x7eef, 0xc829, 0x8400, 0xe508, 0x6300, 0xab4a, 0x8068, 0xffff, 0x8004, 0x5def, 0x0003, 0x7def,
+    0x5def, 0x5def, 0x8003, 0x7def, 0x8003, 0x5def, 0x0006, 0x7def, 0x7def, 0x7eef, 0x7def, 0x7eef,
+    0x7def, 0x800e, 0x7eef, 0x0001, 0x9eef, 0x8004, 0x7eef, 0x0002, 0x9ef7, 0x7eef, 0x8004, 0x9ef7,
+    0x0001, 0x9eef, 0x8010, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x800b, 0xbef7, 0x8003, 0xbff7,
+    0x800e, 0xbef7, 0x0001, 0xbff7, 0x8009, 0xbef7, 0x0023, 0xbff7, 0x9ef7, 0xffff, 0x78c6, 0xc309,
+    0xe401, 0x2502, 0xa201, 0xcc53, 0xffff, 0xdfff, 0xbef7, 0xbef7, 0xffff, 0x35b6, 0xa343, 0xc21a,
+    0x830a, 0xa312, 0x220a, 0x0212, 0x2209, 0x8108, 0xe210, 0xc208, 0x8208, 0x8429, 0x8329, 0x6100,
+    0x8208, 0x6100, 0xc310, 0xa210, 0xc318, 0xe318, 0x8003, 0xc318, 0x0019, 0xa310, 0xc318, 0x0421,
+    0x0321, 0xe318, 0x6429, 0x2642, 0xa74a, 0xe74a, 0x0753, 0x0753, 0xa74a, 0xa631, 0x4629, 0x8631,
+    0x8631, 0x6529, 0x2521, 0x6208, 0x4200, 0xa731, 0x518c, 0x1ce7, 0xffff, 0xffff, 0x8003, 0xdfff,
+    0x8004, 0xffff, 0x0009, 0x5de7, 0x5ab6, 0x5785, 0x5554, 0x1444, 0xf43b, 0x3544, 0x5544, 0x5544,
+    0x8003, 0x343c, 0x0015, 0x143c, 0x143c, 0x343c, 0x353c, 0x7644, 0x9644, 0x9644, 0xf33b, 0x8d22,
+    0x6d22, 0x512b, 0x5223, 0xb413, 0x320b, 0x6901, 0x6400, 0xa400, 0xc500, 0x2200, 0x2a3a, 0x7def,
+    0x8004, 0xffff, 0x0007, 0xbef7, 0x6b42, 0x6300, 0xe508, 0x6400, 0xc829, 0x7def, 0x8068, 0xffff,
+    0x8009, 0x5def, 0x0004, 0x7def, 0x7def, 0x5def, 0x5def, 0x8007, 0x7def, 0x0002, 0x7eef, 0x7def,
+    0x8010, 0x7eef, 0x0002, 0x9ef7, 0x9ef7, 0x8004, 0x9eef, 0x0004, 0x9ef7, 0x9ef7, 0x7eef, 0x9eef,
+    0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0x9ef7, 0x8015, 0xbef7,
+    0x0004, 0xbff7, 0xbef7, 0xdff7, 0xdef7, 0x8005, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x0009,
+    0x9ef7, 0xffff, 0x94a5, 0xc201, 0x0402, 0x2402, 0xa101, 0xed63, 0xffff, 0x8003, 0xbef7, 0x001e,
+    0xffff, 0x37be, 0xe422, 0x810a, 0xa312, 0x820a, 0xa312, 0x4101, 0x031a, 0x6211, 0x0432, 0x8784,
+    0xa67c, 0x643a, 0x8208, 0xa210, 0x2100, 0x6100, 0xc318, 0x4208, 0x8310, 0x6308, 0x8308, 0x6208,
+    0x8310, 0x4521, 0x6521, 0x4421, 0x8429, 0x463a, 0x8003, 0x8642, 0x0010, 0xc74a, 0x2753, 0x2753,
+    0x4753, 0x263a, 0x2521, 0x6529, 0x6529, 0xc639, 0xa639, 0x6529, 0xa310, 0x4200, 0x4521, 0xcf7b,
+    0xbad6, 0x8003, 0xffff, 0x000c, 0x59c6, 0x517c, 0x2d5b, 0xb47c, 0xf76c, 0x554c, 0x354c, 0x354c,
+    0x554c, 0x554c, 0x5544, 0x3544, 0x8003, 0x5544, 0x0015, 0x7544, 0x7644, 0x9644, 0x553c, 0x143c,
+    0xae22, 0xaa11, 0xc911, 0xc500, 0x4300, 0x6300, 0x8400, 0xe600, 0x6901, 0xc600, 0x4300, 0x8400,
+    0xa408, 0x4300, 0xac4a, 0x9ef7, 0x8004, 0xffff, 0x0007, 0xdfff, 0xcc4a, 0x4300, 0x0509, 0xa400,
+    0x2611, 0xbbd6, 0x8069, 0xffff, 0x0001, 0x5de7, 0x8009, 0x5def, 0x0007, 0x7def, 0x5def, 0x5def,
+    0x7def, 0x7def, 0x7eef, 0x7eef, 0x8004, 0x7def, 0x800d, 0x7eef, 0x0001, 0x7def, 0x8005, 0x7eef,
+    0x8004, 0x9eef, 0x0004, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8003,
+    0x9ef7, 0x801a, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xdef7, 0x8004, 0xbef7, 0x8003,
+    0xbff7, 0x0049, 0xbef7, 0xbef7, 0xbff7, 0x9ef7, 0xffff, 0x128d, 0x8201, 0x2402, 0x2402, 0x4101,
+    0x0e6c, 0xffff, 0xdfff, 0xdef7, 0xbef7, 0xffff, 0xd9d6, 0x2533, 0x810a, 0x830a, 0x620a, 0x620a,
+    0x8201, 0x222a, 0x468d, 0xe68c, 0xe67b, 0xe662, 0xa210, 0x877b, 0x489c, 0x4100, 0xc339, 0xe572,
+    0xc56a, 0xa462, 0x8462, 0xe46a, 0x6573, 0x657b, 0x4573, 0x666b, 0xc87b, 0x6773, 0x276b, 0x0663,
+    0x0763, 0x0763, 0xc652, 0xe429, 0x663a, 0xe74a, 0x0632, 0x0419, 0x4521, 0x2521, 0x0419, 0xa639,
+    0x6629, 0xc410, 0x8308, 0x4208, 0xc318, 0xaa52, 0x107c, 0xcb42, 0xa819, 0x8711, 0x2501, 0x8300,
+    0x0a12, 0x344c, 0xb754, 0x8003, 0x764c, 0x0018, 0x5544, 0x7644, 0x7544, 0x5544, 0x3444, 0x913b,
+    0x0f33, 0x4c22, 0xca19, 0x2709, 0x8400, 0x4300, 0x4300, 0x6300, 0x8400, 0x8400, 0xa500, 0xa400,
+    0x8400, 0xa500, 0xc600, 0xa500, 0x4300, 0xaf6b, 0x8005, 0xffff, 0x0009, 0xdfff, 0x0d5b, 0x4300,
+    0xe508, 0xa500, 0xe510, 0x59c6, 0xffff, 0xdfff, 0x8068, 0xffff, 0x8007, 0x5def, 0x0001, 0x7def,
+    0x8005, 0x5def, 0x0008, 0x7def, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7def, 0x8014,
+    0x7eef, 0x8005, 0x9eef, 0x0006, 0x9ef7, 0x9ef7, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x800b, 0x9ef7,
+    0x8015, 0xbef7, 0x0004, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x800c, 0xbef7, 0x0065, 0xdef7, 0xbef7,
+    0xbef7, 0xbff7, 0xbff7, 0xbef7, 0x9ef7, 0xffff, 0x6f74, 0x6201, 0x0502, 0x0402, 0x6201, 0xee6b,
+    0xffff, 0xdfff, 0xbef7, 0xbef7, 0xffff, 0x5ce7, 0xca53, 0x4102, 0x620a, 0x420a, 0xe201, 0xe43a,
+    0x2684, 0x8acd, 0xcefe, 0xcaac, 0x8208, 0x877b, 0xb0ff, 0x477b, 0xc329, 0x8bfe, 0x0af6, 0xc9ed,
+    0xc8e5, 0x4bee, 0x4cee, 0x2aee, 0x86e5, 0x2dee, 0x54ff, 0xf1f6, 0xd0ee, 0x8fee, 0x4fee, 0x2ee6,
+    0x6dc5, 0x6863, 0x8419, 0x0522, 0xc742, 0x062a, 0x2632, 0x8873, 0xe78b, 0x8683, 0x868b, 0xe89b,
+    0x49ac, 0x8bac, 0x6bac, 0x0a9c, 0xca8b, 0xeb8b, 0x2b94, 0x2c94, 0xaea4, 0x2d8c, 0xc952, 0x4609,
+    0xad22, 0xd233, 0xd233, 0xb22b, 0xd32b, 0xd32b, 0x922b, 0x5123, 0x4c1a, 0x8909, 0xaa11, 0x0b12,
+    0xcf22, 0xef1a, 0x4d0a, 0x6d0a, 0x2c0a, 0xec01, 0x0c02, 0x2c02, 0x2c02, 0x6d02, 0x8e02, 0xf00a,
+    0xd002, 0xaf02, 0x368d, 0x8005, 0xffff, 0x0009, 0xdff7, 0xed52, 0x4300, 0xe508, 0xa400, 0xc408,
+    0xd7b5, 0xffff, 0xdfff, 0x8069, 0xffff, 0x0003, 0x5def, 0x5def, 0x7def, 0x8007, 0x5def, 0x0003,
+    0x7def, 0x5def, 0x5def, 0x8003, 0x7def, 0x000f, 0x7eef, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7eef,
+    0x7eef, 0x7def, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x9eef, 0x8008, 0x7eef, 0x0003,
+    0x9ef7, 0x7eef, 0x7eef, 0x8003, 0x9eef, 0x0004, 0x7eef, 0x9eef, 0x9ef7, 0x7eef, 0x8003, 0x9ef7,
+    0x0001, 0x9eef, 0x800b, 0x9ef7, 0x8014, 0xbef7, 0x0001, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xbff7,
+    0x800b, 0xbef7, 0x0003, 0xdef7, 0xbff7, 0xbff7, 0x8005, 0xbef7, 0x0028, 0xffff, 0x4e6c, 0x6201,
+    0x0402, 0x2402, 0x4101, 0x8c5b, 0xdfff, 0xffff, 0xbef7, 0xbef7, 0xffff, 0xdfff, 0xcf7c, 0xc101,
+    0xe101, 0x230a, 0x0201, 0xa100, 0xacac, 0xb2ff, 0xcaac, 0x664a, 0xe65a, 0x51f7, 0x4fde, 0x664a,
+    0x4cee, 0xeaed, 0x68dd, 0xd1f6, 0x54ff, 0x34ff, 0x33ff, 0x8ff6, 0x2df6, 0x12ff, 0x13ff, 0x33ff,
+    0x53ff, 0x8003, 0x74ff, 0x0025, 0x32ff, 0xcfc5, 0x8642, 0xe421, 0x862a, 0x2522, 0xa421, 0xe55a,
+    0x8bcd, 0x6acd, 0xecdd, 0x11ff, 0xd1fe, 0xd1fe, 0xd2fe, 0xb1f6, 0x70e6, 0x51de, 0x51d6, 0x73ce,
+    0xb6c6, 0xbaae, 0x7424, 0x340c, 0x951c, 0x951c, 0x9524, 0x752c, 0x542c, 0x1414, 0x1404, 0xf403,
+    0xf403, 0xf40b, 0xf30b, 0xd30b, 0xd30b, 0x8003, 0x9303, 0x8003, 0xb303, 0x0006, 0x9303, 0x7203,
+    0x720b, 0x3103, 0xd323, 0xbbbe, 0x8005, 0xffff, 0x0009, 0x7def, 0x6b42, 0x4300, 0xe508, 0xa500,
+    0xc408, 0xb6b5, 0xffff, 0xdfff, 0x806a, 0xffff, 0x8004, 0x5def, 0x0002, 0x7def, 0x7def, 0x8004,
+    0x5def, 0x0006, 0x7def, 0x5def, 0x5def, 0x7def, 0x7eef, 0x7eef, 0x8004, 0x7def, 0x0003, 0x7eef,
+    0x7def, 0x7def, 0x8012, 0x7eef, 0x0008, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9ef7,
+    0x9eef, 0x800f, 0x9ef7, 0x8014, 0xbef7, 0x0001, 0xbff7, 0x8005, 0xbef7, 0x0001, 0xbff7, 0x8009,
+    0xbef7, 0x003e, 0xbff7, 0xbff7, 0xbef7, 0xdef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xffff,
+    0x2e74, 0x4101, 0xe401, 0xe401, 0x4201, 0x0a43, 0x7def, 0xffff, 0xbef7, 0xdef7, 0xdfff, 0xffff,
+    0x15b6, 0x231a, 0xa101, 0x031a, 0x232a, 0x6cad, 0x52ff, 0x74ff, 0xed94, 0xa442, 0xf1f6, 0xb3ff,
+    0x11ff, 0xeffe, 0x10ff, 0x0ce6, 0xebe5, 0x8ff6, 0xd1f6, 0x12ff, 0x53ff, 0xb1f6, 0x6fee, 0xf1fe,
+    0xb0f6, 0x8ff6, 0xb0f6, 0xf2fe, 0xf2fe, 0x53ff, 0x91de, 0x685b, 0x452a, 0xe73a, 0x452a, 0xa74a,
+    0xf1c5, 0x75ff, 0x34ff, 0xf4fe, 0x8003, 0xd3f6, 0x0017, 0x59ef, 0x97c6, 0x77b6, 0x379e, 0xf785,
+    0xb775, 0xd85d, 0xd93d, 0xda25, 0xfa25, 0xda1d, 0xda15, 0xda15, 0xd91d, 0xfa25, 0xda1d, 0xb90d,
+    0xda0d, 0x9a0d, 0x990d, 0x9905, 0x7805, 0x3805, 0x8003, 0x1705, 0x0008, 0x1605, 0xf604, 0xf704,
+    0xf60c, 0xb604, 0x9504, 0xb85d, 0xbeef, 0x8005, 0xffff, 0x0009, 0xfbde, 0xe929, 0x6300, 0xe508,
+    0xa500, 0xc508, 0xb7b5, 0xffff, 0xdfff, 0x806b, 0xffff, 0x8005, 0x5def, 0x0001, 0x7def, 0x8004,
+    0x5def, 0x0003, 0x7def, 0x5def, 0x5def, 0x8003, 0x7def, 0x0001, 0x7eef, 0x8003, 0x7def, 0x0003,
+    0x7eef, 0x7eef, 0x7def, 0x8003, 0x7eef, 0x0001, 0x7def, 0x800e, 0x7eef, 0x0003, 0x9eef, 0x7eef,
+    0x7eef, 0x8003, 0x9eef, 0x800f, 0x9ef7, 0x0008, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7,
+    0xbef7, 0x9ef7, 0x8014, 0xbef7, 0x0005, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8005, 0xbef7,
+    0x0002, 0xbff7, 0xbff7, 0x8003, 0xbef7, 0x8003, 0xbff7, 0x0037, 0xbef7, 0xbef7, 0xffff, 0x907c,
+    0x2101, 0xa301, 0xe401, 0x4201, 0x682a, 0xbace, 0xffff, 0xbef7, 0xdef7, 0xbef7, 0xffff, 0x5ce7,
+    0x2d85, 0x6254, 0x835c, 0x0354, 0xabad, 0x33ef, 0x276c, 0xe232, 0x0ece, 0xcdc5, 0x6cbd, 0xf0f6,
+    0xf0f6, 0x32ff, 0xf1fe, 0x8ff6, 0x4eee, 0x8aac, 0xeedd, 0xebac, 0x6a9c, 0x32ff, 0x33ff, 0xb1f6,
+    0xf2fe, 0x13ff, 0x55ff, 0x0d9d, 0xe74a, 0xe742, 0x652a, 0xe632, 0x662a, 0xa511, 0x873a, 0xcecd,
+    0xd1fe, 0xb1f6, 0xb1f6, 0x8003, 0xd2f6, 0x001f, 0xf3fe, 0xf3fe, 0x13ff, 0x13ff, 0xf3fe, 0xf3f6,
+    0xb3e6, 0x74c6, 0x75be, 0x96b6, 0x779e, 0x377e, 0x3876, 0x1766, 0xb745, 0x9735, 0xb73d, 0xd845,
+    0x972d, 0xd93d, 0x1a4e, 0x5a5e, 0xf93d, 0x3605, 0x1605, 0x1605, 0xf504, 0xf504, 0x9404, 0xf514,
+    0xbb9e, 0x8006, 0xffff, 0x0009, 0xd7b5, 0x6711, 0x8400, 0x0609, 0x8400, 0x0609, 0xf8bd, 0xffff,
+    0xdfff, 0x806c, 0xffff, 0x0002, 0x5def, 0x3de7, 0x8004, 0x5def, 0x0001, 0x7def, 0x8003, 0x5def,
+    0x0004, 0x7def, 0x5def, 0x5def, 0x7eef, 0x8005, 0x7def, 0x0003, 0x7eef, 0x7def, 0x7def, 0x8013,
+    0x7eef, 0x0010, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef,
+    0x9ef7, 0x9ef7, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x8007, 0x9ef7, 0x8004, 0xbef7, 0x0005, 0x9ef7,
+    0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x8010, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8009, 0xbef7, 0x8003,
+    0xbff7, 0x0001, 0xbef7, 0x8005, 0xbff7, 0x0034, 0xbef7, 0xbef7, 0xffff, 0xf28c, 0x2201, 0x6201,
+    0xe401, 0x8201, 0xc409, 0xd6ad, 0xffff, 0xdfff, 0xdef7, 0xbef7, 0xffff, 0xffff, 0x95be, 0xc564,
+    0xc03b, 0xc13b, 0xa243, 0x4233, 0x823b, 0x623b, 0xe34a, 0xeed5, 0x52ff, 0x2ed6, 0x8894, 0x34f7,
+    0x14f7, 0x73ff, 0x6a9c, 0x6873, 0xecac, 0xa652, 0xf7ff, 0x6a8c, 0x8c8c, 0xb7ff, 0x14ff, 0x14ff,
+    0x11ce, 0xad9c, 0x2209, 0xa311, 0x6522, 0xc873, 0x6a9c, 0x0763, 0xa55a, 0x2dee, 0x8003, 0x6ef6,
+    0x0001, 0x6ff6, 0x8003, 0x6ef6, 0x0015, 0x8ef6, 0x6df6, 0x8df6, 0x8dfe, 0x8dfe, 0xaefe, 0xaefe,
+    0xcdfe, 0xcefe, 0xd0fe, 0xf1fe, 0xf1fe, 0x11ff, 0x14ff, 0x15ff, 0x58f7, 0x9cf7, 0x9eef, 0x7ddf,
+    0xdbae, 0xd755, 0x8003, 0xf404, 0x0004, 0xd404, 0x9304, 0xd85d, 0xbee7, 0x8006, 0xffff, 0x0009,
+    0xd885, 0xca01, 0x8400, 0xc508, 0x8400, 0x4719, 0x79c6, 0xffff, 0xdfff, 0x806d, 0xffff, 0x0002,
+    0x5def, 0x5de7, 0x800c, 0x5def, 0x0004, 0x7def, 0x7def, 0x5def, 0x7def, 0x8003, 0x7eef, 0x000b,
+    0x7def, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x8009,
+    0x7eef, 0x000d, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9eef,
+    0x9ef7, 0x9ef7, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x8006, 0x9ef7, 0x000b, 0xbef7, 0x9ef7,
+    0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x8003, 0xbef7, 0x0001,
+    0x9ef7, 0x8007, 0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x8008, 0xbef7, 0x0004,
+    0xbff7, 0xbff7, 0xbef7, 0xbef7, 0x8006, 0xbff7, 0x0039, 0xbef7, 0x9ef7, 0xffff, 0xd6ad, 0x8409,
+    0x4201, 0xe409, 0xa301, 0x8301, 0x5074, 0x9ef7, 0xffff, 0xbef7, 0xbff7, 0xdff7, 0xffff, 0xbdef,
+    0xf0a5, 0x034c, 0x8033, 0xe24b, 0x4354, 0xe133, 0xc87c, 0x0fd6, 0xd0ee, 0xf2ee, 0xa222, 0xc442,
+    0x276b, 0x54f7, 0xb2e6, 0x4542, 0x8fb5, 0x453a, 0x2b74, 0x8101, 0x4422, 0x0a7c, 0x13ff, 0x33ff,
+    0x11de, 0x8319, 0x863a, 0x8ebd, 0x0853, 0x065b, 0x30ff, 0x11ff, 0x8ecd, 0x0ee6, 0xb0fe, 0x90f6,
+    0xb1fe, 0xd1fe, 0xf3fe, 0x14ff, 0x8003, 0x35ff, 0x0018, 0x55ff, 0x55ff, 0x35ff, 0x55ff, 0x57ff,
+    0x59ef, 0x37e7, 0x58f7, 0x79f7, 0x5ad7, 0x1bbf, 0x1bb7, 0xdba6, 0x9a8e, 0x386e, 0xb545, 0x532d,
+    0xd104, 0xb104, 0x1205, 0xd104, 0xb204, 0x553d, 0xdbb6, 0x8006, 0xffff, 0x000a, 0x9ee7, 0x154d,
+    0xb103, 0x1404, 0x710b, 0x2701, 0xe929, 0xfcde, 0xffff, 0xdfff, 0x806e, 0xffff, 0x0001, 0x5de7,
+    0x8009, 0x5def, 0x0003, 0x5eef, 0x5def, 0x7eef, 0x8003, 0x7def, 0x0002, 0x5def, 0x7def, 0x8003,
+    0x7eef, 0x0007, 0x7def, 0x7def, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7eef, 0x8005, 0x7def, 0x8007,
+    0x7eef, 0x0001, 0x9eef, 0x8003, 0x7eef, 0x0005, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x8005,
+    0x9ef7, 0x0001, 0x9eef, 0x8009, 0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7, 0x8010, 0xbef7, 0x8003,
+    0xbff7, 0x0008, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8003, 0xbef7,
+    0x8008, 0xbff7, 0x0002, 0xbef7, 0xbff7, 0x8003, 0xbef7, 0x0051, 0x9ef7, 0xffff, 0x9ace, 0x4722,
+    0x2101, 0xa301, 0xe401, 0x0302, 0xeb33, 0xface, 0xffff, 0xdfff, 0xdff7, 0xdff7, 0xffff, 0xffff,
+    0x3be7, 0x2d8d, 0x034c, 0xc03b, 0xc133, 0x0444, 0xe111, 0xe532, 0x296c, 0xe101, 0x6643, 0x4a8c,
+    0xc75a, 0xb7ff, 0x4763, 0x032a, 0xa209, 0x8001, 0xc101, 0xa632, 0x2eb5, 0x50de, 0xb5ff, 0x0763,
+    0x095b, 0x75ff, 0x51ee, 0x0963, 0x285b, 0xb2ee, 0xf3f6, 0x35ff, 0x15ff, 0x15f7, 0x57ff, 0x99ff,
+    0x9aff, 0xbbff, 0xdbff, 0xbbf7, 0xdaff, 0xdaff, 0x9aff, 0x39df, 0xfdff, 0x578e, 0x1886, 0x763d,
+    0xb414, 0x3976, 0x983d, 0xb404, 0xd404, 0xf304, 0xf204, 0xf014, 0x1025, 0x101d, 0x302d, 0x2f25,
+    0x0f1d, 0xae0c, 0x1235, 0x99a6, 0xdfff, 0x8006, 0xffff, 0x000a, 0x9aae, 0x121c, 0x9103, 0xf20b,
+    0xf203, 0xd203, 0xb54c, 0x7eef, 0xffff, 0xdfff, 0x806f, 0xffff, 0x0001, 0x5de7, 0x800c, 0x5def,
+    0x0001, 0x5eef, 0x8003, 0x7def, 0x0010, 0x5def, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7def, 0x7eef,
+    0x7def, 0x7def, 0x7eef, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x8004, 0x7eef, 0x0001,
+    0x7def, 0x8007, 0x7eef, 0x0003, 0x9eef, 0x7eef, 0x7eef, 0x8006, 0x9ef7, 0x0001, 0x9eef, 0x800f,
+    0x9ef7, 0x0004, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x800b, 0xbef7, 0x8003, 0xbff7, 0x000e, 0xbef7,
+    0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7,
+    0xbef7, 0x8005, 0xbff7, 0x8004, 0xbef7, 0x0050, 0xbff7, 0xbef7, 0x9ef7, 0xffff, 0x7def, 0xed53,
+    0x8402, 0xa80b, 0x490c, 0xe703, 0x0804, 0xd385, 0xdef7, 0xffff, 0xdff7, 0xdff7, 0xdef7, 0xffff,
+    0xffff, 0x3bdf, 0x6e8d, 0x2333, 0xc001, 0x0112, 0x620a, 0x4102, 0x620a, 0x820a, 0x664b, 0x4109,
+    0x8963, 0x2a74, 0x2001, 0x020a, 0x6312, 0xc101, 0x2fa5, 0x495b, 0xe96b, 0xf8ff, 0x8c94, 0xc73a,
+    0x14ff, 0xb0dd, 0x0c8c, 0xd5ee, 0x57ff, 0x36ff, 0x57f7, 0x79f7, 0x7aef, 0x9bef, 0x9bef, 0xbbf7,
+    0x9aef, 0x9aef, 0xdcff, 0x5ae7, 0x78be, 0x1ac7, 0xb234, 0x1786, 0xb12c, 0x2f04, 0x9104, 0x7204,
+    0x9104, 0xb004, 0x8f04, 0x101d, 0x0f1d, 0xee1c, 0x0f2d, 0x2f35, 0x0f25, 0xee1c, 0xee24, 0x7155,
+    0x98a6, 0xdff7, 0x8006, 0xffff, 0x0008, 0x9ee7, 0x5665, 0x9003, 0xd103, 0xf20b, 0xb103, 0xb103,
+    0xb87d, 0x8073, 0xffff, 0x8005, 0x5def, 0x0001, 0x5de7, 0x8007, 0x5def, 0x8006, 0x7def, 0x0002,
+    0x7eef, 0x7eef, 0x8005, 0x7def, 0x0003, 0x7eef, 0x7def, 0x7def, 0x800d, 0x7eef, 0x8005, 0x9eef,
+    0x0002, 0x7eef, 0x9eef, 0x8005, 0x9ef7, 0x0002, 0x9eef, 0x9eef, 0x800f, 0x9ef7, 0x0002, 0xbef7,
+    0x9ef7, 0x800d, 0xbef7, 0x0003, 0xbff7, 0xbff7, 0xbef7, 0x8004, 0xbff7, 0x8003, 0xbef7, 0x0006,
+    0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x0004, 0xdff7, 0xbff7, 0xbff7,
+    0xdff7, 0x8003, 0xbff7, 0x001f, 0xbef7, 0xdef7, 0xbef7, 0xdfff, 0xffff, 0xf58d, 0xa803, 0xa603,
+    0x490c, 0x4904, 0xc703, 0x6c34, 0xd9c6, 0xffff, 0xffff, 0xdff7, 0xdef7, 0xdff7, 0xffff, 0xffff,
+    0x1bdf, 0xaf84, 0x642a, 0x0002, 0x2102, 0x420a, 0xa212, 0xe101, 0xc201, 0xc101, 0x020a, 0x8003,
+    0x4202, 0x0010, 0x631a, 0x4432, 0x2001, 0x441a, 0x79f7, 0xf2bd, 0x8101, 0x72e6, 0xca93, 0x35d6,
+    0x79ff, 0x59ef, 0x59ef, 0x7ae7, 0x7ae7, 0x7aef, 0x8003, 0x7ae7, 0x0018, 0xbbef, 0x3ad7, 0xf695,
+    0x135d, 0xce13, 0xd124, 0xd104, 0x9004, 0xd10c, 0x9004, 0xd00c, 0xf014, 0xcf14, 0xef24, 0x0f25,
+    0x2f2d, 0x2f2d, 0x2f35, 0x2e2d, 0xee24, 0xee2c, 0x9255, 0xd9b6, 0xdfff, 0x8007, 0xffff, 0x0008,
+    0x7a9e, 0x321c, 0x7003, 0xd103, 0xf103, 0x7003, 0x121c, 0xbbb6, 0x8074, 0xffff, 0x8004, 0x5def,
+    0x0001, 0x5de7, 0x8004, 0x5def, 0x0001, 0x7def, 0x8005, 0x5def, 0x0002, 0x7def, 0x7eef, 0x8008,
+    0x7def, 0x0004, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x800d, 0x7eef, 0x0002, 0x9eef, 0x9eef, 0x8003,
+    0x7eef, 0x8003, 0x9eef, 0x8004, 0x9ef7, 0x0002, 0x9eef, 0x9eef, 0x800f, 0x9ef7, 0x0003, 0xbef7,
+    0x9ef7, 0x9ef7, 0x8011, 0xbef7, 0x0005, 0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0x8004, 0xbff7,
+    0x0001, 0xbef7, 0x8003, 0xbff7, 0x0001, 0xbef7, 0x8007, 0xbff7, 0x0011, 0xbef7, 0xbef7, 0xdef7,
+    0xbef7, 0xbef7, 0xffff, 0xdac6, 0x2b34, 0x8603, 0x2904, 0x490c, 0x0804, 0xe703, 0x305d, 0x3bd7,
+    0xffff, 0xffff, 0x8003, 0xdef7, 0x0036, 0xffff, 0xffff, 0x7def, 0xb4a5, 0x0954, 0xa212, 0x4102,
+    0x210a, 0x420a, 0x420a, 0x0202, 0x2202, 0x6202, 0x4202, 0xe52a, 0x4422, 0x8101, 0xc201, 0xa63a,
+    0x895b, 0x8101, 0x4963, 0x11ad, 0x51a5, 0x3095, 0xbaef, 0x79e7, 0x79df, 0x9ae7, 0x9ae7, 0x7ae7,
+    0xbbef, 0x56b6, 0x0e34, 0xd044, 0x8b03, 0x0d04, 0x4e04, 0x4e04, 0xcf0c, 0xaf0c, 0xef1c, 0xef1c,
+    0xef24, 0x0f2d, 0x0f2d, 0x2f35, 0x4f3d, 0x2f35, 0x0e2d, 0x0e35, 0x504d, 0x5696, 0x3bd7, 0x8008,
+    0xffff, 0x000b, 0x1cc7, 0xd444, 0x9003, 0xb103, 0xf20b, 0xd103, 0x9003, 0x1555, 0x9ee7, 0xffff,
+    0xdfff, 0x8073, 0xffff, 0x0005, 0x5de7, 0x5de7, 0x5def, 0x5def, 0x3de7, 0x800b, 0x5def, 0x8009,
+    0x7def, 0x0003, 0x7eef, 0x7def, 0x7def, 0x8003, 0x7eef, 0x0002, 0x7def, 0x7def, 0x800a, 0x7eef,
+    0x0001, 0x9eef, 0x8003, 0x7eef, 0x8003, 0x9eef, 0x8004, 0x9ef7, 0x0004, 0x9eef, 0x9eef, 0x9ef7,
+    0xbef7, 0x800f, 0x9ef7, 0x800c, 0xbef7, 0x0001, 0xbff7, 0x800a, 0xbef7, 0x8007, 0xbff7, 0x001f,
+    0xdff7, 0xbef7, 0xbef7, 0xbff7, 0xdfff, 0xbff7, 0xbef7, 0xdff7, 0xdff7, 0xbef7, 0xbef7, 0xdef7,
+    0xdff7, 0xbff7, 0xbef7, 0xffff, 0xdfff, 0x727d, 0x6603, 0xa703, 0x4904, 0x6904, 0x0704, 0x290c,
+    0x9275, 0x7de7, 0xffff, 0xffff, 0xdef7, 0xdef7, 0xdff7, 0x8003, 0xffff, 0x002f, 0xd9ce, 0x107d,
+    0x0733, 0x4212, 0xe001, 0xe101, 0x0102, 0x4202, 0xa30a, 0x2202, 0x2202, 0xe201, 0xe201, 0xa101,
+    0xa101, 0x030a, 0x4209, 0xcb63, 0x0743, 0x37df, 0xb6ce, 0x96c6, 0xb7ce, 0x76c6, 0x97c6, 0x7ad7,
+    0x7375, 0xed23, 0x2c14, 0xeb03, 0xad1c, 0xad1c, 0xce1c, 0xee24, 0xee2c, 0x2f2d, 0x4f3d, 0x4f35,
+    0x4f3d, 0x2e35, 0x0e2d, 0x0e2d, 0xee34, 0x0f4d, 0xd47d, 0xd9be, 0xbef7, 0x8008, 0xffff, 0x000c,
+    0x5dd7, 0x565d, 0xb003, 0x9003, 0xf103, 0xf103, 0x7003, 0xf113, 0x5a9e, 0xffff, 0xffff, 0xdfff,
+    0x8074, 0xffff, 0x0005, 0x3de7, 0x3de7, 0x5def, 0x5def, 0x5de7, 0x8009, 0x5def, 0x0003, 0x7def,
+    0x5def, 0x5def, 0x8009, 0x7def, 0x8005, 0x7eef, 0x0001, 0x7def, 0x800f, 0x7eef, 0x0005, 0x9eef,
+    0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x8011, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8003, 0xbef7,
+    0x0001, 0x9ef7, 0x800b, 0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x0002, 0xbef7,
+    0xbff7, 0x8004, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8006, 0xbef7, 0x0002, 0xdef7, 0xdef7, 0x8008,
+    0xbff7, 0x0035, 0xdff7, 0xbef7, 0xbfff, 0xffff, 0xdac6, 0x6c44, 0x4503, 0xc703, 0x490c, 0x4904,
+    0xe703, 0x2a14, 0xb37d, 0x5ce7, 0xffff, 0xffff, 0xdff7, 0xbef7, 0xbef7, 0xdfff, 0xffff, 0xffff,
+    0xdff7, 0xb9ce, 0x5295, 0xea53, 0xe51a, 0xe201, 0x4202, 0x6202, 0x0202, 0x0202, 0x4302, 0x230a,
+    0x430a, 0x430a, 0x030a, 0x4001, 0xeb6b, 0x2c74, 0x8311, 0x8411, 0x2311, 0x4209, 0x492b, 0x0f3d,
+    0x8d1c, 0xad14, 0x2e2d, 0x0e2d, 0x0e35, 0x0e35, 0x2e35, 0x8003, 0x2f3d, 0x0008, 0x0e35, 0x0e35,
+    0xed2c, 0x4f45, 0x915d, 0x3486, 0xfabe, 0xbeef, 0x8009, 0xffff, 0x000a, 0x5dd7, 0x766d, 0xf10b,
+    0x9003, 0xd103, 0xf103, 0xb003, 0xb003, 0x155d, 0x7edf, 0x8078, 0xffff, 0x0002, 0x3ce7, 0x3de7,
+    0x800d, 0x5def, 0x0001, 0x7eef, 0x800b, 0x7def, 0x0002, 0x7eef, 0x7def, 0x8012, 0x7eef, 0x0002,
+    0x9eef, 0x9ef7, 0x8004, 0x9eef, 0x0002, 0x9ef7, 0x9eef, 0x800e, 0x9ef7, 0x0001, 0xbef7, 0x8003,
+    0x9ef7, 0x8011, 0xbef7, 0x0006, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0x8005, 0xbff7,
+    0x0003, 0xbef7, 0xbef7, 0xbff7, 0x8003, 0xbef7, 0x0001, 0xdef7, 0x8003, 0xbef7, 0x8007, 0xbff7,
+    0x0012, 0xdff7, 0xbff7, 0xbef7, 0xffff, 0xffff, 0xf59d, 0xa923, 0x0403, 0xc703, 0x490c, 0x2804,
+    0xe703, 0x2914, 0x7275, 0xbad6, 0xffff, 0xffff, 0xdfff, 0x8003, 0xbef7, 0x0001, 0xdfff, 0x8003,
+    0xffff, 0x0022, 0x7def, 0x37b6, 0xf184, 0xca53, 0xa522, 0x4212, 0x0102, 0x0102, 0x2102, 0x4202,
+    0x4202, 0x0202, 0x2101, 0xe100, 0xe100, 0x6301, 0x071b, 0xac34, 0x0d3d, 0x0d3d, 0x0d35, 0x0e35,
+    0x0d2d, 0xed2c, 0x0e2d, 0xcd2c, 0xcd24, 0xcd2c, 0xee3c, 0x5055, 0x926d, 0x5596, 0xd9b6, 0x7cdf,
+    0x800b, 0xffff, 0x000d, 0xfbbe, 0x1455, 0xd00b, 0x8f03, 0xb003, 0xd10b, 0x9003, 0x6f03, 0x9334,
+    0xdbb6, 0xffff, 0xffff, 0xdfff, 0x8077, 0xffff, 0x0007, 0x3de7, 0x3de7, 0x5def, 0x5def, 0x5de7,
+    0x5def, 0x5de7, 0x8008, 0x5def, 0x0002, 0x5eef, 0x7eef, 0x8003, 0x7def, 0x0001, 0x5def, 0x8006,
+    0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x8011, 0x7eef, 0x0002, 0x9ef7, 0x9ef7, 0x8004, 0x9eef,
+    0x0002, 0x9ef7, 0x9eef, 0x8011, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x800f, 0xbef7, 0x0004,
+    0xbff7, 0xbef7, 0xbff7, 0xbef7, 0x8007, 0xbff7, 0x0003, 0xbef7, 0xbef7, 0xdff7, 0x8003, 0xbef7,
+    0x0007, 0xdef7, 0xbef7, 0xbef7, 0xbff7, 0xdfff, 0xbef7, 0xdff7, 0x8006, 0xbff7, 0x0013, 0xdff7,
+    0xbef7, 0xdff7, 0xffff, 0x9eef, 0x7285, 0x671b, 0x4503, 0x2804, 0x890c, 0x4804, 0x8302, 0x040a,
+    0xcc5b, 0xd6b5, 0xbef7, 0xffff, 0xffff, 0xdfff, 0x8003, 0xbef7, 0x0001, 0xdfff, 0x8004, 0xffff,
+    0x001a, 0x7def, 0xdad6, 0xf6b5, 0x118d, 0x6e6c, 0xec53, 0x693b, 0xe62a, 0x241a, 0x251a, 0x8933,
+    0x4f55, 0xd05d, 0x8f5d, 0x8f5d, 0x4f55, 0x4f55, 0x2f4d, 0x705d, 0x9165, 0xf375, 0x358e, 0x97a6,
+    0xfabe, 0x5cd7, 0xbeef, 0x8006, 0xffff, 0x8003, 0xdfff, 0x8003, 0xffff, 0x000b, 0xbee7, 0x799e,
+    0xd23c, 0xae03, 0x6e03, 0xd003, 0xf10b, 0xd003, 0x6f03, 0x5224, 0x3996, 0x807c, 0xffff, 0x8003,
+    0x3de7, 0x0003, 0x5def, 0x5def, 0x3de7, 0x8009, 0x5def, 0x0005, 0x7def, 0x7eef, 0x7def, 0x7def,
+    0x5def, 0x8007, 0x7def, 0x0005, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7def, 0x800a, 0x7eef, 0x0009,
+    0x9ef7, 0x7eef, 0x7eef, 0x9ef7, 0x7eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9ef7, 0x8003, 0x9eef, 0x8007,
+    0x9ef7, 0x0003, 0x9eef, 0x9ef7, 0xbef7, 0x8008, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x800b,
+    0xbef7, 0x000b, 0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbff7,
+    0xbef7, 0x8004, 0xbff7, 0x8006, 0xbef7, 0x000a, 0xdef7, 0xdef7, 0xbef7, 0xbff7, 0xdff7, 0xbff7,
+    0xbff7, 0xdff7, 0xdff7, 0xbff7, 0x8005, 0xdff7, 0x0011, 0xdfff, 0xbef7, 0xdfff, 0xffff, 0x7de7,
+    0x527d, 0xe913, 0xc703, 0x2302, 0x440a, 0x8402, 0x6201, 0x2000, 0x8629, 0xef7b, 0x59ce, 0xdff7,
+    0x8003, 0xffff, 0x0001, 0xdff7, 0x8003, 0xdef7, 0x0001, 0xdfff, 0x8007, 0xffff, 0x000c, 0xbef7,
+    0x3ce7, 0x5de7, 0xfef7, 0xbde7, 0x7cdf, 0x5cdf, 0x7ce7, 0x9de7, 0xbdef, 0xbeef, 0xdfff, 0x8009,
+    0xffff, 0x0002, 0xdfff, 0xdfff, 0x8005, 0xffff, 0x000d, 0xdff7, 0xbaae, 0x545d, 0x0f14, 0x6c03,
+    0x6d03, 0xae03, 0xaf03, 0x8f03, 0x8f03, 0x311c, 0xf88d, 0xdff7, 0x807d, 0xffff, 0x0002, 0x3ce7,
+    0x3de7, 0x8003, 0x5def, 0x0001, 0x3def, 0x800a, 0x5def, 0x8004, 0x7def, 0x0001, 0x7eef, 0x8006,
+    0x7def, 0x8007, 0x7eef, 0x0002, 0x7def, 0x7def, 0x8006, 0x7eef, 0x000b, 0x9ef7, 0x7eef, 0x9eef,
+    0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9ef7, 0x9ef7, 0x8003, 0x9eef, 0x800d, 0x9ef7,
+    0x0001, 0xbef7, 0x8004, 0x9ef7, 0x0006, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x8007,
+    0xbef7, 0x0005, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8003, 0xbef7, 0x000a, 0xbff7, 0xbff7,
+    0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xdef7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x0006, 0xbef7,
+    0xbef7, 0xbff7, 0xdff7, 0xbff7, 0xbff7, 0x8004, 0xdff7, 0x0018, 0xbff7, 0xdff7, 0xbff7, 0xbfff,
+    0xdfff, 0xdff7, 0xdff7, 0xbef7, 0xdfff, 0xffff, 0x7de7, 0x3285, 0xa62a, 0x0202, 0xc201, 0xc208,
+    0x8210, 0x4100, 0x0000, 0x6208, 0xe739, 0x1084, 0xf7bd, 0x7def, 0x8004, 0xffff, 0x0008, 0xdfff,
+    0xdff7, 0xdef7, 0xdef7, 0xbef7, 0xdff7, 0xdfff, 0xdfff, 0x800e, 0xffff, 0x8005, 0xdfff, 0x8006,
+    0xffff, 0x0011, 0x9ee7, 0xdaae, 0xb56d, 0x7024, 0xad03, 0x8c03, 0xad03, 0xce0b, 0xae03, 0x8d03,
+    0x6e03, 0x7234, 0x3896, 0xbeef, 0xffff, 0xffff, 0xdfff, 0x807c, 0xffff, 0x0002, 0x3de7, 0x3de7,
+    0x800e, 0x5def, 0x8003, 0x7def, 0x0008, 0x5def, 0x7def, 0x5def, 0x7def, 0x7def, 0x7eef, 0x7def,
+    0x7def, 0x8007, 0x7eef, 0x8003, 0x7def, 0x8006, 0x7eef, 0x0006, 0x9ef7, 0x9eef, 0x7eef, 0x9ef7,
+    0x9eef, 0x7eef, 0x8003, 0x9eef, 0x0004, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x800e, 0x9ef7, 0x0001,
+    0xbef7, 0x8004, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x800a, 0xbef7, 0x0006, 0xbff7, 0xbef7, 0xbef7,
+    0xbff7, 0xbff7, 0xbef7, 0x8004, 0xbff7, 0x000f, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7,
+    0xdef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xdef7, 0x8007, 0xbff7, 0x0005,
+    0xdff7, 0xbff7, 0xbff7, 0xdff7, 0xdfff, 0x8003, 0xdff7, 0x0013, 0xbef7, 0xdfff, 0xffff, 0xbef7,
+    0xd5ad, 0x6b53, 0x8208, 0x0000, 0x2000, 0x6208, 0x4208, 0x2100, 0x6000, 0xc301, 0xc923, 0xee54,
+    0x5596, 0x1acf, 0xbeef, 0x8007, 0xffff, 0x0001, 0xdfff, 0x8004, 0xdff7, 0x8009, 0xdfff, 0x8008,
+    0xffff, 0x000f, 0x9ee7, 0xfabe, 0x1686, 0x3245, 0x6e14, 0xec03, 0xac03, 0xcd03, 0xce0b, 0xcd03,
+    0x8c03, 0x4b03, 0x8d03, 0xf34c, 0xbaae, 0x8003, 0xffff, 0x0001, 0xdfff, 0x807e, 0xffff, 0x0002,
+    0x3ce7, 0x3de7, 0x800c, 0x5def, 0x8005, 0x7def, 0x0005, 0x5def, 0x7def, 0x5def, 0x7def, 0x5def,
+    0x8003, 0x7def, 0x8004, 0x7eef, 0x0001, 0x7def, 0x800c, 0x7eef, 0x8004, 0x9eef, 0x8003, 0x7eef,
+    0x0005, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x800c, 0x9ef7, 0x8004, 0xbef7, 0x0003, 0x9ef7,
+    0xbef7, 0x9ef7, 0x8012, 0xbef7, 0x0004, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0x8005, 0xbff7, 0x0002,
+    0xbef7, 0xdff7, 0x8005, 0xbef7, 0x8003, 0xbff7, 0x0004, 0xbef7, 0xdff7, 0xbff7, 0xdff7, 0x8003,
+    0xbff7, 0x8003, 0xdff7, 0x8003, 0xdfff, 0x001b, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0xbef7, 0xdfff,
+    0xffff, 0xffff, 0xbad6, 0x508c, 0x073a, 0xc108, 0x6101, 0x8402, 0x8603, 0x0704, 0xc603, 0xa603,
+    0xa503, 0x0704, 0x8d3d, 0xd05d, 0x347e, 0xd8a6, 0x3ac7, 0x7cdf, 0xdef7, 0x8011, 0xffff, 0x0013,
+    0xdeef, 0x7ddf, 0x1bbf, 0x9896, 0xf565, 0x323d, 0x6f14, 0x0d04, 0xec03, 0x0d04, 0x0d04, 0x0d0c,
+    0x0d04, 0xcc03, 0x8c03, 0x8c03, 0x7034, 0xd685, 0x1cd7, 0x8003, 0xffff, 0x0001, 0xdfff, 0x8080,
+    0xffff, 0x0006, 0x3ce7, 0x3de7, 0x5def, 0x5de7, 0x5def, 0x5de7, 0x800a, 0x5def, 0x8005, 0x7def,
+    0x0001, 0x5def, 0x8006, 0x7def, 0x0006, 0x7eef, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7def, 0x8004,
+    0x7eef, 0x0001, 0x7def, 0x8009, 0x7eef, 0x0006, 0x9eef, 0x7eef, 0x7eef, 0x9ef7, 0x9eef, 0x9eef,
+    0x800e, 0x9ef7, 0x0001, 0xbef7, 0x8007, 0x9ef7, 0x800c, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7,
+    0x8003, 0xbff7, 0x0001, 0xbef7, 0x8005, 0xbff7, 0x0003, 0xdff7, 0xbff7, 0xdef7, 0x8004, 0xbef7,
+    0x8006, 0xbff7, 0x0001, 0xdff7, 0x8004, 0xbff7, 0x0006, 0xdff7, 0xbff7, 0xdfff, 0xdfff, 0xdff7,
+    0xdff7, 0x8003, 0xdfff, 0x0004, 0xdff7, 0xbff7, 0xbef7, 0xbff7, 0x8003, 0xffff, 0x0017, 0xb9ce,
+    0x5285, 0x2b3c, 0x6603, 0x4503, 0x8603, 0xe703, 0x0804, 0x890c, 0xac1d, 0x6b15, 0x2a05, 0x0a05,
+    0x2b05, 0x2c15, 0x6e2d, 0x8f3d, 0xd155, 0x1366, 0x5576, 0x557e, 0x9696, 0xb89e, 0x8003, 0xb8a6,
+    0x0017, 0x989e, 0x9796, 0x5586, 0x3576, 0xf465, 0x924d, 0x3035, 0x0f1d, 0xae0c, 0x6d04, 0x4c04,
+    0x4c04, 0x2c04, 0x4d04, 0x4d04, 0x2d04, 0x0d04, 0xcc03, 0xab03, 0x0d04, 0x902c, 0xd57d, 0xfbc6,
+    0x8087, 0xffff, 0x0004, 0x3de7, 0x3de7, 0x5de7, 0x5de7, 0x800d, 0x5def, 0x0005, 0x7def, 0x5def,
+    0x7def, 0x7def, 0x5def, 0x8004, 0x7def, 0x8003, 0x7eef, 0x0005, 0x7def, 0x7def, 0x7eef, 0x7eef,
+    0x7def, 0x8004, 0x7eef, 0x0002, 0x7def, 0x5def, 0x8007, 0x7eef, 0x0006, 0x9eef, 0x9ef7, 0x9ef7,
+    0x7eef, 0x9eef, 0x9eef, 0x800c, 0x9ef7, 0x0004, 0xbef7, 0xbef7, 0x9ef7, 0xbef7, 0x8007, 0x9ef7,
+    0x8010, 0xbef7, 0x8004, 0xbff7, 0x8003, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8004, 0xbef7, 0x800c,
+    0xbff7, 0x0003, 0xdff7, 0xdff7, 0xbff7, 0x8004, 0xdff7, 0x0006, 0xbff7, 0xdff7, 0xdfff, 0xdfff,
+    0xbff7, 0xdff7, 0x8003, 0xdfff, 0x0017, 0xbff7, 0xbef7, 0xbff7, 0xffff, 0xffff, 0xdfff, 0xfbd6,
+    0xf495, 0x0f55, 0x6a1c, 0x4804, 0x2704, 0x8b0d, 0x8b15, 0x6b0d, 0x6c0d, 0x4c05, 0x6c05, 0x2c05,
+    0x0b05, 0x0b05, 0xeb04, 0xeb04, 0x8003, 0xcb04, 0x0002, 0xab04, 0xab04, 0x8003, 0x8b04, 0x8003,
+    0x6b04, 0x0002, 0x6c04, 0x8c04, 0x8003, 0xad04, 0x000a, 0x8d04, 0x6d04, 0x2c04, 0x2b04, 0xea03,
+    0x0c04, 0x4e1c, 0x324d, 0x378e, 0x3ccf, 0x8004, 0xffff, 0x0001, 0xdfff, 0x8085, 0xffff, 0x8003,
+    0x3de7, 0x0002, 0x5de7, 0x5de7, 0x800a, 0x5def, 0x0001, 0x7def, 0x8003, 0x5def, 0x8003, 0x7def,
+    0x0001, 0x5def, 0x8004, 0x7def, 0x0002, 0x7eef, 0x7eef, 0x8003, 0x7def, 0x0003, 0x7eef, 0x7def,
+    0x7def, 0x8004, 0x7eef, 0x0002, 0x7def, 0x7def, 0x8007, 0x7eef, 0x8005, 0x9eef, 0x800d, 0x9ef7,
+    0x0002, 0xbef7, 0xbef7, 0x8008, 0x9ef7, 0x800f, 0xbef7, 0x8005, 0xbff7, 0x0002, 0xbef7, 0xbef7,
+    0x8003, 0xbff7, 0x0005, 0xbef7, 0xbef7, 0xdef7, 0xbef7, 0xbef7, 0x8005, 0xbff7, 0x0002, 0xbef7,
+    0xbef7, 0x8006, 0xbff7, 0x0003, 0xdff7, 0xdff7, 0xbff7, 0x8007, 0xdff7, 0x000a, 0xdfff, 0xdff7,
+    0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xbef7, 0xbef7, 0xdff7, 0x8003, 0xffff, 0x001a, 0xbeef,
+    0x3acf, 0x759e, 0x3376, 0xcf4d, 0x6d2d, 0x2b0d, 0x0a05, 0x0a05, 0xeb04, 0x0b05, 0x0c05, 0x2c05,
+    0x2c05, 0x0c05, 0xec04, 0xec04, 0x0d05, 0xed04, 0xec04, 0xed04, 0xcd04, 0xad04, 0xac04, 0xad04,
+    0x8d04, 0x8003, 0x6c04, 0x0008, 0x4c04, 0x6d04, 0x8e0c, 0xf02c, 0x935d, 0x3796, 0x1bc7, 0xbeef,
+    0x8004, 0xffff, 0x0001, 0xdfff, 0x8088, 0xffff, 0x0002, 0x3de7, 0x3de7, 0x8004, 0x5de7, 0x800a,
+    0x5def, 0x0001, 0x7def, 0x8003, 0x5def, 0x8005, 0x7def, 0x0006, 0x5def, 0x7def, 0x7def, 0x7eef,
+    0x7def, 0x7eef, 0x8005, 0x7def, 0x0002, 0x7eef, 0x7def, 0x8009, 0x7eef, 0x0006, 0x9ef7, 0x9ef7,
+    0x7eef, 0x9ef7, 0x9eef, 0x9eef, 0x800c, 0x9ef7, 0x8004, 0xbef7, 0x8004, 0x9ef7, 0x0001, 0xbef7,
+    0x8004, 0x9ef7, 0x8005, 0xbef7, 0x0001, 0x9ef7, 0x8008, 0xbef7, 0x0003, 0xbff7, 0xbff7, 0xbef7,
+    0x8005, 0xbff7, 0x000d, 0xbef7, 0xbef7, 0xbff7, 0xdff7, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7,
+    0xbff7, 0xbef7, 0xdef7, 0xbef7, 0x8004, 0xbff7, 0x0001, 0xdff7, 0x8003, 0xbff7, 0x8003, 0xdff7,
+    0x0007, 0xbff7, 0xdfff, 0xbff7, 0xdff7, 0xdff7, 0xdfff, 0xbff7, 0x8003, 0xdfff, 0x0001, 0xdff7,
+    0x8004, 0xdfff, 0x8003, 0xbff7, 0x0001, 0xdfff, 0x8004, 0xffff, 0x000b, 0xbdef, 0x5bcf, 0xd8ae,
+    0x758e, 0x136e, 0xb155, 0x9045, 0x4e2d, 0x2d1d, 0x4d15, 0x2d0d, 0x8005, 0xcc04, 0x000b, 0xac04,
+    0xcd0c, 0xed14, 0xef1c, 0xef34, 0x3145, 0x935d, 0x167e, 0x989e, 0x3bc7, 0x9de7, 0x8005, 0xffff,
+    0x0003, 0xdfff, 0xdff7, 0xdfff, 0x808a, 0xffff, 0x0002, 0x3de7, 0x3de7, 0x8004, 0x5de7, 0x800f,
+    0x5def, 0x8007, 0x7def, 0x0004, 0x7eef, 0x7def, 0x7eef, 0x7eef, 0x8004, 0x7def, 0x8004, 0x7eef,
+    0x0001, 0x7def, 0x8006, 0x7eef, 0x0003, 0x7ef7, 0x7eef, 0x7eef, 0x8003, 0x9eef, 0x800c, 0x9ef7,
+    0x8005, 0xbef7, 0x8007, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x800e, 0xbef7, 0x0002, 0xbff7, 0xbff7,
+    0x8004, 0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x8003, 0xbef7, 0x0003, 0xbff7,
+    0xbff7, 0xbef7, 0x8006, 0xbff7, 0x000e, 0xdff7, 0xbff7, 0xbff7, 0xdff7, 0xbff7, 0xbff7, 0xdff7,
+    0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0x800c, 0xdfff, 0x8003, 0xdff7, 0x0001,
+    0xdfff, 0x8007, 0xffff, 0x0005, 0xdef7, 0xbeef, 0x7de7, 0x7cdf, 0x5cd7, 0x8003, 0x3bcf, 0x0005,
+    0x5ccf, 0x7cd7, 0x9ddf, 0x9de7, 0xbef7, 0x8008, 0xffff, 0x0004, 0xdfff, 0xdff7, 0xdfff, 0xdfff,
+    0x800c, 0xffff, 0x0001, 0xdfff, 0x8080, 0xffff, 0x0002, 0x3de7, 0x3de7, 0x8005, 0x5de7, 0x800e,
+    0x5def, 0x0004, 0x7def, 0x5def, 0x7def, 0x5def, 0x8003, 0x7def, 0x0005, 0x7eef, 0x7eef, 0x7def,
+    0x7eef, 0x7def, 0x8003, 0x7eef, 0x0002, 0x7def, 0x7def, 0x8009, 0x7eef, 0x0007, 0x9eef, 0x7eef,
+    0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x800c, 0x9ef7, 0x8003, 0xbef7, 0x8008, 0x9ef7, 0x0002,
+    0xbef7, 0x9ef7, 0x8005, 0xbef7, 0x0001, 0x9ef7, 0x8008, 0xbef7, 0x0001, 0xbff7, 0x8008, 0xbef7,
+    0x0002, 0xbff7, 0xbff7, 0x8004, 0xbef7, 0x0006, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xdff7,
+    0x8005, 0xbff7, 0x0001, 0xdff7, 0x8003, 0xbff7, 0x0003, 0xdff7, 0xdff7, 0xdfff, 0x8003, 0xdff7,
+    0x8014, 0xdfff, 0x8003, 0xdff7, 0x0002, 0xdfff, 0xdfff, 0x800e, 0xffff, 0x0003, 0xdfff, 0xdfff,
+    0xdff7, 0x8003, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x8004, 0xffff, 0x0002, 0xdfff, 0xffff,
+    0x8004, 0xdfff, 0x8083, 0xffff, 0x0001, 0x5de7, 0x8003, 0x3de7, 0x0002, 0x5de7, 0x5ce7, 0x8003,
+    0x5de7, 0x800c, 0x5def, 0x0003, 0x7def, 0x5def, 0x5def, 0x8004, 0x7def, 0x0007, 0x7eef, 0x7def,
+    0x7def, 0x7eef, 0x7eef, 0x7def, 0x7eef, 0x8003, 0x7def, 0x8006, 0x7eef, 0x0001, 0x7def, 0x8004,
+    0x7eef, 0x0003, 0x9eef, 0x7eef, 0x9eef, 0x8003, 0x7eef, 0x0001, 0x9eef, 0x800b, 0x9ef7, 0x0002,
+    0xbef7, 0xbef7, 0x8006, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8008, 0xbef7, 0x0001, 0x9ef7, 0x8008,
+    0xbef7, 0x0004, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0x8005, 0xbef7, 0x0001, 0xdef7, 0x8004, 0xbef7,
+    0x8008, 0xbff7, 0x0006, 0xdfff, 0xbff7, 0xbff7, 0xdff7, 0xbff7, 0xbff7, 0x8003, 0xdff7, 0x0001,
+    0xbff7, 0x8003, 0xdff7, 0x803e, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x800d, 0xffff, 0x0001,
+    0xdfff, 0x8070, 0xffff, 0x0002, 0x5de7, 0x3de7, 0x8008, 0x5de7, 0x800b, 0x5def, 0x0005, 0x7def,
+    0x7def, 0x5def, 0x7def, 0x5def, 0x8004, 0x7def, 0x8005, 0x7eef, 0x0002, 0x7def, 0x7def, 0x800c,
+    0x7eef, 0x0002, 0x9eef, 0x9eef, 0x8004, 0x7eef, 0x0006, 0x9eef, 0x9ef7, 0x7eef, 0x9ef7, 0x9ef7,
+    0x9eef, 0x8005, 0x9ef7, 0x8003, 0xbef7, 0x8005, 0x9ef7, 0x8005, 0xbef7, 0x0002, 0x9ef7, 0x9ef7,
+    0x8008, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x0007, 0xbff7,
+    0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0x8008, 0xbff7, 0x0001, 0xbef7, 0x8004, 0xbff7,
+    0x0004, 0xdff7, 0xdfff, 0xbff7, 0xbff7, 0x8006, 0xdff7, 0x803f, 0xdfff, 0x0003, 0xffff, 0xffff,
+    0xdfff, 0x807d, 0xffff, 0x0002, 0x3de7, 0x3de7, 0x8004, 0x5de7, 0x0001, 0x5def, 0x8003, 0x5de7,
+    0x8006, 0x5def, 0x0001, 0x5de7, 0x8004, 0x5def, 0x0002, 0x7def, 0x7def, 0x8003, 0x5def, 0x0004,
+    0x7def, 0x7eef, 0x7eef, 0x7def, 0x8004, 0x7eef, 0x0001, 0x7def, 0x8007, 0x7eef, 0x0001, 0x7def,
+    0x8004, 0x7eef, 0x0008, 0x7ef7, 0x7eef, 0x7eef, 0x9eef, 0x7eef, 0x9eef, 0x7eef, 0x9eef, 0x8003,
+    0x7eef, 0x0001, 0x9eef, 0x8005, 0x9ef7, 0x0001, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0xbef7, 0x8005,
+    0x9ef7, 0x8007, 0xbef7, 0x0003, 0x9ef7, 0xbef7, 0x9ef7, 0x800a, 0xbef7, 0x8004, 0xbff7, 0x0001,
+    0xbef7, 0x8008, 0xbff7, 0x0001, 0xbef7, 0x8003, 0xbff7, 0x000e, 0xdef7, 0xdff7, 0xbff7, 0xdfff,
+    0xdff7, 0xbff7, 0xbff7, 0xbfff, 0xdfff, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xdfff, 0x8004, 0xdff7,
+    0x0004, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0x8031, 0xdfff, 0x0001, 0xffff, 0x8009, 0xdfff, 0x0002,
+    0xffff, 0xdfff, 0x807e, 0xffff, 0x0007, 0x3de7, 0x3de7, 0x5cef, 0x5def, 0x5de7, 0x5de7, 0x5def,
+    0x8003, 0x5de7, 0x8007, 0x5def, 0x0001, 0x5de7, 0x8004, 0x5def, 0x0004, 0x7def, 0x5eef, 0x5def,
+    0x5def, 0x8004, 0x7def, 0x8003, 0x7eef, 0x8003, 0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x800b,
+    0x7eef, 0x000a, 0x9eef, 0x7eef, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef,
+    0x8004, 0x9ef7, 0x0001, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0xbef7, 0x8005, 0x9ef7, 0x0003, 0xbef7,
+    0xbef7, 0x9ef7, 0x8004, 0xbef7, 0x0001, 0x9ef7, 0x800a, 0xbef7, 0x0002, 0xbff7, 0xbef7, 0x8003,
+    0xbff7, 0x0005, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0x8009, 0xbff7, 0x0008, 0xdff7, 0xdff7,
+    0xbff7, 0xbff7, 0xdfff, 0xbff7, 0xbff7, 0xdff7, 0x8006, 0xbff7, 0x0002, 0xdff7, 0xdff7, 0x8004,
+    0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8009, 0xdfff, 0x0001, 0xdff7, 0x8027, 0xdfff, 0x0001, 0xffff,
+    0x800b, 0xdfff, 0x0002, 0xffff, 0xdfff, 0x807c, 0xffff, 0x0005, 0x5ce7, 0x3de7, 0x5ce7, 0x5de7,
+    0x5ce7, 0x8004, 0x5de7, 0x8005, 0x5def, 0x0002, 0x7def, 0x5de7, 0x8007, 0x5def, 0x0004, 0x5eef,
+    0x5def, 0x5eef, 0x5def, 0x8005, 0x7def, 0x0007, 0x5def, 0x7def, 0x7eef, 0x7def, 0x7eef, 0x7def,
+    0x7def, 0x8011, 0x7eef, 0x0004, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x8008, 0x9ef7, 0x0001, 0xbef7,
+    0x8006, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8013, 0xbef7, 0x0007, 0xbff7, 0xbef7, 0xbef7, 0xbff7,
+    0xbff7, 0xbef7, 0xbef7, 0x8005, 0xbff7, 0x0001, 0xdfff, 0x8006, 0xbff7, 0x0007, 0xdfff, 0xbff7,
+    0xbef7, 0xdef7, 0xbff7, 0xdfff, 0xbff7, 0x8005, 0xdff7, 0x0001, 0xdfff, 0x8003, 0xdff7, 0x0007,
+    0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0x8021, 0xdfff, 0x0001, 0xffff, 0x8016,
+    0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x807a, 0xffff, 0x0002, 0x3ce7, 0x3ce7, 0x8003, 0x5ce7,
+    0x8004, 0x5de7, 0x0003, 0x5def, 0x5def, 0x5de7, 0x8005, 0x5def, 0x0001, 0x7def, 0x8006, 0x5def,
+    0x0002, 0x7def, 0x5def, 0x8006, 0x7def, 0x0003, 0x5def, 0x7def, 0x7def, 0x8014, 0x7eef, 0x8003,
+    0x9eef, 0x0006, 0x9ef7, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x8004, 0x9ef7, 0x0004, 0xbef7,
+    0x9ef7, 0x9ef7, 0xbef7, 0x8005, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8010, 0xbef7, 0x0005,
+    0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0x8004, 0xbff7, 0x0002, 0xdef7, 0xbef7, 0x8007, 0xbff7,
+    0x0001, 0xdff7, 0x8003, 0xbff7, 0x0007, 0xbef7, 0xbff7, 0xdfff, 0xdfff, 0xbff7, 0xdff7, 0xdfff,
+    0x8003, 0xdff7, 0x0003, 0xdfff, 0xdff7, 0xdff7, 0x8005, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8036,
+    0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x807d, 0xffff, 0x8004, 0x3ce7, 0x0002, 0x5de7, 0x3de7,
+    0x8003, 0x5de7, 0x8003, 0x5def, 0x0004, 0x5de7, 0x5def, 0x5def, 0x5de7, 0x8008, 0x5def, 0x0002,
+    0x7def, 0x5def, 0x800b, 0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x800f, 0x7eef, 0x8003, 0x9eef,
+    0x0003, 0x9ef7, 0x9ef7, 0x9eef, 0x8006, 0x9ef7, 0x0003, 0x9eef, 0x9ef7, 0xbef7, 0x8006, 0x9ef7,
+    0x0008, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x800d, 0xbef7, 0x8006,
+    0xbff7, 0x0001, 0xbef7, 0x8005, 0xbff7, 0x0001, 0xbef7, 0x8004, 0xbff7, 0x0003, 0xdff7, 0xbff7,
+    0xdff7, 0x8003, 0xbff7, 0x0005, 0xdff7, 0xbff7, 0xbfff, 0xdfff, 0xbfff, 0x8014, 0xdfff, 0x0001,
+    0xdff7, 0x8015, 0xdfff, 0x0001, 0xffff, 0x801b, 0xdfff, 0x8003, 0xffff, 0x0002, 0xdfff, 0xdfff,
+    0x8078, 0xffff, 0x0004, 0x5de7, 0x3de7, 0x5de7, 0x5ce7, 0x8004, 0x5de7, 0x0002, 0x5def, 0x5de7,
+    0x8003, 0x5def, 0x0007, 0x5de7, 0x5def, 0x5def, 0x5de7, 0x5def, 0x5def, 0x5de7, 0x8004, 0x5def,
+    0x0002, 0x7def, 0x5def, 0x8007, 0x7def, 0x0001, 0x7eef, 0x8003, 0x7def, 0x0002, 0x7eef, 0x7def,
+    0x8010, 0x7eef, 0x0002, 0x9eef, 0x9eef, 0x8004, 0x9ef7, 0x0001, 0x9eef, 0x8006, 0x9ef7, 0x0004,
+    0x9eef, 0xbef7, 0x9ef7, 0xbef7, 0x8005, 0x9ef7, 0x0007, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7,
+    0xbef7, 0x9ef7, 0x800f, 0xbef7, 0x8003, 0xbff7, 0x0002, 0xbef7, 0xbef7, 0x8004, 0xbff7, 0x0002,
+    0xbef7, 0xbef7, 0x8010, 0xbff7, 0x8007, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x803c, 0xdfff, 0x0002,
+    0xffff, 0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x8077, 0xffff, 0x0008, 0x3ce7, 0x3de7, 0x5ce7,
+    0x5ce7, 0x5def, 0x5de7, 0x5def, 0x5ce7, 0x8003, 0x5de7, 0x8010, 0x5def, 0x0003, 0x7def, 0x7def,
+    0x7eef, 0x8009, 0x7def, 0x8010, 0x7eef, 0x0008, 0x9eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9ef7,
+    0x9ef7, 0x9eef, 0x8008, 0x9ef7, 0x0001, 0xbef7, 0x8006, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7,
+    0x8013, 0xbef7, 0x0004, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x000a, 0xdff7, 0xbff7,
+    0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xdff7, 0xbef7, 0x8004, 0xbff7, 0x0005, 0xdff7,
+    0xdff7, 0xbff7, 0xdfff, 0xbfff, 0x8007, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x803e, 0xdfff, 0x0004,
+    0xffff, 0xdfff, 0xffff, 0xdfff, 0x8077, 0xffff, 0x000b, 0x5ce7, 0x3ce7, 0x5ce7, 0x5ce7, 0x5def,
+    0x5de7, 0x5de7, 0x5def, 0x5def, 0x5de7, 0x5de7, 0x8011, 0x5def, 0x0003, 0x7def, 0x7def, 0x7eef,
+    0x8003, 0x7def, 0x0006, 0x7eef, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x7def, 0x800e, 0x7eef, 0x0006,
+    0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9ef7, 0x9eef, 0x8012, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7,
+    0x8007, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x0001, 0xbff7,
+    0x8006, 0xbef7, 0x8004, 0xbff7, 0x0002, 0xbef7, 0xdfff, 0x8003, 0xbff7, 0x0001, 0xdfff, 0x8003,
+    0xbff7, 0x0002, 0xdff7, 0xbff7, 0x8005, 0xdfff, 0x0009, 0xbff7, 0xdfff, 0xdff7, 0xdff7, 0xdfff,
+    0xdff7, 0xdfff, 0xdfff, 0xbfff, 0x8039, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0002, 0xffff,
+    0xdfff, 0x8076, 0xffff, 0x0006, 0x3ce7, 0x5de7, 0x5de7, 0x5ce7, 0x5de7, 0x5de7, 0x8004, 0x5def,
+    0x0001, 0x5de7, 0x8006, 0x5def, 0x0001, 0x7def, 0x800b, 0x5def, 0x000e, 0x7def, 0x7def, 0x5def,
+    0x7eef, 0x7def, 0x7def, 0x7eef, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x7def, 0x8005,
+    0x7eef, 0x0001, 0x9eef, 0x8004, 0x7eef, 0x0008, 0x9eef, 0x9eef, 0x7eef, 0x9ef7, 0x9eef, 0x7eef,
+    0x9eef, 0x9eef, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x800d, 0x9ef7, 0x0005, 0xbef7, 0xbef7, 0x9ef7,
+    0x9ef7, 0xbef7, 0x8003, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8006, 0xbef7, 0x0001, 0xbff7, 0x8006,
+    0xbef7, 0x8003, 0xbff7, 0x8006, 0xbef7, 0x8003, 0xbff7, 0x0001, 0xbef7, 0x8003, 0xbff7, 0x0012,
+    0xdfff, 0xdfff, 0xbff7, 0xdff7, 0xbef7, 0xdef7, 0xbef7, 0xdfff, 0xdfff, 0xbfff, 0xdef7, 0xdfff,
+    0xdfff, 0xbff7, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0x800e, 0xdfff, 0x0001, 0xdff7, 0x802d, 0xdfff,
+    0x0002, 0xffff, 0xffff, 0x8003, 0xdfff, 0x0002, 0xffff, 0xdfff, 0x8076, 0xffff, 0x0002, 0x3ce7,
+    0x3ce7, 0x8005, 0x5de7, 0x0004, 0x5def, 0x5de7, 0x5de7, 0x5ce7, 0x8010, 0x5def, 0x0008, 0x7def,
+    0x5def, 0x5def, 0x7eef, 0x5eef, 0x5def, 0x7eef, 0x7eef, 0x8004, 0x7def, 0x8003, 0x7eef, 0x0001,
+    0x7def, 0x8005, 0x7eef, 0x0001, 0x9eef, 0x8005, 0x7eef, 0x000b, 0x9eef, 0x9eef, 0x7eef, 0x9ef7,
+    0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x800f, 0x9ef7, 0x0004, 0xbef7, 0xbef7,
+    0x9ef7, 0x9ef7, 0x800b, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x8003, 0xbff7, 0x0004, 0xbef7,
+    0xbff7, 0xbef7, 0xbff7, 0x8003, 0xbef7, 0x8006, 0xbff7, 0x0013, 0xdfff, 0xbff7, 0xbef7, 0xbff7,
+    0xdff7, 0xdef7, 0xbff7, 0xdfff, 0xdfff, 0xbef7, 0xbef7, 0xdff7, 0xbff7, 0xbff7, 0xdfff, 0xbff7,
+    0xdfff, 0xdff7, 0xdff7, 0x8022, 0xdfff, 0x0001, 0xffff, 0x801a, 0xdfff, 0x8003, 0xffff, 0x0002,
+    0xdfff, 0xdfff, 0x8077, 0xffff, 0x0004, 0x5ce7, 0x3ce7, 0x3de7, 0x5def, 0x8004, 0x5de7, 0x0005,
+    0x3de7, 0x5de7, 0x5de7, 0x3de7, 0x5ce7, 0x8006, 0x5def, 0x0001, 0x7def, 0x8006, 0x5def, 0x000f,
+    0x7def, 0x5def, 0x7def, 0x5def, 0x7def, 0x5def, 0x5def, 0x7def, 0x7def, 0x7eef, 0x7def, 0x7eef,
+    0x5def, 0x7def, 0x7def, 0x8008, 0x7eef, 0x0005, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x7eef, 0x8003,
+    0x9eef, 0x0005, 0x9ef7, 0x9eef, 0x7eef, 0x9ef7, 0x9eef, 0x8013, 0x9ef7, 0x8008, 0xbef7, 0x0001,
+    0x9ef7, 0x8005, 0xbef7, 0x0001, 0xbff7, 0x8007, 0xbef7, 0x0001, 0xbff7, 0x8004, 0xbef7, 0x0003,
+    0xbff7, 0xbef7, 0xbef7, 0x8007, 0xbff7, 0x000b, 0xbef7, 0xbff7, 0xdff7, 0xdfff, 0xbff7, 0xdff7,
+    0xdff7, 0xbff7, 0xbff7, 0xdff7, 0xdff7, 0x8004, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8003, 0xdfff,
+    0x0001, 0xdff7, 0x801c, 0xdfff, 0x0001, 0xffff, 0x801f, 0xdfff, 0x0002, 0xffff, 0xdfff, 0x800b,
+    0xffff, 0x0001, 0xdfff, 0x806b, 0xffff, 0x0005, 0x3ce7, 0x3ce7, 0x5de7, 0x3ce7, 0x3ce7, 0x8003,
+    0x5de7, 0x8003, 0x3de7, 0x0003, 0x3ce7, 0x3ce7, 0x3def, 0x800e, 0x5def, 0x8004, 0x7def, 0x0006,
+    0x5def, 0x7def, 0x7def, 0x7eef, 0x7def, 0x7eef, 0x8003, 0x7def, 0x800d, 0x7eef, 0x8005, 0x9eef,
+    0x0001, 0x7eef, 0x8004, 0x9ef7, 0x0001, 0x9eef, 0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8005, 0x9ef7,
+    0x8003, 0xbef7, 0x0001, 0x9ef7, 0x800f, 0xbef7, 0x0007, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7,
+    0xbef7, 0xbef7, 0x8007, 0xbff7, 0x0003, 0xdff7, 0xbff7, 0xdff7, 0x8003, 0xbff7, 0x8004, 0xdff7,
+    0x0003, 0xbff7, 0xdfff, 0xdff7, 0x8004, 0xdfff, 0x0006, 0xdff7, 0xdff7, 0xdfff, 0xdfff, 0xdff7,
+    0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x8018, 0xdfff, 0x0001, 0xffff, 0x8006, 0xdfff, 0x0001,
+    0xffff, 0x800c, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8006, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8005,
+    0xdfff, 0x0004, 0xffff, 0xdfff, 0xffff, 0xdfff, 0x8072, 0xffff, 0x000f, 0x3ce7, 0x3ce7, 0x3de7,
+    0x3ce7, 0x3ce7, 0x5de7, 0x5def, 0x5def, 0x5ce7, 0x5ce7, 0x3ce7, 0x3de7, 0x3de7, 0x5ce7, 0x3de7,
+    0x800d, 0x5def, 0x8004, 0x7def, 0x000b, 0x5def, 0x7def, 0x7def, 0x7eef, 0x7def, 0x7eef, 0x7eef,
+    0x7def, 0x7eef, 0x7eef, 0x7def, 0x800b, 0x7eef, 0x0008, 0x9eef, 0x7eef, 0x9eef, 0x7eef, 0x9eef,
+    0x9eef, 0x7eef, 0x9eef, 0x8016, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x8003, 0xbef7, 0x0001,
+    0x9ef7, 0x800c, 0xbef7, 0x0004, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0x8005, 0xbef7, 0x0001, 0xbff7,
+    0x8003, 0xbef7, 0x8007, 0xbff7, 0x0003, 0xdfff, 0xdfff, 0xbff7, 0x8006, 0xdff7, 0x0005, 0xdfff,
+    0xdfff, 0xdff7, 0xdff7, 0xdfff, 0x8003, 0xdff7, 0x8013, 0xdfff, 0x0001, 0xdff7, 0x802a, 0xdfff,
+    0x0002, 0xffff, 0xdfff, 0x8006, 0xffff, 0x0001, 0xdfff, 0x806d, 0xffff, 0x8005, 0x3ce7, 0x0003,
+    0x3de7, 0x5def, 0x5de7, 0x8003, 0x5ce7, 0x0002, 0x5def, 0x3de7, 0x8003, 0x5ce7, 0x0001, 0x5de7,
+    0x800a, 0x5def, 0x0006, 0x7def, 0x7def, 0x5def, 0x7def, 0x5def, 0x5def, 0x8004, 0x7def, 0x0003,
+    0x7eef, 0x7def, 0x7def, 0x8003, 0x7eef, 0x0001, 0x7def, 0x8004, 0x7eef, 0x0001, 0x9eef, 0x8006,
+    0x7eef, 0x8007, 0x9eef, 0x8011, 0x9ef7, 0x0008, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7,
+    0xbef7, 0x9ef7, 0x8010, 0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8005, 0xbff7, 0x8005, 0xbef7,
+    0x8007, 0xbff7, 0x0004, 0xdfff, 0xdfff, 0xbff7, 0xbff7, 0x8003, 0xdff7, 0x0004, 0xbff7, 0xbff7,
+    0xdff7, 0xdfff, 0x8006, 0xdff7, 0x0002, 0xdfff, 0xdff7, 0x801f, 0xdfff, 0x0001, 0xffff, 0x8018,
+    0xdfff, 0x0006, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0x8004, 0xffff, 0x0001, 0xdfff,
+    0x806f, 0xffff, 0x0001, 0x3de7, 0x8005, 0x3ce7, 0x0009, 0x5de7, 0x5de7, 0x3ce7, 0x3de7, 0x5de7,
+    0x5de7, 0x5ce7, 0x5de7, 0x5def, 0x8004, 0x5de7, 0x8009, 0x5def, 0x0005, 0x7def, 0x5def, 0x5def,
+    0x7def, 0x5def, 0x8006, 0x7def, 0x8003, 0x7eef, 0x0002, 0x7def, 0x7def, 0x800b, 0x7eef, 0x8005,
+    0x9eef, 0x0002, 0x9ef7, 0x9eef, 0x8013, 0x9ef7, 0x000a, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7,
+    0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x800f, 0xbef7, 0x0007, 0xbff7, 0xbff7, 0xbef7, 0xbff7,
+    0xbff7, 0xbef7, 0xbef7, 0x8008, 0xbff7, 0x0004, 0xdff7, 0xbff7, 0xbff7, 0xdff7, 0x8003, 0xbff7,
+    0x0006, 0xdff7, 0xbff7, 0xbff7, 0xdff7, 0xdff7, 0xdfff, 0x8004, 0xdff7, 0x0006, 0xdfff, 0xdfff,
+    0xdff7, 0xdff7, 0xdfff, 0xdff7, 0x803b, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x8072, 0xffff,
+    0x0011, 0x3ce7, 0x3ce7, 0x3de7, 0x3de7, 0x3ce7, 0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x3de7, 0x5de7,
+    0x5de7, 0x5ce7, 0x3def, 0x3def, 0x5de7, 0x3de7, 0x8003, 0x5de7, 0x8008, 0x5def, 0x0003, 0x7def,
+    0x5def, 0x5def, 0x8009, 0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x800d, 0x7eef, 0x0008, 0x9eef,
+    0x7eef, 0x9eef, 0x7eef, 0x7eef, 0x9ef7, 0x9ef7, 0x9eef, 0x8013, 0x9ef7, 0x0005, 0xbef7, 0xbef7,
+    0x9ef7, 0xbef7, 0x9ef7, 0x800f, 0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x0002,
+    0xbef7, 0xdff7, 0x800d, 0xbff7, 0x0005, 0xdff7, 0xdff7, 0xbff7, 0xdfff, 0xdfff, 0x8005, 0xdff7,
+    0x0002, 0xbff7, 0xbff7, 0x8005, 0xdfff, 0x0001, 0xdff7, 0x8024, 0xdfff, 0x0002, 0xffff, 0xffff,
+    0x8014, 0xdfff, 0x000e, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0xdfff, 0xffff,
+    0xffff, 0xdfff, 0xffff, 0xdfff, 0xdfff, 0x806a, 0xffff, 0x8007, 0x3ce7, 0x8003, 0x5de7, 0x000a,
+    0x5ce7, 0x3de7, 0x5de7, 0x5de7, 0x3ce7, 0x5de7, 0x5de7, 0x5def, 0x5de7, 0x5de7, 0x8008, 0x5def,
+    0x0006, 0x7def, 0x5def, 0x5def, 0x7def, 0x5def, 0x5def, 0x8006, 0x7def, 0x8011, 0x7eef, 0x0007,
+    0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x8011, 0x9ef7, 0x0008, 0xbef7, 0x9ef7,
+    0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8011, 0xbef7, 0x8003, 0xbff7, 0x0001, 0xbef7,
+    0x8010, 0xbff7, 0x0009, 0xdff7, 0xbff7, 0xdfff, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0xbff7,
+    0x8004, 0xdff7, 0x0004, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0x8023, 0xdfff, 0x0002, 0xffff, 0xffff,
+    0x800e, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0002, 0xffff,
+    0xdfff, 0x8004, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x806b, 0xffff, 0x8003, 0x3ce7, 0x0001, 0x5de7,
+    0x8004, 0x3ce7, 0x0008, 0x5ce7, 0x5ce7, 0x5de7, 0x3de7, 0x5def, 0x5de7, 0x5de7, 0x3de7, 0x8003,
+    0x5de7, 0x8004, 0x5def, 0x0001, 0x5de7, 0x8004, 0x5def, 0x0003, 0x7def, 0x7def, 0x5def, 0x800b,
+    0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x800c, 0x7eef, 0x0008, 0x9eef, 0x9eef, 0x7eef, 0x7eef,
+    0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x800a, 0x9ef7, 0x0001, 0x9eef, 0x8006, 0x9ef7, 0x0005, 0xbef7,
+    0x9ef7, 0x9ef7, 0xbef7, 0xbef7, 0x8003, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x800c, 0xbef7,
+    0x8004, 0xbff7, 0x0001, 0xbef7, 0x8003, 0xbff7, 0x0001, 0xbef7, 0x8009, 0xbff7, 0x0010, 0xdef7,
+    0xbff7, 0xbfff, 0xdff7, 0xbff7, 0xbef7, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0xdff7, 0xbff7,
+    0xdff7, 0xbff7, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x8033, 0xdfff, 0x0001, 0xffff, 0x800b,
+    0xdfff, 0x0002, 0xffff, 0xdfff, 0x8003, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x806b, 0xffff, 0x8003,
+    0x3ce7, 0x0002, 0x3de7, 0x3de7, 0x8004, 0x3ce7, 0x8004, 0x5de7, 0x0007, 0x5def, 0x5def, 0x5ce7,
+    0x5de7, 0x5def, 0x5def, 0x5de7, 0x8003, 0x5def, 0x0001, 0x5de7, 0x8007, 0x5def, 0x800a, 0x7def,
+    0x0003, 0x7eef, 0x7def, 0x7def, 0x800e, 0x7eef, 0x0001, 0x9eef, 0x8003, 0x7eef, 0x0002, 0x9eef,
+    0x9eef, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x800e, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8004, 0xbef7,
+    0x0002, 0x9ef7, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8006, 0xbef7, 0x0001, 0xbff7, 0x8004,
+    0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8004, 0xbff7, 0x0001, 0xbef7, 0x8006, 0xbff7, 0x0001,
+    0xbef7, 0x8003, 0xbff7, 0x0010, 0xbef7, 0xbff7, 0xdfff, 0xbff7, 0xbff7, 0xbef7, 0xdff7, 0xbff7,
+    0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0xdfff, 0xbff7, 0xbff7, 0x8003, 0xdff7, 0x0002, 0xdfff,
+    0xdff7, 0x8008, 0xdfff, 0x0001, 0xdff7, 0x8035, 0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x806e,
+    0xffff, 0x8007, 0x3ce7, 0x0004, 0x5ce7, 0x3ce7, 0x5ce7, 0x5def, 0x8004, 0x5de7, 0x8008, 0x5def,
+    0x0001, 0x5de7, 0x8007, 0x5def, 0x0002, 0x7def, 0x5def, 0x8004, 0x7def, 0x0001, 0x7eef, 0x8003,
+    0x7def, 0x0001, 0x7eef, 0x8003, 0x7def, 0x800e, 0x7eef, 0x0001, 0x9eef, 0x8003, 0x7eef, 0x0001,
+    0x9eef, 0x8003, 0x9ef7, 0x0002, 0x9eef, 0x9eef, 0x800f, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7,
+    0x8012, 0xbef7, 0x0004, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0x800f, 0xbff7, 0x0002, 0xdff7, 0xdff7,
+    0x8003, 0xbff7, 0x0011, 0xdff7, 0xdff7, 0xbff7, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xbff7, 0xbff7,
+    0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0x800a, 0xdfff, 0x0001, 0xdff7,
+    0x800d, 0xdfff, 0x0001, 0xffff, 0x8008, 0xdfff, 0x0001, 0xffff, 0x8016, 0xdfff, 0x0001, 0xffff,
+    0x8003, 0xdfff, 0x0004, 0xffff, 0xffff, 0xdfff, 0xdfff, 0x806d, 0xffff, 0x8005, 0x3ce7, 0x0006,
+    0x5ce7, 0x5ce7, 0x3de7, 0x3de7, 0x5de7, 0x5def, 0x8003, 0x5de7, 0x0001, 0x5ce7, 0x8004, 0x5de7,
+    0x0006, 0x5def, 0x5de7, 0x5def, 0x5def, 0x5de7, 0x5de7, 0x8006, 0x5def, 0x0003, 0x7def, 0x7def,
+    0x5def, 0x8007, 0x7def, 0x0001, 0x7eef, 0x8004, 0x7def, 0x800b, 0x7eef, 0x0002, 0x9eef, 0x9eef,
+    0x8004, 0x7eef, 0x0003, 0x9eef, 0x9ef7, 0x7ef7, 0x8003, 0x9ef7, 0x0001, 0x9eef, 0x800f, 0x9ef7,
+    0x8014, 0xbef7, 0x0009, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0xbef7,
+    0x800b, 0xbff7, 0x0001, 0xdff7, 0x8005, 0xbff7, 0x8003, 0xdff7, 0x0006, 0xbff7, 0xbff7, 0xdff7,
+    0xbff7, 0xdff7, 0xdfff, 0x8003, 0xdff7, 0x8003, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8003, 0xdfff,
+    0x0001, 0xdff7, 0x801c, 0xdfff, 0x0001, 0xffff, 0x8018, 0xdfff, 0x8005, 0xffff, 0x0001, 0xdfff,
+    0x806d, 0xffff, 0x8005, 0x3ce7, 0x000d, 0x5def, 0x5def, 0x3ce7, 0x3de7, 0x5de7, 0x5de7, 0x3de7,
+    0x5de7, 0x5de7, 0x3de7, 0x5def, 0x5def, 0x3de7, 0x8004, 0x5de7, 0x0003, 0x5def, 0x5def, 0x5de7,
+    0x8006, 0x5def, 0x8003, 0x7def, 0x0002, 0x5def, 0x5def, 0x8007, 0x7def, 0x0002, 0x7eef, 0x7eef,
+    0x8003, 0x7def, 0x800a, 0x7eef, 0x0001, 0x9eef, 0x8004, 0x7eef, 0x0008, 0x9eef, 0x9ef7, 0x9ef7,
+    0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x800a, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x8004,
+    0xbef7, 0x0001, 0x9ef7, 0x800f, 0xbef7, 0x0002, 0xbff7, 0xbef7, 0x8005, 0xbff7, 0x0001, 0xbef7,
+    0x8004, 0xbff7, 0x0001, 0xdff7, 0x8004, 0xbff7, 0x0001, 0xdff7, 0x8006, 0xbff7, 0x0001, 0xdff7,
+    0x8003, 0xbff7, 0x0001, 0xdff7, 0x8004, 0xbff7, 0x8006, 0xdff7, 0x0003, 0xdfff, 0xdff7, 0xdff7,
+    0x8039, 0xdfff, 0x000b, 0xffff, 0xdfff, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff,
+    0xdfff, 0xdfff, 0x8069, 0xffff, 0x8005, 0x3ce7, 0x000c, 0x3de7, 0x5de7, 0x3ce7, 0x3de7, 0x3ce7,
+    0x5de7, 0x5de7, 0x3de7, 0x3de7, 0x5de7, 0x5de7, 0x5def, 0x8003, 0x5de7, 0x0002, 0x5def, 0x5de7,
+    0x800b, 0x5def, 0x0003, 0x7def, 0x7def, 0x5def, 0x8007, 0x7def, 0x0001, 0x7eef, 0x8005, 0x7def,
+    0x8004, 0x7eef, 0x0002, 0x7def, 0x7def, 0x800a, 0x7eef, 0x8003, 0x9eef, 0x0003, 0x9ef7, 0x9ef7,
+    0x9eef, 0x800b, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x0006, 0xbef7, 0x9ef7, 0xbef7, 0xbef7,
+    0x9ef7, 0x9ef7, 0x8004, 0xbef7, 0x0002, 0x9ef7, 0x9ef7, 0x8004, 0xbef7, 0x0003, 0xbff7, 0xbef7,
+    0xbff7, 0x8003, 0xbef7, 0x8004, 0xbff7, 0x0002, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x0001, 0xdff7,
+    0x8004, 0xbff7, 0x0003, 0xbef7, 0xbff7, 0xdff7, 0x8004, 0xbff7, 0x0001, 0xdff7, 0x8004, 0xbff7,
+    0x8003, 0xdff7, 0x0001, 0xbff7, 0x8003, 0xdff7, 0x0006, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdff7,
+    0xdff7, 0x802d, 0xdfff, 0x0001, 0xffff, 0x800b, 0xdfff, 0x0004, 0xffff, 0xdfff, 0xffff, 0xffff,
+    0x8003, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xffff, 0x8003, 0xdfff, 0x8067, 0xffff, 0x800a, 0x3ce7,
+    0x000a, 0x3de7, 0x5de7, 0x5de7, 0x3de7, 0x5de7, 0x5de7, 0x5def, 0x5def, 0x5de7, 0x5de7, 0x800d,
+    0x5def, 0x0003, 0x7def, 0x7def, 0x5def, 0x800a, 0x7def, 0x0003, 0x7eef, 0x7def, 0x7def, 0x8010,
+    0x7eef, 0x0001, 0x9ef7, 0x8003, 0x9eef, 0x0003, 0x9ef7, 0x9ef7, 0x9eef, 0x800a, 0x9ef7, 0x0001,
+    0xbef7, 0x8006, 0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8004, 0xbef7, 0x0003, 0x9ef7, 0xbef7,
+    0x9ef7, 0x8006, 0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8005, 0xbff7, 0x0007, 0xbef7, 0xbef7,
+    0xbff7, 0xbef7, 0xdff7, 0xdef7, 0xbef7, 0x8004, 0xbff7, 0x0001, 0xdff7, 0x8006, 0xbff7, 0x800c,
+    0xdff7, 0x8003, 0xdfff, 0x8003, 0xdff7, 0x802a, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0002,
+    0xffff, 0xffff, 0x8004, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x0003, 0xffff, 0xffff, 0xdfff,
+    0x8003, 0xffff, 0x0003, 0xdfff, 0xffff, 0xffff, 0x8005, 0xdfff, 0x8064, 0xffff, 0x800a, 0x3ce7,
+    0x0006, 0x3de7, 0x5de7, 0x5def, 0x5de7, 0x3de7, 0x3de7, 0x8003, 0x5de7, 0x8004, 0x5def, 0x0001,
+    0x5de7, 0x800a, 0x5def, 0x0002, 0x7def, 0x5def, 0x800b, 0x7def, 0x0001, 0x7eef, 0x8003, 0x7def,
+    0x8004, 0x7eef, 0x0001, 0x7def, 0x8005, 0x7eef, 0x0001, 0x9eef, 0x8004, 0x7eef, 0x0003, 0x9ef7,
+    0x9eef, 0x7eef, 0x8005, 0x9ef7, 0x0001, 0x9eef, 0x8005, 0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7,
+    0x000c, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7,
+    0x9ef7, 0x800c, 0xbef7, 0x8007, 0xbff7, 0x0004, 0xbef7, 0xbff7, 0xbff7, 0xdff7, 0x8003, 0xbff7,
+    0x0002, 0xdff7, 0xdff7, 0x8006, 0xbff7, 0x8003, 0xdff7, 0x8003, 0xbff7, 0x8003, 0xdff7, 0x0003,
+    0xdfff, 0xdff7, 0xdff7, 0x8006, 0xdfff, 0x0001, 0xdff7, 0x8020, 0xdfff, 0x0001, 0xffff, 0x8008,
+    0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8004, 0xdfff, 0x0001, 0xffff,
+    0x8007, 0xdfff, 0x0005, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0x8005, 0xdfff, 0x8003, 0xffff,
+    0x0001, 0xdfff, 0x8006, 0xffff, 0x0001, 0xdfff, 0x8059, 0xffff, 0x800a, 0x3ce7, 0x0006, 0x3de7,
+    0x5de7, 0x3de7, 0x5de7, 0x5de7, 0x3de7, 0x8003, 0x5de7, 0x0005, 0x5def, 0x5de7, 0x5def, 0x5def,
+    0x5de7, 0x8003, 0x5def, 0x8005, 0x5de7, 0x8004, 0x5def, 0x0005, 0x7def, 0x5def, 0x5def, 0x7def,
+    0x7def, 0x8003, 0x7eef, 0x8006, 0x7def, 0x0003, 0x7eef, 0x7def, 0x7def, 0x8008, 0x7eef, 0x8003,
+    0x9eef, 0x0003, 0x7eef, 0x7eef, 0x9ef7, 0x8003, 0x9eef, 0x8011, 0x9ef7, 0x0002, 0xbef7, 0xbef7,
+    0x8003, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x8007, 0xbef7, 0x0001, 0xbff7, 0x8008, 0xbef7, 0x0002,
+    0xbff7, 0xbef7, 0x8012, 0xbff7, 0x0001, 0xdff7, 0x8007, 0xbff7, 0x8006, 0xdff7, 0x8003, 0xdfff,
+    0x0004, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0x8008, 0xdfff, 0x0001, 0xdff7, 0x801e, 0xdfff, 0x0001,
+    0xffff, 0x8003, 0xdfff, 0x0009, 0xffff, 0xffff, 0xdfff, 0xffff, 0xdfff, 0xffff, 0xdfff, 0xdfff,
+    0xffff, 0x8007, 0xdfff, 0x8005, 0xffff, 0x8007, 0xdfff, 0x8013, 0xffff, 0x0001, 0xdfff, 0x804e,
+    0xffff, 0x800a, 0x3ce7, 0x8003, 0x3de7, 0x0006, 0x5de7, 0x5de7, 0x3de7, 0x3de7, 0x5de7, 0x5de7,
+    0x8004, 0x5def, 0x0001, 0x5de7, 0x8004, 0x5def, 0x8004, 0x5de7, 0x8005, 0x5def, 0x0002, 0x7def,
+    0x5def, 0x8004, 0x7def, 0x0004, 0x7eef, 0x7def, 0x7def, 0x7eef, 0x8003, 0x7def, 0x0003, 0x7eef,
+    0x7eef, 0x7def, 0x8008, 0x7eef, 0x8003, 0x9eef, 0x0001, 0x7eef, 0x8005, 0x9eef, 0x8003, 0x9ef7,
+    0x0003, 0x9eef, 0x9ef7, 0x9eef, 0x800d, 0x9ef7, 0x8005, 0xbef7, 0x0004, 0x9ef7, 0xbef7, 0x9ef7,
+    0x9ef7, 0x800c, 0xbef7, 0x0003, 0xbff7, 0xbff7, 0xbef7, 0x8015, 0xbff7, 0x0004, 0xdff7, 0xdff7,
+    0xbff7, 0xbff7, 0x8003, 0xdff7, 0x0003, 0xbff7, 0xdff7, 0xdff7, 0x8003, 0xdfff, 0x8004, 0xdff7,
+    0x8007, 0xdfff, 0x0001, 0xdff7, 0x8023, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8004, 0xdfff, 0x8004,
+    0xffff, 0x8006, 0xdfff, 0x8006, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x8007, 0xffff, 0x0001, 0xdfff,
+    0x800a, 0xffff, 0x0001, 0xdfff, 0x8053, 0xffff, 0x800b, 0x3ce7, 0x0006, 0x5de7, 0x3de7, 0x5de7,
+    0x5de7, 0x3de7, 0x3de7, 0x8003, 0x5de7, 0x0002, 0x5def, 0x5de7, 0x8005, 0x5def, 0x0004, 0x5de7,
+    0x5def, 0x5def, 0x3de7, 0x8005, 0x5def, 0x0001, 0x5de7, 0x8003, 0x5def, 0x0002, 0x7def, 0x5def,
+    0x8004, 0x7def, 0x0004, 0x7eef, 0x7eef, 0x7def, 0x7def, 0x8006, 0x7eef, 0x0001, 0x7def, 0x8004,
+    0x7eef, 0x8005, 0x9eef, 0x0006, 0x7eef, 0x7eef, 0x9eef, 0x9ef7, 0x9eef, 0x7eef, 0x8005, 0x9eef,
+    0x8009, 0x9ef7, 0x0001, 0xbef7, 0x8004, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8010, 0xbef7,
+    0x0004, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0x800d, 0xbff7, 0x0001, 0xdff7, 0x8005, 0xbff7, 0x000a,
+    0xdff7, 0xdff7, 0xbff7, 0xdff7, 0xdfff, 0xdff7, 0xdfff, 0xbff7, 0xdff7, 0xbff7, 0x8003, 0xdfff,
+    0x8005, 0xdff7, 0x802a, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff, 0x0002, 0xffff, 0xffff, 0x800c,
+    0xdfff, 0x0002, 0xffff, 0xdfff, 0x8004, 0xffff, 0x0001, 0xdfff, 0x8009, 0xffff, 0x0001, 0xdfff,
+    0x8059, 0xffff, 0x800c, 0x3ce7, 0x8004, 0x3de7, 0x0005, 0x3ce7, 0x3de7, 0x5de7, 0x3de7, 0x3de7,
+    0x8006, 0x5def, 0x0005, 0x5de7, 0x5def, 0x5def, 0x5de7, 0x5de7, 0x8006, 0x5def, 0x0005, 0x7def,
+    0x5def, 0x7def, 0x5def, 0x5def, 0x8004, 0x7def, 0x0004, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x8008,
+    0x7eef, 0x0005, 0x7def, 0x7eef, 0x7eef, 0x9eef, 0x7eef, 0x8004, 0x9eef, 0x0002, 0x9ef7, 0x9ef7,
+    0x8003, 0x9eef, 0x0005, 0x9ef7, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x8008, 0x9ef7, 0x0001, 0xbef7,
+    0x8005, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x8008, 0xbef7, 0x0004, 0x9ef7, 0xbef7, 0xbef7,
+    0xbff7, 0x8008, 0xbef7, 0x8015, 0xbff7, 0x0008, 0xdff7, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0xdfff,
+    0xdff7, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x8004, 0xdfff, 0x0001, 0xdff7, 0x800c, 0xdfff,
+    0x0001, 0xdff7, 0x8009, 0xdfff, 0x0001, 0xffff, 0x8016, 0xdfff, 0x8004, 0xffff, 0x800d, 0xdfff,
+    0x8003, 0xffff, 0x8003, 0xdfff, 0x800a, 0xffff, 0x0001, 0xdfff, 0x8042, 0xffff, 0x0001, 0xdfff,
+    0x8015, 0xffff, 0x800d, 0x3ce7, 0x0002, 0x5ce7, 0x5de7, 0x8003, 0x3de7, 0x0005, 0x5de7, 0x5de7,
+    0x3de7, 0x3de7, 0x5de7, 0x8004, 0x5def, 0x0003, 0x5de7, 0x5def, 0x5def, 0x8003, 0x5de7, 0x8005,
+    0x5def, 0x0001, 0x7def, 0x8005, 0x5def, 0x0001, 0x7eef, 0x8003, 0x7def, 0x0005, 0x7eef, 0x7def,
+    0x7eef, 0x7def, 0x7def, 0x8003, 0x7eef, 0x0002, 0x7def, 0x7def, 0x8007, 0x7eef, 0x8003, 0x9eef,
+    0x0003, 0x9ef7, 0x7eef, 0x9eef, 0x8003, 0x9ef7, 0x0004, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x800b,
+    0x9ef7, 0x0004, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x8006, 0x9ef7, 0x8004, 0xbef7, 0x0004, 0x9ef7,
+    0xbef7, 0xbef7, 0xbff7, 0x8006, 0xbef7, 0x0002, 0xbff7, 0xbef7, 0x8015, 0xbff7, 0x8006, 0xdff7,
+    0x0002, 0xdfff, 0xdff7, 0x8004, 0xdfff, 0x0001, 0xdff7, 0x8003, 0xdfff, 0x0001, 0xdff7, 0x802c,
+    0xdfff, 0x0005, 0xffff, 0xffff, 0xdfff, 0xdfff, 0xffff, 0x800d, 0xdfff, 0x8004, 0xffff, 0x0001,
+    0xdfff, 0x8004, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x8048, 0xffff, 0x0004, 0xdfff, 0xffff, 0xffff,
+    0xdfff, 0x8012, 0xffff, 0x800f, 0x3ce7, 0x0010, 0x3de7, 0x3de7, 0x5de7, 0x5de7, 0x5def, 0x3de7,
+    0x3de7, 0x5ce7, 0x5def, 0x5def, 0x5de7, 0x5def, 0x5de7, 0x5de7, 0x5def, 0x5de7, 0x800c, 0x5def,
+    0x0001, 0x5eef, 0x8003, 0x7def, 0x0001, 0x5def, 0x8005, 0x7def, 0x0002, 0x7eef, 0x7eef, 0x8003,
+    0x7def, 0x8009, 0x7eef, 0x0005, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9ef7, 0x8005, 0x9eef, 0x8012,
+    0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x800e, 0xbef7, 0x0008,
+    0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xdff7, 0xdff7, 0x800a, 0xbff7, 0x0004, 0xdff7,
+    0xdff7, 0xbfff, 0xdfff, 0x8004, 0xdff7, 0x000b, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdfff,
+    0xbff7, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0x801b, 0xdfff, 0x0001, 0xffff, 0x801a, 0xdfff, 0x0001,
+    0xffff, 0x8008, 0xdfff, 0x8003, 0xffff, 0x8003, 0xdfff, 0x000a, 0xffff, 0xffff, 0xdfff, 0xdfff,
+    0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x8044, 0xffff, 0x0001, 0xdfff, 0x8013, 0xffff,
+    0x0002, 0x3ce7, 0x1ce7, 0x800d, 0x3ce7, 0x8003, 0x3de7, 0x0005, 0x5de7, 0x5def, 0x3de7, 0x3de7,
+    0x5de7, 0x8004, 0x5def, 0x0005, 0x5de7, 0x5de7, 0x5def, 0x5de7, 0x5de7, 0x8005, 0x5def, 0x0001,
+    0x5de7, 0x8005, 0x5def, 0x8003, 0x7def, 0x0004, 0x5def, 0x5def, 0x7def, 0x7def, 0x8004, 0x7eef,
+    0x0004, 0x7def, 0x7def, 0x7eef, 0x7def, 0x8007, 0x7eef, 0x0002, 0x9eef, 0x7eef, 0x8004, 0x9eef,
+    0x0001, 0x9ef7, 0x8005, 0x9eef, 0x800d, 0x9ef7, 0x0001, 0xbef7, 0x8005, 0x9ef7, 0x8013, 0xbef7,
+    0x0006, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0x800d, 0xbff7, 0x8008, 0xdff7, 0x0003,
+    0xdfff, 0xdfff, 0xbff7, 0x8003, 0xdff7, 0x0005, 0xdfff, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0x8007,
+    0xdfff, 0x0001, 0xdff7, 0x802e, 0xdfff, 0x0001, 0xffff, 0x8008, 0xdfff, 0x8003, 0xffff, 0x8004,
+    0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x8008, 0xffff, 0x0001,
+    0xdfff, 0x803a, 0xffff, 0x0002, 0xdfff, 0xffff, 0x8003, 0xdfff, 0x8012, 0xffff, 0x0002, 0x3ce7,
+    0x1ce7, 0x8003, 0x3ce7, 0x0001, 0x3de7, 0x8009, 0x3ce7, 0x0008, 0x3de7, 0x3de7, 0x3ce7, 0x5def,
+    0x3ce7, 0x5ce7, 0x5de7, 0x5de7, 0x8003, 0x5def, 0x8004, 0x5de7, 0x0003, 0x5def, 0x5de7, 0x5de7,
+    0x8004, 0x5def, 0x0001, 0x3de7, 0x8005, 0x5def, 0x0002, 0x7def, 0x5def, 0x8005, 0x7def, 0x0009,
+    0x7eef, 0x7def, 0x7def, 0x7eef, 0x7eef, 0x7def, 0x7eef, 0x7def, 0x7def, 0x8007, 0x7eef, 0x0003,
+    0x9eef, 0x7eef, 0x9ef7, 0x8009, 0x9eef, 0x800b, 0x9ef7, 0x0001, 0xbef7, 0x8003, 0x9ef7, 0x0005,
+    0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8008, 0xbef7, 0x0001,
+    0xbff7, 0x8003, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8003, 0xbef7, 0x8014, 0xbff7, 0x0004, 0xdff7,
+    0xdfff, 0xdfff, 0xdff7, 0x8003, 0xbff7, 0x0004, 0xdfff, 0xdff7, 0xdfff, 0xdff7, 0x800f, 0xdfff,
+    0x0001, 0xdff7, 0x802d, 0xdfff, 0x0001, 0xffff, 0x8005, 0xdfff, 0x0002, 0xffff, 0xffff, 0x800c,
+    0xdfff, 0x0008, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x803a, 0xffff,
+    0x0006, 0xdfff, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff, 0x8011, 0xffff, 0x0002, 0x1cdf, 0x1ce7,
+    0x800a, 0x3ce7, 0x0001, 0x5ce7, 0x8004, 0x3ce7, 0x0012, 0x5ce7, 0x3de7, 0x5de7, 0x3de7, 0x5def,
+    0x5de7, 0x5de7, 0x5def, 0x5def, 0x5de7, 0x5de7, 0x5def, 0x5de7, 0x5def, 0x5de7, 0x5de7, 0x5def,
+    0x5de7, 0x8008, 0x5def, 0x0003, 0x7eef, 0x7def, 0x5def, 0x800a, 0x7def, 0x800a, 0x7eef, 0x0005,
+    0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x7eef, 0x8006, 0x9eef, 0x0002, 0x9ef7, 0x9eef, 0x800c, 0x9ef7,
+    0x0003, 0xbef7, 0x9ef7, 0xbef7, 0x8004, 0x9ef7, 0x0004, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8008,
+    0xbef7, 0x0001, 0xbff7, 0x8006, 0xbef7, 0x0002, 0xbff7, 0xbef7, 0x8010, 0xbff7, 0x0001, 0xdff7,
+    0x8004, 0xbff7, 0x0002, 0xdfff, 0xdfff, 0x8003, 0xdff7, 0x0002, 0xbff7, 0xdfff, 0x8003, 0xdff7,
+    0x0003, 0xdfff, 0xdfff, 0xbff7, 0x8008, 0xdfff, 0x0001, 0xdff7, 0x8038, 0xdfff, 0x0001, 0xffff,
+    0x800c, 0xdfff, 0x8003, 0xffff, 0x0003, 0xdfff, 0xffff, 0xdfff, 0x803d, 0xffff, 0x0001, 0xdfff,
+    0x8015, 0xffff, 0x0002, 0x1ce7, 0x1ce7, 0x800f, 0x3ce7, 0x0009, 0x3de7, 0x3ce7, 0x5ce7, 0x3de7,
+    0x3de7, 0x5de7, 0x5de7, 0x5def, 0x5def, 0x8003, 0x5de7, 0x0004, 0x3de7, 0x5de7, 0x5def, 0x5de7,
+    0x800b, 0x5def, 0x800c, 0x7def, 0x800c, 0x7eef, 0x000b, 0x9eef, 0x7eef, 0x7eef, 0x9eef, 0x7eef,
+    0x7eef, 0x9eef, 0x9ef7, 0x9ef7, 0x9eef, 0x9eef, 0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8006, 0x9ef7,
+    0x0003, 0xbef7, 0xbef7, 0x9ef7, 0x8010, 0xbef7, 0x800a, 0xbff7, 0x0001, 0xdff7, 0x8006, 0xbff7,
+    0x0007, 0xdfff, 0xbff7, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0xdfff, 0x800a, 0xdff7, 0x8006, 0xdfff,
+    0x0001, 0xdff7, 0x803d, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8005,
+    0xdfff, 0x8003, 0xffff, 0x0001, 0xdfff, 0x803e, 0xffff, 0x0004, 0xdfff, 0xffff, 0xdfff, 0xdfff,
+    0x8013, 0xffff, 0x0002, 0x1ce7, 0x1ce7, 0x8003, 0x3ce7, 0x0004, 0x1ce7, 0x3ce7, 0x3ce7, 0x3de7,
+    0x8007, 0x3ce7, 0x8003, 0x3de7, 0x0004, 0x5de7, 0x5de7, 0x3de7, 0x3de7, 0x8004, 0x5de7, 0x0005,
+    0x5def, 0x5de7, 0x3de7, 0x5de7, 0x3de7, 0x800d, 0x5def, 0x800c, 0x7def, 0x8006, 0x7eef, 0x0001,
+    0x7def, 0x8006, 0x7eef, 0x8003, 0x9eef, 0x0005, 0x7eef, 0x9ef7, 0x9eef, 0x9ef7, 0x9eef, 0x800a,
+    0x9ef7, 0x0004, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x8004, 0x9ef7, 0x0002, 0xbef7, 0x9ef7, 0x800c,
+    0xbef7, 0x0001, 0xbff7, 0x8005, 0xbef7, 0x8005, 0xbff7, 0x0001, 0xbef7, 0x8005, 0xbff7, 0x0001,
+    0xdff7, 0x8009, 0xbff7, 0x800e, 0xdff7, 0x0001, 0xbff7, 0x8004, 0xdfff, 0x0001, 0xdff7, 0x8043,
+    0xdfff, 0x0002, 0xffff, 0xffff, 0x8009, 0xdfff, 0x0003, 0xffff, 0xffff, 0xdfff, 0x803b, 0xffff,
+    0x0001, 0xdfff, 0x8005, 0xffff, 0x0001, 0xdfff, 0x8010, 0xffff, 0x8005, 0x1ce7, 0x800b, 0x3ce7,
+    0x0001, 0x5de7, 0x8008, 0x3de7, 0x0004, 0x5de7, 0x3de7, 0x5de7, 0x5def, 0x8003, 0x5de7, 0x800e,
+    0x5def, 0x8003, 0x7def, 0x0002, 0x5def, 0x5def, 0x8006, 0x7def, 0x800a, 0x7eef, 0x0006, 0x7def,
+    0x7eef, 0x7eef, 0x9eef, 0x7eef, 0x7eef, 0x8005, 0x9eef, 0x800d, 0x9ef7, 0x0001, 0xbef7, 0x8004,
+    0x9ef7, 0x0003, 0xbef7, 0x9ef7, 0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8008, 0xbef7, 0x8003,
+    0xbff7, 0x0001, 0xbef7, 0x8004, 0xbff7, 0x0006, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbff7, 0xdff7,
+    0x800d, 0xbff7, 0x0009, 0xdff7, 0xdff7, 0xbff7, 0xbff7, 0xdff7, 0xbff7, 0xdff7, 0xbff7, 0xbff7,
+    0x8003, 0xdff7, 0x8004, 0xdfff, 0x0003, 0xdff7, 0xdfff, 0xdff7, 0x8008, 0xdfff, 0x0001, 0xdff7,
+    0x8003, 0xdfff, 0x0001, 0xdff7, 0x802d, 0xdfff, 0x0001, 0xffff, 0x8007, 0xdfff, 0x0002, 0xffff,
+    0xffff, 0x8007, 0xdfff, 0x0004, 0xffff, 0xffff, 0xdfff, 0xdfff, 0x8054, 0xffff, 0x8006, 0x1ce7,
+    0x800d, 0x3ce7, 0x8009, 0x3de7, 0x0001, 0x5def, 0x8003, 0x5de7, 0x800d, 0x5def, 0x0002, 0x7def,
+    0x5def, 0x8003, 0x7def, 0x0001, 0x5def, 0x8007, 0x7def, 0x8009, 0x7eef, 0x0001, 0x7def, 0x8003,
+    0x9eef, 0x8003, 0x7eef, 0x0002, 0x9eef, 0x9ef7, 0x8004, 0x9eef, 0x800e, 0x9ef7, 0x0004, 0xbef7,
+    0x9ef7, 0xbef7, 0x9ef7, 0x8016, 0xbef7, 0x0002, 0xbff7, 0xbef7, 0x800b, 0xbff7, 0x0001, 0xdff7,
+    0x8005, 0xbff7, 0x0005, 0xdff7, 0xbff7, 0xbff7, 0xdff7, 0xbff7, 0x8006, 0xdff7, 0x0008, 0xbff7,
+    0xdfff, 0xbfff, 0xbff7, 0xdff7, 0xdfff, 0xdff7, 0xdfff, 0x8004, 0xdff7, 0x8003, 0xdfff, 0x0001,
+    0xdff7, 0x8038, 0xdfff, 0x0001, 0xffff, 0x8010, 0xdfff, 0x8051, 0xffff, 0x8006, 0x1ce7, 0x800d,
+    0x3ce7, 0x8003, 0x3de7, 0x0001, 0x5de7, 0x8005, 0x3de7, 0x0005, 0x5de7, 0x3de7, 0x5de7, 0x3de7,
+    0x5de7, 0x8005, 0x5def, 0x0001, 0x5de7, 0x8006, 0x5def, 0x0003, 0x7def, 0x5def, 0x5def, 0x8006,
+    0x7def, 0x0003, 0x7eef, 0x7def, 0x7def, 0x800c, 0x7eef, 0x0001, 0x9eef, 0x8004, 0x7eef, 0x0002,
+    0x9ef7, 0x9ef7, 0x8006, 0x9eef, 0x800e, 0x9ef7, 0x000b, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7,
+    0xbef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x800b, 0xbef7, 0x8004, 0xbff7, 0x0001, 0xbef7,
+    0x800d, 0xbff7, 0x0003, 0xdff7, 0xbff7, 0xbff7, 0x8008, 0xdff7, 0x000b, 0xdfff, 0xdfff, 0xdff7,
+    0xbff7, 0xdff7, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xdfff, 0xdff7, 0x8005, 0xdfff, 0x0001, 0xdff7,
+    0x8006, 0xdfff, 0x0001, 0xdff7, 0x8031, 0xdfff, 0x8003, 0xffff, 0x8012, 0xdfff, 0x0002, 0xffff,
+    0xdfff, 0x804d, 0xffff, 0x0003, 0x1ce7, 0x1ce7, 0x3ce7, 0x8003, 0x1ce7, 0x800d, 0x3ce7, 0x0004,
+    0x3de7, 0x3ce7, 0x3de7, 0x5de7, 0x8009, 0x3de7, 0x0001, 0x5de7, 0x8005, 0x5def, 0x0002, 0x5de7,
+    0x5de7, 0x8007, 0x5def, 0x800a, 0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x8004, 0x7eef, 0x0001,
+    0x7def, 0x8006, 0x7eef, 0x0002, 0x9eef, 0x7eef, 0x8009, 0x9eef, 0x8011, 0x9ef7, 0x0001, 0xbef7,
+    0x8003, 0x9ef7, 0x800b, 0xbef7, 0x0005, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0x8003, 0xbff7,
+    0x0003, 0xbef7, 0xbff7, 0xbef7, 0x8007, 0xbff7, 0x0008, 0xdff7, 0xbff7, 0xdff7, 0xbff7, 0xdff7,
+    0xdff7, 0xbff7, 0xbff7, 0x8007, 0xdff7, 0x000b, 0xdfff, 0xdfff, 0xdff7, 0xbff7, 0xdff7, 0xdff7,
+    0xbff7, 0xdff7, 0xdfff, 0xdff7, 0xdff7, 0x8004, 0xdfff, 0x0001, 0xdff7, 0x8035, 0xdfff, 0x8007,
+    0xffff, 0x8012, 0xdfff, 0x0003, 0xffff, 0xffff, 0xdfff, 0x804c, 0xffff, 0x0002, 0x1ce7, 0x1ce7,
+    0x8005, 0x3ce7, 0x0001, 0x1ce7, 0x800d, 0x3ce7, 0x8003, 0x3de7, 0x0001, 0x5de7, 0x8005, 0x3de7,
+    0x0005, 0x5de7, 0x5de7, 0x3de7, 0x5de7, 0x5def, 0x8004, 0x5de7, 0x0001, 0x3de7, 0x8006, 0x5def,
+    0x0005, 0x7def, 0x7def, 0x5def, 0x5def, 0x7eef, 0x8004, 0x7def, 0x0002, 0x7eef, 0x7def, 0x8003,
+    0x7eef, 0x0006, 0x7def, 0x9eef, 0x7eef, 0x7eef, 0x7def, 0x7def, 0x8005, 0x7eef, 0x0001, 0x9eef,
+    0x8003, 0x7eef, 0x0002, 0x9eef, 0x7eef, 0x8005, 0x9eef, 0x800d, 0x9ef7, 0x8003, 0xbef7, 0x0004,
+    0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x800c, 0xbef7, 0x8007, 0xbff7, 0x0001, 0xbef7, 0x800c, 0xbff7,
+    0x8004, 0xdff7, 0x8006, 0xbff7, 0x8003, 0xdff7, 0x0008, 0xdfff, 0xdeff, 0xdef7, 0xdfff, 0xdff7,
+    0xbff7, 0xdff7, 0xdfff, 0x8003, 0xdff7, 0x8004, 0xdfff, 0x0001, 0xdff7, 0x8008, 0xdfff, 0x0001,
+    0xdff7, 0x802d, 0xdfff, 0x0001, 0xffff, 0x8019, 0xdfff, 0x804d, 0xffff, 0x0001, 0x1cdf, 0x8003,
+    0x1ce7, 0x0006, 0x3ce7, 0x3ce7, 0x1ce7, 0x1ce7, 0x3ce7, 0x1ce7, 0x8007, 0x3ce7, 0x0001, 0x3de7,
+    0x8006, 0x3ce7, 0x8003, 0x3de7, 0x0007, 0x5de7, 0x3de7, 0x5de7, 0x5de7, 0x3de7, 0x5de7, 0x3de7,
+    0x8005, 0x5de7, 0x0001, 0x3de7, 0x800b, 0x5def, 0x800a, 0x7def, 0x8003, 0x7eef, 0x0004, 0x7def,
+    0x7def, 0x7eef, 0x7def, 0x800a, 0x7eef, 0x0004, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x8012, 0x9ef7,
+    0x0002, 0xbef7, 0x9ef7, 0x800d, 0xbef7, 0x8004, 0xbff7, 0x8005, 0xbef7, 0x8005, 0xbff7, 0x0001,
+    0xbef7, 0x800b, 0xbff7, 0x0004, 0xdff7, 0xdff7, 0xbff7, 0xdff7, 0x8004, 0xbff7, 0x0002, 0xbef7,
+    0xbfff, 0x8003, 0xdff7, 0x000f, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xdfff,
+    0xdfff, 0xdff7, 0xdfff, 0xdff7, 0xdfff, 0xdfff, 0xdff7, 0x802d, 0xdfff, 0x0001, 0xffff, 0x8003,
+    0xdfff, 0x8003, 0xffff, 0x8017, 0xdfff, 0x804c, 0xffff, 0x8005, 0x1ce7, 0x0001, 0x3ce7, 0x8004,
+    0x1ce7, 0x8007, 0x3ce7, 0x0001, 0x3de7, 0x8006, 0x3ce7, 0x8003, 0x3de7, 0x0001, 0x3def, 0x8003,
+    0x3de7, 0x8004, 0x5de7, 0x0005, 0x5def, 0x3de7, 0x5def, 0x3de7, 0x3de7, 0x800c, 0x5def, 0x8008,
+    0x7def, 0x8004, 0x7eef, 0x0002, 0x7def, 0x7eef, 0x8003, 0x7def, 0x0008, 0x7eef, 0x7eef, 0x9eef,
+    0x7eef, 0x7eef, 0x9eef, 0x7eef, 0x7eef, 0x8004, 0x9eef, 0x0001, 0x7eef, 0x8015, 0x9ef7, 0x8012,
+    0xbef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8005, 0xbff7, 0x8003, 0xbef7, 0x8004, 0xbff7, 0x0002,
+    0xdff7, 0xdff7, 0x8004, 0xbff7, 0x8003, 0xdff7, 0x8004, 0xbff7, 0x8003, 0xdff7, 0x0001, 0xbff7,
+    0x8005, 0xdff7, 0x0005, 0xbff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0x8028, 0xdfff, 0x0001, 0xffff,
+    0x800e, 0xdfff, 0x0001, 0xffff, 0x8014, 0xdfff, 0x0006, 0xffff, 0xdfff, 0xffff, 0xffff, 0xdfff,
+    0xdfff, 0x804b, 0xffff, 0x8006, 0x1ce7, 0x0001, 0x3ce7, 0x8003, 0x1ce7, 0x8007, 0x3ce7, 0x0001,
+    0x3de7, 0x8006, 0x3ce7, 0x0008, 0x3de7, 0x3de7, 0x5de7, 0x3de7, 0x3de7, 0x5de7, 0x3de7, 0x3de7,
+    0x8003, 0x5de7, 0x0007, 0x3de7, 0x5de7, 0x3de7, 0x5de7, 0x5de7, 0x3de7, 0x5de7, 0x8007, 0x5def,
+    0x0007, 0x7def, 0x5def, 0x5def, 0x7def, 0x7eef, 0x7def, 0x7eef, 0x8003, 0x7def, 0x8005, 0x7eef,
+    0x0002, 0x7def, 0x7eef, 0x8003, 0x7def, 0x0003, 0x7eef, 0x7eef, 0x7def, 0x8005, 0x7eef, 0x0009,
+    0x9eef, 0x9ef7, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x8011, 0x9ef7, 0x0002,
+    0xbef7, 0x9ef7, 0x800c, 0xbef7, 0x0002, 0xbff7, 0xbff7, 0x8004, 0xbef7, 0x800d, 0xbff7, 0x8003,
+    0xdff7, 0x8007, 0xbff7, 0x8006, 0xdff7, 0x0001, 0xbff7, 0x8006, 0xdff7, 0x0006, 0xdfff, 0xdfff,
+    0xdff7, 0xdfff, 0xdff7, 0xdff7, 0x801e, 0xdfff, 0x0001, 0xffff, 0x8004, 0xdfff, 0x0001, 0xffff,
+    0x8008, 0xdfff, 0x0002, 0xffff, 0xffff, 0x8007, 0xdfff, 0x0001, 0xffff, 0x8010, 0xdfff, 0x0001,
+    0xffff, 0x8009, 0xdfff, 0x804b, 0xffff, 0x0002, 0x1ce7, 0x1cdf, 0x8009, 0x1ce7, 0x8009, 0x3ce7,
+    0x0006, 0x3de7, 0x3ce7, 0x3ce7, 0x3de7, 0x3de7, 0x5de7, 0x8003, 0x3de7, 0x0006, 0x5de7, 0x5de7,
+    0x3de7, 0x3de7, 0x5de7, 0x5de7, 0x8003, 0x3de7, 0x0006, 0x5de7, 0x5def, 0x3de7, 0x5def, 0x5def,
+    0x5de7, 0x800a, 0x5def, 0x8008, 0x7def, 0x8004, 0x7eef, 0x8003, 0x7def, 0x0004, 0x7eef, 0x7eef,
+    0x7def, 0x7def, 0x8004, 0x7eef, 0x0009, 0x9ef7, 0x7eef, 0x9eef, 0x9eef, 0x7eef, 0x9eef, 0x7eef,
+    0x9ef7, 0x9eef, 0x800c, 0x9ef7, 0x0001, 0xbef7, 0x8005, 0x9ef7, 0x800d, 0xbef7, 0x8003, 0xbff7,
+    0x8003, 0xbef7, 0x8009, 0xbff7, 0x0001, 0xbef7, 0x8005, 0xbff7, 0x0002, 0xdff7, 0xbff7, 0x8004,
+    0xdff7, 0x8004, 0xbff7, 0x0002, 0xdff7, 0xbff7, 0x800b, 0xdff7, 0x0008, 0xbff7, 0xbff7, 0xdfff,
+    0xdfff, 0xdff7, 0xdfff, 0xdff7, 0xdff7, 0x8047, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x804d,
+    0xffff, 0x0008, 0x1ce7, 0x1cdf, 0x1cdf, 0x1ce7, 0x3ce7, 0x3ce7, 0x1ce7, 0x3ce7, 0x8004, 0x1ce7,
+    0x8007, 0x3ce7, 0x0005, 0x3de7, 0x3de7, 0x3ce7, 0x3de7, 0x3ce7, 0x8009, 0x3de7, 0x8003, 0x5de7,
+    0x0002, 0x3de7, 0x3de7, 0x8003, 0x5de7, 0x800d, 0x5def, 0x8004, 0x7def, 0x0001, 0x7eef, 0x8003,
+    0x7def, 0x8006, 0x7eef, 0x0001, 0x7def, 0x800a, 0x7eef, 0x0001, 0x9eef, 0x8004, 0x7eef, 0x8004,
+    0x9eef, 0x0003, 0x9ef7, 0x9eef, 0x7eef, 0x8008, 0x9ef7, 0x000b, 0xbef7, 0x9ef7, 0x9ef7, 0xbef7,
+    0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8003, 0xbef7, 0x0004, 0xbff7, 0xbef7,
+    0xbff7, 0xbff7, 0x8003, 0xbef7, 0x0006, 0xbff7, 0xbff7, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0x8003,
+    0xbef7, 0x800a, 0xbff7, 0x8006, 0xdff7, 0x0002, 0xbff7, 0xbff7, 0x8003, 0xdfff, 0x0002, 0xbff7,
+    0xbff7, 0x8006, 0xdff7, 0x0001, 0xdfff, 0x8003, 0xdff7, 0x0003, 0xbff7, 0xdfff, 0xdfff, 0x8005,
+    0xdff7, 0x801c, 0xdfff, 0x0001, 0xffff, 0x800c, 0xdfff, 0x0002, 0xffff, 0xffff, 0x801b, 0xdfff,
+    0x0002, 0xffff, 0xdfff, 0x804e, 0xffff, 0x0001, 0x1cdf, 0x8004, 0x1ce7, 0x0001, 0x3ce7, 0x8007,
+    0x1ce7, 0x8005, 0x3ce7, 0x8007, 0x3de7, 0x0001, 0x3ce7, 0x8009, 0x3de7, 0x0001, 0x5def, 0x8003,
+    0x5de7, 0x0003, 0x3de7, 0x3de7, 0x5de7, 0x800a, 0x5def, 0x8007, 0x7def, 0x0002, 0x7eef, 0x7eef,
+    0x8005, 0x7def, 0x8003, 0x7eef, 0x0001, 0x7def, 0x8008, 0x7eef, 0x0001, 0x9eef, 0x8004, 0x7eef,
+    0x0002, 0x9eef, 0x7eef, 0x8004, 0x9eef, 0x0002, 0x9ef7, 0x9eef, 0x800a, 0x9ef7, 0x000a, 0xbef7,
+    0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0x9ef7, 0x9ef7, 0x8005, 0xbef7, 0x0004,
+    0xbff7, 0xbff7, 0xbef7, 0xbef7, 0x8003, 0xbff7, 0x0005, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0xbef7,
+    0x8009, 0xbff7, 0x8004, 0xdff7, 0x0002, 0xbff7, 0xbff7, 0x8003, 0xdff7, 0x0005, 0xbff7, 0xbff7,
+    0xdff7, 0xdfff, 0xdff7, 0x8003, 0xbff7, 0x800b, 0xdff7, 0x0001, 0xdfff, 0x8004, 0xdff7, 0x8004,
+    0xdfff, 0x0001, 0xdff7, 0x803b, 0xdfff, 0x0003, 0xffff, 0xffff, 0xdfff, 0x8053, 0xffff, 0x0001,
+    0xfcde, 0x8009, 0x1ce7, 0x0003, 0x3ce7, 0x1ce7, 0x1ce7, 0x8004, 0x3ce7, 0x8004, 0x3de7, 0x0001,
+    0x3ce7, 0x8003, 0x3de7, 0x0002, 0x3ce7, 0x3ce7, 0x8008, 0x3de7, 0x0001, 0x5def, 0x8003, 0x5de7,
+    0x0006, 0x3de7, 0x3de7, 0x5de7, 0x5def, 0x5de7, 0x5de7, 0x800b, 0x5def, 0x8003, 0x7def, 0x8003,
+    0x7eef, 0x0003, 0x7def, 0x7eef, 0x7def, 0x800c, 0x7eef, 0x0003, 0x9eef, 0x7eef, 0x9eef, 0x8003,
+    0x7eef, 0x0003, 0x9eef, 0x9eef, 0x7eef, 0x8004, 0x9eef, 0x800b, 0x9ef7, 0x0001, 0xbef7, 0x8004,
+    0x9ef7, 0x8003, 0xbef7, 0x0001, 0x9ef7, 0x8004, 0xbef7, 0x0006, 0x9ef7, 0xbef7, 0xbef7, 0xbff7,
+    0xbff7, 0xbef7, 0x8003, 0xbff7, 0x0009, 0xbef7, 0xbff7, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0xbff7,
+    0xbff7, 0xbef7, 0x8008, 0xbff7, 0x0002, 0xdff7, 0xdff7, 0x8006, 0xbff7, 0x0002, 0xdff7, 0xdfff,
+    0x8007, 0xbff7, 0x0002, 0xdff7, 0xbff7, 0x8006, 0xdff7, 0x0003, 0xdfff, 0xdfff, 0xdff7, 0x8003,
+    0xdfff, 0x0001, 0xdff7, 0x8003, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x801c, 0xdfff, 0x8003, 0xffff,
+    0x8015, 0xdfff, 0x0001, 0xffff, 0x8003, 0xdfff, 0x8057, 0xffff, 0x0002, 0xfcde, 0xfcde, 0x800c,
+    0x1ce7, 0x8005, 0x3ce7, 0x8005, 0x3de7, 0x0005, 0x3ce7, 0x3ce7, 0x3de7, 0x3de7, 0x3ce7, 0x8006,
+    0x3de7, 0x0005, 0x5de7, 0x5def, 0x5de7, 0x3de7, 0x3de7, 0x8004, 0x5de7, 0x8003, 0x5def, 0x0002,
+    0x5de7, 0x5de7, 0x8005, 0x5def, 0x8006, 0x7def, 0x8003, 0x7eef, 0x0002, 0x7def, 0x7def, 0x8013,
+    0x7eef, 0x8004, 0x9eef, 0x0005, 0x9ef7, 0x9eef, 0x9eef, 0x9ef7, 0x9eef, 0x8011, 0x9ef7, 0x0009,
+    0xbef7, 0x9ef7, 0x9ef7, 0xbef7, 0x9ef7, 0xbef7, 0xbef7, 0xbff7, 0xbef7, 0x8004, 0xbff7, 0x0003,
+    0xbef7, 0xbff7, 0xbef7, 0x8003, 0xbff7, 0x8003, 0xbef7, 0x8005, 0xbff7, 0x0001, 0xdff7, 0x800d,
+    0xbff7, 0x0001, 0xdff7, 0x8005, 0xbff7, 0x8006, 0xdff7, 0x0009, 0xbff7, 0xdff7, 0xdfff, 0xdfff,
+    0xdff7, 0xdfff, 0xdfff, 0xdff7, 0xdff7, 0x8003, 0xdfff, 0x8003, 0xdff7, 0x801d, 0xdfff, 0x0001,
+    0xffff, 0x8014, 0xdfff, 0x0003, 0xffff, 0xdfff, 0xdfff, 0x8059, 0xffff, 0x0002, 0xfcde, 0xfcde,
+    0x800d, 0x1ce7, 0x0003, 0x3ce7, 0x3de7, 0x3de7, 0x8005, 0x3ce7, 0x000c, 0x3de7, 0x3de7, 0x3ce7,
+    0x3de7, 0x3de7, 0x3ce7, 0x3ce7, 0x3de7, 0x3de7, 0x5de7, 0x3de7, 0x3de7, 0x8003, 0x5de7, 0x0001,
+    0x3de7, 0x8003, 0x5de7, 0x0001, 0x3de7, 0x8004, 0x5def, 0x0002, 0x5de7, 0x5de7, 0x8007, 0x5def,
+    0x0005, 0x7def, 0x5def, 0x5def, 0x7def, 0x7def, 0x8017, 0x7eef, 0x0002, 0x9eef, 0x7eef, 0x8003,
+    0x9eef, 0x8004, 0x9ef7, 0x0001, 0x9eef, 0x8004, 0x9ef7, 0x0001, 0x9eef, 0x800a, 0x9ef7, 0x8003,
+    0xbef7, 0x8004, 0x9ef7, 0x0003, 0xbff7, 0xbef7, 0xbef7, 0x8006, 0xbff7, 0x0001, 0xbef7, 0x8004,
+    0xbff7, 0x0005, 0xbef7, 0xbef7, 0xbff7, 0xbff7, 0xbef7, 0x800f, 0xbff7, 0x0003, 0xdff7, 0xbff7,
+    0xdff7, 0x8003, 0xbff7, 0x0005, 0xdff7, 0xbff7, 0xdff7, 0xdff7, 0xbff7, 0x8004, 0xdff7, 0x0003,
+    0xbff7, 0xbff7, 0xdff7, 0x8007, 0xdfff, 0x0003, 0xdff7, 0xdfff, 0xdff7, 0x801c, 0xdfff, 0x0001,
+    0xffff, 0x8008, 0xdfff, 0x8003, 0xffff, 0x0002, 0xdfff, 0xdfff, 0x8064, 0xffff, 0x0002, 0xfbde,
+    0x1cdf, 0x800c, 0x1ce7, 0x8003, 0x3ce7, 0x0001, 0x3de7, 0x800e, 0x3ce7, 0x0005, 0x3de7, 0x3de7,
+    0x3ce7, 0x3de7, 0x5de7, 0x8003, 0x3de7, 0x0003, 0x5de7, 0x3de7, 0x3de7, 0x800d, 0x5def, 0x0005,
+    0x7def, 0x5def, 0x5def, 0x7def, 0x7def, 0x8009, 0x7eef, 0x8005, 0x7def, 0x800c, 0x7eef, 0x0001,
+    0x9eef, 0x801d, 0x9ef7, 0x0002, 0xbef7, 0xbef7, 0x8005, 0xbff7, 0x0002, 0xbef7, 0xbef7, 0x8006,
+    0xbff7, 0x0004, 0xbef7, 0xbff7, 0xbef7, 0xbef7, 0x8011, 0xbff7, 0x0001, 0xdff7, 0x8007, 0xbff7,
+    0x0001, 0xdff7, 0x8005, 0xbff7, 0x0001, 0xdff7, 0x8008, 0xdfff, 0x0002, 0xdff7, 0xdff7, 0x8015,
+    0xdfff, 0x0001, 0xffff, 0x8006, 0xdfff, 0x0001, 0xffff, 0x800d, 0xdfff, 0x8063, 0xffff, 0x0001,
+    0xdfff,
+};
+const size_t g_logo_rle_len = 29905;
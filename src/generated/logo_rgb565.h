@@ -0,0 +1,16 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+// logo_png.png (320x240) scaled to the panel at build time by scripts/embed_asset.py.
+// RLE over byte-swapped RGB565: a header word with bit 15 set repeats the
+// next word (h & 0x7FFF) times, otherwise h literal pixel words follow.
+#define LOGO_RGB565_WIDTH 320
+#define LOGO_RGB565_HEIGHT 240
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern const uint16_t g_logo_rle[];
+extern const size_t g_logo_rle_len;
+#ifdef __cplusplus
+}
+#endif
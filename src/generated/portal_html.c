@@ -0,0 +1,177 @@
+#include "portal_html.h"
+const uint8_t g_portal_html_gz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x58,
+    0x51, 0x73, 0xdb, 0xb8, 0x11, 0x7e, 0xd7, 0xaf, 0x40, 0x98, 0xeb, 0x90,
+    0x9c, 0xc8, 0x14, 0xe5, 0x9c, 0xaf, 0x2e, 0x2d, 0xa9, 0x93, 0x4b, 0x2f,
+    0x73, 0xe9, 0xdc, 0x39, 0x9e, 0x93, 0xaf, 0x7d, 0x48, 0xd2, 0x19, 0x88,
+    0x04, 0x45, 0x9c, 0x21, 0x92, 0x03, 0x80, 0xb6, 0x55, 0x9d, 0x1e, 0xfb,
+    0xd6, 0x9f, 0xd0, 0xfe, 0xb9, 0xfe, 0x92, 0xee, 0x02, 0x20, 0x45, 0xca,
+    0x72, 0x32, 0x9a, 0x31, 0x49, 0x60, 0xb1, 0xd8, 0xfd, 0xf6, 0xdb, 0xc5,
+    0xc2, 0xb3, 0x17, 0x59, 0x95, 0xea, 0x6d, 0xcd, 0x48, 0xa1, 0x37, 0x62,
+    0x31, 0x9a, 0xb5, 0x0f, 0x46, 0x33, 0x78, 0x6c, 0x98, 0xa6, 0x24, 0x2d,
+    0xa8, 0x54, 0x4c, 0xcf, 0xbd, 0x46, 0xe7, 0x67, 0x97, 0x5e, 0x3b, 0x5c,
+    0xd2, 0x0d, 0x9b, 0x7b, 0xf7, 0x9c, 0x3d, 0xd4, 0x95, 0xd4, 0x1e, 0x49,
+    0xab, 0x52, 0xb3, 0x12, 0xc4, 0x1e, 0x78, 0xa6, 0x8b, 0x79, 0xc6, 0xee,
+    0x79, 0xca, 0xce, 0xcc, 0xc7, 0x98, 0x97, 0x5c, 0x73, 0x2a, 0xce, 0x54,
+    0x4a, 0x05, 0x9b, 0x4f, 0x51, 0x87, 0xe6, 0x5a, 0xb0, 0xc5, 0x12, 0x56,
+    0xf0, 0x92, 0x09, 0xb2, 0x64, 0xba, 0xa9, 0x67, 0x13, 0x3b, 0x3a, 0x9a,
+    0x29, 0xbd, 0xc5, 0xe7, 0xaa, 0xca, 0xb6, 0xbb, 0x1c, 0x14, 0x9f, 0xe5,
+    0x74, 0xc3, 0xc5, 0x36, 0x79, 0x23, 0x41, 0xcd, 0x58, 0xd1, 0x52, 0x9d,
+    0x29, 0x26, 0x79, 0x7e, 0xb5, 0xa1, 0x72, 0xcd, 0xcb, 0xe4, 0x3c, 0xae,
+    0x1f, 0xaf, 0x56, 0x34, 0xbd, 0x5b, 0xcb, 0xaa, 0x29, 0xb3, 0xe4, 0x65,
+    0x1e, 0xe3, 0x6f, 0x3f, 0x8a, 0xd0, 0x2c, 0x0a, 0x5b, 0xc8, 0x5d, 0x6f,
+    0xfa, 0xa1, 0xe0, 0x9a, 0x5d, 0xd5, 0x34, 0xcb, 0x78, 0xb9, 0x76, 0x8b,
+    0x2b, 0x99, 0x31, 0x79, 0x26, 0x69, 0xc6, 0x1b, 0x95, 0x5c, 0xc2, 0xc8,
+    0x86, 0x3e, 0x5a, 0xf3, 0x93, 0x8b, 0x38, 0x36, 0xdf, 0x66, 0xab, 0x98,
+    0xd0, 0x46, 0x57, 0xa0, 0xb9, 0x64, 0xfa, 0xa1, 0x92, 0x77, 0xbb, 0xc1,
+    0xb6, 0x97, 0xf8, 0xeb, 0x34, 0x4f, 0x7b, 0xeb, 0x2e, 0xea, 0x47, 0x12,
+    0x1f, 0x6d, 0xf3, 0x2d, 0x4c, 0xa7, 0x8d, 0x54, 0x95, 0x4c, 0xea, 0x8a,
+    0x03, 0x7e, 0xd2, 0x09, 0x24, 0x53, 0x90, 0x56, 0x95, 0xe0, 0x19, 0x79,
+    0x99, 0x65, 0xd9, 0x61, 0xb7, 0xa4, 0xa8, 0xee, 0x87, 0xbe, 0xbc, 0x64,
+    0x97, 0xf8, 0xdb, 0x8f, 0x78, 0x59, 0x37, 0x7a, 0xbc, 0x6a, 0xb4, 0xae,
+    0xca, 0xb1, 0x66, 0x8f, 0x9a, 0x4a, 0x46, 0x77, 0xd6, 0x83, 0x69, 0x1c,
+    0xff, 0x01, 0x54, 0x3f, 0x9e, 0x29, 0xfe, 0x4f, 0x34, 0xcc, 0x99, 0x01,
+    0x23, 0x9d, 0xad, 0x97, 0xa7, 0x4d, 0xed, 0x5b, 0x92, 0xa6, 0xe9, 0x53,
+    0x07, 0xf6, 0x23, 0xbb, 0xe5, 0xc0, 0xa6, 0x38, 0xfe, 0xe3, 0x2a, 0xcf,
+    0xaf, 0xd2, 0x4a, 0x80, 0x6b, 0x16, 0xed, 0xa1, 0x9f, 0x7b, 0xbb, 0xe8,
+    0x84, 0x3b, 0x71, 0x7c, 0xf1, 0xdd, 0xea, 0x35, 0x78, 0x9c, 0x57, 0x72,
+    0xb3, 0xcb, 0xb8, 0xaa, 0x05, 0xdd, 0x26, 0x65, 0x55, 0x32, 0x67, 0xde,
+    0x99, 0xae, 0x6a, 0x1b, 0xb3, 0x0e, 0xe6, 0x8b, 0xe3, 0xe8, 0xff, 0x09,
+    0x7f, 0xa7, 0x6c, 0x8d, 0x6a, 0xaa, 0x14, 0x00, 0x99, 0x81, 0x96, 0xf5,
+    0x5a, 0xb0, 0xdd, 0xc0, 0x65, 0x43, 0x35, 0x80, 0x88, 0x25, 0xd3, 0x93,
+    0xd2, 0xc4, 0x60, 0xec, 0x30, 0x45, 0x1a, 0xb4, 0x26, 0x49, 0xbe, 0x2e,
+    0x34, 0x2a, 0xd9, 0x8f, 0x66, 0x13, 0x47, 0xde, 0xd9, 0xc4, 0x65, 0x11,
+    0xb2, 0x18, 0x1e, 0x19, 0xbf, 0x27, 0xa9, 0x00, 0x85, 0x73, 0xaf, 0x23,
+    0x25, 0x66, 0x42, 0x31, 0x3d, 0xa4, 0xc1, 0xdb, 0xaa, 0xcc, 0xf9, 0xba,
+    0x91, 0x54, 0xf3, 0xaa, 0x04, 0x05, 0x53, 0xb7, 0x8e, 0x67, 0x73, 0x4f,
+    0x69, 0xaa, 0x1b, 0xe5, 0x11, 0xa3, 0x7e, 0xee, 0xf5, 0x91, 0x41, 0x35,
+    0xf5, 0xe2, 0x7f, 0xff, 0xf9, 0xd7, 0x50, 0x01, 0x51, 0xf4, 0x9e, 0x65,
+    0x44, 0x35, 0x69, 0xca, 0x94, 0xca, 0x1b, 0x21, 0xb6, 0x2f, 0x66, 0x93,
+    0xda, 0x08, 0x43, 0x8a, 0xc9, 0xaa, 0x5c, 0x2f, 0xfe, 0xce, 0xdf, 0xf1,
+    0x04, 0x6d, 0x36, 0x5f, 0x64, 0xa6, 0x6a, 0x5a, 0x9a, 0xed, 0x1e, 0x78,
+    0xce, 0xaf, 0x21, 0xc7, 0xbd, 0x05, 0xcc, 0xc2, 0xe0, 0xf1, 0xdc, 0x12,
+    0xcc, 0x39, 0x4c, 0x1e, 0xe6, 0xe0, 0xc9, 0xc4, 0x33, 0x56, 0xce, 0x56,
+    0xb2, 0xdb, 0xf8, 0x06, 0xe5, 0xc8, 0xaf, 0xbf, 0xfc, 0x74, 0x72, 0x77,
+    0xa3, 0xe5, 0x57, 0x29, 0x0e, 0x1b, 0xb4, 0x8f, 0xa1, 0xf9, 0x4b, 0x26,
+    0x81, 0x40, 0x27, 0x55, 0x28, 0x33, 0x75, 0xca, 0xfc, 0x5c, 0x30, 0xa6,
+    0xdf, 0x02, 0x55, 0xb4, 0x37, 0xd4, 0x6b, 0x49, 0x49, 0xaa, 0x32, 0x15,
+    0x3c, 0xbd, 0x9b, 0x7b, 0xa2, 0x4a, 0x0d, 0x90, 0x51, 0x21, 0x59, 0x3e,
+    0xf7, 0x27, 0x92, 0x41, 0x21, 0xf4, 0xbd, 0xc5, 0x2f, 0xf8, 0x3c, 0x0e,
+    0x96, 0x5d, 0x8c, 0x71, 0x87, 0x88, 0xf5, 0xe3, 0x86, 0xa5, 0xed, 0xd9,
+    0xb0, 0x15, 0xe7, 0x8b, 0x37, 0xf7, 0x94, 0x0b, 0xba, 0x02, 0x7a, 0x61,
+    0x30, 0xc8, 0xb5, 0xcd, 0x74, 0x05, 0xe1, 0x3f, 0xef, 0xa9, 0x71, 0x05,
+    0x40, 0x79, 0x8b, 0x65, 0x4a, 0xcb, 0x12, 0x78, 0x1f, 0x45, 0xd1, 0xf1,
+    0x5e, 0xa9, 0x31, 0xe9, 0x1d, 0x64, 0x8e, 0xd7, 0x72, 0x0d, 0xd3, 0xc8,
+    0x6c, 0xf4, 0xda, 0xc4, 0xfa, 0x09, 0xc5, 0x5e, 0xc3, 0x9c, 0xa1, 0x35,
+    0xc1, 0x73, 0x60, 0xee, 0x15, 0x3c, 0xcb, 0x58, 0xe9, 0x39, 0xd3, 0x05,
+    0x4b, 0x35, 0xcb, 0x96, 0xcb, 0xf7, 0x7f, 0xf1, 0x06, 0xb8, 0x3b, 0x23,
+    0x4f, 0x02, 0xef, 0x2c, 0x1d, 0x90, 0xc7, 0xe2, 0xdb, 0xdf, 0xa7, 0x4d,
+    0x2d, 0xaf, 0x63, 0xd4, 0x0d, 0x8c, 0x78, 0x04, 0xd0, 0x49, 0x59, 0x51,
+    0x09, 0xc8, 0xdc, 0xb9, 0x67, 0x2c, 0xbe, 0x69, 0x25, 0x87, 0x49, 0x74,
+    0x94, 0x9b, 0xde, 0x91, 0xfe, 0xb4, 0x60, 0xe9, 0x1d, 0x14, 0x38, 0xe7,
+    0x49, 0x51, 0x3d, 0x74, 0x7a, 0x30, 0xc0, 0x05, 0x2d, 0xd7, 0x20, 0x65,
+    0xd7, 0xb6, 0x33, 0x7f, 0xe3, 0x8a, 0xaf, 0xb8, 0xe0, 0x7a, 0x1b, 0x84,
+    0xa8, 0x0f, 0xa2, 0x02, 0x1c, 0x05, 0x04, 0x8f, 0x14, 0x2c, 0x96, 0xf0,
+    0x45, 0x5a, 0x03, 0x66, 0x13, 0x23, 0x77, 0x88, 0x3c, 0x60, 0x6a, 0x79,
+    0xf9, 0x55, 0xb0, 0xb1, 0x4c, 0x7b, 0x3d, 0xb6, 0xbe, 0xbf, 0x39, 0x02,
+    0xc0, 0xe9, 0x79, 0x7f, 0x43, 0xde, 0x64, 0x19, 0xd0, 0x4f, 0x1d, 0xbb,
+    0x59, 0x36, 0x9b, 0x15, 0xb0, 0xbc, 0xa7, 0xe3, 0xc6, 0x1c, 0xc7, 0x03,
+    0x2d, 0x66, 0xe8, 0x8b, 0xf8, 0xdb, 0xa5, 0x6f, 0x1a, 0x5d, 0x9c, 0x36,
+    0xa0, 0x1f, 0x03, 0xf0, 0xe2, 0xe7, 0x4a, 0x32, 0x62, 0xa7, 0x14, 0x09,
+    0xaa, 0x1a, 0xdd, 0xa3, 0x22, 0x74, 0x1e, 0xb6, 0x87, 0xcf, 0x21, 0xd9,
+    0x3c, 0x22, 0xab, 0x07, 0x88, 0xd9, 0xb7, 0x47, 0xda, 0x3f, 0x94, 0x8c,
+    0xd4, 0xa0, 0x5e, 0x40, 0xf5, 0x4b, 0x08, 0xaf, 0x13, 0xec, 0x25, 0x3a,
+    0x60, 0xc9, 0x47, 0x6c, 0x32, 0x3e, 0x23, 0x89, 0x5a, 0x95, 0x27, 0x92,
+    0x14, 0x8b, 0x9c, 0xc5, 0x19, 0x83, 0xb6, 0x84, 0xaf, 0xaf, 0x65, 0xe6,
+    0xf0, 0xa1, 0x52, 0xc9, 0x6b, 0xbd, 0x18, 0xe5, 0x4d, 0x99, 0x9a, 0xaa,
+    0xf9, 0x4d, 0xc0, 0xb3, 0x90, 0xec, 0x88, 0x84, 0xc4, 0x95, 0x25, 0x81,
+    0x0e, 0xa9, 0xd9, 0x40, 0x81, 0x8e, 0xd6, 0x4c, 0xff, 0x20, 0x18, 0xbe,
+    0x7e, 0xbf, 0x7d, 0x9f, 0xa1, 0xd0, 0x15, 0xd9, 0x1f, 0x96, 0x3d, 0x4f,
+    0x25, 0xb2, 0x1b, 0x11, 0xd0, 0xea, 0xb7, 0x24, 0xf7, 0xc3, 0xc8, 0xf4,
+    0x5c, 0x73, 0x1c, 0xec, 0x13, 0x0b, 0x26, 0x0c, 0x6d, 0xa1, 0x68, 0xff,
+    0x99, 0xf8, 0xe8, 0xb3, 0x4f, 0x12, 0xe2, 0xb7, 0x78, 0xf8, 0x57, 0xa3,
+    0xde, 0x7e, 0x36, 0x39, 0x5d, 0x22, 0x06, 0x4a, 0x19, 0xa3, 0xed, 0x46,
+    0xfd, 0xbc, 0x05, 0x9d, 0xf7, 0x54, 0x34, 0xb8, 0x1b, 0xca, 0x5c, 0x59,
+    0x89, 0x5e, 0x8e, 0xa2, 0x35, 0xb0, 0xd3, 0x5b, 0xdb, 0xbf, 0x0d, 0xc5,
+    0x0e, 0xf5, 0x04, 0xa4, 0x4c, 0x05, 0x8b, 0x5c, 0x01, 0x03, 0x39, 0x7f,
+    0x05, 0xf5, 0xf1, 0xce, 0x18, 0x35, 0x99, 0x10, 0xef, 0xb9, 0xe8, 0x75,
+    0x01, 0xbe, 0x22, 0xba, 0x60, 0x87, 0xe9, 0x0d, 0x28, 0x59, 0x31, 0x22,
+    0x58, 0xae, 0x49, 0x05, 0xb4, 0xa4, 0x65, 0x86, 0x02, 0xa8, 0xcb, 0xe8,
+    0xc9, 0x58, 0x4e, 0x1b, 0xa1, 0x15, 0x00, 0x4b, 0x2e, 0xe3, 0x88, 0xdc,
+    0x16, 0xc8, 0x21, 0x88, 0x3b, 0xa1, 0x46, 0x1d, 0x79, 0xe0, 0xba, 0x80,
+    0x55, 0xa4, 0x29, 0x1b, 0x65, 0xca, 0x27, 0x2e, 0x8b, 0x0e, 0x00, 0xd5,
+    0xd8, 0xb7, 0xbe, 0x43, 0xfa, 0x05, 0xe8, 0xa0, 0x45, 0xc7, 0x05, 0x15,
+    0x07, 0x22, 0x70, 0x84, 0xeb, 0xc0, 0xff, 0x54, 0x82, 0x73, 0x1b, 0x5a,
+    0x07, 0x82, 0xcc, 0x17, 0x44, 0x44, 0x5a, 0xf2, 0x4d, 0x10, 0xba, 0xd9,
+    0xc9, 0x27, 0xf5, 0x6a, 0x12, 0x86, 0x51, 0xce, 0x05, 0xb4, 0x2d, 0x41,
+    0x8e, 0x22, 0xf9, 0xc7, 0xf8, 0xb3, 0x5d, 0x61, 0x3e, 0x51, 0x2d, 0xc1,
+    0xfe, 0x57, 0x69, 0x52, 0xd4, 0x00, 0x0c, 0xce, 0xb7, 0xca, 0x13, 0x3f,
+    0xbc, 0xea, 0xcd, 0x1b, 0xcf, 0xe6, 0x20, 0x16, 0x09, 0x56, 0xae, 0xc1,
+    0xfe, 0xf9, 0x9c, 0x4c, 0x21, 0xd8, 0x97, 0x31, 0x04, 0x7a, 0xf2, 0x8f,
+    0x4f, 0xd9, 0xab, 0x6f, 0x26, 0x10, 0x0e, 0xa5, 0x83, 0xa2, 0xfe, 0x38,
+    0xfd, 0x1c, 0xc2, 0xd4, 0xb5, 0xc9, 0xf0, 0xf6, 0x3b, 0x81, 0x36, 0xc5,
+    0xe8, 0xe3, 0x39, 0x09, 0x0e, 0x6a, 0x16, 0xe4, 0x9c, 0xfc, 0xfe, 0x3b,
+    0x79, 0x01, 0x52, 0xf1, 0x67, 0x7c, 0x33, 0x1b, 0xcd, 0x40, 0x77, 0xfb,
+    0xbe, 0x20, 0xdf, 0x5d, 0x5c, 0xbc, 0xbe, 0x08, 0xcd, 0x62, 0x02, 0x48,
+    0x03, 0x9a, 0xa4, 0x64, 0x0f, 0xe4, 0x07, 0x29, 0x2b, 0x19, 0xf8, 0xdf,
+    0x53, 0xe8, 0x14, 0x6c, 0xb2, 0x1b, 0x74, 0x3d, 0x9f, 0xbc, 0x32, 0x9e,
+    0xc0, 0xc3, 0xf7, 0x12, 0xc2, 0x1e, 0x6b, 0xc3, 0xa9, 0x2e, 0x4b, 0x2d,
+    0xfc, 0x56, 0x79, 0x2e, 0xab, 0x0d, 0xec, 0x05, 0x91, 0x32, 0x9b, 0xb4,
+    0x3e, 0x3b, 0xb0, 0x77, 0xb0, 0x84, 0x18, 0xcb, 0xc6, 0x46, 0x3c, 0x31,
+    0x7f, 0xc7, 0xd8, 0x48, 0x17, 0x09, 0xec, 0x31, 0x35, 0x16, 0xfb, 0xfe,
+    0xd8, 0x5c, 0x2a, 0x60, 0x24, 0x52, 0x90, 0xda, 0x2c, 0x38, 0x0f, 0xa3,
+    0xdf, 0xa0, 0x5d, 0x0c, 0x7c, 0xe2, 0x87, 0x7b, 0xd4, 0xb8, 0x0f, 0x87,
+    0x19, 0xd0, 0xcb, 0x7c, 0x13, 0x05, 0x01, 0xa7, 0xb2, 0xf5, 0x41, 0xa1,
+    0xb8, 0x96, 0x5b, 0x17, 0x1c, 0x37, 0x08, 0xc8, 0xf7, 0x48, 0x01, 0xfc,
+    0x36, 0xc5, 0xa9, 0xcd, 0x10, 0x63, 0xf4, 0x9e, 0xc0, 0x91, 0x9f, 0x16,
+    0x24, 0x60, 0xa1, 0x5b, 0x0b, 0x57, 0x16, 0xa9, 0x03, 0x16, 0x6d, 0xa0,
+    0xfa, 0xd2, 0x35, 0x1b, 0xb8, 0x66, 0x56, 0x8c, 0xda, 0xe0, 0x66, 0x14,
+    0xee, 0x45, 0xf3, 0x76, 0x4b, 0xc8, 0xa2, 0xe4, 0xb9, 0x64, 0x1c, 0x1b,
+    0x91, 0x36, 0x15, 0x92, 0xa3, 0xe2, 0xd0, 0x13, 0x41, 0xe4, 0x8c, 0x0e,
+    0x7b, 0x3a, 0x1c, 0xad, 0x37, 0x58, 0x76, 0xd3, 0x58, 0xe5, 0x87, 0x02,
+    0x16, 0xe0, 0x4e, 0x00, 0xcb, 0xfb, 0x50, 0xc0, 0xe1, 0x92, 0xb4, 0x2f,
+    0xe8, 0x0e, 0xfa, 0x94, 0x33, 0xc0, 0x20, 0xf0, 0x27, 0x88, 0x30, 0x84,
+    0x65, 0x07, 0x37, 0xbe, 0xa2, 0x02, 0x3b, 0xfd, 0x9b, 0x0f, 0xcb, 0x5b,
+    0x18, 0xc0, 0xce, 0xd6, 0xac, 0xdb, 0xf9, 0xae, 0x6e, 0x9c, 0xdd, 0x42,
+    0x45, 0xf3, 0x41, 0x82, 0xd6, 0x40, 0x7c, 0xdb, 0x36, 0x4d, 0x7e, 0x53,
+    0x55, 0xe9, 0xef, 0xc7, 0x04, 0x3b, 0xe0, 0x84, 0xfc, 0x75, 0xf9, 0xe1,
+    0x1a, 0x8a, 0x88, 0x84, 0xd6, 0x85, 0xe7, 0xdb, 0x00, 0xd1, 0x0a, 0xf7,
+    0x96, 0x8f, 0x11, 0x24, 0x7e, 0x19, 0xc0, 0xf9, 0x56, 0x03, 0x90, 0x0c,
+    0x93, 0xaa, 0x7d, 0x37, 0xb5, 0x09, 0xb2, 0xd1, 0x08, 0xe0, 0xfb, 0x21,
+    0xe3, 0x6c, 0x0e, 0xbc, 0xe8, 0x24, 0xab, 0xbb, 0xf0, 0x09, 0xad, 0xcd,
+    0x0a, 0x24, 0xd7, 0x8f, 0xb7, 0xb7, 0x37, 0x04, 0x29, 0xdd, 0x89, 0xdb,
+    0x7e, 0xda, 0x85, 0xb3, 0x0d, 0xb3, 0x7f, 0xa2, 0x81, 0x7e, 0xe1, 0x77,
+    0x42, 0x5d, 0x43, 0x28, 0x99, 0xa8, 0x68, 0x16, 0xb8, 0x89, 0x7d, 0xe8,
+    0xdc, 0x30, 0xdc, 0x09, 0x8c, 0x03, 0x4e, 0x1f, 0x9c, 0x47, 0xe0, 0x2f,
+    0xc9, 0xa1, 0xc5, 0x63, 0x08, 0x20, 0x58, 0x70, 0xa0, 0xd2, 0x11, 0x9d,
+    0xe1, 0x24, 0x58, 0x1a, 0xa3, 0x02, 0x35, 0x38, 0x33, 0x4e, 0x57, 0xe9,
+    0xa8, 0xad, 0xd3, 0x88, 0x82, 0xc2, 0x8b, 0x6e, 0x69, 0x78, 0xd6, 0xf2,
+    0xd6, 0x2d, 0x36, 0x7d, 0xfa, 0x93, 0xd5, 0x7e, 0xf0, 0xb6, 0x95, 0x27,
+    0x70, 0x6f, 0x08, 0xfd, 0xab, 0x76, 0x4d, 0xdb, 0x79, 0x3f, 0x5d, 0x52,
+    0x68, 0x5d, 0x27, 0x93, 0x09, 0xba, 0xa0, 0x22, 0x23, 0x36, 0x5c, 0x74,
+    0xea, 0x88, 0xe0, 0x25, 0x16, 0x13, 0xdf, 0x66, 0x16, 0x13, 0x10, 0x5b,
+    0x6b, 0xed, 0xe1, 0xb8, 0xfa, 0xaa, 0xa1, 0xd7, 0x95, 0x26, 0xe9, 0xc1,
+    0xd8, 0xff, 0xfe, 0xdb, 0x1a, 0xbb, 0x6f, 0x8f, 0x3a, 0x24, 0xee, 0x29,
+    0x74, 0x6c, 0x2d, 0xc3, 0xd8, 0x3b, 0x0d, 0x26, 0xae, 0x2c, 0xf3, 0x0f,
+    0x98, 0x99, 0xf4, 0x0f, 0x49, 0x5b, 0x08, 0xcc, 0x95, 0xe0, 0x84, 0x05,
+    0xaf, 0xac, 0xcb, 0x46, 0x06, 0xab, 0x21, 0xd9, 0x40, 0xfb, 0x63, 0xad,
+    0x40, 0x0b, 0x4c, 0xc8, 0xbe, 0x7c, 0x3e, 0x76, 0x31, 0x46, 0xd6, 0xb4,
+    0x0d, 0xbe, 0x2b, 0x5a, 0x5d, 0xae, 0x41, 0x5b, 0xef, 0x3b, 0xa2, 0xcb,
+    0x03, 0xcb, 0xe1, 0x38, 0x3c, 0x8f, 0xcf, 0x13, 0x73, 0x76, 0xda, 0x7f,
+    0xaa, 0x10, 0xae, 0xe0, 0x36, 0xc1, 0x85, 0x20, 0xca, 0xdd, 0x04, 0xa0,
+    0x94, 0xaa, 0x3b, 0x42, 0xd7, 0x70, 0xa7, 0x44, 0x16, 0x49, 0x2d, 0xb6,
+    0xdd, 0x19, 0x21, 0x1d, 0xd1, 0xf1, 0xa4, 0x01, 0x45, 0x21, 0xa4, 0xba,
+    0xbe, 0xe5, 0x1b, 0x06, 0x47, 0x6e, 0xd0, 0xb7, 0x66, 0x4c, 0xa6, 0x71,
+    0x1c, 0x0f, 0x0b, 0xb7, 0x74, 0xd9, 0x67, 0x6b, 0xaf, 0x35, 0xcd, 0x16,
+    0xb9, 0x45, 0xaf, 0x89, 0x40, 0xdf, 0x39, 0xc4, 0x47, 0xfe, 0x78, 0xfb,
+    0xf3, 0x4f, 0xe0, 0xb7, 0x49, 0x6c, 0xd7, 0x15, 0x7c, 0x28, 0xc5, 0xd6,
+    0x98, 0xae, 0x36, 0x14, 0x0d, 0xb6, 0xa6, 0xb4, 0x2d, 0x15, 0x7a, 0xb2,
+    0x66, 0xb0, 0x92, 0x62, 0x68, 0xb1, 0x87, 0xea, 0x9c, 0x1c, 0x75, 0xb0,
+    0xb4, 0xf0, 0x1e, 0x80, 0x91, 0x11, 0x16, 0x96, 0x20, 0x74, 0x63, 0xaa,
+    0x05, 0xab, 0x4b, 0x04, 0x17, 0xe9, 0x96, 0x60, 0x83, 0xc4, 0xea, 0x51,
+    0xb1, 0xa3, 0x9f, 0xb9, 0xa2, 0x7d, 0x29, 0x82, 0xb6, 0x56, 0x7e, 0x0d,
+    0xb7, 0xfd, 0x08, 0x0f, 0x28, 0xb8, 0xf1, 0xb8, 0x8e, 0x12, 0x3a, 0x4f,
+    0x7b, 0xf5, 0x9f, 0xd8, 0x7f, 0xab, 0xfd, 0x1f, 0x9f, 0x85, 0xc7, 0xfc,
+    0x6e, 0x13, 0x00, 0x00,
+};
+const size_t g_portal_html_gz_len = 2068;
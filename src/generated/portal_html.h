@@ -0,0 +1,13 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+// portal.html gzip-compressed at build time by scripts/embed_asset.py.
+// Serve with Content-Encoding: gzip.
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern const uint8_t g_portal_html_gz[];
+extern const size_t g_portal_html_gz_len;
+#ifdef __cplusplus
+}
+#endif
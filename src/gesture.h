@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+
+enum Gesture : uint8_t {
+  GESTURE_NONE,
+  GESTURE_TAP,
+  GESTURE_LONG_PRESS,
+  GESTURE_SWIPE_LEFT,
+  GESTURE_SWIPE_RIGHT,
+  GESTURE_SWIPE_UP,
+  GESTURE_SWIPE_DOWN,
+};
+
+// Turns touch samples (pressed or not, screen position, time) into taps,
+// swipes and long presses. Press and release each need a few consecutive
+// samples, so contact bounce and single noisy reads from a resistive panel
+// don't register as gestures.
+class GestureDecoder
+{
+public:
+  static constexpr uint8_t PRESS_SAMPLES = 2;   // touched samples that start a press
+  static constexpr uint8_t RELEASE_SAMPLES = 3; // untouched samples that end it
+  static constexpr int SLOP_PX = 12;            // movement that still counts as holding still
+  static constexpr int SWIPE_PX = 40;           // travel along the dominant axis for a swipe
+  static constexpr uint32_t TAP_MAX_MS = 400;
+  static constexpr uint32_t LONG_PRESS_MS = 700;
+
+  // Feed one sample; returns the gesture it completes, if any. A long press
+  // fires while still held; its release then reports nothing.
+  Gesture feed(bool touched, int x, int y, uint32_t now_ms)
+  {
+    if (touched) {
+      m_up_run = 0;
+      if (!m_pressed) {
+        if (m_down_run == 0) {
+          m_start_x = x;
+          m_start_y = y;
+          m_start_ms = now_ms;
+        }
+        if (++m_down_run < PRESS_SAMPLES) return GESTURE_NONE;
+        m_pressed = true;
+        m_moved = false;
+        m_long_sent = false;
+      }
+      m_last_x = x;
+      m_last_y = y;
+      m_last_ms = now_ms;
+      if (abs(x - m_start_x) > SLOP_PX || abs(y - m_start_y) > SLOP_PX) m_moved = true;
+      if (!m_moved && !m_long_sent && now_ms - m_start_ms >= LONG_PRESS_MS) {
+        m_long_sent = true;
+        return GESTURE_LONG_PRESS;
+      }
+      return GESTURE_NONE;
+    }
+    if (!m_pressed) {
+      m_down_run = 0; // bounce: never became a press
+      return GESTURE_NONE;
+    }
+    if (++m_up_run < RELEASE_SAMPLES) return GESTURE_NONE;
+    m_pressed = false;
+    m_down_run = 0;
+    m_up_run = 0;
+    if (m_long_sent) return GESTURE_NONE;
+    int dx = m_last_x - m_start_x;
+    int dy = m_last_y - m_start_y;
+    if (abs(dx) >= SWIPE_PX && abs(dx) >= 2 * abs(dy)) return dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+    if (abs(dy) >= SWIPE_PX && abs(dy) >= 2 * abs(dx)) return dy < 0 ? GESTURE_SWIPE_UP : GESTURE_SWIPE_DOWN;
+    if (!m_moved && m_last_ms - m_start_ms <= TAP_MAX_MS) return GESTURE_TAP;
+    return GESTURE_NONE;
+  }
+
+  // Nothing pressed or pending: the caller can stop sampling
+  bool idle() const { return !m_pressed && m_down_run == 0; }
+
+private:
+  int m_start_x = 0, m_start_y = 0;
+  int m_last_x = 0, m_last_y = 0;
+  uint32_t m_start_ms = 0, m_last_ms = 0;
+  uint8_t m_down_run = 0, m_up_run = 0;
+  bool m_pressed = false;
+  bool m_moved = false;
+  bool m_long_sent = false;
+};
@@ -0,0 +1,107 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+
+// Collects one HTTP/1.x response in a fixed buffer as bytes arrive, for
+// callers driving non-blocking sockets: recv() into tail()/space(), then
+// commit() the count. Bodies need a Content-Length or end when the server
+// closes; chunked responses are rejected (nothing small needs them).
+template <size_t Cap>
+class HttpReplyBuffer
+{
+public:
+  enum State { PENDING, COMPLETE, FAILED };
+
+  void reset()
+  {
+    m_len = 0;
+    m_body = 0;
+    m_status = 0;
+    m_content_length = -1;
+    m_keep_alive = true;
+    m_state = PENDING;
+  }
+
+  char* tail() { return m_buf + m_len; }
+  size_t space() const { return Cap - 1 - m_len; }
+  size_t received() const { return m_len; }
+
+  // Account for n bytes written at tail(); n == 0 means the peer closed.
+  State commit(size_t n)
+  {
+    if (m_state != PENDING) return m_state;
+    if (n == 0) {
+      // Close ends a body without a length; anywhere else it's a failure
+      if (m_body && m_content_length < 0) {
+        m_keep_alive = false;
+        return m_state = COMPLETE;
+      }
+      return m_state = FAILED;
+    }
+    m_len += n;
+    m_buf[m_len] = '\0';
+    if (!m_body) {
+      // Headers are text, so the terminator is found before any body NUL
+      const char* end = strstr(m_buf, "\r\n\r\n");
+      if (!end) return m_state = space() ? PENDING : FAILED;
+      m_body = (size_t)(end - m_buf) + 4;
+      if (!parseHead()) return m_state = FAILED;
+    }
+    if (m_content_length >= 0 && m_len - m_body >= (size_t)m_content_length) return m_state = COMPLETE;
+    return m_state = space() ? PENDING : FAILED;
+  }
+
+  State state() const { return m_state; }
+  int status() const { return m_status; }
+  bool keepAlive() const { return m_keep_alive; }
+  const uint8_t* body() const { return (const uint8_t*)m_buf + m_body; }
+  size_t bodyLength() const
+  {
+    size_t n = m_len - m_body;
+    return m_content_length >= 0 && n > (size_t)m_content_length ? (size_t)m_content_length : n;
+  }
+
+private:
+  bool parseHead()
+  {
+    // "HTTP/1.1 200 OK"; HTTP/1.0 closes unless it says otherwise
+    if (strncmp(m_buf, "HTTP/1.", 7) != 0) return false;
+    if (m_buf[7] == '0') m_keep_alive = false;
+    const char* sp = strchr(m_buf, ' ');
+    if (!sp) return false;
+    m_status = atoi(sp + 1);
+    const char* line = strstr(m_buf, "\r\n") + 2;
+    const char* head_end = m_buf + m_body - 2;
+    while (line < head_end) {
+      const char* eol = strstr(line, "\r\n");
+      const char* colon = (const char*)memchr(line, ':', (size_t)(eol - line));
+      if (colon) {
+        size_t name_len = (size_t)(colon - line);
+        const char* value = colon + 1;
+        while (*value == ' ') ++value;
+        size_t value_len = (size_t)(eol - value);
+        if (name_len == 14 && strncasecmp(line, "Content-Length", 14) == 0) {
+          m_content_length = atol(value);
+        } else if (name_len == 10 && strncasecmp(line, "Connection", 10) == 0) {
+          if (value_len == 5 && strncasecmp(value, "close", 5) == 0) m_keep_alive = false;
+          else if (value_len == 10 && strncasecmp(value, "keep-alive", 10) == 0) m_keep_alive = true;
+        } else if (name_len == 17 && strncasecmp(line, "Transfer-Encoding", 17) == 0) {
+          return false;
+        }
+      }
+      line = eol + 2;
+    }
+    return true;
+  }
+
+  char m_buf[Cap];
+  size_t m_len = 0;
+  size_t m_body = 0; // offset of the body; 0 until the headers are in
+  int m_status = 0;
+  int32_t m_content_length = -1;
+  bool m_keep_alive = true;
+  State m_state = PENDING;
+};
@@ -0,0 +1,167 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "chart_draw.h"
+#include "envelope.h"
+#include "ring_series.h"
+
+// History for charts: raw samples plus 1 min / 15 min rollups (an hour and
+// a day) as 8-bit fixed point, ~700 bytes per series
+static const int HIST_SIZE = 150; // ~5 minutes at 2s/sample, 2 px apart on a 300 px plot
+typedef TieredSeries<uint8_t, HIST_SIZE, 60, 96> MetricSeries;
+// Last hour as per-pixel-column min/max, one 12 s column per plot pixel
+static const int TREND_COLUMNS = 300;
+static const uint32_t TREND_COLUMN_S = 12;
+typedef ColumnEnvelope<uint8_t, TREND_COLUMNS> TrendEnvelope;
+
+// Chart screens, shared by the firmware and the native benchmarks so both
+// compose the same frames. compose*() paints a layout's static chrome and
+// reports where each widget goes through place(slot, x, y, w, h); painting
+// and refreshing the widgets is up to the caller. Canvas is anything with
+// LovyanGFX's primitives and text calls.
+namespace layout
+{
+
+// Widgets a layout can place, in the order of the firmware's WidgetId
+enum Slot : uint8_t {
+  SLOT_UPTIME, SLOT_CLOCK,
+  SLOT_CPU_PLOT, SLOT_CPU_LABEL, SLOT_RAM_PLOT, SLOT_RAM_LABEL,
+  SLOT_CPU_TREND, SLOT_RAM_TREND,
+  SLOT_DISK_BAR, SLOT_DISK_LABEL,
+  SLOT_STATUS,
+  SLOT_PERF,
+};
+
+struct Inks
+{
+  uint16_t background, text, grid, used, free;
+};
+
+static const char* const CPU_TITLE = "CPU";
+static const char* const RAM_TITLE = "RAM";
+static const int MARGIN = 8;
+
+// Static parts of a chart: border, title and the plot background
+template <typename Canvas>
+void drawChartChrome(Canvas& g, int x, int y, int w, int h, const char* title, const Inks& inks)
+{
+  g.fillRect(x, y, w, h, inks.background);
+  g.drawRect(x, y, w, h, inks.text);
+  g.setTextColor(inks.text); g.setTextSize(1);
+  g.setCursor(x + 4, y + 2); g.print(title);
+}
+
+template <typename Canvas>
+void drawStorageBar(Canvas& g, int x, int y, int w, int h, float usedPct, const Inks& inks)
+{
+  g.fillRect(x, y, w, h, inks.background);
+  g.drawRect(x, y, w, h, inks.text);
+  int usedW = (int)(w * (usedPct / 100.0f));
+  if (usedW > 0) g.fillRect(x + 1, y + 1, usedW - 2 < 0 ? 0 : usedW - 2, h - 2, inks.used);
+  if (usedW < w) g.fillRect(x + usedW + 1, y + 1, w - usedW - 2, h - 2, inks.free);
+}
+
+// Small "NN%" label with its background cleared
+template <typename Canvas>
+void drawPercentLabel(Canvas& g, int x, int y, int w, int h, float pct, const Inks& inks)
+{
+  g.fillRect(x, y, w, h, inks.background);
+  g.setTextColor(inks.text); g.setTextSize(1);
+  g.setCursor(x + 2, y + 1); g.printf("%2.0f%%", pct);
+}
+
+// One line of small text in a cleared box, left-aligned
+template <typename Canvas>
+void drawTextBox(Canvas& g, int x, int y, int w, int h, const char* text, const Inks& inks)
+{
+  g.fillRect(x, y, w, h, inks.background);
+  g.setTextColor(inks.text); g.setTextSize(1);
+  g.setCursor(x + 2, y + 2);
+  g.print(text);
+}
+
+// The same, right-aligned and centred vertically, in `color`
+template <typename Canvas>
+void drawStatusText(Canvas& g, int x, int y, int w, int h, const char* text, uint16_t color, const Inks& inks)
+{
+  g.fillRect(x, y, w, h, inks.background);
+  g.setTextColor(color); g.setTextSize(1);
+  g.setCursor(x + w - 2 - 6 * (int)strlen(text), y + (h - 8) / 2);
+  g.print(text);
+}
+
+// Chart frame plus the widgets inside it: the plot and its latest value
+template <typename Canvas, typename Place>
+void composeChart(Canvas& g, Slot plot, Slot label, int x, int y, int w, int h, const char* title, const Inks& inks, Place& place)
+{
+  drawChartChrome(g, x, y, w, h, title, inks);
+  place(plot, x, y, w, h);
+  place(label, x + w - 42, y + 1, 40, 11);
+}
+
+// Title row: text at size 2 on the left, the uptime box on the right
+// ("Up: 999d 23:59:59" fits in 110 px)
+template <typename Canvas, typename Place>
+void composeHeader(Canvas& g, const char* title, const Inks& inks, Place& place)
+{
+  g.fillScreen(inks.background);
+  if (title) {
+    g.setTextColor(inks.text); g.setTextSize(2);
+    g.setCursor(6, 4); g.print(title);
+  }
+  place(SLOT_UPTIME, g.width() - 114, 2, 110, 14);
+}
+
+// Live charts for CPU and RAM with a storage bar below
+template <typename Canvas, typename Place>
+void composeCharts(Canvas& g, const Inks& inks, Place place)
+{
+  composeHeader(g, "Sentinel Monitor", inks, place);
+  int chartW = g.width() - 2 * MARGIN;
+  int chartH = 60;
+  int x = MARGIN;
+  int y = 24;
+  composeChart(g, SLOT_CPU_PLOT, SLOT_CPU_LABEL, x, y, chartW, chartH, CPU_TITLE, inks, place);
+  y += chartH + 10;
+  composeChart(g, SLOT_RAM_PLOT, SLOT_RAM_LABEL, x, y, chartW, chartH, RAM_TITLE, inks, place);
+  y += chartH + 16;
+  g.setTextColor(inks.text); g.setTextSize(1);
+  g.setCursor(x + 4, y - 12); g.print("Storage");
+  place(SLOT_DISK_BAR, x, y, chartW, 18);
+  place(SLOT_DISK_LABEL, x + chartW - 48, y - 13, 48, 11);
+}
+
+// A big clock and mini charts below
+template <typename Canvas, typename Place>
+void composeClock(Canvas& g, const Inks& inks, Place place)
+{
+  composeHeader(g, nullptr, inks, place);
+  place(SLOT_CLOCK, 0, 24, g.width(), 32);
+  int x = MARGIN; int w = g.width() - 2 * MARGIN; int h = 48; int y = 70;
+  composeChart(g, SLOT_CPU_PLOT, SLOT_CPU_LABEL, x, y, w, h, CPU_TITLE, inks, place);
+  y += h + 8;
+  composeChart(g, SLOT_RAM_PLOT, SLOT_RAM_LABEL, x, y, w, h, RAM_TITLE, inks, place);
+}
+
+// Last hour of CPU and RAM as min/max envelopes
+template <typename Canvas, typename Place>
+void composeTrends(Canvas& g, const Inks& inks, Place place)
+{
+  composeHeader(g, "Last hour", inks, place);
+  int x = MARGIN; int w = g.width() - 2 * MARGIN; int h = 96; int y = 24;
+  composeChart(g, SLOT_CPU_TREND, SLOT_CPU_LABEL, x, y, w, h, CPU_TITLE, inks, place);
+  y += h + 10;
+  composeChart(g, SLOT_RAM_TREND, SLOT_RAM_LABEL, x, y, w, h, RAM_TITLE, inks, place);
+}
+
+// Every layout keeps the bottom 12 px free for the poll status; the perf
+// overlay, when on, floats over the middle of whatever is there
+template <typename Canvas, typename Place>
+void placeStatus(Canvas& g, bool overlay, Place place)
+{
+  place(SLOT_STATUS, g.width() - 154, g.height() - 12, 150, 11);
+  if (overlay) place(SLOT_PERF, (g.width() - 236) / 2, 52, 236, 106);
+}
+
+} // namespace layout
@@ -0,0 +1,143 @@
+#pragma once
+#include <LovyanGFX.hpp>
+
+// Fixed LovyanGFX setup for the Cheap Yellow Display (ESP32-2432S028).
+// The panel sits on HSPI's IOMUX pins and is clocked at 40 MHz with DMA,
+// which every CYD panel seen so far runs stably at; SENTINEL_LCD_WRITE_HZ
+// opts into more on panels that take it. The XPT2046 gets VSPI to itself,
+// which keeps touch reads off the display bus. Boards with one USB port
+// carry an ILI9341, the two-port variant an ST7789: build with
+// -D SENTINEL_CYD_ST7789=1 for the latter.
+// init() reads the controller ID and switches driver if the other one
+// answers, so a wrong guess costs one extra init, not a blank screen.
+#ifndef SENTINEL_CYD_ST7789
+#define SENTINEL_CYD_ST7789 0
+#endif
+#ifndef SENTINEL_LCD_WRITE_HZ
+#define SENTINEL_LCD_WRITE_HZ 40000000
+#endif
+
+class LGFX_CYD : public lgfx::LGFX_Device
+{
+public:
+  enum Variant : uint8_t { CYD_ILI9341, CYD_ST7789, CYD_UNKNOWN };
+
+  LGFX_CYD()
+  {
+    {
+      auto cfg = m_bus.config();
+      cfg.spi_host = SPI2_HOST; // HSPI
+      cfg.spi_mode = 0;
+      cfg.freq_write = SENTINEL_LCD_WRITE_HZ;
+      cfg.freq_read = 16000000;
+      cfg.spi_3wire = false;
+      cfg.use_lock = true;
+      cfg.dma_channel = SPI_DMA_CH_AUTO;
+      cfg.pin_sclk = 14;
+      cfg.pin_mosi = 13;
+      cfg.pin_miso = 12;
+      cfg.pin_dc = 2;
+      m_bus.config(cfg);
+    }
+    {
+      auto cfg = m_light.config();
+      cfg.pin_bl = 21;
+      cfg.invert = false;
+      cfg.freq = 12000;
+      cfg.pwm_channel = 7;
+      m_light.config(cfg);
+    }
+    {
+      auto cfg = m_touch.config();
+      cfg.spi_host = SPI3_HOST; // VSPI, routed through the GPIO matrix
+      cfg.freq = 1000000;
+      cfg.pin_sclk = 25;
+      cfg.pin_mosi = 32;
+      cfg.pin_miso = 39;
+      cfg.pin_cs = 33;
+      cfg.pin_int = 36;
+      cfg.bus_shared = false;
+      cfg.offset_rotation = 0;
+      cfg.x_min = 300;
+      cfg.x_max = 3900;
+      cfg.y_min = 3700;
+      cfg.y_max = 200;
+      m_touch.config(cfg);
+    }
+    configurePanel(m_ili9341, false);
+    configurePanel(m_st7789, true); // the ST7789 glass needs inversion for normal colors
+    select(SENTINEL_CYD_ST7789 ? CYD_ST7789 : CYD_ILI9341);
+  }
+
+  Variant variant() const { return m_variant; }
+
+protected:
+  bool init_impl(bool use_reset, bool use_clear) override
+  {
+    if (!lgfx::LGFX_Device::init_impl(use_reset, use_clear)) return false;
+    Variant found = probe();
+    if (found == CYD_UNKNOWN || found == m_variant) return true;
+    select(found);
+    return lgfx::LGFX_Device::init_impl(use_reset, use_clear);
+  }
+
+private:
+  void configurePanel(lgfx::Panel_LCD& panel, bool invert)
+  {
+    auto cfg = panel.config();
+    cfg.pin_cs = 15;
+    cfg.pin_rst = -1;
+    cfg.pin_busy = -1;
+    cfg.panel_width = 240;
+    cfg.panel_height = 320;
+    cfg.offset_x = 0;
+    cfg.offset_y = 0;
+    cfg.offset_rotation = 0;
+    cfg.dummy_read_pixel = 8;
+    cfg.dummy_read_bits = 1;
+    cfg.readable = true;
+    cfg.invert = invert;
+    cfg.rgb_order = false;
+    cfg.dlen_16bit = false;
+    cfg.bus_shared = false; // touch has its own host
+    panel.config(cfg);
+    panel.setBus(&m_bus);
+    panel.setLight(&m_light);
+    panel.setTouch(&m_touch);
+  }
+
+  void select(Variant v)
+  {
+    m_variant = v;
+    if (v == CYD_ST7789) setPanel(&m_st7789);
+    else setPanel(&m_ili9341);
+  }
+
+  // 16 bits of the reply starting `bit` bits into the read. readCommand()
+  // packs the first byte lowest and has already skipped one dummy bit
+  // (dummy_read_bits = 1).
+  static uint16_t replyBits(uint32_t reply, int bit)
+  {
+    return (uint16_t)(__builtin_bswap32(reply) >> (16 - bit));
+  }
+
+  // ST7789 answers RDDID (04h) with 85 85 52 right after the dummy bit.
+  // ILI9341 answers RDID4 (D3h) with a dummy byte, then 00 93 41: 93 41
+  // lands at bit 15 (seven dummy bits and the 00 left) or at bit 8 where
+  // the dummy is a single bit. Matching only there keeps a floating MISO
+  // from passing for a panel; no answer keeps the configured driver.
+  Variant probe()
+  {
+    if (replyBits(readCommand(0x04, 0, 4), 0) == 0x8585) return CYD_ST7789;
+    uint32_t id4 = readCommand(0xD3, 0, 4);
+    if (replyBits(id4, 8) == 0x9341 || replyBits(id4, 15) == 0x9341) return CYD_ILI9341;
+    return CYD_UNKNOWN;
+  }
+
+  lgfx::Bus_SPI m_bus;
+  lgfx::Panel_ILI9341 m_ili9341;
+  lgfx::Panel_ST7789 m_st7789;
+  lgfx::Light_PWM m_light;
+  lgfx::Touch_XPT2046 m_touch;
+  Variant m_variant = CYD_ILI9341;
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Streaming decoder for the RLE logo written by scripts/embed_asset.py:
+// a header word with bit 15 set repeats the next word (h & 0x7FFF) times,
+// otherwise h literal pixel words follow.
+struct LogoRleCursor {
+  size_t pos = 0;
+  uint16_t remaining = 0;
+  bool run = false;
+};
+
+// Expands the next n pixels of rle into out; runs may span bands
+inline void decodeLogoRle(const uint16_t *rle, size_t rle_len, LogoRleCursor &cur, uint16_t *out, size_t n)
+{
+  while (n > 0) {
+    if (cur.remaining == 0) {
+      if (cur.pos >= rle_len) {
+        memset(out, 0, n * sizeof(uint16_t));
+        return;
+      }
+      uint16_t h = rle[cur.pos++];
+      cur.run = (h & 0x8000) != 0;
+      cur.remaining = h & 0x7FFF;
+      continue;
+    }
+    size_t take = cur.remaining < n ? cur.remaining : n;
+    if (cur.run) {
+      uint16_t c = rle[cur.pos];
+      for (size_t i = 0; i < take; ++i) out[i] = c;
+    } else {
+      memcpy(out, &rle[cur.pos], take * sizeof(uint16_t));
+      cur.pos += take;
+    }
+    out += take;
+    n -= take;
+    cur.remaining -= take;
+    if (cur.run && cur.remaining == 0) ++cur.pos;
+  }
+}
@@ -1,179 +1,2154 @@
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "generated/logo_rgb565.h"
+#include "generated/portal_html.h"
+#include <PNGdec.h>
+#include <WiFi.h>
+#if SENTINEL_ASYNC_HTTP
+#include <ESPAsyncWebServer.h>
+#else
+#include <WebServer.h>
+#endif
+#include <DNSServer.h>
+#include <SPIFFS.h>
+#include <ArduinoJson.h>
+#include <Preferences.h>
+#include <Update.h>
+#include <driver/gpio.h>
+#include <esp_ota_ops.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <lwip/sockets.h>
+#include <mbedtls/sha256.h>
+#include <sys/time.h>
+#include <atomic>
+#include <cassert>
+#include <new>
+#include <type_traits>
+#include "metrics.h"
+#include "perf.h"
+#include "chart_draw.h"
+#include "envelope.h"
+#include "gesture.h"
+#include "http_reply.h"
+#include "layouts.h"
+#include "logo_rle.h"
+#include "png_bands.h"
+#include "poll_schedule.h"
+#include "ring_series.h"
+#include "spsc_queue.h"
+
+// Low-power idle (frequency scaling, light sleep) on the main screen;
+// build with -D SENTINEL_LOW_POWER=0 to keep the CPU at full speed
+#ifndef SENTINEL_LOW_POWER
+#define SENTINEL_LOW_POWER 1
+#endif
+// Abort when a steady-state path allocates (see AllocTally); for debugging
+#ifndef SENTINEL_ALLOC_CHECK
+#define SENTINEL_ALLOC_CHECK 0
+#endif
+
+// Sunton CYD 2.8" (ESP32-2432S028): fixed bus and panel setup, see lgfx_cyd.h
+#include "lgfx_cyd.h"
+
+static LGFX_CYD lcd;
+
+// Captive portal globals
+// The config panel runs either on the synchronous WebServer, serviced from
+// loop(), or with -D SENTINEL_ASYNC_HTTP=1 on ESPAsyncWebServer, whose
+// handlers run on the AsyncTCP task and serve several clients at once.
+// Handlers are written against PortalReply so both backends share them, and
+// anything touching Wi-Fi or the display is handed to loop() as an action.
+static DNSServer s_dns;
+#if SENTINEL_ASYNC_HTTP
+static AsyncWebServer s_http(80);
+#else
+static WebServer s_http(80);
+#endif
+static IPAddress s_apIP;
+static const byte DNS_PORT = 53;
+
+// Configuration storage
+static String s_saved_ssid = "";
+static String s_saved_password = "";
+static String s_saved_ip = "";
+static String s_saved_port = "";
+static String s_saved_auth = "";
+static bool s_config_complete = false;
+static bool s_wifi_connected = false;
+static unsigned long s_success_start_time = 0;
+static bool s_showing_success = false;
+
+// Wi-Fi link state machine. WiFi.onEvent() callbacks run on the system event
+// task and only post flags; serviceWiFi() on the loop task acts on them, so
+// joining, drop-outs and retries never stall the display or the portal.
+enum WifiLink : uint8_t { LINK_OFF, LINK_CONNECTING, LINK_UP, LINK_BACKOFF };
+static const uint32_t WIFI_CONNECT_TIMEOUT_MS = 15000;
+static const uint32_t WIFI_BACKOFF_MIN_MS = 1000;
+static const uint32_t WIFI_BACKOFF_MAX_MS = 60000;
+static const uint8_t WIFI_EVT_GOT_IP = 1 << 0;
+static const uint8_t WIFI_EVT_LOST = 1 << 1;
+static std::atomic<uint8_t> s_wifi_events{0};
+static WifiLink s_link = LINK_OFF;
+static uint32_t s_link_since = 0;
+static uint32_t s_link_wait_ms = 0;
+static uint32_t s_link_backoff_ms = WIFI_BACKOFF_MIN_MS;
+static bool s_wifi_ever_connected = false; // success/pairing screens only on first join
+static std::atomic<bool> s_ap_active{false}; // also read by the DNS task
+static bool s_http_started = false;
+
+// Portal requests that must run on the loop task (see servicePortalActions())
+static const uint8_t PORTAL_CONNECT = 1 << 0;      // join the newly saved network
+static const uint8_t PORTAL_FORGET_ASSOC = 1 << 1; // saved network changed
+static const uint8_t PORTAL_RESET = 1 << 2;        // back to unconfigured AP mode
+static const uint8_t PORTAL_SCAN = 1 << 3;         // refresh the scan cache
+static const uint8_t PORTAL_REDRAW = 1 << 4;       // re-render the main screen
+static const uint8_t PORTAL_REBOOT = 1 << 5;       // start the firmware just written
+static std::atomic<uint8_t> s_portal_actions{0};
+
+// Captive DNS answers on its own task, independent of loop() cadence
+static const uint32_t DNS_TASK_STACK = 3072;
+static TaskHandle_t s_dns_task = nullptr;
+
+// Settings live in NVS: "sentinel" holds the config, "fastboot" the last
+// successful association (BSSID and channel) so a reboot can rejoin without
+// scanning. DHCP still runs on every join: a cached lease would turn into a
+// static IP that nobody renews. A failed fast join drops the cache and
+// falls back to a normal join. Each user opens its own Preferences handle:
+// portal handlers may run on the AsyncTCP task while the loop saves the
+// association, and NVS serializes the handles, not a shared object.
+static const char* PREFS_CONFIG = "sentinel";
+static const char* PREFS_FASTBOOT = "fastboot";
+struct FastConnect {
+  uint8_t bssid[6];
+  uint8_t channel;
+};
+static const uint32_t WIFI_FAST_TIMEOUT_MS = 5000; // association plus DHCP
+static FastConnect s_fast = {};
+static bool s_fast_valid = false;
+static bool s_fast_attempt = false;  // current join uses s_fast
+static bool s_quick_resume = false;  // booted with saved config: go straight to metrics
+
+// Pairing check: after the first join the loop asks the network task for one
+// fetch and shows the outcome, rather than blocking on an HTTP request itself
+enum PairState : uint8_t { PAIR_IDLE, PAIR_PENDING, PAIR_DONE };
+static const uint32_t PAIR_RESULT_MS = 2000;
+static std::atomic<uint8_t> s_pair_state{PAIR_IDLE};
+static std::atomic<int> s_pair_status{0}; // HTTP status of the check, 0 if none
+static std::atomic<bool> s_pair_ok{false};
+static bool s_showing_pair = false;
+static unsigned long s_pair_shown_at = 0;
+
+// Firmware updates. POST /update streams a multipart upload into the
+// inactive OTA slot through Update's sector buffer, hashing it on the way;
+// the slot is only made bootable once the SHA-256 matches ?sha256=. The
+// new firmware then boots on trial: PREFS_OTA names both slots, and until
+// the first live sample arrives the boot partition points back at the old
+// one, so a crash or reset returns to it. No sample within OTA_TRIAL_MS of
+// the station getting its IP, or no IP within OTA_TRIAL_JOIN_MS of boot,
+// reboots into it as well.
+static const char* PREFS_OTA = "ota";
+static const uint32_t OTA_TRIAL_MS = 3 * 60 * 1000;       // a few polls once online
+static const uint32_t OTA_TRIAL_JOIN_MS = 10 * 60 * 1000; // firmware that never gets online
+static uint32_t s_ota_trial_from = 0; // millis() of the first IP, 0 until then; loop only
+// One upload at a time: another request gets 409 until the current one
+// ends, or goes this long without a chunk (client gone mid-upload)
+static const uint32_t OTA_STALL_MS = 15000;
+struct OtaUpload {
+  const void* owner;      // request that started it
+  bool active;            // Update.begin() succeeded, not finished or aborted
+  const char* error;      // first failure, reported when the request ends
+  uint8_t expected[32];
+  mbedtls_sha256_context sha;
+  size_t written;
+  uint32_t touched_at;    // millis() of the last chunk
+};
+// Own lock, so flash writes and hashing don't hold up s_config_mutex
+static SemaphoreHandle_t s_ota_mutex = nullptr;
+static OtaUpload s_ota = {}; // guarded by s_ota_mutex
+static std::atomic<bool> s_ota_trial{false}; // also read by /status
+
+// Forward declarations
+static void connectToWiFi();
+static void startAccessPoint();
+static void clearFastConnect();
+static void startWiFiScan();
+static bool saveConfig();
+static void onWiFiEvent(arduino_event_id_t event);
+static void displayWiFiSuccess();
+static void displayMainScreen();
+static void startTouch();
+static void confirmOtaTrial();
+
 // Stats update globals
-static bool s_stats_active = false;
-static unsigned long s_last_stats_update = 0;
-// History buffers for charts
-static const int HIST_SIZE = 120; // ~4 minutes at 2s/sample
-static float s_cpu_hist[HIST_SIZE];
-static float s_ram_hist[HIST_SIZE];
-static int s_hist_idx = 0;
-static bool s_hist_full = false;
+// Metrics arrive on a network task pinned to core 0, pushed by the server over
+// /metrics/stream or polled when streaming isn't available. Parsed samples
+// reach the render loop (core 1) through a lock-free SPSC queue, so a slow or
+// missing server never stalls touch, the config panel or redraws.
+static std::atomic<bool> s_stats_active{false};
+static const uint32_t STATS_POLL_MS = 2000;
+static const uint32_t NET_TASK_STACK = 8192;
+static const BaseType_t NET_TASK_CORE = 0;
+static TaskHandle_t s_net_task = nullptr;
+static SpscQueue<MetricsSample, 8> s_sample_queue;
+
+// Adaptive poll cadence (see poll_schedule.h): between POLL_MIN_MS and
+// POLL_CALM_MAX_MS depending on how fast the values move, at least
+// POLL_HIDDEN_MS (one trends column) when the layout shows no live values,
+// and backing off up to POLL_BACKOFF_MAX_MS while the server fails.
+static const uint32_t POLL_MIN_MS = 1000;
+static const uint32_t POLL_CALM_MAX_MS = 6000;
+static const uint32_t POLL_HIDDEN_MS = 12000;
+static const uint32_t POLL_BACKOFF_MAX_MS = 60000;
+static std::atomic<bool> s_live_shown{true}; // set by the loop per layout
+// Status line: the network task's next wait (0 while streaming) and how
+// many polls in a row failed
+static std::atomic<uint32_t> s_poll_wait_ms{STATS_POLL_MS};
+static std::atomic<uint8_t> s_poll_failures{0};
+// Guards the s_saved_* strings, s_poll_target and the Wi-Fi scan cache,
+// which the network task and async HTTP handlers read while other tasks
+// may rewrite them
+static SemaphoreHandle_t s_config_mutex = nullptr;
+
+// Prebuilt /metrics/stream, /metrics.bin and /metrics requests, regenerated
+// only when the config changes
+struct PollTarget
+{
+  char host[64];
+  uint16_t port;
+  char request_stream[320];
+  size_t request_stream_len;
+  char request_bin[320];
+  size_t request_bin_len;
+  char request_json[320];
+  size_t request_json_len;
+};
+static PollTarget s_poll_target = {};
+static std::atomic<uint32_t> s_poll_target_gen{0};
+
+// Keep-alive connection state, owned by the network task
+static const uint32_t HTTP_TIMEOUT_MS = 3000;
+static WiFiClient s_poll_client;
+static PollTarget s_net_target = {};
+static uint32_t s_net_target_gen = 0;
+// Cleared when the server answers 404 to /metrics.bin (older Sentinel-Server)
+static bool s_net_use_binary = true;
+
+// Server push: a silent stream is dead after this long (the server pings
+// every 5 s); after a short-lived stream, poll for a while before retrying
+static const uint32_t STREAM_IDLE_TIMEOUT_MS = 12000;
+static const uint32_t STREAM_RETRY_MS = 30000;
+static bool s_net_use_stream = true; // cleared on 404 from older servers
+static int s_net_last_status = 0;    // HTTP status of the last poll, 0 if none
+static uint32_t s_net_stream_retry_at = 0;
+static AdaptiveInterval s_net_interval(POLL_MIN_MS, STATS_POLL_MS, POLL_CALM_MAX_MS, POLL_HIDDEN_MS);
+static CircuitBreaker s_net_breaker(STATS_POLL_MS, POLL_BACKOFF_MAX_MS);
+
+// Backfill: when a sample arrives more than a few polls after the previous
+// one, fetch what the server sampled in between from /metrics/history in one
+// request on its own connection and forward it ahead of the new sample
+static const uint32_t BACKFILL_GAP_S = 3 * STATS_POLL_MS / 1000;
+static const uint32_t BACKFILL_MAX_SAMPLES = 1800; // an hour at the poll cadence
+static WiFiClient s_backfill_client;
+static bool s_net_use_history = true; // cleared on 404 from older servers
+static uint32_t s_net_last_unix = 0;  // server time of the newest forwarded sample
+
+// Fleet: more servers for the overview layout, saved as a JSON array of
+// {ip, port, auth, name}. The primary server above is host 0; these are
+// hosts 1..n, polled together each period by the fleet task over
+// non-blocking sockets, so a round takes as long as the slowest host
+// rather than the sum of them. Each fleet host keeps a socket open, so the
+// fleet is sized to what lwIP's socket pool has left after the primary
+// poll, the backfill connection, the sync WebServer's listener and client
+// and the captive DNS (AsyncTCP uses raw PCBs, not sockets).
+static const int NET_RESERVED_SOCKETS = 6; // the above, plus one spare
+static const int FLEET_MAX_HOSTS = 16;
+static const int FLEET_MAX = CONFIG_LWIP_MAX_SOCKETS - NET_RESERVED_SOCKETS + 1 < FLEET_MAX_HOSTS
+                                 ? CONFIG_LWIP_MAX_SOCKETS - NET_RESERVED_SOCKETS + 1
+                                 : FLEET_MAX_HOSTS; // hosts, including the primary
+static_assert(FLEET_MAX >= 2, "CONFIG_LWIP_MAX_SOCKETS leaves no room for fleet hosts");
+static_assert(FLEET_MAX - 1 + NET_RESERVED_SOCKETS <= CONFIG_LWIP_MAX_SOCKETS, "fleet would exhaust lwIP sockets");
+static const uint32_t FLEET_TASK_STACK = 4096;
+static const size_t FLEET_REPLY_CAP = 512;
+struct FleetTarget
+{
+  char label[20];
+  char host[40];
+  uint16_t port;
+  char request[256];
+  size_t request_len;
+};
+struct FleetSample
+{
+  uint8_t host;
+  uint8_t gen; // low bits of s_poll_target_gen when it was polled
+  float cpu_pct, ram_pct;
+};
+// Largest /save body worth accepting: every field at the most the config
+// can use (802.11 SSID and passphrase, the host buffers, a token no longer
+// than a whole poll request), twice over for JSON escapes, plus the keys
+static const size_t SAVE_TOKEN_MAX = sizeof(PollTarget::request_json);
+static const size_t SAVE_SERVER_MAX = sizeof(FleetTarget::host) + 5 + SAVE_TOKEN_MAX + sizeof(FleetTarget::label) + 40;
+static const size_t SAVE_BODY_MAX =
+  2 * (32 + 64 + sizeof(PollTarget::host) + 5 + SAVE_TOKEN_MAX + 80 + (FLEET_MAX - 1) * SAVE_SERVER_MAX);
+static String s_saved_servers = "";
+static FleetTarget s_fleet_targets[FLEET_MAX - 1]; // guarded by s_config_mutex
+static int s_fleet_target_count = 0;
+static TaskHandle_t s_fleet_task = nullptr;
+static SpscQueue<FleetSample, 32> s_fleet_queue;
+
+// History for charts and the last hour; shapes are in layouts.h
+static MetricSeries s_cpu_hist;
+static MetricSeries s_ram_hist;
+static TrendEnvelope s_cpu_trend(TREND_COLUMN_S);
+static TrendEnvelope s_ram_trend(TREND_COLUMN_S);
+
+// Fleet overview: a short sparkline per host plus when it last answered,
+// owned by the loop. FLEET_ROWS hosts per page, paged with vertical swipes.
+static const int FLEET_SPARK_N = 45; // 90 s at the poll cadence
+static const int FLEET_ROWS = 7;
+static const uint32_t FLEET_STALE_MS = 3 * STATS_POLL_MS + HTTP_TIMEOUT_MS;
+struct FleetHost
+{
+  char label[20];
+  RingSeries<uint8_t, FLEET_SPARK_N> cpu, ram;
+  uint32_t seen_at; // millis() of the last reading, 0 if none
+  uint32_t seq;     // bumped per reading
+};
+static FleetHost s_fleet[FLEET_MAX];
+static int s_fleet_hosts = 1;
+static uint32_t s_fleet_gen = 0; // s_poll_target_gen the host list came from
+static int s_fleet_page = 0;
+
+// Disk usage percentage (0-100)
+static float s_disk_used_pct = 0.0f;
+
+// Uptime tracking: the server's uptime as of the last sample, carried
+// forward with millis() so it ticks every second between samples
+static uint32_t s_uptime_seconds = 0;
+static unsigned long s_last_uptime_tick = 0; // millis() when it arrived
+
+// Local time: SNTP once the station is up; until it syncs, the last server
+// timestamp carried forward with millis(). Shown in the server's time zone,
+// which follows from its local timestamp and unix time.
+static const time_t CLOCK_VALID_AFTER = 1704067200; // 2024-01-01: system clock has been set
+static uint32_t s_server_unix = 0;    // unix time of the latest sample, 0 if none
+static uint32_t s_server_unix_at = 0; // millis() when it arrived
+static int32_t s_utc_offset_s = 0;
+static bool s_sntp_started = false;
+
+// Layout management. Swipes step through layouts in enum order; a new
+// layout goes before LAYOUT_MAX and gets an entry in LAYOUT_RENDERERS.
+enum LayoutType { LAYOUT_CHARTS, LAYOUT_CLOCK, LAYOUT_TRENDS, LAYOUT_FLEET, LAYOUT_MAX };
+static int s_layout = LAYOUT_CHARTS;
+
+// Touch input. The XPT2046 pulls PENIRQ low while the panel is pressed;
+// that wakes loop(), which samples the controller only until the press is
+// over. With nothing pressed the controller is never read. Sampling stays
+// on the loop task because LovyanGFX doesn't lock `lcd` between touch
+// reads and drawing. The interrupt is level-triggered so it can also wake
+// the chip from light sleep; the ISR masks it until the press is done.
+static const int TOUCH_IRQ_PIN = 36;
+static const uint32_t TOUCH_SAMPLE_MS = 20;
+static std::atomic<bool> s_touch_pending{false}; // set by the ISR
+static bool s_touch_sampling = false;            // press in progress
+static uint32_t s_touch_sampled_at = 0;
+static GestureDecoder s_touch_decoder;
+
+// Power management. On the main screen the loop blocks between events
+// instead of spinning, and ESP-IDF power management scales the CPU down
+// to 80 MHz and light-sleeps (Wi-Fi in modem sleep) while every task is
+// idle. Timers, PENIRQ and Wi-Fi traffic wake it. s_pm_busy holds 240 MHz
+// while the loop or the pollers have work in hand.
+static const int PM_MAX_MHZ = 240;
+static const int PM_MIN_MHZ = 80;
+static const uint32_t LOOP_TICK_MS = 10;       // loop cadence off the main screen
+static const uint32_t LOOP_IDLE_HTTP_MS = 100; // WebServer polling while idle
+static TaskHandle_t s_loop_task = nullptr;
+#if SENTINEL_LOW_POWER
+static esp_pm_lock_handle_t s_pm_busy = nullptr;
+#endif
+
+static void initPowerManagement()
+{
+  s_loop_task = xTaskGetCurrentTaskHandle();
+#if SENTINEL_LOW_POWER
+  esp_pm_config_esp32_t pm = {};
+  pm.max_freq_mhz = PM_MAX_MHZ;
+  pm.min_freq_mhz = PM_MIN_MHZ;
+  pm.light_sleep_enable = true;
+  esp_err_t err = esp_pm_configure(&pm);
+  if (err != ESP_OK) {
+    // Automatic light sleep needs a tickless-idle build; scaling alone still helps
+    pm.light_sleep_enable = false;
+    err = esp_pm_configure(&pm);
+  }
+  if (err != ESP_OK) {
+    Serial.printf("Power management unavailable (%d)\n", (int)err);
+    return;
+  }
+  Serial.printf("Power management: %d-%d MHz, light sleep %s\n", PM_MIN_MHZ, PM_MAX_MHZ, pm.light_sleep_enable ? "on" : "off");
+  if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "busy", &s_pm_busy) != ESP_OK) s_pm_busy = nullptr;
+  if (s_pm_busy) esp_pm_lock_acquire(s_pm_busy); // the loop starts out busy
+  gpio_wakeup_enable((gpio_num_t)TOUCH_IRQ_PIN, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+#endif
+}
+
+// Hold full speed for a burst of work; the lock counts, so calls nest
+static void powerBusy(bool busy)
+{
+#if SENTINEL_LOW_POWER
+  if (!s_pm_busy) return;
+  if (busy) esp_pm_lock_acquire(s_pm_busy);
+  else esp_pm_lock_release(s_pm_busy);
+#else
+  (void)busy;
+#endif
+}
+
+// Cut the loop's idle wait short: a sample, gesture, Wi-Fi event or portal
+// action is waiting
+static void wakeLoop()
+{
+  if (s_loop_task) xTaskNotifyGive(s_loop_task);
+}
+
+// Performance counters, served on /debug/perf and shown on an optional
+// overlay. PerfScope times a block with the CPU cycle counter, holding
+// s_pm_busy so the clock can't scale down mid-measurement.
+enum PerfId : uint8_t {
+  PERF_POLL, PERF_PARSE, PERF_REFRESH,
+  PERF_RENDER_CHARTS, PERF_RENDER_CLOCK, PERF_RENDER_TRENDS, PERF_RENDER_FLEET,
+  PERF_BOOT_IMAGE, PERF_HTTP, PERF_LOOP,
+  PERF_COUNT
+};
+static const char* const PERF_NAMES[PERF_COUNT] = {
+  "poll", "parse", "refresh",
+  "render_charts", "render_clock", "render_trends", "render_fleet",
+  "boot_image", "http", "loop",
+};
+static_assert(PERF_RENDER_FLEET - PERF_RENDER_CHARTS == LAYOUT_FLEET - LAYOUT_CHARTS, "one render timer per layout");
+static const size_t PERF_WINDOW = 64;
+static const uint32_t PERF_HEAP_EVERY_MS = 10000;
+static PerfWindow<PERF_WINDOW> s_perf[PERF_COUNT];
+static std::atomic<uint32_t> s_perf_spi_bytes{0}; // pixel data pushed to the panel
+static std::atomic<uint32_t> s_perf_spi_pushes{0};
+static RingSeries<uint8_t, 60> s_perf_frag;        // heap fragmentation %, every PERF_HEAP_EVERY_MS
+static uint8_t s_perf_frag_worst = 0;
+static uint32_t s_perf_heap_at = 0;
+static std::atomic<bool> s_perf_overlay{false};
+
+// Heap allocations per task, counted by the malloc/calloc/realloc wrappers
+// below (linked in with -Wl,--wrap in platformio.ini; new and String go
+// through malloc too). Once warmed up, polling, parsing and widget drawing
+// make none; PerfScope checks that for every timed pass. A pass that opens
+// a connection calls allocExpected(): the socket and WiFiClient's receive
+// buffer are allocated then.
+enum AllocTask : uint8_t { ALLOC_LOOP, ALLOC_NET, ALLOC_FLEET, ALLOC_TASKS };
+static const char* const ALLOC_TASK_NAMES[ALLOC_TASKS] = { "loop", "net", "fleet" };
+static const uint32_t ALLOC_WARMUP_MS = 60000; // first-use allocations (lwip, drivers) settle by then
+struct AllocTally
+{
+  volatile uint32_t count;    // written only by its own task
+  volatile uint32_t expected; // allocExpected() calls
+};
+static AllocTally s_alloc[ALLOC_TASKS] = {};
+static std::atomic<uint32_t> s_alloc_steady{0}; // hot-path allocations after warm-up
+
+static IRAM_ATTR AllocTally* allocTally()
+{
+  TaskHandle_t t = xTaskGetCurrentTaskHandle();
+  if (!t) return nullptr;
+  if (t == s_loop_task) return &s_alloc[ALLOC_LOOP];
+  if (t == s_net_task) return &s_alloc[ALLOC_NET];
+  if (t == s_fleet_task) return &s_alloc[ALLOC_FLEET];
+  return nullptr;
+}
+
+static IRAM_ATTR void countAlloc()
+{
+  AllocTally* a = allocTally();
+  if (a) a->count = a->count + 1;
+}
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+IRAM_ATTR void* __wrap_malloc(size_t size)
+{
+  countAlloc();
+  return __real_malloc(size);
+}
+
+IRAM_ATTR void* __wrap_calloc(size_t n, size_t size)
+{
+  countAlloc();
+  return __real_calloc(n, size);
+}
+
+IRAM_ATTR void* __wrap_realloc(void* ptr, size_t size)
+{
+  countAlloc();
+  return __real_realloc(ptr, size);
+}
+}
+
+// Allocations by the current task so far (0 on untracked tasks)
+static uint32_t allocCount()
+{
+  AllocTally* a = allocTally();
+  return a ? a->count : 0;
+}
+
+// The timed passes running on this task may allocate this time round
+static void allocExpected()
+{
+  AllocTally* a = allocTally();
+  if (a) a->expected = a->expected + 1;
+}
+
+static uint32_t allocExpectedCount()
+{
+  AllocTally* a = allocTally();
+  return a ? a->expected : 0;
+}
+
+// Timers whose passes must not allocate once warmed up
+static bool perfSteady(PerfId id)
+{
+  return id <= PERF_RENDER_FLEET;
+}
+
+static uint32_t s_perf_allocs[PERF_COUNT] = {}; // allocations seen by each timer
+
+class PerfScope
+{
+public:
+  explicit PerfScope(PerfId id) : m_id(id)
+  {
+    powerBusy(true);
+    m_allocs = allocCount();
+    m_expected = allocExpectedCount();
+    m_start = ESP.getCycleCount();
+  }
+
+  ~PerfScope()
+  {
+    uint32_t cycles = ESP.getCycleCount() - m_start;
+    s_perf[m_id].add(cycles / getCpuFrequencyMhz());
+    uint32_t allocs = allocCount() - m_allocs;
+    if (allocs) {
+      s_perf_allocs[m_id] += allocs;
+      if (perfSteady(m_id) && allocExpectedCount() == m_expected && millis() >= ALLOC_WARMUP_MS) {
+        s_alloc_steady += allocs;
+#if SENTINEL_ALLOC_CHECK
+        Serial.printf("alloc: %u in %s\n", (unsigned)allocs, PERF_NAMES[m_id]);
+        assert(!"heap allocation on a steady-state path");
+#endif
+      }
+    }
+    powerBusy(false);
+  }
+
+private:
+  PerfId m_id;
+  uint32_t m_start;
+  uint32_t m_allocs;
+  uint32_t m_expected;
+};
+
+// 100 % minus the largest free block's share of free heap: how badly the
+// free memory is split up
+static uint8_t heapFragmentation()
+{
+  uint32_t free_bytes = ESP.getFreeHeap();
+  if (free_bytes == 0) return 100;
+  return (uint8_t)(100 - (uint64_t)ESP.getMaxAllocHeap() * 100 / free_bytes);
+}
+
+static void countPanelPush(int w, int h)
+{
+  s_perf_spi_bytes.fetch_add((uint32_t)(w * h * 2)); // RGB565 on the wire
+  s_perf_spi_pushes.fetch_add(1);
+}
+
+// Off-screen frame buffer. Layouts are composed here and pushed to the panel
+// in one transfer, so the panel only ever shows complete frames. 4 bpp with
+// a palette keeps it at ~38 KB; drawing code picks colors through ink() so
+// the same calls still work straight on the panel if allocation fails.
+enum Ink : uint8_t { INK_WHITE, INK_BLACK, INK_GRID, INK_CPU, INK_RAM, INK_USED, INK_FREE, INK_COUNT };
+static const uint16_t INK_RGB565[INK_COUNT] = {
+  0xFFFFu, // white background
+  0x0000u, // black text and borders
+  0xBDF7u, // light gray grid
+  0x001Fu, // CPU line (blue)
+  0x07E0u, // RAM line (green)
+  0xF800u, // storage used (red)
+  0x07E0u, // storage free (green)
+};
+static LGFX_Sprite s_frame(&lcd);
+static bool s_frame_ok = false;
+
+static void initFrameBuffer()
+{
+  s_frame.setPsram(false);
+  s_frame.setColorDepth(lgfx::palette_4bit);
+  s_frame_ok = s_frame.createSprite(lcd.width(), lcd.height()) != nullptr;
+  if (!s_frame_ok) {
+    Serial.println("Frame buffer allocation failed, drawing straight to the panel");
+    return;
+  }
+  s_frame.createPalette();
+  for (int i = 0; i < INK_COUNT; ++i) {
+    uint16_t c = INK_RGB565[i];
+    s_frame.setPaletteColor(i, (uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)(c << 3));
+  }
+}
+
+// Render target for layouts: the frame buffer, or the panel as a fallback.
+static lgfx::LovyanGFX& gfx()
+{
+  if (s_frame_ok) return s_frame;
+  return lcd;
+}
+
+// Palette index when drawing into the frame buffer, RGB565 on the panel.
+static inline uint16_t ink(Ink i)
+{
+  return s_frame_ok ? (uint16_t)i : INK_RGB565[i];
+}
+
+// Push the composed frame to the panel (no-op when drawing direct).
+static void presentFrame()
+{
+  if (!s_frame_ok) return;
+  lcd.startWrite();
+  s_frame.pushSprite(&lcd, 0, 0);
+  lcd.endWrite();
+  countPanelPush(s_frame.width(), s_frame.height());
+}
+
+// Push one region of the frame buffer; the panel clip limits the transfer.
+static void presentRect(int x, int y, int w, int h)
+{
+  if (!s_frame_ok || w <= 0 || h <= 0) return;
+  lcd.setClipRect(x, y, w, h);
+  s_frame.pushSprite(&lcd, 0, 0);
+  lcd.clearClipRect();
+  countPanelPush(w, h);
+}
+
+// Helpers for drawing charts
+using chart::mapValueToY;
+using chart::PlotArea;
+
+// Chart series shown by the chart widgets
+struct ChartSeries
+{
+  const MetricSeries* data;
+  const TrendEnvelope* trend;
+  Ink color;
+};
+enum SeriesId : uint8_t { SERIES_CPU, SERIES_RAM, SERIES_COUNT };
+static const ChartSeries SERIES[SERIES_COUNT] = {
+  { &s_cpu_hist, &s_cpu_trend, INK_CPU },
+  { &s_ram_hist, &s_ram_trend, INK_RAM },
+};
+// Bumped for every sample so plots know they are stale
+static uint32_t s_sample_seq = 0;
+
+static float latestValue(const MetricSeries& data)
+{
+  return data.latest();
+}
+
+static layout::Inks layoutInks()
+{
+  return { ink(INK_WHITE), ink(INK_BLACK), ink(INK_GRID), ink(INK_USED), ink(INK_FREE) };
+}
+
+static PlotArea plotArea(int x, int y, int w, int h)
+{
+  return chart::plotArea(x, y, w, h, HIST_SIZE);
+}
+
+static chart::Inks plotInks(Ink color)
+{
+  return { ink(INK_WHITE), ink(INK_GRID), ink(color) };
+}
+
+// Plot interior of a chart: grid lines and the whole visible history
+static void drawChartPlot(int x, int y, int w, int h, const MetricSeries& data, Ink color)
+{
+  chart::drawChartPlot(gfx(), plotArea(x, y, w, h), x, w, data, plotInks(color));
+}
+
+// Scroll the plot left by `added` samples and draw only the new segments.
+// Cost depends on the number of new samples, not the history length.
+// [top, bottom] gets the rows that changed. Returns false when a full
+// replot is needed instead.
+static bool scrollChartPlot(int x, int y, int w, int h, const MetricSeries& data, uint32_t added, Ink color,
+                            int& top, int& bottom)
+{
+  PlotArea a = plotArea(x, y, w, h);
+  int count = (int)data.raw().size();
+  // Scrolling reads back the frame buffer; on the bare panel just replot
+  if (!s_frame_ok || added == 0 || (int)added >= a.visible || (int)added >= count) return false;
+  auto& g = gfx();
+  int shift = (int)added * a.step;
+  g.copyRect(a.x, a.y, a.w - shift, a.h, a.x + shift, a.y);
+  int stripX = a.x + a.w - shift;
+  g.fillRect(stripX, a.y, shift, a.h, ink(INK_WHITE));
+  chart::drawPlotGrid(g, a, stripX, shift, ink(INK_GRID));
+  chart::drawPlotSegments(g, a, data, (int)added, 0, ink(color));
+  chart::scrollRowSpan(a, data, (int)added, top, bottom);
+  return true;
+}
+
+// Envelope plot of a trend: one column per pixel, newest at the right edge
+static void drawTrendPlot(int x, int y, int w, int h, const TrendEnvelope& env, Ink color)
+{
+  chart::drawTrendPlot<MetricSeries::Codec>(gfx(), plotArea(x, y, w, h), x, w, env, plotInks(color));
+}
+
+static void drawStorageBar(int x, int y, int w, int h, float usedPct)
+{
+  layout::drawStorageBar(gfx(), x, y, w, h, usedPct, layoutInks());
+}
+
+static void drawPercentLabel(int x, int y, int w, int h, float pct)
+{
+  layout::drawPercentLabel(gfx(), x, y, w, h, pct, layoutInks());
+}
+
+static uint32_t uptimeNow()
+{
+  if (s_last_uptime_tick == 0) return s_uptime_seconds;
+  return s_uptime_seconds + (millis() - s_last_uptime_tick) / 1000;
+}
+
+static bool localUnixNow(uint32_t& out)
+{
+  time_t t = time(nullptr);
+  if (t >= CLOCK_VALID_AFTER) {
+    out = (uint32_t)t;
+    return true;
+  }
+  if (s_server_unix == 0) return false;
+  out = s_server_unix + (millis() - s_server_unix_at) / 1000;
+  return true;
+}
+
+static void drawUptimeTopRight(int x, int y, int boxW, int boxH)
+{
+  // Render uptime at top-right in a small cleared area
+  char up[24];
+  uint32_t s = uptimeNow();
+  uint32_t days = s / 86400; s %= 86400;
+  uint32_t hours = s / 3600; s %= 3600;
+  uint32_t minutes = s / 60; uint32_t seconds = s % 60;
+  if (days > 0) snprintf(up, sizeof(up), "Up: %ud %02u:%02u:%02u", (unsigned)days, (unsigned)hours, (unsigned)minutes, (unsigned)seconds);
+  else snprintf(up, sizeof(up), "Up: %02u:%02u:%02u", (unsigned)hours, (unsigned)minutes, (unsigned)seconds);
+  layout::drawTextBox(gfx(), x, y, boxW, boxH, up, layoutInks());
+}
+
+// Status line: how the primary server is being read, right-aligned
+static void drawPollStatus(int x, int y, int boxW, int boxH)
+{
+  char text[32];
+  uint32_t wait = s_poll_wait_ms.load();
+  uint8_t failures = s_poll_failures.load();
+  if (failures) snprintf(text, sizeof(text), "No reply x%u, retry %us", (unsigned)failures, (unsigned)(wait / 1000));
+  else if (wait == 0) strlcpy(text, "Live", sizeof(text));
+  else snprintf(text, sizeof(text), "Poll %u.%us", (unsigned)(wait / 1000), (unsigned)(wait % 1000 / 100));
+  layout::drawStatusText(gfx(), x, y, boxW, boxH, text, ink(failures ? INK_USED : INK_GRID), layoutInks());
+}
+
+// Local HH:MM:SS, or "--:--:--" until the time is known
+static void formatClockText(char* buf, size_t cap)
+{
+  uint32_t now;
+  if (!localUnixNow(now)) {
+    strlcpy(buf, "--:--:--", cap);
+    return;
+  }
+  uint32_t s = (uint32_t)(((int64_t)now + s_utc_offset_s) % 86400);
+  snprintf(buf, cap, "%02u:%02u:%02u", (unsigned)(s / 3600), (unsigned)(s / 60 % 60), (unsigned)(s % 60));
+}
+
+// Big clock characters, rendered once at text size 4 into 1-bit masks. A
+// tick repaints only the cells that changed, one bitmap blit each, instead
+// of clearing the widget and drawing scaled text.
+static const char CLOCK_GLYPH_CHARS[] = "0123456789:-";
+static const int CLOCK_GLYPH_COUNT = sizeof(CLOCK_GLYPH_CHARS) - 1;
+static const int CLOCK_GLYPH_W = 24; // built-in 6x8 font at size 4
+static const int CLOCK_GLYPH_H = 32;
+static const int CLOCK_CELLS = 8;    // HH:MM:SS
+static uint8_t s_clock_glyphs[CLOCK_GLYPH_COUNT][CLOCK_GLYPH_W / 8 * CLOCK_GLYPH_H];
+static bool s_clock_glyphs_ok = false;
+static char s_clock_shown[CLOCK_CELLS + 1]; // what the clock cells show
+
+static void initClockGlyphs()
+{
+  LGFX_Sprite cell;
+  cell.setColorDepth(1);
+  if (!cell.createSprite(CLOCK_GLYPH_W, CLOCK_GLYPH_H)) return;
+  cell.setTextSize(4);
+  cell.setTextColor(1, 0);
+  for (int i = 0; i < CLOCK_GLYPH_COUNT; ++i) {
+    cell.fillSprite(0);
+    cell.drawChar(CLOCK_GLYPH_CHARS[i], 0, 0);
+    // 1-bit sprites are row-major, MSB first: the layout drawBitmap() takes
+    memcpy(s_clock_glyphs[i], cell.getBuffer(), sizeof(s_clock_glyphs[i]));
+  }
+  cell.deleteSprite();
+  s_clock_glyphs_ok = true;
+}
+
+static int clockCellX(int x, int w, int cell)
+{
+  return x + (w - CLOCK_CELLS * CLOCK_GLYPH_W) / 2 + cell * CLOCK_GLYPH_W;
+}
+
+// Blit the clock cells whose character changed (all of them if full),
+// pushing each one to the panel when present is set.
+static void paintClockCells(int x, int y, int w, bool full, bool present)
+{
+  char text[CLOCK_CELLS + 1];
+  formatClockText(text, sizeof(text));
+  auto& g = gfx();
+  for (int i = 0; i < CLOCK_CELLS; ++i) {
+    if (!full && text[i] == s_clock_shown[i]) continue;
+    const char* glyph = strchr(CLOCK_GLYPH_CHARS, text[i]);
+    int cx = clockCellX(x, w, i);
+    if (glyph) g.drawBitmap(cx, y, s_clock_glyphs[glyph - CLOCK_GLYPH_CHARS], CLOCK_GLYPH_W, CLOCK_GLYPH_H, ink(INK_BLACK), ink(INK_WHITE));
+    else g.fillRect(cx, y, CLOCK_GLYPH_W, CLOCK_GLYPH_H, ink(INK_WHITE));
+    if (present) presentRect(cx, y, CLOCK_GLYPH_W, CLOCK_GLYPH_H);
+  }
+  memcpy(s_clock_shown, text, sizeof(text));
+}
+
+static void drawClockText(int x, int y, int w, int h)
+{
+  auto& g = gfx();
+  g.fillRect(x, y, w, h, ink(INK_WHITE));
+  if (s_clock_glyphs_ok) {
+    paintClockCells(x, y, w, true, false);
+    return;
+  }
+  char hhmmss[9];
+  formatClockText(hhmmss, sizeof(hhmmss));
+  g.setTextColor(ink(INK_BLACK)); g.setTextSize(4);
+  int16_t tw = g.textWidth(hhmmss);
+  g.setCursor(x + (w - tw) / 2, y); g.print(hhmmss);
+}
+
+// Fleet overview rows: label, then CPU and RAM sparklines each with the
+// latest value. Hosts that stopped answering are greyed out.
+static const int FLEET_LABEL_W = 76;
+static const int FLEET_VALUE_W = 28;
+
+static bool fleetOnline(const FleetHost& f)
+{
+  return f.seen_at != 0 && millis() - f.seen_at < FLEET_STALE_MS;
+}
+
+static void recordFleetReading(FleetHost& f, float cpu_pct, float ram_pct)
+{
+  f.cpu.push(MetricSeries::Codec::encode(cpu_pct));
+  f.ram.push(MetricSeries::Codec::encode(ram_pct));
+  f.seen_at = millis() | 1;
+  ++f.seq;
+}
+
+// Pick up host list changes: labels come from the config, and a host keeps
+// its sparkline unless its slot now holds a different server
+static void syncFleetHosts()
+{
+  uint32_t gen = s_poll_target_gen.load();
+  if (gen == s_fleet_gen) return;
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  strlcpy(s_fleet[0].label, s_saved_ip.c_str(), sizeof(s_fleet[0].label));
+  s_fleet_hosts = s_fleet_target_count + 1;
+  for (int i = 1; i < s_fleet_hosts; ++i) {
+    const char* label = s_fleet_targets[i - 1].label;
+    if (strcmp(s_fleet[i].label, label) == 0) continue;
+    s_fleet[i] = FleetHost();
+    strlcpy(s_fleet[i].label, label, sizeof(s_fleet[i].label));
+  }
+  xSemaphoreGive(s_config_mutex);
+  s_fleet_gen = gen;
+  int pages = (s_fleet_hosts + FLEET_ROWS - 1) / FLEET_ROWS;
+  if (s_fleet_page >= pages) s_fleet_page = pages - 1;
+}
+
+static void drawSparkline(int x, int y, int w, int h, const RingSeries<uint8_t, FLEET_SPARK_N>& data, Ink color)
+{
+  auto& g = gfx();
+  int step = (w - 1) / (FLEET_SPARK_N - 1);
+  if (step < 1) step = 1;
+  int visible = (w - 1) / step + 1;
+  if (visible > (int)data.size()) visible = (int)data.size();
+  int right = x + w - 1;
+  int prevX = 0, prevY = 0;
+  for (int age = visible - 1; age >= 0; --age) {
+    int px = right - age * step;
+    int py = mapValueToY(MetricSeries::Codec::decode(data.fromNewest(age)), y, h - 1);
+    if (age == visible - 1) g.drawPixel(px, py, ink(color));
+    else g.drawLine(prevX, prevY, px, py, ink(color));
+    prevX = px; prevY = py;
+  }
+}
+
+static void drawFleetRow(int x, int y, int w, int h, int host)
+{
+  auto& g = gfx();
+  g.fillRect(x, y, w, h, ink(INK_WHITE));
+  if (host >= s_fleet_hosts) return;
+  const FleetHost& f = s_fleet[host];
+  bool online = fleetOnline(f);
+  g.drawFastHLine(x, y + h - 1, w, ink(INK_GRID));
+  char label[FLEET_LABEL_W / 6];
+  strlcpy(label, f.label[0] ? f.label : "?", sizeof(label));
+  g.setTextSize(1);
+  g.setTextColor(ink(online ? INK_BLACK : INK_GRID));
+  g.setCursor(x + 2, y + (h - 8) / 2); g.print(label);
+  int sw = (w - FLEET_LABEL_W - 2 * FLEET_VALUE_W) / 2;
+  int sx = x + FLEET_LABEL_W;
+  for (int i = 0; i < 2; ++i) {
+    const RingSeries<uint8_t, FLEET_SPARK_N>& data = i == 0 ? f.cpu : f.ram;
+    drawSparkline(sx, y + 3, sw - 4, h - 6, data, online ? (i == 0 ? INK_CPU : INK_RAM) : INK_GRID);
+    g.setCursor(sx + sw, y + (h - 8) / 2);
+    if (online && !data.empty()) g.printf("%3.0f%%", MetricSeries::Codec::decode(data.newest()));
+    else g.print(" --");
+    sx += sw + FLEET_VALUE_W;
+  }
+}
+
+// Perf overlay: timer percentiles in microseconds, panel traffic and heap
+static void drawPerfOverlay(int x, int y, int w, int h)
+{
+  auto& g = gfx();
+  g.fillRect(x, y, w, h, ink(INK_BLACK));
+  g.setTextColor(ink(INK_WHITE)); g.setTextSize(1);
+  int ty = y + 3;
+  g.setCursor(x + 4, ty); g.print("us                p50     p99");
+  PerfId render = (PerfId)(PERF_RENDER_CHARTS + s_layout);
+  const PerfId rows[] = { PERF_POLL, PERF_PARSE, PERF_REFRESH, render, PERF_HTTP, PERF_LOOP };
+  for (PerfId id : rows) {
+    ty += 10;
+    g.setCursor(x + 4, ty);
+    g.printf("%-13s %7u %7u", PERF_NAMES[id], (unsigned)s_perf[id].percentile(50), (unsigned)s_perf[id].percentile(99));
+  }
+  ty += 10;
+  g.setCursor(x + 4, ty);
+  g.printf("spi %u KB in %u pushes", (unsigned)(s_perf_spi_bytes.load() / 1024), (unsigned)s_perf_spi_pushes.load());
+  ty += 10;
+  g.setCursor(x + 4, ty);
+  g.printf("heap %uK, block %uK, frag %u%%", (unsigned)(ESP.getFreeHeap() / 1024), (unsigned)(ESP.getMaxAllocHeap() / 1024),
+           (unsigned)heapFragmentation());
+  ty += 10;
+  g.setCursor(x + 4, ty);
+  g.printf("allocs loop %u net %u, steady %u", (unsigned)s_alloc[ALLOC_LOOP].count, (unsigned)s_alloc[ALLOC_NET].count,
+           (unsigned)s_alloc_steady.load());
+}
+
+// Widget layer: each widget owns a screen rectangle and can tell (through a
+// small content key) whether what it would draw differs from what is on the
+// panel. Static chrome is painted once per layout; afterwards only widgets
+// whose key changed are repainted and only their rectangles are pushed.
+// The chart layouts place widgets by layout::Slot, which shares these ids.
+enum WidgetId : uint8_t {
+  W_UPTIME = layout::SLOT_UPTIME, W_CLOCK = layout::SLOT_CLOCK,
+  W_CPU_PLOT = layout::SLOT_CPU_PLOT, W_CPU_LABEL = layout::SLOT_CPU_LABEL,
+  W_RAM_PLOT = layout::SLOT_RAM_PLOT, W_RAM_LABEL = layout::SLOT_RAM_LABEL,
+  W_CPU_TREND = layout::SLOT_CPU_TREND, W_RAM_TREND = layout::SLOT_RAM_TREND,
+  W_DISK_BAR = layout::SLOT_DISK_BAR, W_DISK_LABEL = layout::SLOT_DISK_LABEL,
+  W_LINK = layout::SLOT_STATUS,
+  W_FLEET_ROW0,
+  W_PERF = W_FLEET_ROW0 + FLEET_ROWS, // last: painted over whatever it covers
+  W_COUNT
+};
+struct Widget
+{
+  int16_t x, y, w, h; // w == 0: not part of the current layout
+  uint32_t drawn_key;
+};
+static Widget s_widgets[W_COUNT];
+static uint32_t s_widgets_valid = 0; // bit per widget: panel shows drawn_key
+
+static void placeWidget(WidgetId id, int x, int y, int w, int h)
+{
+  s_widgets[id] = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, 0 };
+}
+
+static void placeSlot(layout::Slot slot, int x, int y, int w, int h)
+{
+  placeWidget(slot == layout::SLOT_PERF ? W_PERF : (WidgetId)slot, x, y, w, h);
+}
+
+static uint32_t widgetKey(WidgetId id)
+{
+  if (id == W_PERF) return millis() / 1000;
+  if (id >= W_FLEET_ROW0) {
+    int host = s_fleet_page * FLEET_ROWS + (id - W_FLEET_ROW0);
+    if (host >= s_fleet_hosts) return 0;
+    return s_fleet[host].seq * 2 + (fleetOnline(s_fleet[host]) ? 1 : 0);
+  }
+  switch (id) {
+    case W_UPTIME: return uptimeNow();
+    case W_LINK: return (uint32_t)s_poll_failures.load() << 24 | (s_poll_wait_ms.load() / 100 & 0xFFFFFFu);
+    case W_CLOCK: {
+      char hhmmss[9];
+      formatClockText(hhmmss, sizeof(hhmmss));
+      uint32_t k = 2166136261u; // FNV-1a
+      for (const char* p = hhmmss; *p; ++p) k = (k ^ (uint8_t)*p) * 16777619u;
+      return k;
+    }
+    case W_CPU_PLOT:
+    case W_RAM_PLOT: return s_sample_seq;
+    case W_CPU_TREND: return s_cpu_trend.revision();
+    case W_RAM_TREND: return s_ram_trend.revision();
+    case W_CPU_LABEL: return (uint32_t)lroundf(latestValue(s_cpu_hist));
+    case W_RAM_LABEL: return (uint32_t)lroundf(latestValue(s_ram_hist));
+    case W_DISK_BAR: return (uint32_t)(s_widgets[W_DISK_BAR].w * (s_disk_used_pct / 100.0f));
+    case W_DISK_LABEL: return (uint32_t)lroundf(s_disk_used_pct);
+    default: return 0;
+  }
+}
+
+// Paint a widget into the frame buffer.
+static void paintWidget(WidgetId id)
+{
+  const Widget& w = s_widgets[id];
+  if (id == W_PERF) {
+    drawPerfOverlay(w.x, w.y, w.w, w.h);
+    return;
+  }
+  if (id >= W_FLEET_ROW0) {
+    drawFleetRow(w.x, w.y, w.w, w.h, s_fleet_page * FLEET_ROWS + (id - W_FLEET_ROW0));
+    return;
+  }
+  switch (id) {
+    case W_UPTIME: drawUptimeTopRight(w.x, w.y, w.w, w.h); break;
+    case W_LINK: drawPollStatus(w.x, w.y, w.w, w.h); break;
+    case W_CLOCK: drawClockText(w.x, w.y, w.w, w.h); break;
+    case W_CPU_PLOT:
+    case W_RAM_PLOT: {
+      const ChartSeries& cs = SERIES[id == W_CPU_PLOT ? SERIES_CPU : SERIES_RAM];
+      drawChartPlot(w.x, w.y, w.w, w.h, *cs.data, cs.color);
+      break;
+    }
+    case W_CPU_TREND:
+    case W_RAM_TREND: {
+      const ChartSeries& cs = SERIES[id == W_CPU_TREND ? SERIES_CPU : SERIES_RAM];
+      drawTrendPlot(w.x, w.y, w.w, w.h, *cs.trend, cs.color);
+      break;
+    }
+    case W_CPU_LABEL: drawPercentLabel(w.x, w.y, w.w, w.h, latestValue(s_cpu_hist)); break;
+    case W_RAM_LABEL: drawPercentLabel(w.x, w.y, w.w, w.h, latestValue(s_ram_hist)); break;
+    case W_DISK_BAR: drawStorageBar(w.x, w.y, w.w, w.h, s_disk_used_pct); break;
+    case W_DISK_LABEL: drawPercentLabel(w.x, w.y, w.w, w.h, s_disk_used_pct); break;
+    default: break;
+  }
+}
+
+// Screen area a widget repaint covers (plots skip their frame and title row)
+static void widgetDirtyRect(WidgetId id, int& x, int& y, int& w, int& h)
+{
+  const Widget& wd = s_widgets[id];
+  x = wd.x; y = wd.y; w = wd.w; h = wd.h;
+  if (id == W_CPU_PLOT || id == W_RAM_PLOT || id == W_CPU_TREND || id == W_RAM_TREND) {
+    x += 1; y += 13; w -= 2; h -= 14;
+  }
+}
+
+static bool widgetsOverlap(const Widget& a, const Widget& b)
+{
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+// Repaint and push only the widgets whose content changed. The perf
+// overlay comes last and is repainted whenever something under it was.
+static void refreshWidgets()
+{
+  PerfScope timer(PERF_REFRESH);
+  bool writing = false;
+  bool overlay_hit = false;
+  for (int i = 0; i < W_COUNT; ++i) {
+    WidgetId id = (WidgetId)i;
+    const Widget& w = s_widgets[id];
+    if (w.w == 0) continue;
+    uint32_t key = widgetKey(id);
+    uint32_t bit = 1u << i;
+    bool valid = (s_widgets_valid & bit) != 0;
+    if (valid && key == w.drawn_key && !(id == W_PERF && overlay_hit)) continue;
+    if (id != W_PERF && s_widgets[W_PERF].w != 0 && widgetsOverlap(w, s_widgets[W_PERF])) overlay_hit = true;
+    if (!writing) { lcd.startWrite(); writing = true; }
+    if (valid && id == W_CLOCK && s_clock_glyphs_ok) {
+      // Only the changed digits are blitted and pushed
+      paintClockCells(w.x, w.y, w.w, false, true);
+      s_widgets[id].drawn_key = key;
+      continue;
+    }
+    bool scrolled = false;
+    int top = 0, bottom = -1;
+    if (valid && (id == W_CPU_PLOT || id == W_RAM_PLOT)) {
+      // Plot keys count samples, so the difference is how many arrived
+      const ChartSeries& cs = SERIES[id == W_CPU_PLOT ? SERIES_CPU : SERIES_RAM];
+      scrolled = scrollChartPlot(w.x, w.y, w.w, w.h, *cs.data, key - w.drawn_key, cs.color, top, bottom);
+    }
+    if (!scrolled) paintWidget(id);
+    s_widgets[id].drawn_key = key;
+    s_widgets_valid |= bit;
+    int x, y, rw, rh; widgetDirtyRect(id, x, y, rw, rh);
+    if (scrolled) { y = top; rh = bottom - top + 1; } // only the rows the line crosses
+    presentRect(x, y, rw, rh);
+  }
+  if (writing) lcd.endWrite();
+}
+
+// Paint every widget of a freshly laid out screen and push one full frame.
+static void paintAllWidgets()
+{
+  s_widgets_valid = 0;
+  for (int i = 0; i < W_COUNT; ++i) {
+    if (s_widgets[i].w == 0) continue;
+    paintWidget((WidgetId)i);
+    s_widgets[i].drawn_key = widgetKey((WidgetId)i);
+    s_widgets_valid |= 1u << i;
+  }
+  presentFrame();
+}
+
+static void placeStatusLine()
+{
+  layout::placeStatus(gfx(), s_perf_overlay, placeSlot);
+}
+
+// Lay out widgets for the current layout, paint everything and push one full
+// frame. Used on layout switches; new samples go through refreshWidgets().
+static void renderChartsLayout()
+{
+  memset(s_widgets, 0, sizeof(s_widgets));
+  layout::composeCharts(gfx(), layoutInks(), placeSlot);
+  placeStatusLine();
+  paintAllWidgets();
+}
+
+static void renderClockLayout()
+{
+  memset(s_widgets, 0, sizeof(s_widgets));
+  layout::composeClock(gfx(), layoutInks(), placeSlot);
+  placeStatusLine();
+  paintAllWidgets();
+}
+
+static void renderTrendsLayout()
+{
+  memset(s_widgets, 0, sizeof(s_widgets));
+  layout::composeTrends(gfx(), layoutInks(), placeSlot);
+  placeStatusLine();
+  paintAllWidgets();
+}
+
+// Every server at a glance
+static void renderFleetLayout()
+{
+  auto& g = gfx();
+  memset(s_widgets, 0, sizeof(s_widgets));
+  syncFleetHosts();
+  g.fillScreen(ink(INK_WHITE));
+  g.setTextColor(ink(INK_BLACK)); g.setTextSize(2);
+  g.setCursor(6, 4); g.print("Fleet");
+  g.setTextSize(1);
+  int sw = (g.width() - FLEET_LABEL_W - 2 * FLEET_VALUE_W) / 2;
+  g.setCursor(FLEET_LABEL_W, 12); g.print("CPU");
+  g.setCursor(FLEET_LABEL_W + sw + FLEET_VALUE_W, 12); g.print("RAM");
+  int pages = (s_fleet_hosts + FLEET_ROWS - 1) / FLEET_ROWS;
+  if (pages > 1) {
+    g.setCursor(g.width() - 30, 12); g.printf("%d/%d", s_fleet_page + 1, pages);
+  }
+  int y = 24, h = 29;
+  for (int r = 0; r < FLEET_ROWS; ++r) placeWidget((WidgetId)(W_FLEET_ROW0 + r), 0, y + r * h, g.width(), h);
+  placeStatusLine();
+  paintAllWidgets();
+}
+
+static void (*const LAYOUT_RENDERERS[LAYOUT_MAX])() = {
+  renderChartsLayout, // LAYOUT_CHARTS
+  renderClockLayout,  // LAYOUT_CLOCK
+  renderTrendsLayout, // LAYOUT_TRENDS
+  renderFleetLayout,  // LAYOUT_FLEET
+};
+// Layouts that show the primary server's latest values; the others only
+// need a sample per trends column
+static const bool LAYOUT_SHOWS_LIVE[LAYOUT_MAX] = { true, true, false, true };
+
+static void renderLayout()
+{
+  if (s_layout < 0 || s_layout >= LAYOUT_MAX) s_layout = LAYOUT_CHARTS;
+  PerfScope timer((PerfId)(PERF_RENDER_CHARTS + s_layout));
+  bool live = LAYOUT_SHOWS_LIVE[s_layout];
+  // Coming back to live values: poll now rather than after a long wait
+  if (live && !s_live_shown.exchange(live) && s_net_task) xTaskNotifyGive(s_net_task);
+  s_live_shown = live;
+  LAYOUT_RENDERERS[s_layout]();
+}
+
+static size_t formatHttpGet(char* buf, size_t cap, const char* path, const char* host, uint16_t port, const char* auth)
+{
+  int n = snprintf(buf, cap,
+                   "GET %s HTTP/1.1\r\n"
+                   "Host: %s:%u\r\n"
+                   "Authorization: Bearer %s\r\n"
+                   "Connection: keep-alive\r\n"
+                   "\r\n",
+                   path, host, (unsigned)port, auth);
+  return (n > 0 && n < (int)cap) ? (size_t)n : 0;
+}
+
+static size_t formatPollRequest(char* buf, size_t cap, const char* path, const PollTarget& t)
+{
+  return formatHttpGet(buf, cap, path, t.host, t.port, s_saved_auth.c_str());
+}
+
+// Rebuild s_fleet_targets from s_saved_servers. Caller holds s_config_mutex.
+static void rebuildFleetTargetsLocked()
+{
+  s_fleet_target_count = 0;
+  if (s_saved_servers.length() == 0) return;
+  JsonDocument doc;
+  if (deserializeJson(doc, s_saved_servers)) return;
+  for (JsonObjectConst server : doc.as<JsonArrayConst>()) {
+    if (s_fleet_target_count >= FLEET_MAX - 1) {
+      Serial.printf("Fleet: only %d servers fit, ignoring the rest\n", FLEET_MAX - 1);
+      break;
+    }
+    FleetTarget& f = s_fleet_targets[s_fleet_target_count];
+    strlcpy(f.host, server["ip"] | "", sizeof(f.host));
+    f.port = server["port"] | 0;
+    const char* name = server["name"] | "";
+    strlcpy(f.label, *name ? name : f.host, sizeof(f.label));
+    f.request_len = formatHttpGet(f.request, sizeof(f.request), "/metrics.bin", f.host, f.port, server["auth"] | "");
+    if (f.host[0] && f.port && f.request_len) ++s_fleet_target_count;
+  }
+}
+
+// Rebuild s_poll_target from the saved config. Caller holds s_config_mutex.
+static void rebuildPollTargetLocked()
+{
+  PollTarget& t = s_poll_target;
+  t.request_stream_len = 0;
+  t.request_bin_len = 0;
+  t.request_json_len = 0;
+  strlcpy(t.host, s_saved_ip.c_str(), sizeof(t.host));
+  t.port = (uint16_t)s_saved_port.toInt();
+  if (s_saved_ip.length() > 0 && t.port != 0 && s_saved_auth.length() > 0) {
+    t.request_stream_len = formatPollRequest(t.request_stream, sizeof(t.request_stream), "/metrics/stream?compact=1", t);
+    t.request_bin_len = formatPollRequest(t.request_bin, sizeof(t.request_bin), "/metrics.bin", t);
+    t.request_json_len = formatPollRequest(t.request_json, sizeof(t.request_json), "/metrics", t);
+  }
+  rebuildFleetTargetsLocked();
+  s_poll_target_gen.fetch_add(1);
+}
+
+// Status line and the few headers the poller cares about
+struct HttpResponseHead
+{
+  int status;
+  int32_t content_length; // -1 when not sent
+  bool chunked;
+  bool keep_alive;
+};
+
+// Read one CRLF-terminated line into buf (without the CRLF).
+// Over-long lines are truncated; returns false on timeout or disconnect.
+static bool readHttpLine(Client& c, char* buf, size_t cap, uint32_t deadline)
+{
+  size_t n = 0;
+  for (;;) {
+    if (!c.available()) {
+      if (!c.connected() || (int32_t)(millis() - deadline) >= 0) return false;
+      delay(1);
+      continue;
+    }
+    int ch = c.read();
+    if (ch < 0) continue;
+    if (ch == '\n') break;
+    if (ch != '\r' && n + 1 < cap) buf[n++] = (char)ch;
+  }
+  buf[n] = '\0';
+  return true;
+}
+
+static bool readHttpResponseHead(Client& c, HttpResponseHead& head, uint32_t deadline)
+{
+  char line[128];
+  head.status = 0;
+  head.content_length = -1;
+  head.chunked = false;
+  head.keep_alive = true;
+  if (!readHttpLine(c, line, sizeof(line), deadline)) return false;
+  // "HTTP/1.1 200 OK"; HTTP/1.0 servers close unless they say otherwise
+  if (strncmp(line, "HTTP/1.", 7) != 0) return false;
+  if (line[7] == '0') head.keep_alive = false;
+  const char* sp = strchr(line, ' ');
+  if (!sp) return false;
+  head.status = atoi(sp + 1);
+  for (;;) {
+    if (!readHttpLine(c, line, sizeof(line), deadline)) return false;
+    if (line[0] == '\0') return true; // end of headers
+    char* colon = strchr(line, ':');
+    if (!colon) continue;
+    *colon = '\0';
+    const char* value = colon + 1;
+    while (*value == ' ') ++value;
+    if (strcasecmp(line, "Content-Length") == 0) {
+      head.content_length = atol(value);
+    } else if (strcasecmp(line, "Transfer-Encoding") == 0) {
+      head.chunked = strcasestr(value, "chunked") != nullptr;
+    } else if (strcasecmp(line, "Connection") == 0) {
+      if (strcasecmp(value, "close") == 0) head.keep_alive = false;
+      else if (strcasecmp(value, "keep-alive") == 0) head.keep_alive = true;
+    }
+  }
+}
+
+// Byte source over a response body, undoing chunked transfer encoding.
+class HttpBodyReader
+{
+public:
+  HttpBodyReader(Client& c, const HttpResponseHead& head, uint32_t deadline)
+    : m_client(c), m_chunked(head.chunked), m_remaining(head.content_length), m_deadline(deadline) {}
+
+  // Next body byte, or -1 at end of body / on error.
+  int read()
+  {
+    if (m_done) return -1;
+    if (m_chunked && m_remaining == 0) {
+      if (m_started && !skipLine()) return fail(); // CRLF after previous chunk
+      char line[24];
+      if (!readHttpLine(m_client, line, sizeof(line), m_deadline)) return fail();
+      m_remaining = strtol(line, nullptr, 16);
+      m_started = true;
+      if (m_remaining == 0) {
+        skipLine(); // terminating CRLF (no trailers expected)
+        m_done = true;
+        return -1;
+      }
+    }
+    if (!m_chunked && m_remaining == 0) {
+      m_done = true;
+      return -1;
+    }
+    while (!m_client.available()) {
+      if (!m_client.connected() && !m_chunked && m_remaining < 0) {
+        m_done = true; // no length given: the body ends when the server closes
+        return -1;
+      }
+      if (!m_client.connected() || (int32_t)(millis() - m_deadline) >= 0) return fail();
+      delay(1);
+    }
+    int ch = m_client.read();
+    if (ch < 0) return fail();
+    if (m_remaining > 0) --m_remaining;
+    return ch;
+  }
+
+  // True once the body was read to its end, so the connection can be reused.
+  bool complete() const { return m_done && !m_failed; }
+
+  // Long-lived bodies (event streams) move the deadline forward per event.
+  void extendDeadline(uint32_t deadline) { m_deadline = deadline; }
+
+private:
+  bool skipLine()
+  {
+    char tmp[4];
+    return readHttpLine(m_client, tmp, sizeof(tmp), m_deadline);
+  }
+  int fail()
+  {
+    m_done = true;
+    m_failed = true;
+    return -1;
+  }
+
+  Client& m_client;
+  bool m_chunked;
+  int32_t m_remaining; // bytes left in the body or current chunk; -1 = until close
+  uint32_t m_deadline;
+  bool m_started = false;
+  bool m_done = false;
+  bool m_failed = false;
+};
+
+// Send the prebuilt request over the keep-alive connection, reconnecting
+// first if the previous exchange failed or the server closed the socket.
+static bool sendPollRequest(const char* request, size_t request_len)
+{
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    bool reused = s_poll_client.connected();
+    if (!reused) {
+      allocExpected(); // socket now, receive buffer on the first read
+      s_poll_client.stop();
+      if (!s_poll_client.connect(s_net_target.host, s_net_target.port, HTTP_TIMEOUT_MS)) return false;
+      s_poll_client.setNoDelay(true);
+    }
+    // Discard anything left over from the previous response
+    while (s_poll_client.available()) s_poll_client.read();
+    size_t sent = s_poll_client.write((const uint8_t*)request, request_len);
+    if (sent == request_len) return true;
+    // An idle keep-alive socket may have been dropped; retry once on a fresh one
+    s_poll_client.stop();
+    if (!reused) return false;
+  }
+  return false;
+}
+
+// Pick up config changes published by rebuildPollTargetLocked().
+static void syncPollTarget()
+{
+  uint32_t gen = s_poll_target_gen.load();
+  if (gen == s_net_target_gen) return;
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  s_net_target = s_poll_target;
+  xSemaphoreGive(s_config_mutex);
+  s_net_target_gen = gen;
+  s_net_use_binary = true;
+  s_net_use_stream = true;
+  s_net_use_history = true;
+  s_net_stream_retry_at = millis();
+  s_net_interval.reset();
+  s_net_breaker.success();
+  s_poll_client.stop(); // target changed; never reuse the old socket
+}
+
+static void pushSample(const MetricsSample& sample)
+{
+  if (!s_sample_queue.push(sample)) Serial.println("Sample queue full, dropping sample");
+  wakeLoop();
+}
+
+// Backfill outruns the queue; wait for the loop to drain it instead of dropping
+static bool pushSampleWait(const MetricsSample& sample)
+{
+  uint32_t start = millis();
+  while (!s_sample_queue.push(sample)) {
+    wakeLoop();
+    if (!s_stats_active || millis() - start >= HTTP_TIMEOUT_MS) return false;
+    vTaskDelay(1);
+  }
+  wakeLoop();
+  return true;
+}
+
+static size_t readBodyBytes(HttpBodyReader& body, uint8_t* buf, size_t n)
+{
+  size_t len = 0;
+  int ch;
+  while (len < n && (ch = body.read()) >= 0) buf[len++] = (uint8_t)ch;
+  return len;
+}
+
+// Fetch the samples the server took after `since` and before `until` (unix
+// time) and forward them oldest first. One request, averaged down to the
+// poll cadence so the raw chart keeps its spacing.
+static void backfillHistory(uint32_t since, uint32_t until)
+{
+  if (!s_net_use_history) return;
+  char path[96];
+  snprintf(path, sizeof(path), "/metrics/history?since=%u&step=%u&limit=%u&format=bin",
+           (unsigned)since, (unsigned)(STATS_POLL_MS / 1000), (unsigned)BACKFILL_MAX_SAMPLES);
+  char request[320];
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY); // formatPollRequest reads s_saved_auth
+  size_t request_len = formatPollRequest(request, sizeof(request), path, s_net_target);
+  xSemaphoreGive(s_config_mutex);
+  if (request_len == 0) return;
+
+  WiFiClient& c = s_backfill_client;
+  if (!c.connect(s_net_target.host, s_net_target.port, HTTP_TIMEOUT_MS)) return;
+  c.setNoDelay(true);
+  HttpResponseHead head;
+  if (c.write((const uint8_t*)request, request_len) != request_len ||
+      !readHttpResponseHead(c, head, millis() + HTTP_TIMEOUT_MS)) {
+    c.stop();
+    return;
+  }
+  HttpBodyReader body(c, head, millis() + HTTP_TIMEOUT_MS);
+  uint32_t forwarded = 0;
+  uint8_t buf[HISTORY_BIN_MAX_SIZE];
+  HistoryBinHeader hh;
+  if (head.status == 404) {
+    Serial.println("Server has no /metrics/history, not backfilling");
+    s_net_use_history = false;
+  } else if (head.status == 200 && readBodyBytes(body, buf, HISTORY_BIN_HEADER_MIN) == HISTORY_BIN_HEADER_MIN &&
+             decodeHistoryHeader(buf, HISTORY_BIN_HEADER_MIN, hh) &&
+             readBodyBytes(body, buf, hh.header_size - HISTORY_BIN_HEADER_MIN) == hh.header_size - HISTORY_BIN_HEADER_MIN) {
+    for (uint32_t i = 0; i < hh.count; ++i) {
+      body.extendDeadline(millis() + HTTP_TIMEOUT_MS);
+      if (readBodyBytes(body, buf, hh.record_size) != hh.record_size) break;
+      MetricsSample sample;
+      decodeHistoryRecord(buf, sample);
+      if (sample.unix_s >= until) break;
+      if (!pushSampleWait(sample)) break;
+      ++forwarded;
+    }
+  }
+  c.stop(); // one request per gap; not worth keeping open
+  if (forwarded) Serial.printf("Backfilled %u samples\n", (unsigned)forwarded);
+}
+
+// Forward a polled or streamed sample, filling any gap before it first.
+// A gap is a few polls longer than the current interval.
+static void forwardSample(const MetricsSample& sample)
+{
+  uint32_t gap_s = BACKFILL_GAP_S + s_net_interval.intervalMs() / 1000;
+  if (sample.unix_s && s_net_last_unix && sample.unix_s > s_net_last_unix + gap_s) {
+    backfillHistory(s_net_last_unix, sample.unix_s);
+  }
+  if (sample.unix_s) s_net_last_unix = sample.unix_s;
+  pushSample(sample);
+}
+
+// Runs on the network task: fetch /metrics.bin (or /metrics on servers that
+// don't have it) and decode it into a sample.
+static bool updateStatsFromServer(MetricsSample& out)
+{
+  bool binary = s_net_use_binary;
+  const char* request = binary ? s_net_target.request_bin : s_net_target.request_json;
+  size_t request_len = binary ? s_net_target.request_bin_len : s_net_target.request_json_len;
+  s_net_last_status = 0;
+  if (request_len == 0) return false;
+
+  if (!sendPollRequest(request, request_len)) return false;
+  uint32_t deadline = millis() + HTTP_TIMEOUT_MS;
+  HttpResponseHead head;
+  if (!readHttpResponseHead(s_poll_client, head, deadline)) {
+    s_poll_client.stop();
+    return false;
+  }
+  s_net_last_status = head.status;
+  HttpBodyReader body(s_poll_client, head, deadline);
+  bool parsed = false;
+  if (head.status == 200 && binary) {
+    uint8_t record[METRICS_BIN_MAX_SIZE];
+    size_t len = 0;
+    int ch;
+    while (len < sizeof(record) && (ch = body.read()) >= 0) record[len++] = (uint8_t)ch;
+    PerfScope timer(PERF_PARSE);
+    parsed = decodeMetricsBinary(record, len, out);
+  } else if (head.status == 200) {
+    // Parse straight off the socket; only the MetricsSample fields are kept
+    MetricsJsonParser<HttpBodyReader> parser(body);
+    parsed = parser.parse(out);
+  }
+  // Drain the rest of the body so the connection can carry the next request
+  while (body.read() >= 0) {}
+  if (!body.complete() || !head.keep_alive) s_poll_client.stop();
+
+  if (binary && head.status == 404) {
+    Serial.println("Server has no /metrics.bin, falling back to JSON");
+    s_net_use_binary = false;
+    return updateStatsFromServer(out);
+  }
+  return parsed && body.complete();
+}
 
-// Disk usage percentage (0-100)
-static float s_disk_used_pct = 0.0f;
+// Read one Server-Sent Event and copy its data payload into buf.
+// Returns the payload length, 0 for events without data (comments, retry:)
+// or oversized ones, and -1 once the stream ends or times out.
+static int readSseEvent(HttpBodyReader& body, char* buf, size_t cap)
+{
+  size_t len = 0;
+  bool overflow = false;
+  for (;;) {
+    char field[8];
+    size_t fn = 0;
+    int ch;
+    while ((ch = body.read()) >= 0 && ch != ':' && ch != '\n') {
+      if (ch != '\r' && fn + 1 < sizeof(field)) field[fn++] = (char)ch;
+    }
+    if (ch < 0) return -1;
+    field[fn] = '\0';
+    if (ch == '\n') {
+      if (fn > 0) continue; // field without a value
+      buf[overflow ? 0 : len] = '\0';
+      return overflow ? 0 : (int)len; // blank line dispatches the event
+    }
+    // ':' at line start is a comment; only data: lines are kept
+    bool is_data = fn > 0 && strcmp(field, "data") == 0;
+    if (is_data && len > 0 && len + 1 < cap) buf[len++] = '\n';
+    ch = body.read();
+    if (ch == ' ') ch = body.read();
+    while (ch >= 0 && ch != '\n') {
+      if (is_data && ch != '\r') {
+        if (len + 1 < cap) buf[len++] = (char)ch;
+        else overflow = true;
+      }
+      ch = body.read();
+    }
+    if (ch < 0) return -1;
+  }
+}
 
-// Uptime tracking
-static uint32_t s_uptime_seconds = 0;
-static unsigned long s_last_uptime_tick = 0;
-static String s_last_timestamp_iso = ""; // from server metrics
+// Hold /metrics/stream open and forward every sample the server pushes.
+// Returns when the stream fails or ends, polling is switched off, or the
+// target changes.
+static void runMetricsStream()
+{
+  if (s_net_target.request_stream_len == 0) return;
+  if (!sendPollRequest(s_net_target.request_stream, s_net_target.request_stream_len)) return;
+  HttpResponseHead head;
+  if (!readHttpResponseHead(s_poll_client, head, millis() + HTTP_TIMEOUT_MS)) {
+    s_poll_client.stop();
+    return;
+  }
+  if (head.status != 200) {
+    if (head.status == 404) {
+      Serial.println("Server has no /metrics/stream, polling instead");
+      s_net_use_stream = false;
+    }
+    HttpBodyReader body(s_poll_client, head, millis() + HTTP_TIMEOUT_MS);
+    while (body.read() >= 0) {}
+    if (!body.complete() || !head.keep_alive) s_poll_client.stop();
+    return;
+  }
 
-// Layout management
-enum LayoutType { LAYOUT_CHARTS = 0, LAYOUT_CLOCK = 1, LAYOUT_MAX = 2 };
-static int s_layout = LAYOUT_CHARTS;
-static bool s_touch_down = false;
+  Serial.println("Metrics stream open");
+  HttpBodyReader body(s_poll_client, head, millis() + STREAM_IDLE_TIMEOUT_MS);
+  char event[256];
+  while (s_stats_active && s_poll_target_gen.load() == s_net_target_gen) {
+    body.extendDeadline(millis() + STREAM_IDLE_TIMEOUT_MS);
+    powerBusy(false); // an open stream is nearly all waiting
+    int len = readSseEvent(body, event, sizeof(event));
+    powerBusy(true);
+    if (len < 0) break;
+    if (len == 0) continue;
+    MetricsSample sample;
+    bool parsed;
+    {
+      PerfScope timer(PERF_PARSE);
+      BufferSource src(event, (size_t)len);
+      MetricsJsonParser<BufferSource> parser(src);
+      parsed = parser.parse(sample);
+    }
+    if (parsed) forwardSample(sample);
+  }
+  // The stream never finishes cleanly, so its socket can't be reused
+  s_poll_client.stop();
+  Serial.println("Metrics stream closed");
+}
 
-// Helpers for drawing charts
-static inline int mapValueToY(float pct, int yTop, int height)
-{
-  if (pct < 0) pct = 0; if (pct > 100) pct = 100;
-  return yTop + (int)((100.0f - pct) * (height / 100.0f));
-}
-
-static void drawLineChartArea(int x, int y, int w, int h, const float* data, int size, int idx, bool full, uint16_t color, const char* title)
-{
-  // Clear area
-  lcd.fillRect(x, y, w, h, 0xFFFFu);
-  // Border
-  lcd.drawRect(x, y, w, h, 0x0000u);
-  // Title
-  lcd.setTextColor(0x0000u); lcd.setTextSize(1);
-  lcd.setCursor(x + 4, y + 2); lcd.print(title);
-  // Y-axis grid (25%,50%,75%)
-  uint16_t grid = 0xBDF7u; // light gray
-  for (int p : {25,50,75}) {
-    int gy = mapValueToY((float)p, y + 15, h - 20);
-    lcd.drawFastHLine(x + 1, gy, w - 2, grid);
-  }
-  // Line plot
-  int plotY = y + 15; int plotH = h - 20; int plotX = x + 2; int plotW = w - 4;
-  int points = full ? size : idx;
-  if (points <= 1) return;
-  // Iterate across visible window from oldest to newest
-  auto getVal = [&](int i)->float{
-    if (full) {
-      int pos = (idx + i) % size; return data[pos];
-    } else {
-      return data[i];
-    }
-  };
-  int prevX = plotX;
-  int prevY = mapValueToY(getVal(0), plotY, plotH);
-  lcd.drawPixel(prevX, prevY, color);
-  for (int i = 1; i < (full ? size : idx); ++i) {
-    int px = plotX + (i * plotW) / (size - 1);
-    int py = mapValueToY(getVal(i), plotY, plotH);
-    lcd.drawLine(prevX, prevY, px, py, color);
-    prevX = px; prevY = py;
+static void networkTask(void*)
+{
+  for (;;) {
+    powerBusy(true);
+    if (s_pair_state == PAIR_PENDING) {
+      syncPollTarget();
+      MetricsSample sample;
+      bool ok = updateStatsFromServer(sample);
+      if (ok) forwardSample(sample);
+      s_pair_ok = ok;
+      s_pair_status = s_net_last_status;
+      s_pair_state = PAIR_DONE;
+    }
+    if (s_stats_active && WiFi.status() == WL_CONNECTED) {
+      syncPollTarget();
+      // While the server is failing only a single poll probes it
+      if (!s_net_breaker.open() && s_net_use_stream && (int32_t)(millis() - s_net_stream_retry_at) >= 0) {
+        uint32_t opened = millis();
+        s_poll_wait_ms = 0;
+        runMetricsStream();
+        // Reconnect straight away after a long-lived stream drops; back off
+        // and poll if streams keep failing quickly
+        bool lived = millis() - opened >= STREAM_RETRY_MS;
+        s_net_stream_retry_at = lived ? millis() : millis() + STREAM_RETRY_MS;
+      }
+      MetricsSample sample;
+      bool ok = false;
+      if (s_stats_active) {
+        PerfScope timer(PERF_POLL);
+        ok = updateStatsFromServer(sample);
+      }
+      if (ok) {
+        s_net_breaker.success();
+        forwardSample(sample);
+        s_net_interval.update(sample.cpu_pct, sample.ram_pct);
+      } else if (s_stats_active) {
+        s_net_breaker.failure(millis());
+        s_net_interval.reset();
+      }
+      s_poll_failures = s_net_breaker.failures();
+    }
+    // Sleep until the next poll, or until the loop asks for one now
+    s_net_interval.setShown(s_live_shown.load());
+    uint32_t wait = s_net_breaker.open() ? s_net_breaker.delayMs() : s_net_interval.intervalMs();
+    s_poll_wait_ms = wait;
+    powerBusy(false);
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
   }
-  // Current value label
-  float lastPct = getVal((full ? size : idx) - 1);
-  lcd.setCursor(x + w - 40, y + 2); lcd.printf("%2.0f%%", lastPct);
 }
 
-static void drawStorageBar(int x, int y, int w, int h, float usedPct)
+static void startNetworkTask()
 {
-  lcd.fillRect(x, y, w, h, 0xFFFFu);
-  lcd.drawRect(x, y, w, h, 0x0000u);
-  int usedW = (int)(w * (usedPct / 100.0f));
-  uint16_t usedColor = 0xF800u; // red
-  uint16_t freeColor = 0x07E0u; // green
-  if (usedW > 0) lcd.fillRect(x + 1, y + 1, usedW - 2 < 0 ? 0 : usedW - 2, h - 2, usedColor);
-  if (usedW < w) lcd.fillRect(x + usedW + 1, y + 1, w - usedW - 2, h - 2, freeColor);
-  lcd.setTextColor(0x0000u); lcd.setTextSize(1);
-  lcd.setCursor(x + 4, y - 12); lcd.print("Storage");
-  lcd.setCursor(x + w - 46, y - 12); lcd.printf("%2.0f%%", usedPct);
+  if (s_net_task) return;
+  xTaskCreatePinnedToCore(networkTask, "net", NET_TASK_STACK, nullptr, 1, &s_net_task, NET_TASK_CORE);
 }
 
-static void drawUptimeTopRight()
+// Fleet polling state, owned by the fleet task. Connections are kept alive
+// between rounds.
+enum FleetConnState : uint8_t { FLEET_IDLE, FLEET_CONNECTING, FLEET_SENDING, FLEET_RECEIVING, FLEET_DONE, FLEET_FAILED };
+struct FleetConn
 {
-  // Render uptime at top-right in a small cleared area
-  String up;
-  uint32_t s = s_uptime_seconds;
-  uint32_t days = s / 86400; s %= 86400;
-  uint32_t hours = s / 3600; s %= 3600;
-  uint32_t minutes = s / 60; uint32_t seconds = s % 60;
-  if (days > 0) up = String(days) + "d " + (hours < 10 ? "0" : "") + String(hours) + ":" + (minutes < 10 ? "0" : "") + String(minutes) + ":" + (seconds < 10 ? "0" : "") + String(seconds);
-  else up = (hours < 10 ? "0" : "") + String(hours) + ":" + (minutes < 10 ? "0" : "") + String(minutes) + ":" + (seconds < 10 ? "0" : "") + String(seconds);
-  int boxW = 140; int boxH = 14; int x = lcd.width() - boxW - 4; int y = 2;
-  lcd.fillRect(x, y, boxW, boxH, 0xFFFFu);
-  lcd.setTextColor(0x0000u); lcd.setTextSize(1);
-  lcd.setCursor(x + 2, y + 2);
-  lcd.print("Up: "); lcd.print(up);
+  int fd;        // -1 when closed
+  uint32_t addr; // IPv4 in network order, 0 until resolved
+  FleetConnState state;
+  bool reused;   // request went out on a kept-alive socket
+  size_t sent;
+  HttpReplyBuffer<FLEET_REPLY_CAP> reply;
+  CircuitBreaker breaker{STATS_POLL_MS, POLL_BACKOFF_MAX_MS}; // unreachable hosts sit out rounds
+};
+static FleetTarget s_fleet_net_targets[FLEET_MAX - 1];
+static FleetConn s_fleet_conns[FLEET_MAX - 1];
+static int s_fleet_net_count = 0;
+static uint32_t s_fleet_net_gen = 0;
+
+static void closeFleetConn(FleetConn& c)
+{
+  if (c.fd >= 0) close(c.fd);
+  c.fd = -1;
 }
 
-static void renderChartsLayout()
+static void syncFleetTargets()
 {
-  // Background and title
-  lcd.fillScreen(0xFFFFu);
-  lcd.setTextColor(0x0000u); lcd.setTextSize(2);
-  lcd.setCursor(6, 4); lcd.print("Sentinel Monitor");
-  drawUptimeTopRight();
-  // Regions
-  int margin = 8;
-  int chartW = lcd.width() - 2 * margin;
-  int chartH = 60;
-  int x = margin;
-  int y = 24;
-  drawLineChartArea(x, y, chartW, chartH, s_cpu_hist, HIST_SIZE, s_hist_idx, s_hist_full, 0x001Fu, "CPU");
-  y += chartH + 10;
-  drawLineChartArea(x, y, chartW, chartH, s_ram_hist, HIST_SIZE, s_hist_idx, s_hist_full, 0x07E0u, "RAM");
-  y += chartH + 16;
-  drawStorageBar(x, y, chartW, 18, s_disk_used_pct);
+  uint32_t gen = s_poll_target_gen.load();
+  if (gen == s_fleet_net_gen) return;
+  for (int i = 0; i < s_fleet_net_count; ++i) closeFleetConn(s_fleet_conns[i]);
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  s_fleet_net_count = s_fleet_target_count;
+  memcpy(s_fleet_net_targets, s_fleet_targets, sizeof(FleetTarget) * s_fleet_net_count);
+  xSemaphoreGive(s_config_mutex);
+  for (int i = 0; i < s_fleet_net_count; ++i) {
+    s_fleet_conns[i].fd = -1;
+    s_fleet_conns[i].addr = 0;
+    s_fleet_conns[i].breaker.success();
+  }
+  s_fleet_net_gen = gen;
 }
 
-static void renderClockLayout()
+// Start a non-blocking connect, or reuse the open socket
+static void beginFleetRequest(int i)
+{
+  FleetConn& c = s_fleet_conns[i];
+  const FleetTarget& t = s_fleet_net_targets[i];
+  c.sent = 0;
+  c.reply.reset();
+  c.reused = c.fd >= 0;
+  if (c.reused) {
+    c.state = FLEET_SENDING;
+    return;
+  }
+  c.state = FLEET_FAILED;
+  if (c.addr == 0) {
+    IPAddress ip;
+    if (!ip.fromString(t.host) && !WiFi.hostByName(t.host, ip)) return;
+    c.addr = (uint32_t)ip;
+  }
+  c.fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (c.fd < 0) return;
+  fcntl(c.fd, F_SETFL, fcntl(c.fd, F_GETFL, 0) | O_NONBLOCK);
+  int one = 1;
+  setsockopt(c.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  sockaddr_in sa = {};
+  sa.sin_family = AF_INET;
+  sa.sin_port = htons(t.port);
+  sa.sin_addr.s_addr = c.addr;
+  if (connect(c.fd, (sockaddr*)&sa, sizeof(sa)) == 0) {
+    c.state = FLEET_SENDING;
+  } else if (errno == EINPROGRESS) {
+    c.state = FLEET_CONNECTING;
+  } else {
+    closeFleetConn(c);
+  }
+}
+
+// A kept-alive socket the server dropped fails before any reply byte; try
+// once more on a fresh one
+static void failFleetConn(int i)
+{
+  FleetConn& c = s_fleet_conns[i];
+  closeFleetConn(c);
+  if (c.reused && c.reply.received() == 0) {
+    beginFleetRequest(i);
+    c.reused = false;
+  } else {
+    c.state = FLEET_FAILED;
+  }
+}
+
+static void serviceFleetConn(int i, bool readable, bool writable)
+{
+  FleetConn& c = s_fleet_conns[i];
+  const FleetTarget& t = s_fleet_net_targets[i];
+  if (c.state == FLEET_CONNECTING && writable) {
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (getsockopt(c.fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+      failFleetConn(i);
+      return;
+    }
+    c.state = FLEET_SENDING;
+  }
+  if (c.state == FLEET_SENDING && writable) {
+    ssize_t n = send(c.fd, t.request + c.sent, t.request_len - c.sent, 0);
+    if (n < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK) failFleetConn(i);
+      return;
+    }
+    c.sent += (size_t)n;
+    if (c.sent == t.request_len) c.state = FLEET_RECEIVING;
+    return;
+  }
+  if (c.state == FLEET_RECEIVING && readable) {
+    ssize_t n = recv(c.fd, c.reply.tail(), c.reply.space(), 0);
+    if (n < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK) failFleetConn(i);
+      return;
+    }
+    HttpReplyBuffer<FLEET_REPLY_CAP>::State st = c.reply.commit((size_t)n);
+    if (st == c.reply.FAILED) {
+      failFleetConn(i);
+    } else if (st == c.reply.COMPLETE) {
+      c.state = FLEET_DONE;
+      if (!c.reply.keepAlive()) closeFleetConn(c);
+    }
+  }
+}
+
+// One round: every host's request in flight at once, then select() until
+// all replies are in or the round times out. Hosts backing off sit it out.
+static void pollFleetOnce()
+{
+  uint32_t now = millis();
+  for (int i = 0; i < s_fleet_net_count; ++i) {
+    if (s_fleet_conns[i].breaker.allow(now)) beginFleetRequest(i);
+    else s_fleet_conns[i].state = FLEET_IDLE;
+  }
+  uint32_t deadline = millis() + HTTP_TIMEOUT_MS;
+  for (;;) {
+    fd_set rd, wr;
+    FD_ZERO(&rd);
+    FD_ZERO(&wr);
+    int max_fd = -1;
+    for (int i = 0; i < s_fleet_net_count; ++i) {
+      const FleetConn& c = s_fleet_conns[i];
+      if (c.state == FLEET_CONNECTING || c.state == FLEET_SENDING) FD_SET(c.fd, &wr);
+      else if (c.state == FLEET_RECEIVING) FD_SET(c.fd, &rd);
+      else continue;
+      if (c.fd > max_fd) max_fd = c.fd;
+    }
+    int32_t left = (int32_t)(deadline - millis());
+    if (max_fd < 0 || left <= 0) break;
+    timeval tv = { left / 1000, (left % 1000) * 1000 };
+    int ready = select(max_fd + 1, &rd, &wr, nullptr, &tv);
+    if (ready < 0) break;
+    for (int i = 0; ready > 0 && i < s_fleet_net_count; ++i) {
+      int fd = s_fleet_conns[i].fd;
+      if (fd < 0) continue;
+      bool r = FD_ISSET(fd, &rd), w = FD_ISSET(fd, &wr);
+      if (r || w) serviceFleetConn(i, r, w);
+    }
+  }
+  uint8_t gen = (uint8_t)s_fleet_net_gen;
+  now = millis();
+  for (int i = 0; i < s_fleet_net_count; ++i) {
+    FleetConn& c = s_fleet_conns[i];
+    if (c.state == FLEET_IDLE) continue;
+    MetricsSample sample;
+    if (c.state == FLEET_DONE && c.reply.status() == 200 && decodeMetricsBinary(c.reply.body(), c.reply.bodyLength(), sample)) {
+      FleetSample fs = { (uint8_t)(i + 1), gen, sample.cpu_pct, sample.ram_pct };
+      s_fleet_queue.push(fs);
+      wakeLoop();
+      c.breaker.success();
+      continue;
+    }
+    if (c.state != FLEET_DONE) closeFleetConn(c); // timed out or failed; start clean next round
+    c.breaker.failure(now);
+  }
+}
+
+static void fleetTask(void*)
+{
+  TickType_t wake = xTaskGetTickCount();
+  for (;;) {
+    if (s_stats_active && WiFi.status() == WL_CONNECTED) {
+      syncFleetTargets();
+      if (s_fleet_net_count > 0) {
+        powerBusy(true);
+        pollFleetOnce();
+        powerBusy(false);
+      }
+    }
+    vTaskDelayUntil(&wake, pdMS_TO_TICKS(STATS_POLL_MS));
+  }
+}
+
+static void startFleetTask()
+{
+  if (s_fleet_task) return;
+  xTaskCreatePinnedToCore(fleetTask, "fleet", FLEET_TASK_STACK, nullptr, 1, &s_fleet_task, NET_TASK_CORE);
+}
+
+// History persistence. The history clock continues across reboots so
+// restored buckets line up with new samples. After a soft reset the whole
+// history comes back from RTC slow memory, refreshed after every batch of
+// samples. After a power cycle it's replayed from an append-only log on
+// SPIFFS, written one batch per minute to two files that take turns, so
+// flash sees sequential appends and a truncate per file every few hours.
+struct HistoryRecord {
+  uint32_t clock_s;
+  uint32_t unix_s; // server time, 0 if unknown
+  uint8_t cpu, ram;
+} __attribute__((packed));
+// The snapshot is the series' raw bytes, so it's only valid for the build
+// that wrote it: the magic folds in every persisted size and a layout
+// version, and the app's ELF SHA-256 rules out a same-sized rebuild
+static_assert(std::is_trivially_copyable<MetricSeries>::value, "MetricSeries is persisted with memcpy");
+static_assert(std::is_trivially_copyable<TrendEnvelope>::value, "TrendEnvelope is persisted with memcpy");
+struct HistorySnapshot {
+  uint32_t magic;
+  uint8_t app_sha[32];
+  uint32_t clock_s;
+  uint32_t last_unix, last_clock;
+  uint8_t cpu[sizeof(MetricSeries)], ram[sizeof(MetricSeries)];
+  uint8_t cpu_trend[sizeof(TrendEnvelope)], ram_trend[sizeof(TrendEnvelope)];
+  uint32_t check;
+};
+static const uint32_t HISTORY_LAYOUT_VERSION = 3; // bump when a field changes meaning
+static constexpr uint32_t historyLayoutMix(uint32_t h, uint32_t v) { return (h ^ v) * 16777619u; }
+static constexpr uint32_t HISTORY_MAGIC =
+  historyLayoutMix(historyLayoutMix(historyLayoutMix(historyLayoutMix(2166136261u, HISTORY_LAYOUT_VERSION),
+                                                     sizeof(MetricSeries)), sizeof(TrendEnvelope)), sizeof(HistorySnapshot));
+static const int HISTORY_LOG_BATCH = 30;
+static const size_t HISTORY_LOG_FILE_MAX = 96 * 1024;
+static const char* HISTORY_LOG_FILES[2] = { "/hist0.log", "/hist1.log" };
+RTC_NOINIT_ATTR static HistorySnapshot s_rtc_history;
+static HistoryRecord s_history_batch[HISTORY_LOG_BATCH];
+static int s_history_batch_len = 0;
+static int s_history_log_file = 0;
+static uint32_t s_history_clock_base = 0;
+// Server time of the newest sample and where it sits on the history clock
+static const uint32_t HISTORY_MAX_GAP_S = 24 * 3600; // beyond this, assume the server clock stepped
+static uint32_t s_history_last_unix = 0;
+static uint32_t s_history_last_clock = 0;
+
+// Seconds on the history clock: device uptime plus wherever the restored
+// history left off
+static uint32_t historyNow()
+{
+  return s_history_clock_base + millis() / 1000;
+}
+
+static uint32_t historyChecksum(const HistorySnapshot& snap)
+{
+  const uint8_t* p = (const uint8_t*)&snap;
+  uint32_t h = 2166136261u; // FNV-1a
+  for (size_t i = 0; i < offsetof(HistorySnapshot, check); ++i) h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+static const uint8_t* runningAppSha()
+{
+  return esp_ota_get_app_description()->app_elf_sha256;
+}
+
+static void checkpointHistoryToRtc()
+{
+  s_rtc_history.magic = HISTORY_MAGIC;
+  memcpy(s_rtc_history.app_sha, runningAppSha(), sizeof(s_rtc_history.app_sha));
+  s_rtc_history.clock_s = historyNow();
+  s_rtc_history.last_unix = s_history_last_unix;
+  s_rtc_history.last_clock = s_history_last_clock;
+  memcpy(s_rtc_history.cpu, &s_cpu_hist, sizeof(MetricSeries));
+  memcpy(s_rtc_history.ram, &s_ram_hist, sizeof(MetricSeries));
+  memcpy(s_rtc_history.cpu_trend, &s_cpu_trend, sizeof(TrendEnvelope));
+  memcpy(s_rtc_history.ram_trend, &s_ram_trend, sizeof(TrendEnvelope));
+  s_rtc_history.check = historyChecksum(s_rtc_history);
+}
+
+static void pushHistory(uint8_t cpu, uint8_t ram, uint32_t clock_s)
+{
+  s_cpu_hist.push(MetricSeries::Codec::decode(cpu), clock_s);
+  s_ram_hist.push(MetricSeries::Codec::decode(ram), clock_s);
+  s_cpu_trend.add(cpu, clock_s);
+  s_ram_trend.add(ram, clock_s);
+}
+
+// Replay one log file; returns the clock of its last record (0 if none)
+static uint32_t replayHistoryLog(const char* path)
+{
+  File f = SPIFFS.open(path, "r");
+  if (!f) return 0;
+  HistoryRecord rec[HISTORY_LOG_BATCH];
+  uint32_t last = 0;
+  size_t n;
+  while ((n = f.read((uint8_t*)rec, sizeof(rec))) >= sizeof(HistoryRecord)) {
+    for (size_t i = 0; i < n / sizeof(HistoryRecord); ++i) {
+      pushHistory(rec[i].cpu, rec[i].ram, rec[i].clock_s);
+      last = rec[i].clock_s;
+      if (rec[i].unix_s) {
+        s_history_last_unix = rec[i].unix_s;
+        s_history_last_clock = rec[i].clock_s;
+      }
+    }
+    if (n < sizeof(rec)) break;
+  }
+  f.close();
+  return last;
+}
+
+static uint32_t firstHistoryClock(const char* path)
+{
+  File f = SPIFFS.open(path, "r");
+  if (!f) return 0;
+  HistoryRecord rec;
+  bool ok = f.read((uint8_t*)&rec, sizeof(rec)) == sizeof(rec);
+  f.close();
+  return ok ? rec.clock_s : 0;
+}
+
+// Bring back the charts before the first sample arrives. Called from setup()
+// once SPIFFS is mounted.
+static void restoreHistory()
+{
+  if (s_rtc_history.magic == HISTORY_MAGIC && s_rtc_history.check == historyChecksum(s_rtc_history) &&
+      memcmp(s_rtc_history.app_sha, runningAppSha(), sizeof(s_rtc_history.app_sha)) == 0) {
+    memcpy(&s_cpu_hist, s_rtc_history.cpu, sizeof(MetricSeries));
+    memcpy(&s_ram_hist, s_rtc_history.ram, sizeof(MetricSeries));
+    memcpy(&s_cpu_trend, s_rtc_history.cpu_trend, sizeof(TrendEnvelope));
+    memcpy(&s_ram_trend, s_rtc_history.ram_trend, sizeof(TrendEnvelope));
+    s_history_clock_base = s_rtc_history.clock_s + 1;
+    s_history_last_unix = s_rtc_history.last_unix;
+    s_history_last_clock = s_rtc_history.last_clock;
+    Serial.printf("History restored from RTC memory (%u samples)\n", (unsigned)s_cpu_hist.raw().size());
+  } else {
+    // Older file first; the newer one is where appends continue
+    uint32_t first0 = firstHistoryClock(HISTORY_LOG_FILES[0]);
+    uint32_t first1 = firstHistoryClock(HISTORY_LOG_FILES[1]);
+    s_history_log_file = first1 > first0 ? 1 : 0;
+    replayHistoryLog(HISTORY_LOG_FILES[1 - s_history_log_file]);
+    uint32_t last = replayHistoryLog(HISTORY_LOG_FILES[s_history_log_file]);
+    if (last) s_history_clock_base = last + 1;
+    if (!s_cpu_hist.raw().empty()) Serial.printf("History replayed from SPIFFS (%u samples)\n", (unsigned)s_cpu_hist.raw().size());
+  }
+  s_sample_seq = s_cpu_hist.raw().total();
+  // The network task isn't running yet; backfill picks up from here
+  s_net_last_unix = s_history_last_unix;
+}
+
+static void flushHistoryLog()
+{
+  if (s_history_batch_len == 0) return;
+  const char* path = HISTORY_LOG_FILES[s_history_log_file];
+  File f = SPIFFS.open(path, "a");
+  if (f && f.size() >= HISTORY_LOG_FILE_MAX) {
+    // This file is full: continue in the other one, dropping what it held
+    f.close();
+    s_history_log_file ^= 1;
+    path = HISTORY_LOG_FILES[s_history_log_file];
+    f = SPIFFS.open(path, "w");
+  }
+  if (f) {
+    f.write((const uint8_t*)s_history_batch, s_history_batch_len * sizeof(HistoryRecord));
+    f.close();
+  } else {
+    Serial.printf("History log %s not writable\n", path);
+  }
+  s_history_batch_len = 0;
+}
+
+// Place a sample on the history clock. Samples with server time are spaced
+// by it, so backfilled ones land where they were taken and a gap the device
+// was down for still shows as one (the clock moves forward to match).
+// Returns false for backfill the history already has.
+static bool historyClockFor(const MetricsSample& sample, uint32_t& clock_s)
+{
+  uint32_t now_s = historyNow();
+  clock_s = now_s;
+  if (sample.unix_s == 0) return true;
+  if (s_history_last_unix) {
+    int32_t delta = (int32_t)(sample.unix_s - s_history_last_unix);
+    if (delta <= 0 && sample.backfill) return false;
+    if (delta > 0 && (uint32_t)delta <= HISTORY_MAX_GAP_S) {
+      clock_s = s_history_last_clock + (uint32_t)delta;
+      if (clock_s > now_s) s_history_clock_base += clock_s - now_s;
+    }
+  }
+  s_history_last_unix = sample.unix_s;
+  s_history_last_clock = clock_s;
+  return true;
+}
+
+// Runs on the loop task: fold a sample into the chart history.
+static void applySample(const MetricsSample& sample)
+{
+  uint32_t clock_s;
+  if (!historyClockFor(sample, clock_s)) return;
+  uint8_t cpu = MetricSeries::Codec::encode(sample.cpu_pct);
+  uint8_t ram = MetricSeries::Codec::encode(sample.ram_pct);
+  pushHistory(cpu, ram, clock_s);
+  s_history_batch[s_history_batch_len++] = { clock_s, sample.unix_s, cpu, ram };
+  if (s_history_batch_len == HISTORY_LOG_BATCH) flushHistoryLog();
+  ++s_sample_seq;
+  if (sample.backfill) return; // chart data only; the live sample follows
+  recordFleetReading(s_fleet[0], sample.cpu_pct, sample.ram_pct);
+  s_disk_used_pct = sample.disk_pct;
+  s_uptime_seconds = sample.uptime_s;
+  s_last_uptime_tick = millis();
+  if (sample.unix_s) {
+    s_server_unix = sample.unix_s;
+    s_server_unix_at = millis();
+  }
+  int32_t offset;
+  if (utcOffsetFromSample(sample, offset)) s_utc_offset_s = offset;
+}
+
+// Drain everything the network task produced and redraw once.
+static void processSamples()
+{
+  MetricsSample sample;
+  bool updated = false;
+  while (s_sample_queue.pop(sample)) {
+    applySample(sample);
+    if (s_ota_trial && !sample.backfill) confirmOtaTrial();
+    updated = true;
+  }
+  if (!updated) return;
+  checkpointHistoryToRtc();
+  if (s_showing_success || s_showing_pair) return;
+  refreshWidgets();
+}
+
+// Readings from the fleet task, for the overview rows
+static void processFleetSamples()
 {
-  // Show a big clock and mini charts
-  lcd.fillScreen(0xFFFFu);
-  // Derive HH:MM:SS from last ISO timestamp
-  String hhmmss = "--:--:--";
-  int tpos = s_last_timestamp_iso.indexOf('T');
-  if (tpos >= 0 && s_last_timestamp_iso.length() >= tpos + 9) {
-    hhmmss = s_last_timestamp_iso.substring(tpos + 1, tpos + 9);
-  }
-  lcd.setTextColor(0x0000u); lcd.setTextSize(4);
-  int16_t tw = lcd.textWidth(hhmmss);
-  int cx = (lcd.width() - tw) / 2; int cy = 24;
-  lcd.setCursor(cx, cy); lcd.print(hhmmss);
-  drawUptimeTopRight();
-  // Mini charts below
-  int margin = 8; int x = margin; int w = lcd.width() - 2 * margin; int h = 48; int y = 70;
-  drawLineChartArea(x, y, w, h, s_cpu_hist, HIST_SIZE, s_hist_idx, s_hist_full, 0x001Fu, "CPU");
-  y += h + 8;
-  drawLineChartArea(x, y, w, h, s_ram_hist, HIST_SIZE, s_hist_idx, s_hist_full, 0x07E0u, "RAM");
-}
-
-static void updateStatsFromServer()
-{
-  if (s_saved_ip.length() == 0 || s_saved_port.length() == 0 || s_saved_auth.length() == 0) return;
-  String url = "http://" + s_saved_ip + ":" + s_saved_port + "/metrics";
-  HTTPClient http;
-  http.begin(url);
-  http.addHeader("Authorization", "Bearer " + s_saved_auth);
-  int httpCode = http.GET();
-  if (httpCode == 200) {
-    String payload = http.getString();
-    StaticJsonDocument<1536> doc;
-    DeserializationError err = deserializeJson(doc, payload);
-    if (!err) {
-      // Update histories
-      float cpu_pct = doc["cpu"].as<float>();
-      float ram_pct = doc["memory"]["percentage"].as<float>();
-      float disk_pct = doc["disk"]["percentage"].as<float>();
-      s_cpu_hist[s_hist_idx] = cpu_pct;
-      s_ram_hist[s_hist_idx] = ram_pct;
-      s_disk_used_pct = disk_pct;
-      s_hist_idx = (s_hist_idx + 1) % HIST_SIZE;
-      if (s_hist_idx == 0) s_hist_full = true;
-      // Uptime and timestamp
-      s_uptime_seconds = doc["uptime"]["uptime_seconds"].as<uint32_t>();
-      s_last_timestamp_iso = doc["timestamp"].as<const char*>();
-      // Redraw current layout areas
-      if (s_layout == LAYOUT_CHARTS) renderChartsLayout();
-      else if (s_layout == LAYOUT_CLOCK) renderClockLayout();
-    }
-  }
-  http.end();
+  syncFleetHosts();
+  FleetSample fs;
+  bool updated = false;
+  while (s_fleet_queue.pop(fs)) {
+    if (fs.gen != (uint8_t)s_fleet_gen || fs.host >= s_fleet_hosts) continue; // polled before a config change
+    recordFleetReading(s_fleet[fs.host], fs.cpu_pct, fs.ram_pct);
+    updated = true;
+  }
+  if (!updated || s_showing_success || s_showing_pair) return;
+  refreshWidgets();
 }
+
 static void displayPairingResult(bool success, const String& msg)
 {
   lcd.fillScreen(0xFFFFu); // White background
@@ -191,384 +2166,1050 @@ static void displayPairingResult(bool success, const String& msg)
   y += 60;
   lcd.setCursor(x, y);
   lcd.print(msg);
-  delay(2000);
 }
 
-static bool pairWithSentinelServer()
+// Kick off the pairing check; the result screen follows once the network
+// task has tried the server (see serviceScreens())
+static void startPairing()
 {
   if (s_saved_ip.length() == 0 || s_saved_port.length() == 0 || s_saved_auth.length() == 0) {
     displayPairingResult(false, "Missing config");
-    return false;
+    s_showing_pair = true;
+    s_pair_shown_at = millis();
+    return;
   }
-  String url = "http://" + s_saved_ip + ":" + s_saved_port + "/metrics";
-  HTTPClient http;
-  http.begin(url);
-  http.addHeader("Authorization", "Bearer " + s_saved_auth);
-  int httpCode = http.GET();
-  if (httpCode == 200) {
-    displayPairingResult(true, "Server OK");
-    http.end();
-    return true;
+  s_pair_state = PAIR_PENDING;
+  if (s_net_task) xTaskNotifyGive(s_net_task);
+}
+
+// Boot image: pre-scaled to the panel at build time and RLE-packed RGB565,
+// expanded into two small band buffers so one band decodes while the other
+// is clocked out over DMA
+static constexpr int BOOT_BAND_ROWS = 8;
+static constexpr int BOOT_BAND_W = 320; // panel width in setRotation(1)
+static_assert(LOGO_RGB565_WIDTH <= BOOT_BAND_W, "logo wider than the boot bands");
+static uint16_t s_boot_band[2][BOOT_BAND_W * BOOT_BAND_ROWS];
+
+// User-supplied boot image: /logo_png.png on SPIFFS, decoded with PNGdec into
+// the same band buffers. Images larger than the panel are decimated by an
+// integer step so any width PNGdec accepts fits on screen.
+static File s_png_file;
+
+static void *pngOpen(const char *name, int32_t *size)
+{
+  s_png_file = SPIFFS.open(name, "r");
+  if (!s_png_file) return nullptr;
+  *size = (int32_t)s_png_file.size();
+  return &s_png_file;
+}
+
+static void pngClose(void *handle)
+{
+  s_png_file.close();
+}
+
+static int32_t pngRead(PNGFILE *file, uint8_t *buf, int32_t len)
+{
+  return (int32_t)s_png_file.read(buf, (size_t)len);
+}
+
+static int32_t pngSeek(PNGFILE *file, int32_t pos)
+{
+  return s_png_file.seek((uint32_t)pos) ? pos : -1;
+}
+
+static bool drawSpiffsPng(const char *path)
+{
+  if (!SPIFFS.exists(path)) return false;
+  // PNGdec keeps its scanline and inflate buffers inline; keep them off the
+  // static footprint since they are only needed for this one decode
+  PNG *png = new (std::nothrow) PNG;
+  if (!png) return false;
+  bool ok = false;
+  int rc = png->open(path, pngOpen, pngClose, pngRead, pngSeek, drawPngBandLine<LGFX_CYD>);
+  if (rc == PNG_SUCCESS) {
+    PngBandSink<LGFX_CYD> s = {};
+    s.canvas = &lcd;
+    s.png = png;
+    s.bands[0] = s_boot_band[0];
+    s.bands[1] = s_boot_band[1];
+    s.band_rows = BOOT_BAND_ROWS;
+    s.band_w = BOOT_BAND_W;
+    int32_t w = png->getWidth();
+    int32_t h = png->getHeight();
+    if (pngBandLayout(s, w, h, lcd.width(), lcd.height())) {
+      if (s.step > 1) s.line = (uint16_t *)malloc((size_t)w * sizeof(uint16_t));
+      if (s.step == 1 || s.line) {
+        Serial.printf("PNGdec: %ldx%ld step=%d dst=%dx%d at (%ld,%ld)\n", (long)w, (long)h, s.step, s.dw, s.dh, (long)s.x, (long)s.y);
+        lcd.startWrite();
+        lcd.fillScreen(0x000000u);
+        int drc = png->decode(&s, 0);
+        flushPngBand(s);
+        lcd.endWrite();
+        ok = drc == PNG_SUCCESS;
+        if (!ok) Serial.printf("PNGdec decode rc=%d lastError=%d\n", drc, png->getLastError());
+      }
+      free(s.line);
+    }
+    png->close();
   } else {
-    String err = "HTTP: " + String(httpCode);
-    displayPairingResult(false, err);
-    http.end();
-    return false;
+    Serial.printf("PNGdec open %s failed: %d\n", path, rc);
   }
+  delete png;
+  return ok;
 }
-#include <Arduino.h>
-#include <LovyanGFX.hpp>
-#include "generated/logo_png.h"
-#include <PNGdec.h>
-#include <WiFi.h>
-#include <WebServer.h>
-#include <DNSServer.h>
-#include <SPIFFS.h>
-#include <ArduinoJson.h>
-#include <HTTPClient.h>
 
-// Use auto-detect config for Sunton CYD 2.8" (ESP32-2432S028)
-#include <LGFX_AUTODETECT.hpp>
+void drawBootImage()
+{
+  PerfScope timer(PERF_BOOT_IMAGE);
+  if (drawSpiffsPng("/logo_png.png")) return;
+  int32_t x = (lcd.width()  - LOGO_RGB565_WIDTH) / 2;
+  int32_t y = (lcd.height() - LOGO_RGB565_HEIGHT) / 2;
+  LogoRleCursor cur;
+  lcd.startWrite();
+  if (x > 0 || y > 0) lcd.fillScreen(0x000000u);
+  for (int row = 0, band = 0; row < LOGO_RGB565_HEIGHT; row += BOOT_BAND_ROWS, band ^= 1) {
+    int rows = LOGO_RGB565_HEIGHT - row;
+    if (rows > BOOT_BAND_ROWS) rows = BOOT_BAND_ROWS;
+    // The other band is still in flight; the bus serialises the next push behind it
+    decodeLogoRle(g_logo_rle, g_logo_rle_len, cur, s_boot_band[band], (size_t)LOGO_RGB565_WIDTH * rows);
+    lcd.pushImageDMA(x, y + row, LOGO_RGB565_WIDTH, rows, s_boot_band[band]);
+  }
+  lcd.endWrite();
+}
 
-static LGFX lcd;
-static PNG s_png;
-static int32_t s_png_x = 0;
-static int32_t s_png_y = 0;
+// Backend-neutral response: either a body, a gzip asset in flash or a redirect
+struct PortalReply {
+  int code = 200;
+  const char* type = "text/plain";
+  String body;
+  const uint8_t* gzip = nullptr;
+  size_t gzip_len = 0;
+  const char* location = nullptr;
+  bool no_cache = false;
+};
 
-// Captive portal globals
-static DNSServer s_dns;
-static WebServer s_http(80);
-static IPAddress s_apIP;
-static const byte DNS_PORT = 53;
+// Minimal captive portal: resolve all DNS to AP IP and serve the setup page.
+// The page is gzip-compressed into flash at build time (web/portal.html) and
+// sent as-is, so the OS probe URLs phones hammer cost no heap or formatting.
+static void portalRoot(PortalReply& r)
+{
+  r.type = "text/html; charset=UTF-8";
+  r.gzip = g_portal_html_gz;
+  r.gzip_len = g_portal_html_gz_len;
+  r.no_cache = true;
+}
 
-// Configuration storage
-static String s_saved_ssid = "";
-static String s_saved_password = "";
-static String s_saved_ip = "";
-static String s_saved_port = "";
-static String s_saved_auth = "";
-static bool s_config_complete = false;
-static bool s_wifi_connected = false;
-static unsigned long s_success_start_time = 0;
-static bool s_showing_success = false;
+// The only dynamic part of the portal: config and link state for the page
+static void portalStatus(PortalReply& r)
+{
+  JsonDocument doc;
+  doc["configured"] = s_config_complete;
+  doc["connected"] = (bool)s_wifi_connected;
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  doc["ssid"] = s_saved_ssid;
+  if (s_saved_ip.length() > 0 && s_saved_port.length() > 0) doc["server"] = s_saved_ip + ":" + s_saved_port;
+  doc["fleet"] = s_fleet_target_count;
+  xSemaphoreGive(s_config_mutex);
+  if (s_wifi_connected) doc["panel"] = WiFi.localIP().toString();
+  doc["firmware"] = esp_ota_get_running_partition()->label;
+  doc["firmware_trial"] = s_ota_trial;
+  serializeJson(doc, r.body);
+  r.type = "application/json";
+  r.no_cache = true;
+}
+
+// Timer percentiles (microseconds), panel traffic and heap health
+// 401 for the routes that need the server password
+static void portalUnauthorized(PortalReply& r)
+{
+  r.code = 401;
+  r.type = "application/json";
+  r.body = "{\"ok\":false,\"error\":\"unauthorized\"}";
+  r.no_cache = true;
+}
+
+static void portalPerf(PortalReply& r, bool authorized)
+{
+  if (!authorized) {
+    portalUnauthorized(r);
+    return;
+  }
+  JsonDocument doc;
+  doc["uptime_ms"] = millis();
+  doc["cpu_mhz"] = getCpuFrequencyMhz();
+  doc["overlay"] = s_perf_overlay.load();
+  JsonObject timers = doc["timers"].to<JsonObject>();
+  for (int i = 0; i < PERF_COUNT; ++i) {
+    const PerfWindow<PERF_WINDOW>& p = s_perf[i];
+    JsonObject t = timers[PERF_NAMES[i]].to<JsonObject>();
+    t["count"] = p.count();
+    t["last"] = p.last();
+    t["p50"] = p.percentile(50);
+    t["p99"] = p.percentile(99);
+    t["max"] = p.max();
+    t["allocs"] = s_perf_allocs[i];
+  }
+  JsonObject allocs = doc["allocs"].to<JsonObject>();
+  for (int i = 0; i < ALLOC_TASKS; ++i) allocs[ALLOC_TASK_NAMES[i]] = s_alloc[i].count;
+  allocs["steady"] = s_alloc_steady.load();
+  JsonObject spi = doc["spi"].to<JsonObject>();
+  spi["bytes"] = s_perf_spi_bytes.load();
+  spi["pushes"] = s_perf_spi_pushes.load();
+  JsonObject heap = doc["heap"].to<JsonObject>();
+  heap["free"] = ESP.getFreeHeap();
+  heap["largest_block"] = ESP.getMaxAllocHeap();
+  heap["min_free"] = ESP.getMinFreeHeap();
+  heap["frag_pct"] = heapFragmentation();
+  heap["worst_frag_pct"] = s_perf_frag_worst;
+  JsonArray frag = heap["frag_history"].to<JsonArray>(); // oldest first
+  for (size_t age = s_perf_frag.size(); age-- > 0;) frag.add(s_perf_frag.fromNewest(age));
+  serializeJson(doc, r.body);
+  r.type = "application/json";
+  r.no_cache = true;
+}
+
+// Flip the on-screen perf overlay
+static void portalPerfOverlay(PortalReply& r, bool authorized)
+{
+  if (!authorized) {
+    portalUnauthorized(r);
+    return;
+  }
+  bool on = !s_perf_overlay.load();
+  s_perf_overlay = on;
+  s_portal_actions.fetch_or(PORTAL_REDRAW);
+  wakeLoop();
+  r.type = "application/json";
+  r.body = on ? "{\"overlay\":true}" : "{\"overlay\":false}";
+  r.no_cache = true;
+}
+
+static bool parseSha256(const char* hex, uint8_t out[32])
+{
+  if (!hex || strlen(hex) != 64) return false;
+  for (int i = 0; i < 32; ++i) {
+    char byte[3] = { hex[2 * i], hex[2 * i + 1], 0 };
+    char* end;
+    out[i] = (uint8_t)strtoul(byte, &end, 16);
+    if (*end) return false;
+  }
+  return true;
+}
+
+// Firmware uploads and the debug routes need the configured server password
+// as a Bearer token and are refused over the portal AP, which is open.
+// Uploads are rejected before Update.begin(), so nothing is written.
+static bool tokenAuthorized(const char* authorization, const IPAddress& local)
+{
+  if (s_ap_active && local == s_apIP) return false;
+  static const char BEARER[] = "Bearer ";
+  if (!authorization || strncmp(authorization, BEARER, sizeof(BEARER) - 1) != 0) return false;
+  const char* token = authorization + sizeof(BEARER) - 1;
+  size_t len = strlen(token);
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  const char* expected = s_saved_auth.c_str();
+  size_t expected_len = s_saved_auth.length();
+  // Constant time over the expected length
+  uint8_t diff = len != expected_len || expected_len == 0;
+  for (size_t i = 0; i < expected_len; ++i) diff |= (uint8_t)(expected[i] ^ (i < len ? token[i] : 0));
+  xSemaphoreGive(s_config_mutex);
+  return diff == 0;
+}
+
+// Callers hold s_ota_mutex
+static void otaAbortLocked(const char* error)
+{
+  if (!s_ota.error) s_ota.error = error;
+  if (!s_ota.active) return;
+  Update.abort();
+  mbedtls_sha256_free(&s_ota.sha);
+  s_ota.active = false;
+}
+
+// Upload callbacks (both backends): start, a chunk, abort, finish as a
+// reply. `owner` is the request, so chunks of a refused upload are dropped.
+static void otaStart(const void* owner, const char* sha256_hex, bool authorized)
+{
+  xSemaphoreTake(s_ota_mutex, portMAX_DELAY);
+  if (s_ota.active && s_ota.owner != owner && millis() - s_ota.touched_at < OTA_STALL_MS) {
+    xSemaphoreGive(s_ota_mutex);
+    return; // refused in portalUpdate()
+  }
+  otaAbortLocked(nullptr); // an earlier upload that never finished
+  s_ota.owner = owner;
+  s_ota.error = nullptr;
+  s_ota.written = 0;
+  s_ota.touched_at = millis();
+  if (!authorized) {
+    s_ota.error = "unauthorized";
+  } else if (!parseSha256(sha256_hex, s_ota.expected)) {
+    s_ota.error = "sha256 query parameter (64 hex digits) required";
+  } else if (!Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH)) { // the slot we're not running from; buffers one 4 KB sector
+    s_ota.error = Update.errorString();
+  } else {
+    mbedtls_sha256_init(&s_ota.sha);
+    mbedtls_sha256_starts_ret(&s_ota.sha, 0);
+    s_ota.active = true;
+  }
+  bool active = s_ota.active;
+  xSemaphoreGive(s_ota_mutex);
+  const esp_partition_t* next = esp_ota_get_next_update_partition(nullptr);
+  if (active) Serial.printf("OTA: writing %s\n", next ? next->label : "?");
+}
+
+static void otaWrite(const void* owner, const uint8_t* data, size_t len)
+{
+  if (len == 0) return;
+  xSemaphoreTake(s_ota_mutex, portMAX_DELAY);
+  if (s_ota.active && s_ota.owner == owner) {
+    mbedtls_sha256_update_ret(&s_ota.sha, data, len);
+    if (Update.write(const_cast<uint8_t*>(data), len) != len) otaAbortLocked(Update.errorString());
+    else s_ota.written += len;
+    s_ota.touched_at = millis();
+  }
+  xSemaphoreGive(s_ota_mutex);
+}
+
+static void otaAbort(const void* owner, const char* error)
+{
+  xSemaphoreTake(s_ota_mutex, portMAX_DELAY);
+  if (s_ota.owner == owner) otaAbortLocked(error);
+  xSemaphoreGive(s_ota_mutex);
+}
+
+static void portalUpdate(PortalReply& r, bool authorized, const void* owner)
+{
+  r.type = "application/json";
+  r.no_cache = true;
+  xSemaphoreTake(s_ota_mutex, portMAX_DELAY);
+  if (!authorized) {
+    if (s_ota.owner == owner) {
+      otaAbortLocked(nullptr);
+      s_ota.error = nullptr;
+    }
+    xSemaphoreGive(s_ota_mutex);
+    Serial.println("OTA: rejected an unauthorized upload");
+    portalUnauthorized(r);
+    return;
+  }
+  if (s_ota.owner != owner) {
+    bool busy = s_ota.active;
+    xSemaphoreGive(s_ota_mutex);
+    r.code = busy ? 409 : 400;
+    r.body = busy ? "{\"ok\":false,\"error\":\"another upload is in progress\"}"
+                  : "{\"ok\":false,\"error\":\"no firmware in the request\"}";
+    return;
+  }
+  if (s_ota.active) {
+    uint8_t digest[32];
+    mbedtls_sha256_finish_ret(&s_ota.sha, digest);
+    if (memcmp(digest, s_ota.expected, sizeof(digest)) != 0) {
+      otaAbortLocked("sha256 mismatch");
+    } else if (!Update.end(true)) { // checks the image and sets it as the boot slot
+      s_ota.error = Update.errorString();
+      mbedtls_sha256_free(&s_ota.sha);
+      s_ota.active = false;
+    }
+  } else if (!s_ota.error) {
+    s_ota.error = "no firmware in the request";
+  }
+  if (!s_ota.active) {
+    const char* error = s_ota.error;
+    s_ota.error = nullptr;
+    xSemaphoreGive(s_ota_mutex);
+    Serial.printf("OTA: failed: %s\n", error);
+    r.code = 400;
+    JsonDocument doc;
+    doc["ok"] = false;
+    doc["error"] = error;
+    serializeJson(doc, r.body);
+    return;
+  }
+  mbedtls_sha256_free(&s_ota.sha);
+  s_ota.active = false;
+  size_t written = s_ota.written;
+  xSemaphoreGive(s_ota_mutex);
+  // Both slots for the trial boot; see checkOtaTrial()
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  const esp_partition_t* next = esp_ota_get_boot_partition();
+  Preferences prefs;
+  if (prefs.begin(PREFS_OTA, false)) {
+    prefs.putString("new", next->label);
+    prefs.putString("prev", running->label);
+    prefs.end();
+  }
+  Serial.printf("OTA: %u bytes verified, booting %s\n", (unsigned)written, next->label);
+  r.body = "{\"ok\":true,\"rebooting\":true}";
+  s_portal_actions.fetch_or(PORTAL_REBOOT);
+  wakeLoop();
+}
+
+static void clearOtaTrial()
+{
+  Preferences prefs;
+  if (prefs.begin(PREFS_OTA, false)) {
+    prefs.clear();
+    prefs.end();
+  }
+}
+
+// Arduino marks a freshly updated app valid at startup unless this says
+// otherwise; with bootloader rollback enabled that waits for confirmOtaTrial()
+extern "C" bool verifyRollbackLater()
+{
+  return true;
+}
+
+// Called early in setup(): start the trial of a just-installed firmware,
+// or clean up after one that didn't make it
+static void checkOtaTrial()
+{
+  Preferences prefs;
+  char fresh[17] = "", prev[17] = "";
+  if (prefs.begin(PREFS_OTA, true)) {
+    prefs.getString("new", fresh, sizeof(fresh));
+    prefs.getString("prev", prev, sizeof(prev));
+    prefs.end();
+  }
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  if (!fresh[0]) {
+    esp_ota_mark_app_valid_cancel_rollback();
+    return;
+  }
+  if (strcmp(fresh, running->label) != 0) {
+    Serial.printf("OTA: %s was not confirmed, running %s again\n", fresh, running->label);
+    clearOtaTrial();
+    esp_ota_mark_app_valid_cancel_rollback();
+    return;
+  }
+  // Nothing to poll: no way to judge the new firmware, so keep it
+  const esp_partition_t* old = esp_partition_find_first(ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_ANY, prev);
+  if (s_poll_target.request_bin_len == 0 || !old || esp_ota_set_boot_partition(old) != ESP_OK) {
+    Serial.printf("OTA: keeping %s without a trial\n", fresh);
+    clearOtaTrial();
+    esp_ota_mark_app_valid_cancel_rollback();
+    return;
+  }
+  s_ota_trial = true;
+  Serial.printf("OTA: trial boot of %s, %s until the first sample\n", fresh, prev);
+}
+
+// First live sample on the new firmware: make it the boot slot for good
+static void confirmOtaTrial()
+{
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  if (esp_ota_set_boot_partition(running) != ESP_OK) {
+    Serial.println("OTA: could not confirm the new firmware"); // retried on the next sample
+    return;
+  }
+  s_ota_trial = false;
+  esp_ota_mark_app_valid_cancel_rollback();
+  clearOtaTrial();
+  Serial.printf("OTA: %s confirmed\n", running->label);
+}
 
-// Forward declarations
-static void connectToWiFi();
-static void displayWiFiSuccess();
-static void displayMainScreen();
+// The new firmware never got a sample: restart into the old one
+static void serviceOtaTrial()
+{
+  if (!s_ota_trial) return;
+  uint32_t now = millis();
+  if (s_ota_trial_from ? now - s_ota_trial_from < OTA_TRIAL_MS : now < OTA_TRIAL_JOIN_MS) return;
+  Serial.println(s_ota_trial_from ? "OTA: no sample from the new firmware, rolling back"
+                                  : "OTA: new firmware never got an IP, rolling back");
+  ESP.restart();
+}
 
-static int drawPNGLine(PNGDRAW *pDraw)
+// Wi-Fi scan cache for /scan. Scans run asynchronously (started with the
+// portal and again when a request finds the cache stale); results are
+// deduplicated by SSID hash keeping the strongest BSS, and kept sorted by
+// signal so /scan only has to format them.
+struct ScanEntry {
+  uint32_t hash;
+  char ssid[33];
+  int8_t rssi;
+  bool open;
+};
+static const int SCAN_MAX = 24;
+static const uint32_t SCAN_STALE_MS = 30000;
+static ScanEntry s_scan[SCAN_MAX];
+static int s_scan_count = 0;
+static bool s_scan_valid = false;
+static bool s_scan_running = false;
+static uint32_t s_scan_at = 0;
+
+static uint32_t hashSsid(const char* ssid)
 {
-  // Scale-aware line width from PNGdec
-  int w = pDraw->iWidth; // already scaled width
-  static uint16_t line[480]; // supports up to 480 px wide lines
-  if (w > (int)sizeof(line)/sizeof(line[0])) w = (int)sizeof(line)/sizeof(line[0]);
-  // Use BIG_ENDIAN to match LovyanGFX's RGB565 color order (fixes swapped colors)
-  s_png.getLineAsRGB565(pDraw, line, PNG_RGB565_BIG_ENDIAN, 0x0000);
-  lcd.pushImage(s_png_x, s_png_y + pDraw->y, w, 1, line);
-  return 1;
+  uint32_t h = 2166136261u; // FNV-1a
+  for (; *ssid; ++ssid) h = (h ^ (uint8_t)*ssid) * 16777619u;
+  return h;
 }
 
-void drawBootImage()
+static void startWiFiScan()
 {
-  Serial.printf("Embedded PNG size: %u bytes\n", (unsigned)g_logo_png_len);
-  // Always use PNGdec fallback to avoid driver PNG/rotation quirks
-  int rc = s_png.openRAM((uint8_t*)g_logo_png, (uint32_t)g_logo_png_len, drawPNGLine);
-  if (rc == PNG_SUCCESS) {
-    int32_t w = s_png.getWidth();
-    int32_t h = s_png.getHeight();
-    // Compute downscale to fit screen (power-of-two scaling)
-    int scale = 0;
-    while ((w >> scale) > lcd.width() || (h >> scale) > lcd.height()) {
-      ++scale;
-      if (scale > 4) break; // limit PNGdec scale range
-    }
-    // Centered position
-    int32_t dw = (w >> scale);
-    int32_t dh = (h >> scale);
-    s_png_x = (lcd.width()  - dw) / 2;
-    s_png_y = (lcd.height() - dh) / 2;
-    Serial.printf("PNGdec: %ldx%ld scale=%d dst=%ldx%ld at (%ld,%ld)\n", (long)w, (long)h, scale, (long)dw, (long)dh, (long)s_png_x, (long)s_png_y);
-    lcd.startWrite();
-    lcd.fillScreen(0x000000u);
-    int drc = s_png.decode(NULL, scale);
-    lcd.endWrite();
-    Serial.printf("PNGdec decode rc=%d lastError=%d\n", drc, s_png.getLastError());
-    s_png.close();
+  if (s_scan_running) return;
+  s_scan_running = WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING;
+}
+
+static void addScanResult(const char* ssid, int32_t rssi, bool open)
+{
+  uint32_t h = hashSsid(ssid);
+  int i = 0;
+  while (i < s_scan_count && !(s_scan[i].hash == h && strcmp(s_scan[i].ssid, ssid) == 0)) ++i;
+  if (i < s_scan_count) {
+    if (rssi <= s_scan[i].rssi) return;
+  } else if (s_scan_count < SCAN_MAX) {
+    i = s_scan_count++;
   } else {
-    Serial.printf("PNGdec openFLASH failed: %d\n", rc);
+    // Full: replace the weakest entry (last, the array is sorted) if stronger
+    i = SCAN_MAX - 1;
+    if (rssi <= s_scan[i].rssi) return;
+  }
+  s_scan[i].hash = h;
+  strlcpy(s_scan[i].ssid, ssid, sizeof(s_scan[i].ssid));
+  s_scan[i].rssi = (int8_t)rssi;
+  s_scan[i].open = open;
+  // Restore descending RSSI order; the entry only ever got stronger
+  while (i > 0 && s_scan[i - 1].rssi < s_scan[i].rssi) {
+    ScanEntry t = s_scan[i - 1];
+    s_scan[i - 1] = s_scan[i];
+    s_scan[i] = t;
+    --i;
   }
 }
 
-// Minimal captive portal: resolve all DNS to AP IP and serve a trivial page
-static void handleRoot()
+// Collect a finished scan; called from loop()
+static void serviceWiFiScan()
 {
-  String html = "<!doctype html><html><head><meta name=\"viewport\" content=\"width=device-width,initial-scale=1\">";
-  html += "<title>Sentinel Setup</title>";
-  html += "<style>body{font-family:Arial,sans-serif;margin:20px;background:#f0f0f0}";
-  html += ".container{background:white;padding:20px;border-radius:8px;max-width:500px;margin:0 auto}";
-  html += ".network{background:#f8f8f8;padding:10px;margin:5px 0;border-radius:4px;cursor:pointer;border:1px solid #ddd}";
-  html += ".network:hover{background:#e8e8e8}";
-  html += "input,button{width:100%;padding:8px;margin:5px 0;border:1px solid #ccc;border-radius:4px}";
-  html += "button{background:#007bff;color:white;cursor:pointer}button:hover{background:#0056b3}";
-  html += ".form{display:none;margin-top:20px;padding:15px;background:#f9f9f9;border-radius:4px}";
-  html += ".password-toggle{margin:5px 0;font-size:14px}";
-  html += ".password-toggle input{width:auto;margin-right:5px}</style></head><body>";
-  html += "<div class=\"container\"><h1>Sentinel Configuration</h1>";
-  
-  if (s_config_complete) {
-    html += "<p>✅ Configuration saved successfully!</p>";
-    html += "<p><strong>WiFi:</strong> " + s_saved_ssid;
-    if (s_wifi_connected) {
-      html += " (Connected ✅)<br>";
-      html += "<strong>Panel URL:</strong> http://" + WiFi.localIP().toString() + "</p>";
-    } else if (s_saved_ssid.length() > 0) {
-      html += " (Not connected ❌)</p>";
-    } else {
-      html += "</p>";
-    }
-    if (s_saved_ip.length() > 0 && s_saved_port.length() > 0) {
-      html += "<p><strong>Server:</strong> " + s_saved_ip + ":" + s_saved_port + "</p>";
-    } else {
-      html += "<p><strong>Server:</strong> Not configured</p>";
-    }
-    html += "<button onclick=\"location.href='/reset'\">Reset Configuration</button>";
-  } else {
-    html += "<h2>Available WiFi Networks</h2>";
-    html += "<div id=\"networks\">Scanning...</div>";
-    html += "<div id=\"configForm\" class=\"form\">";
-    html += "<h3>WiFi Configuration</h3>";
-    html += "<input type=\"hidden\" id=\"selectedSSID\">";
-    html += "<p><strong>Network:</strong> <span id=\"networkName\"></span></p>";
-    html += "<input type=\"password\" id=\"wifiPass\" placeholder=\"WiFi Password\">";
-    html += "<div class=\"password-toggle\">";
-    html += "<input type=\"checkbox\" id=\"showPassword\" onchange=\"togglePasswordVisibility()\"> ";
-    html += "<label for=\"showPassword\">Show password</label>";
-    html += "</div>";
-    html += "<h3>Server Configuration</h3>";
-    html += "<input type=\"text\" id=\"serverIP\" placeholder=\"Server IP Address\">";
-    html += "<input type=\"number\" id=\"serverPort\" placeholder=\"Port\">";
-    html += "<input type=\"password\" id=\"serverAuth\" placeholder=\"Server Password\">";
-    html += "<button onclick=\"saveConfig()\">Save Configuration</button>";
-    html += "</div></div>";
-    
-    html += "<script>";
-    html += "function togglePasswordVisibility() {";
-    html += "  const field = document.getElementById('wifiPass');";
-    html += "  const checkbox = document.getElementById('showPassword');";
-    html += "  field.type = checkbox.checked ? 'text' : 'password';";
-    html += "}";
-    html += "function selectNetwork(ssid) {";
-    html += "  document.getElementById('selectedSSID').value = ssid;";
-    html += "  document.getElementById('networkName').textContent = ssid;";
-    html += "  document.getElementById('configForm').style.display = 'block';";
-    html += "}";
-    html += "function saveConfig() {";
-    html += "  const data = {";
-    html += "    ssid: document.getElementById('selectedSSID').value,";
-    html += "    password: document.getElementById('wifiPass').value,";
-    html += "    ip: document.getElementById('serverIP').value,";
-    html += "    port: document.getElementById('serverPort').value,";
-    html += "    auth: document.getElementById('serverAuth').value";
-    html += "  };";
-    html += "  fetch('/save', {method: 'POST', headers: {'Content-Type': 'application/json'}, body: JSON.stringify(data)})";
-    html += "    .then(response => response.text())";
-    html += "    .then(data => { alert('Configuration saved!'); location.reload(); });";
-    html += "}";
-    html += "setTimeout(() => { fetch('/scan').then(r => r.text()).then(data => document.getElementById('networks').innerHTML = data); }, 1000);";
-    html += "</script>";
+  if (!s_scan_running) return;
+  int16_t n = WiFi.scanComplete();
+  if (n == WIFI_SCAN_RUNNING) return;
+  s_scan_running = false;
+  if (n < 0) return; // failed; the next /scan retries
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  s_scan_count = 0;
+  for (int i = 0; i < n; ++i) {
+    String ssid = WiFi.SSID(i);
+    if (ssid.length() == 0) continue; // hidden network
+    addScanResult(ssid.c_str(), WiFi.RSSI(i), WiFi.encryptionType(i) == WIFI_AUTH_OPEN);
   }
-  
-  html += "</body></html>";
-  s_http.send(200, "text/html; charset=UTF-8", html);
+  s_scan_valid = true;
+  s_scan_at = millis();
+  xSemaphoreGive(s_config_mutex);
+  WiFi.scanDelete();
+  Serial.printf("WiFi scan: %d networks, %d listed\n", (int)n, s_scan_count);
 }
 
-static void handleScan() 
+static void appendHtmlEscaped(String& out, const char* text)
 {
-  Serial.println("Scanning for WiFi networks...");
-  int n = WiFi.scanNetworks();
-  String html = "";
-  
-  if (n == 0) {
-    html = "<p>No networks found</p>";
-  } else {
-    // Use a set to track unique SSIDs and avoid duplicates
-    String seenNetworks[32]; // Max 32 unique networks
-    int uniqueCount = 0;
-    
-    for (int i = 0; i < n && uniqueCount < 32; ++i) {
-      String ssid = WiFi.SSID(i);
-      
-      // Skip empty SSIDs
-      if (ssid.length() == 0) continue;
-      
-      // Check if we've already seen this SSID
-      bool isDuplicate = false;
-      for (int j = 0; j < uniqueCount; j++) {
-        if (seenNetworks[j] == ssid) {
-          isDuplicate = true;
-          break;
-        }
-      }
-      
-      // Only add if it's not a duplicate
-      if (!isDuplicate) {
-        seenNetworks[uniqueCount++] = ssid;
-        
-        int rssi = WiFi.RSSI(i);
-        String security = (WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? "Open" : "Secured";
-        
-        html += "<div class=\"network\" onclick=\"selectNetwork('" + ssid + "')\">";
-        html += "<strong>" + ssid + "</strong><br>";
-        html += "Signal: " + String(rssi) + " dBm | " + security;
-        html += "</div>";
-      }
+  for (; *text; ++text) {
+    switch (*text) {
+    case '&': out += "&amp;"; break;
+    case '<': out += "&lt;"; break;
+    case '>': out += "&gt;"; break;
+    case '"': out += "&quot;"; break;
+    case '\'': out += "&#39;"; break;
+    default: out += *text; break;
     }
   }
-  
-  s_http.send(200, "text/html", html);
 }
 
-static void handleSave()
+static void portalScan(PortalReply& r)
 {
-  if (s_http.method() != HTTP_POST) {
-    s_http.send(405, "text/plain", "Method not allowed");
+  r.type = "text/html";
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  bool valid = s_scan_valid;
+  if (!valid || millis() - s_scan_at >= SCAN_STALE_MS) s_portal_actions.fetch_or(PORTAL_SCAN);
+  if (!valid) {
+    xSemaphoreGive(s_config_mutex);
+    // First scan still running; the page polls again on 202
+    r.code = 202;
+    r.body = "<p>Scanning...</p>";
+    return;
+  }
+
+  String& html = r.body;
+  html.reserve(s_scan_count * 160 + 32);
+  if (s_scan_count == 0) html = "<p>No networks found</p>";
+  for (int i = 0; i < s_scan_count; ++i) {
+    const ScanEntry& e = s_scan[i];
+    html += "<div class=\"network\" data-ssid=\"";
+    appendHtmlEscaped(html, e.ssid);
+    html += "\" onclick=\"selectNetwork(this.dataset.ssid)\"><strong>";
+    appendHtmlEscaped(html, e.ssid);
+    html += "</strong><br>Signal: ";
+    html += String((int)e.rssi);
+    html += e.open ? " dBm | Open</div>" : " dBm | Secured</div>";
+  }
+  xSemaphoreGive(s_config_mutex);
+}
+
+static void portalSaveTooLarge(PortalReply& r)
+{
+  r.code = 413;
+  r.body = "Configuration too large";
+}
+
+static void portalSave(const String& body, PortalReply& r)
+{
+  if (body.length() > SAVE_BODY_MAX) {
+    portalSaveTooLarge(r);
     return;
   }
-  
-  String body = s_http.arg("plain");
   JsonDocument doc;
   DeserializationError error = deserializeJson(doc, body);
   
   if (error) {
-    s_http.send(400, "text/plain", "Invalid JSON");
+    r.code = 400;
+    r.body = "Invalid JSON";
     return;
   }
   
-  s_saved_ssid = doc["ssid"].as<String>();
-  s_saved_password = doc["password"].as<String>();
+  String ssid = doc["ssid"].as<String>();
+  String password = doc["password"].as<String>();
+
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  // A different network invalidates the cached association
+  uint8_t actions = (ssid != s_saved_ssid || password != s_saved_password) ? PORTAL_FORGET_ASSOC : 0;
+  s_saved_ssid = ssid;
+  s_saved_password = password;
   s_saved_ip = doc["ip"].as<String>();
   s_saved_port = doc["port"].as<String>();
   s_saved_auth = doc["auth"].as<String>();
+  s_saved_servers = "";
+  if (doc["servers"].is<JsonArrayConst>() && doc["servers"].size() > 0) serializeJson(doc["servers"], s_saved_servers);
+  rebuildPollTargetLocked();
+  bool saved = saveConfig();
+  xSemaphoreGive(s_config_mutex);
   
-  // Save to SPIFFS
-  JsonDocument configDoc;
-  configDoc["ssid"] = s_saved_ssid;
-  configDoc["password"] = s_saved_password;
-  configDoc["ip"] = s_saved_ip;
-  configDoc["port"] = s_saved_port;
-  configDoc["auth"] = s_saved_auth;
-  
-  File configFile = SPIFFS.open("/config.json", "w");
-  if (configFile) {
-    serializeJson(configDoc, configFile);
-    configFile.close();
+  if (saved) {
     s_config_complete = true;
-    Serial.println("Configuration saved to SPIFFS");
-    Serial.printf("WiFi: %s | Server: %s:%s\n", s_saved_ssid.c_str(), s_saved_ip.c_str(), s_saved_port.c_str());
-    
-    // If WiFi credentials provided, attempt connection
-    if (s_saved_ssid.length() > 0 && s_saved_password.length() >= 0) {
-      connectToWiFi();
-    }
+    Serial.println("Configuration saved to NVS");
+    Serial.printf("WiFi: %s | Server: %s:%s\n", ssid.c_str(), doc["ip"].as<String>().c_str(), doc["port"].as<String>().c_str());
+    // Join in the background; the portal stays up until the link is
+    if (ssid.length() > 0) actions |= PORTAL_CONNECT;
   } else {
     Serial.println("Failed to save configuration");
+    r.code = 500;
   }
-  
-  s_http.send(200, "text/plain", "OK");
+  s_portal_actions.fetch_or(actions);
+  wakeLoop();
+  r.body = saved ? "OK" : "Failed to save configuration";
 }
 
-static void handleReset()
+static void portalReset(PortalReply& r)
 {
+  Preferences prefs;
+  prefs.begin(PREFS_CONFIG, false);
+  prefs.clear();
+  prefs.end();
   SPIFFS.remove("/config.json");
+  s_stats_active = false;
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
   s_saved_ssid = "";
   s_saved_password = "";
   s_saved_ip = "";
   s_saved_port = "";
   s_saved_auth = "";
+  s_saved_servers = "";
+  rebuildPollTargetLocked();
+  xSemaphoreGive(s_config_mutex);
   s_config_complete = false;
-  s_wifi_connected = false;
   Serial.println("Configuration reset");
-  
-  // Disconnect from WiFi and restart in AP mode
-  WiFi.disconnect();
-  WiFi.mode(WIFI_AP);
-  bool ap_ok = WiFi.softAP("Sentinel");
-  s_apIP = WiFi.softAPIP();
-  
-  // Restart DNS server for captive portal
-  s_dns.start(DNS_PORT, "*", s_apIP);
-  Serial.printf("Sentinel AP restarted at %s\n", s_apIP.toString().c_str());
-  
-  // Redraw boot image
-  drawBootImage();
-  
-  s_http.sendHeader("Location", "/");
-  s_http.send(302, "text/plain", "");
+  s_portal_actions.fetch_or(PORTAL_RESET | PORTAL_FORGET_ASSOC);
+  wakeLoop();
+  r.code = 302;
+  r.location = "/";
 }
 
-static void loadConfig()
+// Apply what the portal handlers asked for, on the loop task that owns the
+// Wi-Fi state machine and the display
+static void servicePortalActions()
 {
-  // SPIFFS is already mounted in setup(), so we don't need to mount again
-  
-  File configFile = SPIFFS.open("/config.json", "r");
-  if (!configFile) {
-    Serial.println("No saved configuration found");
-    return;
+  uint8_t actions = s_portal_actions.exchange(0);
+  if (!actions) return;
+  if (actions & PORTAL_FORGET_ASSOC) clearFastConnect();
+  if (actions & PORTAL_RESET) {
+    s_wifi_connected = false;
+    s_wifi_ever_connected = false;
+    s_showing_success = false;
+    s_showing_pair = false;
+    s_pair_state = PAIR_IDLE;
+    
+    // Disconnect from WiFi and restart in AP mode
+    s_link = LINK_OFF;
+    WiFi.disconnect();
+    s_ap_active = false;
+    startAccessPoint();
+    
+    // Redraw boot image
+    drawBootImage();
+  } else if (actions & PORTAL_CONNECT) {
+    s_wifi_ever_connected = false; // show success and pairing for the new network
+    s_link_backoff_ms = WIFI_BACKOFF_MIN_MS;
+    connectToWiFi();
+  }
+  if (actions & PORTAL_SCAN) startWiFiScan();
+  if ((actions & PORTAL_REDRAW) && s_stats_active && !s_showing_success && !s_showing_pair) renderLayout();
+  if (actions & PORTAL_REBOOT) {
+    delay(500); // let the reply go out
+    ESP.restart();
   }
+}
+
+static bool saveConfig()
+{
+  Preferences prefs;
+  if (!prefs.begin(PREFS_CONFIG, false)) return false;
+  bool ok = prefs.putString("ssid", s_saved_ssid) == s_saved_ssid.length();
+  prefs.putString("password", s_saved_password);
+  prefs.putString("ip", s_saved_ip);
+  prefs.putString("port", s_saved_port);
+  prefs.putString("auth", s_saved_auth);
+  prefs.putString("servers", s_saved_servers);
+  prefs.end();
+  return ok;
+}
+
+// One-time import of the /config.json written by older firmware
+static bool migrateLegacyConfig()
+{
+  File configFile = SPIFFS.open("/config.json", "r");
+  if (!configFile) return false;
   
   JsonDocument doc;
   DeserializationError error = deserializeJson(doc, configFile);
   configFile.close();
   
   if (error) {
-    Serial.println("Failed to parse configuration");
-    return;
+    Serial.println("Failed to parse legacy configuration");
+    return false;
   }
   
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
   s_saved_ssid = doc["ssid"].as<String>();
   s_saved_password = doc["password"].as<String>();
   s_saved_ip = doc["ip"].as<String>();
   s_saved_port = doc["port"].as<String>();
   s_saved_auth = doc["auth"].as<String>();
+  xSemaphoreGive(s_config_mutex);
+  if (saveConfig()) SPIFFS.remove("/config.json");
+  Serial.println("Configuration migrated from SPIFFS to NVS");
+  return true;
+}
+
+static void loadConfig()
+{
+  Preferences prefs;
+  bool found = false;
+  if (prefs.begin(PREFS_CONFIG, true)) {
+    found = prefs.isKey("ssid");
+    if (found) {
+      xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+      s_saved_ssid = prefs.getString("ssid");
+      s_saved_password = prefs.getString("password");
+      s_saved_ip = prefs.getString("ip");
+      s_saved_port = prefs.getString("port");
+      s_saved_auth = prefs.getString("auth");
+      s_saved_servers = prefs.getString("servers", "");
+      xSemaphoreGive(s_config_mutex);
+    }
+    prefs.end();
+  }
+  if (!found && !migrateLegacyConfig()) {
+    Serial.println("No saved configuration found");
+    return;
+  }
+  
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  rebuildPollTargetLocked();
+  xSemaphoreGive(s_config_mutex);
   s_config_complete = true;
   
-  Serial.println("Configuration loaded from SPIFFS");
+  Serial.println("Configuration loaded");
   Serial.printf("WiFi: %s | Server: %s:%s\n", s_saved_ssid.c_str(), s_saved_ip.c_str(), s_saved_port.c_str());
+
+  if (prefs.begin(PREFS_FASTBOOT, true)) {
+    s_fast_valid = prefs.getBytes("assoc", &s_fast, sizeof(s_fast)) == sizeof(s_fast);
+    prefs.end();
+  }
   
   // Don't attempt WiFi connection here - let setup() handle it
 }
 
+static void clearFastConnect()
+{
+  Preferences prefs;
+  s_fast_valid = false;
+  if (prefs.begin(PREFS_FASTBOOT, false)) {
+    prefs.clear();
+    prefs.end();
+  }
+}
+
+// Remember the association that just came up; NVS is only written when it
+// differs from what's cached
+static void saveFastConnect()
+{
+  Preferences prefs;
+  FastConnect f = {};
+  const uint8_t* bssid = WiFi.BSSID();
+  if (!bssid) return;
+  memcpy(f.bssid, bssid, sizeof(f.bssid));
+  f.channel = (uint8_t)WiFi.channel();
+  if (s_fast_valid && memcmp(&f, &s_fast, sizeof(f)) == 0) return;
+  s_fast = f;
+  s_fast_valid = true;
+  if (prefs.begin(PREFS_FASTBOOT, false)) {
+    prefs.putBytes("assoc", &s_fast, sizeof(s_fast));
+    prefs.end();
+  }
+}
+
+#if SENTINEL_ASYNC_HTTP
+static void sendPortalReply(AsyncWebServerRequest* req, PortalReply& r)
+{
+  if (r.location) {
+    req->redirect(r.location);
+    return;
+  }
+  AsyncWebServerResponse* res = r.gzip
+    ? req->beginResponse_P(r.code, r.type, r.gzip, r.gzip_len)
+    : req->beginResponse(r.code, r.type, r.body);
+  if (r.gzip) res->addHeader("Content-Encoding", "gzip");
+  if (r.no_cache) res->addHeader("Cache-Control", "no-cache");
+  req->send(res);
+}
+
+template <void (*Handler)(PortalReply&)>
+static void portalRoute(AsyncWebServerRequest* req)
+{
+  PerfScope timer(PERF_HTTP);
+  PortalReply r;
+  Handler(r);
+  sendPortalReply(req, r);
+}
+
+// POST bodies arrive in chunks before the request handler runs; collect them
+// in the request's scratch pointer (freed with the request). Bodies over
+// SAVE_BODY_MAX are dropped here and refused in saveRoute().
+static void collectBody(AsyncWebServerRequest* req, uint8_t* data, size_t len, size_t index, size_t total)
+{
+  if (total > SAVE_BODY_MAX) return;
+  if (index == 0) req->_tempObject = calloc(total + 1, 1);
+  if (req->_tempObject && index + len <= total) memcpy((char*)req->_tempObject + index, data, len);
+}
+
+static void saveRoute(AsyncWebServerRequest* req)
+{
+  PerfScope timer(PERF_HTTP);
+  PortalReply r;
+  if (req->contentLength() > SAVE_BODY_MAX) portalSaveTooLarge(r);
+  else portalSave(String(req->_tempObject ? (const char*)req->_tempObject : ""), r);
+  sendPortalReply(req, r);
+}
+
+static bool requestAuthorized(AsyncWebServerRequest* req)
+{
+  const AsyncWebHeader* auth = req->getHeader("Authorization");
+  return tokenAuthorized(auth ? auth->value().c_str() : nullptr, req->client()->localIP());
+}
+
+// Firmware upload, multipart: chunks are written to flash as they arrive
+static void updateUpload(AsyncWebServerRequest* req, const String& filename, size_t index, uint8_t* data, size_t len, bool final)
+{
+  if (index == 0) {
+    const AsyncWebParameter* sha = req->getParam("sha256");
+    otaStart(req, sha ? sha->value().c_str() : nullptr, requestAuthorized(req));
+  }
+  otaWrite(req, data, len);
+}
+
+template <void (*Handler)(PortalReply&, bool)>
+static void authorizedRoute(AsyncWebServerRequest* req)
+{
+  PerfScope timer(PERF_HTTP);
+  PortalReply r;
+  Handler(r, requestAuthorized(req));
+  sendPortalReply(req, r);
+}
+
+static void updateRoute(AsyncWebServerRequest* req)
+{
+  PerfScope timer(PERF_HTTP);
+  PortalReply r;
+  portalUpdate(r, requestAuthorized(req), req);
+  sendPortalReply(req, r);
+}
+
+static void registerHttpRoutes()
+{
+  s_http.on("/", HTTP_GET, portalRoute<portalRoot>);
+  s_http.on("/status", HTTP_GET, portalRoute<portalStatus>);
+  s_http.on("/scan", HTTP_GET, portalRoute<portalScan>);
+  s_http.on("/save", HTTP_POST, saveRoute, nullptr, collectBody);
+  s_http.on("/update", HTTP_POST, updateRoute, updateUpload);
+  s_http.on("/reset", HTTP_GET, portalRoute<portalReset>);
+  s_http.on("/debug/perf", HTTP_GET, authorizedRoute<portalPerf>);
+  s_http.on("/debug/overlay", HTTP_POST, authorizedRoute<portalPerfOverlay>);
+  // Probe URLs and everything else fall through to the portal page
+  s_http.onNotFound(portalRoute<portalRoot>);
+}
+#else
+static void sendPortalReply(PortalReply& r)
+{
+  if (r.location) s_http.sendHeader("Location", r.location);
+  if (r.no_cache) s_http.sendHeader("Cache-Control", "no-cache");
+  if (r.gzip) {
+    s_http.sendHeader("Content-Encoding", "gzip");
+    s_http.send_P(r.code, r.type, (PGM_P)r.gzip, r.gzip_len);
+  } else {
+    s_http.send(r.code, r.type, r.body);
+  }
+}
+
+template <void (*Handler)(PortalReply&)>
+static void portalRoute()
+{
+  PerfScope timer(PERF_HTTP);
+  PortalReply r;
+  Handler(r);
+  sendPortalReply(r);
+}
+
+static void saveRoute()
+{
+  PerfScope timer(PERF_HTTP);
+  PortalReply r;
+  portalSave(s_http.arg("plain"), r);
+  sendPortalReply(r);
+}
+
+// WebServer only keeps the headers named in collectHeaders()
+static const char* AUTH_HEADERS[] = { "Authorization" };
+
+static bool requestAuthorized()
+{
+  return tokenAuthorized(s_http.hasHeader("Authorization") ? s_http.header("Authorization").c_str() : nullptr,
+                       s_http.client().localIP());
+}
+
+// Firmware upload, multipart: WebServer hands over each buffered chunk
+static void updateUpload()
+{
+  HTTPUpload& up = s_http.upload();
+  if (up.status == UPLOAD_FILE_START) otaStart(&s_http, s_http.hasArg("sha256") ? s_http.arg("sha256").c_str() : nullptr, requestAuthorized());
+  else if (up.status == UPLOAD_FILE_WRITE) otaWrite(&s_http, up.buf, up.currentSize);
+  else if (up.status == UPLOAD_FILE_ABORTED) otaAbort(&s_http, "upload aborted");
+}
+
+template <void (*Handler)(PortalReply&, bool)>
+static void authorizedRoute()
+{
+  PerfScope timer(PERF_HTTP);
+  PortalReply r;
+  Handler(r, requestAuthorized());
+  sendPortalReply(r);
+}
+
+// WebServer serves one request at a time, so every upload has the same owner
+static void updateRoute()
+{
+  PerfScope timer(PERF_HTTP);
+  PortalReply r;
+  portalUpdate(r, requestAuthorized(), &s_http);
+  sendPortalReply(r);
+}
 
 static void registerHttpRoutes()
 {
-  s_http.on("/", HTTP_GET, handleRoot);
-  s_http.on("/scan", HTTP_GET, handleScan);
-  s_http.on("/save", HTTP_POST, handleSave);
-  s_http.on("/reset", HTTP_GET, handleReset);
+  s_http.collectHeaders(AUTH_HEADERS, sizeof(AUTH_HEADERS) / sizeof(AUTH_HEADERS[0]));
+  s_http.on("/", HTTP_GET, portalRoute<portalRoot>);
+  s_http.on("/status", HTTP_GET, portalRoute<portalStatus>);
+  s_http.on("/scan", HTTP_GET, portalRoute<portalScan>);
+  s_http.on("/save", HTTP_POST, saveRoute);
+  s_http.on("/update", HTTP_POST, updateRoute, updateUpload);
+  s_http.on("/reset", HTTP_GET, portalRoute<portalReset>);
+  s_http.on("/debug/perf", HTTP_GET, authorizedRoute<portalPerf>);
+  s_http.on("/debug/overlay", HTTP_POST, authorizedRoute<portalPerfOverlay>);
   // Common OS captive portal probes -> respond with a page (200) to trigger portal UI
-  s_http.on("/generate_204", HTTP_ANY, handleRoot);              // Android/Chrome
-  s_http.on("/gen_204", HTTP_ANY, handleRoot);                   // Android alt
-  s_http.on("/hotspot-detect.html", HTTP_ANY, handleRoot);       // Apple
-  s_http.on("/library/test/success.html", HTTP_ANY, handleRoot); // Apple alt
-  s_http.on("/ncsi.txt", HTTP_ANY, handleRoot);                  // Windows
-  s_http.on("/connecttest.txt", HTTP_ANY, handleRoot);           // Windows alt
-  s_http.onNotFound(handleRoot);                                   // Catch-all
+  s_http.on("/generate_204", HTTP_ANY, portalRoute<portalRoot>);              // Android/Chrome
+  s_http.on("/gen_204", HTTP_ANY, portalRoute<portalRoot>);                   // Android alt
+  s_http.on("/hotspot-detect.html", HTTP_ANY, portalRoute<portalRoot>);       // Apple
+  s_http.on("/library/test/success.html", HTTP_ANY, portalRoute<portalRoot>); // Apple alt
+  s_http.on("/ncsi.txt", HTTP_ANY, portalRoute<portalRoot>);                  // Windows
+  s_http.on("/connecttest.txt", HTTP_ANY, portalRoute<portalRoot>);           // Windows alt
+  s_http.onNotFound(portalRoute<portalRoot>);                                   // Catch-all
 }
+#endif
 
-static void startCaptivePortal()
+// Serve wildcard DNS while the AP is up; starts and stops the responder
+// itself so the UDP socket is only ever touched from this task
+static void dnsTask(void*)
+{
+  bool running = false;
+  for (;;) {
+    bool want = s_ap_active;
+    if (want && !running) {
+      // DNS: wildcard to our AP IP so any hostname points here
+      running = s_dns.start(DNS_PORT, "*", s_apIP);
+    } else if (!want && running) {
+      s_dns.stop();
+      running = false;
+    }
+    if (running) s_dns.processNextRequest();
+    vTaskDelay(pdMS_TO_TICKS(running ? 5 : 100));
+  }
+}
+
+static void startDnsTask()
+{
+  if (s_dns_task) return;
+  xTaskCreatePinnedToCore(dnsTask, "dns", DNS_TASK_STACK, nullptr, 1, &s_dns_task, NET_TASK_CORE);
+}
+
+static void startHttpServer()
 {
-  // DNS: wildcard to our AP IP so any hostname points here
-  s_dns.start(DNS_PORT, "*", s_apIP);
+  if (s_http_started) return;
   s_http.begin();
+  s_http_started = true;
+}
+
+// Bring up the Sentinel AP and its wildcard DNS. Keeps the station side
+// running (AP+STA) while a join is in progress or being retried.
+static void startAccessPoint()
+{
+  if (s_ap_active) return;
+  WiFi.mode(s_link == LINK_OFF ? WIFI_AP : WIFI_AP_STA);
+  bool ap_ok = WiFi.softAP("Sentinel");
+  s_apIP = WiFi.softAPIP();
+  Serial.printf("SoftAP '%s' %s, IP: %s\n", "Sentinel", ap_ok ? "started" : "FAILED", s_apIP.toString().c_str());
+  s_ap_active = true; // dnsTask picks this up
+
+}
+
+static void stopAccessPoint()
+{
+  if (!s_ap_active) return;
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_STA);
+  s_ap_active = false;
+}
+
+static void startCaptivePortal()
+{
+  startAccessPoint();
+  startHttpServer();
+  // Have networks ready by the time a phone opens the page
+  startWiFiScan();
   Serial.printf("Captive portal started on AP IP: %s\n", s_apIP.toString().c_str());
 }
 
 void setup()
 {
   Serial.begin(115200);
-  delay(200);
   Serial.println("Booting CYD splash...");
+  initPowerManagement();
   
   // Display flash storage information
   Serial.println("=== Flash Storage Info ===");
@@ -599,92 +3240,173 @@ void setup()
   Serial.println("========================");
   
   // Load saved configuration first
+  s_config_mutex = xSemaphoreCreateMutex();
+  s_ota_mutex = xSemaphoreCreateMutex();
   loadConfig();
+  checkOtaTrial();
+  restoreHistory();
   
   // Init display
-  delay(100);
   lcd.init();
-  lcd.setRotation(1); // some ESP32-2432S028_2-USB batches prefer rotation 0
+  Serial.printf("Display: %s\n", lcd.variant() == LGFX_CYD::CYD_ST7789 ? "ST7789" : "ILI9341");
+  lcd.setRotation(1); // landscape, USB port on the right
   lcd.setColorDepth(16);
   lcd.setBrightness(255);
-  delay(50);
-
-  // Always show boot image for 2 seconds first
-  drawBootImage();
-  delay(2000);
+  // Allocate the frame buffer early, before Wi-Fi fragments the heap
+  initFrameBuffer();
+  initClockGlyphs();
+  startTouch();
 
   // Register HTTP routes once before any s_http.begin()
   registerHttpRoutes();
+  WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+
+  // Metrics polling lives on core 0, away from the UI loop
+  startNetworkTask();
+  startFleetTask();
+  startDnsTask();
 
-  // If we have saved WiFi credentials, try connecting
+  // If we have saved WiFi credentials, start joining before the splash is
+  // drawn so association overlaps it; with a saved config the main screen
+  // replaces the splash as soon as the link is up
   if (s_saved_ssid.length() > 0) {
     Serial.println("Found saved WiFi credentials, attempting connection...");
+    s_quick_resume = s_config_complete;
     connectToWiFi();
   }
 
-  // Only start Sentinel AP if WiFi connection failed or no credentials saved
-  if (!s_wifi_connected) {
-    Serial.println("Starting Sentinel AP mode...");
-    WiFi.mode(WIFI_AP);
-    bool ap_ok = WiFi.softAP("Sentinel");
-    s_apIP = WiFi.softAPIP();
-    Serial.printf("SoftAP '%s' %s, IP: %s\n", "Sentinel", ap_ok ? "started" : "FAILED", s_apIP.toString().c_str());
+  drawBootImage();
 
-    // Start captive portal services (DNS + HTTP)
+  if (s_saved_ssid.length() == 0) {
+    Serial.println("Starting Sentinel AP mode...");
     startCaptivePortal();
-
-    // Redraw boot image for AP mode
-    drawBootImage();
   }
+}
 
-  // If WiFi connected, success screen is already shown by connectToWiFi()
-  // and will automatically transition to main screen after 1.5 seconds
+static void onWiFiEvent(arduino_event_id_t event)
+{
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) s_wifi_events.fetch_or(WIFI_EVT_GOT_IP);
+  else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) s_wifi_events.fetch_or(WIFI_EVT_LOST);
+  wakeLoop();
 }
 
+// Start joining the saved network and return immediately; serviceWiFi()
+// follows the attempt from the loop
 static void connectToWiFi()
 {
-  if (s_saved_ssid.length() == 0) return;
+  // The portal may rewrite the credentials from another task
+  xSemaphoreTake(s_config_mutex, portMAX_DELAY);
+  if (s_saved_ssid.length() == 0) {
+    xSemaphoreGive(s_config_mutex);
+    return;
+  }
   
   Serial.printf("Attempting to connect to WiFi: %s\n", s_saved_ssid.c_str());
   
-  // Switch to STA mode only for WiFi connection
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(s_saved_ssid.c_str(), s_saved_password.c_str());
-  
-  // Wait up to 30 seconds for connection
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 60) {
-    delay(500);
-    attempts++;
-    Serial.print(".");
-  }
-  
-  if (WiFi.status() == WL_CONNECTED) {
-    s_wifi_connected = true;
-    IPAddress localIP = WiFi.localIP();
-    Serial.printf("\nWiFi connected! IP: %s\n", localIP.toString().c_str());
-    Serial.printf("Configuration panel accessible at: http://%s\n", localIP.toString().c_str());
-    
-    // Stop DNS server (no longer needed without AP)
-    s_dns.stop();
-    
-    // Start HTTP server on WiFi interface
-    s_http.begin();
-    Serial.printf("HTTP server started on WiFi IP: %s\n", localIP.toString().c_str());
-    
-  // Always display success message when WiFi connects
-  displayWiFiSuccess();
-  // Pair with Sentinel-Server if config present
-  pairWithSentinelServer();
+  // Keep the portal AP alive alongside the station while it is up
+  WiFi.mode(s_ap_active ? WIFI_AP_STA : WIFI_STA);
+  WiFi.setAutoReconnect(false); // retries are paced by serviceWiFi()
+  s_fast_attempt = s_fast_valid;
+  if (s_fast_attempt) {
+    // Known AP: skip the scan
+    WiFi.begin(s_saved_ssid.c_str(), s_saved_password.c_str(), s_fast.channel, s_fast.bssid);
   } else {
-    s_wifi_connected = false;
-    Serial.println("\nWiFi connection failed - keeping Sentinel AP active");
-    // Go back to AP mode if WiFi connection failed
-    WiFi.mode(WIFI_AP);
-    bool ap_ok = WiFi.softAP("Sentinel");
-    s_apIP = WiFi.softAPIP();
-    s_dns.start(DNS_PORT, "*", s_apIP);
-    Serial.printf("Sentinel AP restarted at %s\n", s_apIP.toString().c_str());
+    WiFi.begin(s_saved_ssid.c_str(), s_saved_password.c_str());
+  }
+  xSemaphoreGive(s_config_mutex);
+  s_link = LINK_CONNECTING;
+  s_link_since = millis();
+}
+
+static void onLinkUp()
+{
+  s_link = LINK_UP;
+  s_wifi_connected = true;
+  s_link_backoff_ms = WIFI_BACKOFF_MIN_MS;
+  IPAddress localIP = WiFi.localIP();
+  Serial.printf("WiFi connected! IP: %s\n", localIP.toString().c_str());
+  Serial.printf("Configuration panel accessible at: http://%s\n", localIP.toString().c_str());
+  if (s_ota_trial && !s_ota_trial_from) s_ota_trial_from = millis(); // trial window starts now
+
+  // AP and DNS are no longer needed once the station is up
+  stopAccessPoint();
+  startHttpServer();
+#if SENTINEL_LOW_POWER
+  WiFi.setSleep(WIFI_PS_MIN_MODEM); // radio off between DTIM beacons; STA only
+#endif
+  s_fast_attempt = false;
+  saveFastConnect();
+  if (!s_sntp_started) {
+    // UTC; the display applies the server's offset
+    configTime(0, 0, "pool.ntp.org", "time.google.com");
+    s_sntp_started = true;
+  }
+
+  if (!s_wifi_ever_connected) {
+    s_wifi_ever_connected = true;
+    // Config was verified when it was saved; after a reboot go straight to
+    // the metrics instead of the success and pairing screens
+    if (s_quick_resume) displayMainScreen();
+    else displayWiFiSuccess();
+  }
+}
+
+static void onLinkFailed(uint32_t now)
+{
+  WiFi.disconnect();
+  s_wifi_connected = false;
+  s_link = LINK_BACKOFF;
+  s_link_since = now;
+  if (s_fast_attempt) {
+    // The AP moved or changed channel; rejoin the slow way right away
+    Serial.println("Fast reconnect failed, falling back to a full join");
+    clearFastConnect();
+    s_link_wait_ms = 0;
+    return;
+  }
+  s_link_wait_ms = s_link_backoff_ms;
+  s_link_backoff_ms = s_link_backoff_ms * 2 > WIFI_BACKOFF_MAX_MS ? WIFI_BACKOFF_MAX_MS : s_link_backoff_ms * 2;
+  Serial.printf("WiFi connection failed, retrying in %lu ms\n", (unsigned long)s_link_wait_ms);
+  // Never joined this network: open the portal so the settings can be fixed
+  if (!s_wifi_ever_connected && !s_ap_active) {
+    Serial.println("Keeping Sentinel AP active");
+    startCaptivePortal();
+    drawBootImage();
+  }
+}
+
+static void serviceWiFi()
+{
+  uint8_t events = s_wifi_events.exchange(0);
+  uint32_t now = millis();
+  wl_status_t status = WiFi.status();
+  switch (s_link) {
+  case LINK_CONNECTING:
+    if ((events & WIFI_EVT_GOT_IP) || status == WL_CONNECTED) {
+      onLinkUp();
+    } else if (((events & WIFI_EVT_LOST) && (status == WL_NO_SSID_AVAIL || status == WL_CONNECT_FAILED))
+               || now - s_link_since >= (s_fast_attempt ? WIFI_FAST_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS)) {
+      onLinkFailed(now);
+    }
+    break;
+  case LINK_UP:
+    if (status != WL_CONNECTED) {
+      Serial.println("WiFi connection lost");
+      // First retry straight away, then back off
+      s_link_backoff_ms = WIFI_BACKOFF_MIN_MS;
+      s_wifi_connected = false;
+      s_link = LINK_BACKOFF;
+      s_link_since = now;
+      s_link_wait_ms = 0;
+    }
+    break;
+  case LINK_BACKOFF:
+    if (status == WL_CONNECTED) onLinkUp();
+    else if (now - s_link_since >= s_link_wait_ms) connectToWiFi();
+    break;
+  case LINK_OFF:
+    break;
   }
 }
 
@@ -754,40 +3476,177 @@ static void displayMainScreen()
   s_layout = LAYOUT_CHARTS;
   renderChartsLayout();
   s_stats_active = true;
-  s_last_stats_update = millis() - 2000; // force immediate update
-  updateStatsFromServer();
+  // Wake the network task so the first sample doesn't wait a full period
+  if (s_net_task) xTaskNotifyGive(s_net_task);
 }
 
-void loop()
+static void IRAM_ATTR onTouchIrq()
+{
+  gpio_intr_disable((gpio_num_t)TOUCH_IRQ_PIN); // level-triggered; sampleTouch() unmasks
+  s_touch_pending = true;
+  BaseType_t woken = pdFALSE;
+  if (s_loop_task) vTaskNotifyGiveFromISR(s_loop_task, &woken);
+  if (woken) portYIELD_FROM_ISR();
+}
+
+static void startTouch()
+{
+  pinMode(TOUCH_IRQ_PIN, INPUT); // PENIRQ has its own pull-up in the XPT2046
+  attachInterrupt(digitalPinToInterrupt(TOUCH_IRQ_PIN), onTouchIrq, ONLOW);
+}
+
+// One controller read per TOUCH_SAMPLE_MS while a press lasts. The CYD
+// wires the XPT2046 to its own SPI host, so a read doesn't wait on panel
+// DMA.
+static Gesture sampleTouch()
+{
+  if (s_touch_pending.exchange(false)) s_touch_sampling = true;
+  if (!s_touch_sampling) return GESTURE_NONE;
+  uint32_t now = millis();
+  if (s_touch_sampled_at != 0 && now - s_touch_sampled_at < TOUCH_SAMPLE_MS) return GESTURE_NONE;
+  s_touch_sampled_at = now | 1;
+  int32_t x = 0, y = 0;
+  bool touched = lcd.getTouch(&x, &y) > 0;
+  Gesture g = s_touch_decoder.feed(touched, x, y, now);
+  if (s_touch_decoder.idle()) {
+    // Conversions pull PENIRQ low as well; drop what they raised and unmask
+    s_touch_sampling = false;
+    s_touch_sampled_at = 0;
+    s_touch_pending = false;
+    gpio_intr_enable((gpio_num_t)TOUCH_IRQ_PIN);
+  }
+  return g;
+}
+
+// Swipe left/right (or tap) to step through layouts, up/down to page the
+// fleet overview, long press for the default layout. Only the main screen
+// reacts.
+static void serviceTouch()
+{
+  Gesture g = sampleTouch();
+  if (g == GESTURE_NONE || !s_stats_active || s_showing_success || s_showing_pair) return;
+  switch (g) {
+    case GESTURE_TAP:
+    case GESTURE_SWIPE_LEFT: s_layout = (s_layout + 1) % LAYOUT_MAX; break;
+    case GESTURE_SWIPE_RIGHT: s_layout = (s_layout + LAYOUT_MAX - 1) % LAYOUT_MAX; break;
+    case GESTURE_LONG_PRESS: s_layout = LAYOUT_CHARTS; break;
+    case GESTURE_SWIPE_UP:
+    case GESTURE_SWIPE_DOWN: {
+      int pages = (s_fleet_hosts + FLEET_ROWS - 1) / FLEET_ROWS;
+      if (s_layout != LAYOUT_FLEET || pages < 2) return;
+      s_fleet_page = (s_fleet_page + (g == GESTURE_SWIPE_UP ? 1 : pages - 1)) % pages;
+      break;
+    }
+    default: return;
+  }
+  renderLayout();
+}
+
+// Repaint what changes without a new sample: the clock and uptime tick
+// every second, the poll status follows the network task, and fleet hosts
+// go grey when they stop answering
+static bool widgetStale(WidgetId id)
+{
+  return s_widgets[id].w != 0 && widgetKey(id) != s_widgets[id].drawn_key;
+}
+
+static void serviceClock()
+{
+  if (!s_stats_active || s_showing_success || s_showing_pair) return;
+  bool stale = widgetStale(W_CLOCK) || widgetStale(W_UPTIME) || widgetStale(W_LINK) || widgetStale(W_PERF);
+  for (int i = W_FLEET_ROW0; !stale && i < W_COUNT; ++i) stale = widgetStale((WidgetId)i);
+  if (stale) refreshWidgets();
+}
+
+// Success screen -> pairing result -> main screen, each step on a timer or
+// on the network task finishing the pairing check
+static void serviceScreens()
 {
-  // Check if we need to transition from success screen to main screen
   if (s_showing_success && (millis() - s_success_start_time >= 1500)) {
     s_showing_success = false;
+    startPairing();
+  }
+  if (s_pair_state == PAIR_DONE) {
+    s_pair_state = PAIR_IDLE;
+    int status = s_pair_status;
+    if (s_pair_ok) displayPairingResult(true, "Server OK");
+    else if (status) displayPairingResult(false, "HTTP: " + String(status));
+    else displayPairingResult(false, "No response");
+    s_showing_pair = true;
+    s_pair_shown_at = millis();
+  }
+  if (s_showing_pair && millis() - s_pair_shown_at >= PAIR_RESULT_MS) {
+    s_showing_pair = false;
     displayMainScreen();
   }
+}
 
-  // Touch to switch layouts
-  if (lcd.getTouchRawX() >= 0) {
-    // Simple edge-triggered toggle
-    if (!s_touch_down) {
-      s_touch_down = true;
-      s_layout = (s_layout + 1) % LAYOUT_MAX;
-      if (s_layout == LAYOUT_CHARTS) renderChartsLayout(); else renderClockLayout();
-    }
-  } else {
-    s_touch_down = false;
-  }
+// Track heap fragmentation over time for /debug/perf
+static void servicePerf()
+{
+  if (s_perf_heap_at != 0 && millis() - s_perf_heap_at < PERF_HEAP_EVERY_MS) return;
+  s_perf_heap_at = millis() | 1;
+  uint8_t frag = heapFragmentation();
+  s_perf_frag.push(frag);
+  if (frag > s_perf_frag_worst) s_perf_frag_worst = frag;
+}
 
-  // Periodically update stats if paired
-  if (s_stats_active && (millis() - s_last_stats_update >= 2000)) {
-    s_last_stats_update = millis();
-    updateStatsFromServer();
+// Time until the clock or uptime on screen turns over, just past the edge
+static uint32_t msUntilNextSecond()
+{
+  uint32_t now = millis();
+  uint32_t wait = 1000 - (now - s_last_uptime_tick) % 1000;
+  timeval tv;
+  gettimeofday(&tv, nullptr);
+  uint32_t clock_wait = tv.tv_sec >= CLOCK_VALID_AFTER ? 1000 - (uint32_t)tv.tv_usec / 1000 : 1000 - (now - s_server_unix_at) % 1000;
+  return (clock_wait < wait ? clock_wait : wait) + 1;
+}
+
+// Between iterations: on the steady main screen, block until woken or
+// the next second, which lets the CPU scale down and sleep. Everywhere
+// else (portal, pairing, link changes) keep the short fixed tick.
+static void idleLoop()
+{
+  bool steady = s_stats_active && s_link == LINK_UP && !s_ap_active && !s_showing_success && !s_showing_pair &&
+                s_pair_state != PAIR_PENDING && s_portal_actions.load() == 0;
+  if (!steady) {
+    delay(LOOP_TICK_MS);
+    return;
   }
+  uint32_t wait = msUntilNextSecond();
+#if !SENTINEL_ASYNC_HTTP
+  if (wait > LOOP_IDLE_HTTP_MS) wait = LOOP_IDLE_HTTP_MS;
+#endif
+  if (s_touch_sampling && wait > TOUCH_SAMPLE_MS) wait = TOUCH_SAMPLE_MS; // mid-press
+  powerBusy(false);
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+  powerBusy(true);
+}
+
+void loop()
+{
+  {
+    PerfScope timer(PERF_LOOP); // one pass, without the idle wait
+    servicePortalActions();
+    serviceWiFi();
+    serviceScreens();
+    serviceWiFiScan();
+
+    serviceTouch();
+
+    // Pick up samples polled by the network task
+    if (s_stats_active) {
+      processSamples();
+      processFleetSamples();
+    }
+    serviceClock();
+    servicePerf();
+    serviceOtaTrial();
 
-  // Process captive portal network traffic (only if in AP mode)
-  if (!s_wifi_connected) {
-    s_dns.processNextRequest();
+#if !SENTINEL_ASYNC_HTTP
+    // Config panel requests (the async backend serves them on its own task)
+    s_http.handleClient();
+#endif
   }
-  s_http.handleClient();
-  delay(10);
+  idleLoop();
 }
@@ -0,0 +1,294 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+// One /metrics reading, reduced to the fields the display actually uses.
+struct MetricsSample
+{
+  float cpu_pct;       // 0-100
+  float ram_pct;       // memory.percentage
+  float disk_pct;      // disk.percentage
+  uint32_t uptime_s;   // uptime.uptime_seconds
+  uint32_t unix_s;     // unix_time; 0 from servers that don't send it
+  char timestamp[32];  // server ISO 8601 time, e.g. 2025-10-05T12:00:00.123456
+  bool backfill;       // from /metrics/history: only the chart fields are set
+};
+
+// Byte source over an in-memory buffer, for MetricsJsonParser.
+struct BufferSource
+{
+  const char* p;
+  const char* end;
+  BufferSource(const char* buf, size_t len) : p(buf), end(buf + len) {}
+  int read() { return p < end ? (uint8_t)*p++ : -1; }
+};
+
+// Streaming pull parser for the /metrics JSON document.
+// Source is anything with `int read()` returning the next byte or -1 at the
+// end. Only the MetricsSample fields are decoded; every other value is
+// skipped as it streams past, so nothing is buffered or heap-allocated.
+template <typename Source>
+class MetricsJsonParser
+{
+public:
+  explicit MetricsJsonParser(Source& in) : m_in(in) {}
+
+  // Parse one top-level object into out. Missing fields read as zero.
+  bool parse(MetricsSample& out)
+  {
+    memset(&out, 0, sizeof(out));
+    m_out = &out;
+    if (skipWs() != '{') return false;
+    return parseObject(SCOPE_ROOT);
+  }
+
+private:
+  enum Scope { SCOPE_ROOT, SCOPE_MEMORY, SCOPE_DISK, SCOPE_UPTIME, SCOPE_OTHER };
+
+  int next()
+  {
+    if (m_peek >= 0) {
+      int c = m_peek;
+      m_peek = -1;
+      return c;
+    }
+    return m_in.read();
+  }
+  int peek()
+  {
+    if (m_peek < 0) m_peek = m_in.read();
+    return m_peek;
+  }
+  // Consume whitespace and return the next significant byte.
+  int skipWs()
+  {
+    int c;
+    do { c = next(); } while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+    return c;
+  }
+
+  // Called after the opening '{'.
+  bool parseObject(Scope scope)
+  {
+    int c = skipWs();
+    if (c == '}') return true;
+    for (;;) {
+      char key[24];
+      if (c != '"' || !readString(key, sizeof(key))) return false;
+      if (skipWs() != ':') return false;
+      if (!parseMember(scope, key)) return false;
+      c = skipWs();
+      if (c == '}') return true;
+      if (c != ',') return false;
+      c = skipWs();
+    }
+  }
+
+  bool parseMember(Scope scope, const char* key)
+  {
+    float* target = nullptr;
+    int c = skipWs();
+    switch (scope) {
+      case SCOPE_ROOT:
+        if (strcmp(key, "cpu") == 0) target = &m_out->cpu_pct;
+        else if (strcmp(key, "unix_time") == 0) return readUnsigned(c, m_out->unix_s);
+        else if (strcmp(key, "timestamp") == 0 && c == '"') return readString(m_out->timestamp, sizeof(m_out->timestamp));
+        else if (c == '{') {
+          Scope child = strcmp(key, "memory") == 0 ? SCOPE_MEMORY
+                      : strcmp(key, "disk") == 0   ? SCOPE_DISK
+                      : strcmp(key, "uptime") == 0 ? SCOPE_UPTIME
+                      : SCOPE_OTHER;
+          if (child != SCOPE_OTHER) return parseObject(child);
+        }
+        break;
+      case SCOPE_MEMORY:
+        if (strcmp(key, "percentage") == 0) target = &m_out->ram_pct;
+        break;
+      case SCOPE_DISK:
+        if (strcmp(key, "percentage") == 0) target = &m_out->disk_pct;
+        break;
+      case SCOPE_UPTIME:
+        if (strcmp(key, "uptime_seconds") == 0) return readUnsigned(c, m_out->uptime_s);
+        break;
+      default:
+        break;
+    }
+    if (target) return readNumber(c, *target);
+    return skipValue(c);
+  }
+
+  // Called after the opening quote; copies up to cap-1 bytes, drops the rest.
+  bool readString(char* buf, size_t cap)
+  {
+    size_t n = 0;
+    for (;;) {
+      int c = next();
+      if (c < 0) return false;
+      if (c == '"') break;
+      if (c == '\\') {
+        c = next();
+        if (c < 0) return false;
+        if (c == 'u') { // keep escapes simple: \uXXXX becomes '?'
+          for (int i = 0; i < 4; ++i) if (next() < 0) return false;
+          c = '?';
+        }
+      }
+      if (n + 1 < cap) buf[n++] = (char)c;
+    }
+    if (cap) buf[n] = '\0';
+    return true;
+  }
+
+  bool readNumber(int c, float& out)
+  {
+    char buf[24];
+    size_t n = 0;
+    while ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+      if (n + 1 < sizeof(buf)) buf[n++] = (char)c;
+      int p = peek();
+      if (!((p >= '0' && p <= '9') || p == '-' || p == '+' || p == '.' || p == 'e' || p == 'E')) break;
+      c = next();
+    }
+    if (n == 0) return skipValue(c); // null, or a type we don't expect: leave zero
+    buf[n] = '\0';
+    out = strtof(buf, nullptr);
+    return true;
+  }
+
+  // Integer counterpart of readNumber() so large counters keep full precision
+  // (a float would start rounding uptime after ~194 days). Fractions are dropped.
+  bool readUnsigned(int c, uint32_t& out)
+  {
+    if (c < '0' || c > '9') return skipValue(c);
+    uint32_t v = (uint32_t)(c - '0');
+    for (int p = peek(); p >= '0' && p <= '9'; p = peek()) {
+      v = v * 10 + (uint32_t)(next() - '0');
+    }
+    out = v;
+    int p = peek();
+    return (p == '.' || p == 'e' || p == 'E') ? skipValue(next()) : true;
+  }
+
+  // Skip one value whose first byte is c.
+  bool skipValue(int c)
+  {
+    if (c == '"') return readString(nullptr, 0);
+    if (c == '{' || c == '[') {
+      int depth = 1;
+      while (depth > 0) {
+        c = next();
+        if (c < 0) return false;
+        if (c == '"') {
+          if (!readString(nullptr, 0)) return false;
+        } else if (c == '{' || c == '[') {
+          ++depth;
+        } else if (c == '}' || c == ']') {
+          --depth;
+        }
+      }
+      return true;
+    }
+    // Number or literal (true/false/null): runs until a delimiter
+    if (c < 0) return false;
+    for (;;) {
+      int p = peek();
+      if (p < 0 || p == ',' || p == '}' || p == ']' || p == ' ' || p == '\n' || p == '\r' || p == '\t') return true;
+      next();
+    }
+  }
+
+  Source& m_in;
+  MetricsSample* m_out = nullptr;
+  int m_peek = -1;
+};
+
+// Seconds the server's local time is ahead of UTC, from a sample's local
+// ISO 8601 timestamp and its unix time. False if either is missing.
+static inline bool utcOffsetFromSample(const MetricsSample& s, int32_t& out)
+{
+  int y, mo, d, h, mi, sec;
+  if (s.unix_s == 0 || sscanf(s.timestamp, "%d-%d-%dT%d:%d:%d", &y, &mo, &d, &h, &mi, &sec) != 6) return false;
+  if (mo < 1 || mo > 12 || d < 1 || d > 31) return false;
+  // Days since 1970-01-01 in the proleptic Gregorian calendar
+  y -= mo <= 2;
+  int era = (y >= 0 ? y : y - 399) / 400;
+  int yoe = y - era * 400;
+  int doy = (153 * (mo + (mo > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  int64_t days = (int64_t)era * 146097 + doe - 719468;
+  int64_t off = days * 86400 + h * 3600 + mi * 60 + sec - (int64_t)s.unix_s;
+  if (off < -14 * 3600 || off > 14 * 3600) return false;
+  out = (int32_t)((off >= 0 ? off + 30 : off - 30) / 60 * 60); // whole minutes
+  return true;
+}
+
+// /metrics.bin record (Sentinel-Server docs/API.md, "Binary Metrics").
+// Little-endian; fields are only appended, so larger sizes are accepted.
+static const uint8_t METRICS_BIN_VERSION = 1;
+static const size_t METRICS_BIN_MIN_SIZE = 24;
+static const size_t METRICS_BIN_MAX_SIZE = 64;
+
+static inline uint16_t readLe16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static inline uint32_t readLe32(const uint8_t* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline bool decodeMetricsBinary(const uint8_t* buf, size_t len, MetricsSample& out)
+{
+  if (len < METRICS_BIN_MIN_SIZE || buf[0] != METRICS_BIN_VERSION) return false;
+  if (buf[1] < METRICS_BIN_MIN_SIZE || buf[1] > len) return false;
+  out.cpu_pct = readLe16(buf + 4) / 100.0f;
+  out.ram_pct = readLe16(buf + 6) / 100.0f;
+  out.disk_pct = readLe16(buf + 8) / 100.0f;
+  out.uptime_s = readLe32(buf + 12);
+  out.unix_s = readLe32(buf + 16);
+  out.backfill = false;
+  // Render server local time in the same shape /metrics uses
+  time_t local = (time_t)readLe32(buf + 16) + (int32_t)readLe32(buf + 20);
+  struct tm tm;
+  gmtime_r(&local, &tm);
+  // Bounded types so the compiler can see the output fits
+  snprintf(out.timestamp, sizeof(out.timestamp), "%04u-%02u-%02uT%02u:%02u:%02u",
+           (unsigned)(tm.tm_year + 1900) % 10000u, (uint8_t)(tm.tm_mon + 1), (uint8_t)tm.tm_mday,
+           (uint8_t)tm.tm_hour, (uint8_t)tm.tm_min, (uint8_t)tm.tm_sec);
+  return true;
+}
+
+// /metrics/history?format=bin (Sentinel-Server docs/API.md, "Metrics History"):
+// a header with the record count, then fixed-size records, oldest first.
+static const uint8_t HISTORY_BIN_VERSION = 1;
+static const size_t HISTORY_BIN_HEADER_MIN = 8;
+static const size_t HISTORY_BIN_RECORD_MIN = 10;
+static const size_t HISTORY_BIN_MAX_SIZE = 32; // larger headers/records are rejected
+
+struct HistoryBinHeader
+{
+  size_t header_size;
+  size_t record_size;
+  uint32_t count;
+};
+
+static inline bool decodeHistoryHeader(const uint8_t* buf, size_t len, HistoryBinHeader& out)
+{
+  if (len < HISTORY_BIN_HEADER_MIN || buf[0] != HISTORY_BIN_VERSION) return false;
+  out.header_size = buf[1];
+  out.record_size = buf[2];
+  out.count = readLe32(buf + 4);
+  return out.header_size >= HISTORY_BIN_HEADER_MIN && out.header_size <= HISTORY_BIN_MAX_SIZE &&
+         out.record_size >= HISTORY_BIN_RECORD_MIN && out.record_size <= HISTORY_BIN_MAX_SIZE;
+}
+
+// One record as a backfill sample; fields outside the charts stay zero
+static inline void decodeHistoryRecord(const uint8_t* rec, MetricsSample& out)
+{
+  memset(&out, 0, sizeof(out));
+  out.unix_s = readLe32(rec);
+  out.cpu_pct = readLe16(rec + 4) / 100.0f;
+  out.ram_pct = readLe16(rec + 6) / 100.0f;
+  out.disk_pct = readLe16(rec + 8) / 100.0f;
+  out.backfill = true;
+}
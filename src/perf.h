@@ -0,0 +1,40 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include "ring_series.h"
+
+// Rolling window over the last N durations (microseconds). add() is O(1);
+// percentiles sort a copy, so they only cost when someone looks. One
+// writer per window: a reader on another task may see a sample land
+// mid-read, which is fine for diagnostics.
+template <size_t N>
+class PerfWindow
+{
+public:
+  void add(uint32_t us)
+  {
+    m_samples.push(us);
+    if (us > m_max) m_max = us;
+  }
+
+  uint32_t count() const { return m_samples.total(); } // all time, not just the window
+  uint32_t max() const { return m_max; }                 // all time
+  uint32_t last() const { return m_samples.empty() ? 0 : m_samples.newest(); }
+
+  // Nearest-rank percentile (0..100) over the window; 0 while empty
+  uint32_t percentile(unsigned pct) const
+  {
+    uint32_t sorted[N];
+    size_t n = m_samples.read(sorted, N);
+    if (n == 0) return 0;
+    size_t k = (n * pct + 99) / 100;
+    k = k ? k - 1 : 0;
+    std::nth_element(sorted, sorted + k, sorted + n);
+    return sorted[k];
+  }
+
+private:
+  RingSeries<uint32_t, N> m_samples;
+  uint32_t m_max = 0;
+};
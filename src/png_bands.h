@@ -0,0 +1,72 @@
+#pragma once
+#include <PNGdec.h>
+#include <cstdint>
+
+// PNGdec line sink shared by the firmware and the native benchmarks. Rows
+// are packed into two alternating bands, each pushed over DMA while the
+// next one decodes. Images larger than the panel are decimated by a whole
+// step; decimated rows are decoded at full width into `line` first, since
+// getLineAsRGB565() always writes the source width. Canvas needs
+// LovyanGFX's pushImageDMA().
+template <typename Canvas>
+struct PngBandSink
+{
+  Canvas* canvas;
+  PNG* png;
+  uint16_t* bands[2]; // band_rows rows of dw pixels each
+  int band_rows;
+  int band_w;         // widest row a band holds
+  uint16_t* line;     // full-width scratch row, only when step > 1
+  int step;
+  int32_t x, y;       // panel origin of the scaled image
+  int dw, dh;         // scaled size
+  int out_row;        // next scaled row to fill
+  int band_start;     // scaled row the current band begins at
+  int band;
+};
+
+// Smallest step that fits a w x h image on the panel, centred. False when
+// the scaled rows don't fit the bands.
+template <typename Canvas>
+bool pngBandLayout(PngBandSink<Canvas>& s, int32_t w, int32_t h, int panel_w, int panel_h)
+{
+  s.step = 1;
+  while ((w + s.step - 1) / s.step > panel_w || (h + s.step - 1) / s.step > panel_h) ++s.step;
+  s.dw = (w + s.step - 1) / s.step;
+  s.dh = (h + s.step - 1) / s.step;
+  s.x = (panel_w - s.dw) / 2;
+  s.y = (panel_h - s.dh) / 2;
+  s.out_row = 0;
+  s.band_start = 0;
+  s.band = 0;
+  return s.dw <= s.band_w;
+}
+
+template <typename Canvas>
+void flushPngBand(PngBandSink<Canvas>& s)
+{
+  int rows = s.out_row - s.band_start;
+  if (rows <= 0) return;
+  s.canvas->pushImageDMA(s.x, s.y + s.band_start, s.dw, rows, s.bands[s.band]);
+  s.band ^= 1;
+  s.band_start = s.out_row;
+}
+
+// PNG_DRAW_CALLBACK; pUser is the PngBandSink
+template <typename Canvas>
+int drawPngBandLine(PNGDRAW* draw)
+{
+  PngBandSink<Canvas>& s = *static_cast<PngBandSink<Canvas>*>(draw->pUser);
+  if (draw->y % s.step != 0 || s.out_row >= s.dh) return 1;
+  uint16_t* dst = s.bands[s.band] + (size_t)(s.out_row - s.band_start) * s.dw;
+  // Use BIG_ENDIAN to match LovyanGFX's RGB565 color order (fixes swapped colors)
+  if (s.step == 1) {
+    s.png->getLineAsRGB565(draw, dst, PNG_RGB565_BIG_ENDIAN, 0x00000000);
+  } else {
+    s.png->getLineAsRGB565(draw, s.line, PNG_RGB565_BIG_ENDIAN, 0x00000000);
+    for (int i = 0; i < s.dw; ++i) dst[i] = s.line[i * s.step];
+  }
+  ++s.out_row;
+  if (s.out_row - s.band_start == s.band_rows || s.out_row == s.dh) flushPngBand(s);
+  return 1;
+}
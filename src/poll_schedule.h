@@ -0,0 +1,100 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+
+// Exponential backoff after consecutive failures. Closed, requests go out
+// as scheduled; after a failure the next attempt waits base << (failures-1),
+// capped at max, and that single attempt decides whether it closes again.
+class CircuitBreaker
+{
+public:
+  CircuitBreaker(uint32_t base_ms, uint32_t max_ms) : m_base_ms(base_ms), m_max_ms(max_ms) {}
+
+  void success() { m_failures = 0; }
+
+  void failure(uint32_t now_ms)
+  {
+    if (m_failures < 255) ++m_failures;
+    m_retry_at = now_ms + delayMs();
+  }
+
+  bool open() const { return m_failures > 0; }
+  uint8_t failures() const { return m_failures; }
+
+  // Wait before the next attempt; 0 while closed
+  uint32_t delayMs() const
+  {
+    if (m_failures == 0) return 0;
+    uint32_t d = m_base_ms;
+    for (uint8_t i = 1; i < m_failures && d < m_max_ms; ++i) d *= 2;
+    return d < m_max_ms ? d : m_max_ms;
+  }
+
+  // Closed, or open and the retry time has come
+  bool allow(uint32_t now_ms) const { return m_failures == 0 || (int32_t)(now_ms - m_retry_at) >= 0; }
+
+private:
+  uint32_t m_base_ms, m_max_ms;
+  uint32_t m_retry_at = 0;
+  uint8_t m_failures = 0;
+};
+
+// Poll interval that follows how fast the values move: a big step between
+// two samples drops it to the minimum, a run of calm samples stretches it
+// by half per poll up to calm_max, anything in between returns to base.
+// While nobody is looking at the live values it never goes below hidden.
+class AdaptiveInterval
+{
+public:
+  static constexpr float FAST_DELTA = 8.0f; // percentage points between samples
+  static constexpr float CALM_DELTA = 1.0f;
+  static constexpr uint8_t CALM_POLLS = 3;  // calm samples before stretching
+
+  AdaptiveInterval(uint32_t min_ms, uint32_t base_ms, uint32_t calm_max_ms, uint32_t hidden_ms)
+    : m_min_ms(min_ms), m_base_ms(base_ms), m_calm_max_ms(calm_max_ms), m_hidden_ms(hidden_ms), m_interval_ms(base_ms)
+  {
+  }
+
+  uint32_t update(float cpu_pct, float ram_pct)
+  {
+    float delta = fmaxf(fabsf(cpu_pct - m_cpu), fabsf(ram_pct - m_ram));
+    m_cpu = cpu_pct;
+    m_ram = ram_pct;
+    if (!m_primed) {
+      m_primed = true;
+    } else if (delta >= FAST_DELTA) {
+      m_interval_ms = m_min_ms;
+      m_calm = 0;
+    } else if (delta < CALM_DELTA) {
+      if (m_calm < CALM_POLLS) ++m_calm;
+      if (m_calm >= CALM_POLLS) {
+        uint32_t next = m_interval_ms + m_interval_ms / 2;
+        m_interval_ms = next < m_calm_max_ms ? next : m_calm_max_ms;
+      }
+    } else {
+      m_interval_ms = m_base_ms;
+      m_calm = 0;
+    }
+    return intervalMs();
+  }
+
+  // Forget the previous sample, e.g. after a gap or a target change
+  void reset()
+  {
+    m_primed = false;
+    m_calm = 0;
+    m_interval_ms = m_base_ms;
+  }
+
+  void setShown(bool shown) { m_shown = shown; }
+
+  uint32_t intervalMs() const { return m_shown || m_interval_ms >= m_hidden_ms ? m_interval_ms : m_hidden_ms; }
+
+private:
+  uint32_t m_min_ms, m_base_ms, m_calm_max_ms, m_hidden_ms;
+  uint32_t m_interval_ms;
+  float m_cpu = 0.0f, m_ram = 0.0f;
+  uint8_t m_calm = 0;
+  bool m_primed = false;
+  bool m_shown = true;
+};
@@ -0,0 +1,170 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Percentages stored as fixed point: 0..100 % maps onto 0..max of T, so
+// uint8_t keeps ~0.4 % resolution in one byte per sample.
+template <typename T>
+struct PctFixed
+{
+  static constexpr float SCALE = (float)std::numeric_limits<T>::max() / 100.0f;
+
+  static T encode(float pct)
+  {
+    if (!(pct > 0.0f)) return 0; // also catches NaN
+    if (pct >= 100.0f) return std::numeric_limits<T>::max();
+    return (T)(pct * SCALE + 0.5f);
+  }
+
+  static float decode(T v) { return (float)v / SCALE; }
+};
+
+// Fixed-capacity ring of samples. push() is O(1) and overwrites the oldest
+// entry once full; reads address samples by age (0 = newest).
+template <typename T, size_t N>
+class RingSeries
+{
+  static_assert(N >= 1, "RingSeries needs at least one slot");
+
+public:
+  void push(const T& v)
+  {
+    m_items[m_head] = v;
+    m_head = m_head + 1 == N ? 0 : m_head + 1;
+    if (m_size < N) ++m_size;
+    ++m_total;
+  }
+
+  void clear()
+  {
+    m_head = 0;
+    m_size = 0;
+    m_total = 0;
+  }
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  static constexpr size_t capacity() { return N; }
+  // Samples pushed since the last clear(); lets views tell how many are new
+  uint32_t total() const { return m_total; }
+
+  // Sample `age` pushes before the newest; age must be < size()
+  const T& fromNewest(size_t age) const
+  {
+    size_t i = m_head + N - 1 - age;
+    return m_items[i >= N ? i - N : i];
+  }
+
+  const T& newest() const { return fromNewest(0); }
+
+  // Copy the newest min(n, size()) samples into out, oldest first.
+  // Returns the number copied.
+  size_t read(T* out, size_t n) const
+  {
+    if (n > m_size) n = m_size;
+    for (size_t k = 0; k < n; ++k) out[k] = fromNewest(n - 1 - k);
+    return n;
+  }
+
+private:
+  T m_items[N];
+  size_t m_head = 0;
+  size_t m_size = 0;
+  uint32_t m_total = 0;
+};
+
+// One rolled-up bucket of a coarser tier
+template <typename T>
+struct Rollup
+{
+  T min, max, avg;
+};
+
+// Percentage history at three resolutions: every raw sample, 1 minute and
+// 15 minute min/max/avg rollups. With uint8_t samples the defaults used by
+// the charts (a few minutes raw, an hour of minutes, a day of quarters) take
+// about 600 bytes per series.
+template <typename T, size_t RawN, size_t MinuteN, size_t QuarterN>
+class TieredSeries
+{
+public:
+  typedef PctFixed<T> Codec;
+  static const uint32_t MINUTE_S = 60;
+  static const uint32_t QUARTER_S = 15 * 60;
+
+  // Append a sample taken at now_s (any monotonic seconds clock). Buckets
+  // close when now_s moves into the next minute/quarter.
+  void push(float pct, uint32_t now_s)
+  {
+    T v = Codec::encode(pct);
+    m_raw.push(v);
+    if (m_minute.count && now_s / MINUTE_S != m_minute.id) closeMinute();
+    m_minute.add(v, v, v, 1, now_s / MINUTE_S);
+    if (m_quarter.count && now_s / QUARTER_S != m_quarter.id) closeQuarter();
+  }
+
+  void clear()
+  {
+    m_raw.clear();
+    m_minutes.clear();
+    m_quarters.clear();
+    m_minute = Bucket();
+    m_quarter = Bucket();
+  }
+
+  float latest() const { return m_raw.empty() ? 0.0f : Codec::decode(m_raw.newest()); }
+  float rawValue(size_t age) const { return Codec::decode(m_raw.fromNewest(age)); }
+
+  const RingSeries<T, RawN>& raw() const { return m_raw; }
+  const RingSeries<Rollup<T>, MinuteN>& minutes() const { return m_minutes; }
+  const RingSeries<Rollup<T>, QuarterN>& quarters() const { return m_quarters; }
+
+private:
+  struct Bucket
+  {
+    uint32_t sum = 0;
+    uint32_t count = 0;
+    uint32_t id = 0;
+    T min = 0, max = 0;
+
+    void add(T lo, T hi, T avg, uint32_t n, uint32_t bucket_id)
+    {
+      if (count == 0) {
+        min = lo;
+        max = hi;
+        id = bucket_id;
+      } else {
+        if (lo < min) min = lo;
+        if (hi > max) max = hi;
+      }
+      sum += (uint32_t)avg * n;
+      count += n;
+    }
+
+    Rollup<T> rollup() const { return Rollup<T>{ min, max, (T)((sum + count / 2) / count) }; }
+  };
+
+  void closeMinute()
+  {
+    Rollup<T> r = m_minute.rollup();
+    m_minutes.push(r);
+    // Quarters fold in whole minutes, weighted by their sample count
+    uint32_t quarter_id = m_minute.id * MINUTE_S / QUARTER_S;
+    if (m_quarter.count && quarter_id != m_quarter.id) closeQuarter();
+    m_quarter.add(r.min, r.max, r.avg, m_minute.count, quarter_id);
+    m_minute = Bucket();
+  }
+
+  void closeQuarter()
+  {
+    m_quarters.push(m_quarter.rollup());
+    m_quarter = Bucket();
+  }
+
+  RingSeries<T, RawN> m_raw;
+  RingSeries<Rollup<T>, MinuteN> m_minutes;
+  RingSeries<Rollup<T>, QuarterN> m_quarters;
+  Bucket m_minute;
+  Bucket m_quarter;
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+// Lock-free single-producer/single-consumer ring buffer.
+// One task may push() and one other task may pop(); nothing else is shared.
+// N must be a power of two; one slot stays free so head == tail means empty.
+template <typename T, size_t N>
+class SpscQueue
+{
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+  // Producer side. Returns false (and drops the item) when the queue is full.
+  bool push(const T& item)
+  {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t next = (head + 1) & (N - 1);
+    if (next == m_tail.load(std::memory_order_acquire)) return false;
+    m_items[head] = item;
+    m_head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side. Returns false when there is nothing to read.
+  bool pop(T& out)
+  {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail == m_head.load(std::memory_order_acquire)) return false;
+    out = m_items[tail];
+    m_tail.store((tail + 1) & (N - 1), std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const
+  {
+    return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire);
+  }
+
+private:
+  T m_items[N];
+  std::atomic<size_t> m_head{0};
+  std::atomic<size_t> m_tail{0};
+};
@@ -0,0 +1,136 @@
+#pragma once
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Host stand-in for the LovyanGFX panel and frame sprite: the drawing calls
+// the firmware's chart and boot-image code make, into an RGB565 buffer,
+// plus counters for what the real panel would have been sent. Text only
+// moves the cursor (6x8 cells per glyph at size 1); glyph rendering is
+// LovyanGFX's own code and isn't what these benchmarks look at.
+class MockPanel
+{
+public:
+  MockPanel(int w = 320, int h = 240) : m_w(w), m_h(h), m_fb((size_t)w * h) {}
+
+  int width() const { return m_w; }
+  int height() const { return m_h; }
+  const uint16_t* buffer() const { return m_fb.data(); }
+  uint16_t pixel(int x, int y) const { return m_fb[(size_t)y * m_w + x]; }
+
+  void startWrite() {}
+  void endWrite() {}
+
+  void fillScreen(uint16_t c) { fillRect(0, 0, m_w, m_h, c); }
+
+  void fillRect(int x, int y, int w, int h, uint16_t c)
+  {
+    if (!clip(x, y, w, h)) return;
+    for (int row = y; row < y + h; ++row) {
+      uint16_t* p = &m_fb[(size_t)row * m_w + x];
+      for (int i = 0; i < w; ++i) p[i] = c;
+    }
+    m_pixels += (uint64_t)w * h;
+  }
+
+  void drawRect(int x, int y, int w, int h, uint16_t c)
+  {
+    drawFastHLine(x, y, w, c);
+    drawFastHLine(x, y + h - 1, w, c);
+    drawFastVLine(x, y, h, c);
+    drawFastVLine(x + w - 1, y, h, c);
+  }
+
+  void drawFastHLine(int x, int y, int w, uint16_t c) { fillRect(x, y, w, 1, c); }
+  void drawFastVLine(int x, int y, int h, uint16_t c) { fillRect(x, y, 1, h, c); }
+
+  void drawPixel(int x, int y, uint16_t c)
+  {
+    if (x < 0 || y < 0 || x >= m_w || y >= m_h) return;
+    m_fb[(size_t)y * m_w + x] = c;
+    ++m_pixels;
+  }
+
+  void drawLine(int x0, int y0, int x1, int y1, uint16_t c)
+  {
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    for (;;) {
+      drawPixel(x0, y0, c);
+      if (x0 == x1 && y0 == y1) break;
+      int e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+
+  void setTextColor(uint16_t) {}
+  void setTextSize(int size) { m_text_size = size; }
+  void setCursor(int x, int y) { m_cursor_x = x; m_cursor_y = y; }
+  size_t print(const char* s)
+  {
+    size_t n = strlen(s);
+    m_cursor_x += (int)n * 6 * m_text_size;
+    return n;
+  }
+  size_t printf(const char* fmt, ...)
+  {
+    char buf[128];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return print(buf);
+  }
+
+  // Image pushes land in the buffer and count as panel traffic
+  void pushImage(int x, int y, int w, int h, const uint16_t* data)
+  {
+    for (int row = 0; row < h; ++row) {
+      if (y + row < 0 || y + row >= m_h) continue;
+      for (int i = 0; i < w; ++i) {
+        if (x + i >= 0 && x + i < m_w) m_fb[(size_t)(y + row) * m_w + x + i] = data[(size_t)row * w + i];
+      }
+    }
+    countPush(w, h);
+  }
+  void pushImageDMA(int x, int y, int w, int h, const uint16_t* data) { pushImage(x, y, w, h, data); }
+
+  // Send a region as the firmware's presentRect() does (RGB565 on the wire)
+  void present(int x, int y, int w, int h)
+  {
+    if (clip(x, y, w, h)) countPush(w, h);
+  }
+
+  uint64_t bytesPushed() const { return m_bytes; }
+  uint32_t pushes() const { return m_pushes; }
+  uint64_t pixelsDrawn() const { return m_pixels; }
+  void resetCounters() { m_bytes = 0; m_pushes = 0; m_pixels = 0; }
+
+private:
+  bool clip(int& x, int& y, int& w, int& h) const
+  {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > m_w) w = m_w - x;
+    if (y + h > m_h) h = m_h - y;
+    return w > 0 && h > 0;
+  }
+
+  void countPush(int w, int h)
+  {
+    m_bytes += (uint64_t)w * h * 2;
+    ++m_pushes;
+  }
+
+  int m_w, m_h;
+  std::vector<uint16_t> m_fb;
+  int m_cursor_x = 0, m_cursor_y = 0, m_text_size = 1;
+  uint64_t m_bytes = 0;
+  uint32_t m_pushes = 0;
+  uint64_t m_pixels = 0;
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Canned server responses, as Sentinel-Server sends them (docs/API.md)
+
+// GET /metrics
+static const char METRICS_JSON[] =
+  "{\n"
+  "  \"timestamp\": \"2025-10-05T12:00:00.123456\",\n"
+  "  \"unix_time\": 1759665600,\n"
+  "  \"cpu\": 15.2,\n"
+  "  \"memory\": {\n"
+  "    \"total_gb\": 8.0,\n"
+  "    \"used_gb\": 4.2,\n"
+  "    \"available_gb\": 3.8,\n"
+  "    \"percentage\": 52.5\n"
+  "  },\n"
+  "  \"disk\": {\n"
+  "    \"total_gb\": 250.0,\n"
+  "    \"used_gb\": 125.5,\n"
+  "    \"free_gb\": 124.5,\n"
+  "    \"percentage\": 50.2\n"
+  "  },\n"
+  "  \"network\": {\n"
+  "    \"outbound_kbits_per_sec\": 150.75,\n"
+  "    \"total_sent_gb\": 12.5,\n"
+  "    \"total_received_gb\": 45.2\n"
+  "  },\n"
+  "  \"uptime\": {\n"
+  "    \"uptime_seconds\": 86400,\n"
+  "    \"uptime_formatted\": \"1 day, 0:00:00\",\n"
+  "    \"boot_time\": \"2025-10-04T12:00:00.000000\"\n"
+  "  },\n"
+  "  \"sample_age_ms\": 412\n"
+  "}\n";
+
+// One event from GET /metrics/stream?compact=1
+static const char METRICS_SSE_JSON[] =
+  "{\"timestamp\":\"2025-10-05T12:00:00.123456\",\"unix_time\":1759665600,\"cpu\":15.2,"
+  "\"memory\":{\"percentage\":52.5},\"disk\":{\"percentage\":50.2},"
+  "\"uptime\":{\"uptime_seconds\":86400},\"sample_age_ms\":0}";
+
+// GET /metrics.bin: v1 record, UTC+2
+static const uint8_t METRICS_BIN[28] = {
+  1, 28, 0, 0,             // version, size, flags
+  0xF0, 0x05,              // cpu 15.20 %
+  0x82, 0x14,              // memory 52.50 %
+  0x9C, 0x13,              // disk 50.20 %
+  0, 0,                    // reserved
+  0x80, 0x51, 0x01, 0x00,  // uptime 86400 s
+  0xC0, 0x5D, 0xE2, 0x68,  // unix 1759665600
+  0x20, 0x1C, 0x00, 0x00,  // utc offset 7200 s
+  0, 0, 0, 0,              // sample age 0 ms
+};
+
+// GET /metrics/history?format=bin: header for 150 records of 10 bytes
+static const uint8_t HISTORY_BIN_HEADER[8] = { 1, 8, 10, 0, 150, 0, 0, 0 };
+static const uint8_t HISTORY_BIN_RECORD[10] = {
+  0xC0, 0x5D, 0xE2, 0x68,  // unix
+  0xF0, 0x05, 0x82, 0x14, 0x9C, 0x13,
+};
@@ -0,0 +1,502 @@
+// Host benchmarks for the firmware's hot paths: chart drawing, /metrics
+// decoding, history rings and the boot image. Run with
+//   pio test -e native -v
+// Timings print as ns/op; draw benchmarks also report the bytes a frame
+// would push to the panel. Values are only checked for correctness, never
+// against a time budget, so a slow CI box can't fail the run.
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <new>
+#include <vector>
+#include <PNGdec.h>
+
+#include "chart_draw.h"
+#include "envelope.h"
+#include "layouts.h"
+#include "logo_rle.h"
+#include "metrics.h"
+#include "png_bands.h"
+#include "ring_series.h"
+#include "generated/logo_rgb565.h"
+#include "mock_lgfx.h"
+#include "payloads.h"
+
+#ifndef SENTINEL_BENCH_LOGO
+#define SENTINEL_BENCH_LOGO "logo_png.png"
+#endif
+
+// History shapes and layouts come from layouts.h, as in the firmware
+static const int BOOT_BAND_ROWS = 8;
+static const int BOOT_BAND_W = 320;
+
+// The firmware's colors (INK_RGB565 in main.cpp)
+static const layout::Inks LAYOUT_INKS = { 0xFFFF, 0x0000, 0xBDF7, 0xF800, 0x07E0 };
+static const uint16_t INK_CPU = 0x001F, INK_RAM = 0x07E0;
+
+static volatile uint32_t s_sink; // keeps results alive under -O2
+static MockPanel s_panel;
+static MetricSeries s_cpu, s_ram;
+static TrendEnvelope s_cpu_trend(TREND_COLUMN_S), s_ram_trend(TREND_COLUMN_S);
+
+// Pseudo-random load that wanders like a real host
+static float wobble(uint32_t i, float base)
+{
+  uint32_t h = i * 2654435761u;
+  return base + (float)((h >> 24) % 40) - 20.0f + (float)(i % 17);
+}
+
+template <typename Op>
+static double benchNs(const char* name, int iters, Op op)
+{
+  op(); // warm
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < iters; ++i) op();
+  auto t1 = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iters;
+  char msg[128];
+  snprintf(msg, sizeof(msg), "%-28s %10.0f ns/op", name, ns);
+  TEST_MESSAGE(msg);
+  return ns;
+}
+
+static void reportBytes(const char* name, uint64_t bytes, uint32_t pushes)
+{
+  char msg[128];
+  snprintf(msg, sizeof(msg), "%-28s %10llu bytes/frame in %u pushes", name, (unsigned long long)bytes, pushes);
+  TEST_MESSAGE(msg);
+}
+
+static void fillHistory()
+{
+  s_cpu.clear(); s_ram.clear();
+  s_cpu_trend.clear(); s_ram_trend.clear();
+  // An hour at the 2 s poll cadence
+  for (uint32_t i = 0; i < 1800; ++i) {
+    uint32_t now_s = 1000 + i * 2;
+    s_cpu.push(wobble(i, 40.0f), now_s);
+    s_ram.push(wobble(i + 7, 60.0f), now_s);
+    s_cpu_trend.add(PctFixed<uint8_t>::encode(wobble(i, 40.0f)), now_s);
+    s_ram_trend.add(PctFixed<uint8_t>::encode(wobble(i + 7, 60.0f)), now_s);
+  }
+}
+
+// Widget rectangles of the layout composed last
+struct Rect
+{
+  int x, y, w, h;
+};
+static Rect s_slots[layout::SLOT_PERF + 1];
+
+static void placeSlot(layout::Slot slot, int x, int y, int w, int h)
+{
+  s_slots[slot] = { x, y, w, h };
+}
+
+static chart::PlotArea slotPlot(layout::Slot slot)
+{
+  const Rect& r = s_slots[slot];
+  return chart::plotArea(r.x, r.y, r.w, r.h, HIST_SIZE);
+}
+
+static chart::Inks plotInks(uint16_t line)
+{
+  return { LAYOUT_INKS.background, LAYOUT_INKS.grid, line };
+}
+
+// Compose a layout and place the status line, as render*Layout() does
+static void composeCharts()
+{
+  memset(s_slots, 0, sizeof(s_slots));
+  layout::composeCharts(s_panel, LAYOUT_INKS, placeSlot);
+  layout::placeStatus(s_panel, false, placeSlot);
+}
+
+static void composeTrends()
+{
+  memset(s_slots, 0, sizeof(s_slots));
+  layout::composeTrends(s_panel, LAYOUT_INKS, placeSlot);
+  layout::placeStatus(s_panel, false, placeSlot);
+}
+
+// What paintWidget() draws for each placed slot, with fixed text where the
+// firmware formats live state
+static void paintSlots()
+{
+  for (int i = 0; i <= layout::SLOT_PERF; ++i) {
+    const Rect& r = s_slots[i];
+    if (r.w == 0) continue;
+    switch ((layout::Slot)i) {
+      case layout::SLOT_UPTIME: layout::drawTextBox(s_panel, r.x, r.y, r.w, r.h, "Up: 01:00:00", LAYOUT_INKS); break;
+      case layout::SLOT_STATUS: layout::drawStatusText(s_panel, r.x, r.y, r.w, r.h, "Live", LAYOUT_INKS.grid, LAYOUT_INKS); break;
+      case layout::SLOT_CPU_PLOT: chart::drawChartPlot(s_panel, slotPlot(layout::SLOT_CPU_PLOT), r.x, r.w, s_cpu, plotInks(INK_CPU)); break;
+      case layout::SLOT_RAM_PLOT: chart::drawChartPlot(s_panel, slotPlot(layout::SLOT_RAM_PLOT), r.x, r.w, s_ram, plotInks(INK_RAM)); break;
+      case layout::SLOT_CPU_TREND:
+        chart::drawTrendPlot<MetricSeries::Codec>(s_panel, slotPlot(layout::SLOT_CPU_TREND), r.x, r.w, s_cpu_trend, plotInks(INK_CPU));
+        break;
+      case layout::SLOT_RAM_TREND:
+        chart::drawTrendPlot<MetricSeries::Codec>(s_panel, slotPlot(layout::SLOT_RAM_TREND), r.x, r.w, s_ram_trend, plotInks(INK_RAM));
+        break;
+      case layout::SLOT_CPU_LABEL: layout::drawPercentLabel(s_panel, r.x, r.y, r.w, r.h, s_cpu.latest(), LAYOUT_INKS); break;
+      case layout::SLOT_RAM_LABEL: layout::drawPercentLabel(s_panel, r.x, r.y, r.w, r.h, s_ram.latest(), LAYOUT_INKS); break;
+      case layout::SLOT_DISK_BAR: layout::drawStorageBar(s_panel, r.x, r.y, r.w, r.h, 50.2f, LAYOUT_INKS); break;
+      case layout::SLOT_DISK_LABEL: layout::drawPercentLabel(s_panel, r.x, r.y, r.w, r.h, 50.2f, LAYOUT_INKS); break;
+      default: break;
+    }
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_chart_plot()
+{
+  composeCharts();
+  const Rect& r = s_slots[layout::SLOT_CPU_PLOT];
+  chart::PlotArea a = slotPlot(layout::SLOT_CPU_PLOT);
+  TEST_ASSERT_EQUAL_INT(HIST_SIZE, a.visible);
+  benchNs("drawChartPlot 304x60", 2000, [&] {
+    chart::drawChartPlot(s_panel, a, r.x, r.w, s_cpu, plotInks(INK_CPU));
+  });
+  // Incremental update: only the newest segment is drawn after a scroll
+  benchNs("drawPlotSegments newest", 200000, [&] {
+    chart::drawPlotSegments(s_panel, a, s_cpu, 1, 0, INK_CPU);
+  });
+}
+
+static void test_trend_plot()
+{
+  composeTrends();
+  const Rect& r = s_slots[layout::SLOT_CPU_TREND];
+  chart::PlotArea a = slotPlot(layout::SLOT_CPU_TREND);
+  TEST_ASSERT_EQUAL_INT(TREND_COLUMNS, (int)s_cpu_trend.size());
+  benchNs("drawTrendPlot 304x96", 2000, [&] {
+    chart::drawTrendPlot<MetricSeries::Codec>(s_panel, a, r.x, r.w, s_cpu_trend, plotInks(INK_CPU));
+  });
+}
+
+// Full repaints as renderChartsLayout()/renderTrendsLayout() compose them,
+// then presented whole; the incremental path presents only the plots
+static void test_layouts()
+{
+  auto charts = [&] {
+    composeCharts();
+    paintSlots();
+    s_panel.present(0, 0, s_panel.width(), s_panel.height());
+  };
+  benchNs("charts layout", 1000, charts);
+  s_panel.resetCounters();
+  charts();
+  TEST_ASSERT_EQUAL_UINT64(320ull * 240 * 2, s_panel.bytesPushed());
+  reportBytes("charts layout full", s_panel.bytesPushed(), s_panel.pushes());
+
+  chart::PlotArea cpu = slotPlot(layout::SLOT_CPU_PLOT);
+  chart::PlotArea ram = slotPlot(layout::SLOT_RAM_PLOT);
+  // A scroll presents only the rows the line crosses, as refreshWidgets() does
+  auto scrollSample = [&](const chart::PlotArea& a, const MetricSeries& data, uint16_t line) {
+    int top, bottom;
+    chart::drawPlotSegments(s_panel, a, data, 1, 0, line);
+    chart::scrollRowSpan(a, data, 1, top, bottom);
+    s_panel.present(a.x, top, a.w, bottom - top + 1);
+  };
+  s_panel.resetCounters();
+  scrollSample(cpu, s_cpu, INK_CPU);
+  scrollSample(ram, s_ram, INK_RAM);
+  TEST_ASSERT_TRUE(s_panel.bytesPushed() <= 2ull * cpu.w * cpu.h * 2);
+  reportBytes("charts layout per sample", s_panel.bytesPushed(), s_panel.pushes());
+
+  // Steady load keeps the line on a couple of rows
+  MetricSeries flat;
+  for (int i = 0; i < HIST_SIZE + 1; ++i) flat.push(52.5f, (uint32_t)i * 2);
+  s_panel.resetCounters();
+  scrollSample(cpu, flat, INK_CPU);
+  scrollSample(ram, flat, INK_RAM);
+  TEST_ASSERT_TRUE(s_panel.bytesPushed() <= 2ull * cpu.w * 2 * 2);
+  reportBytes("charts layout per flat sample", s_panel.bytesPushed(), s_panel.pushes());
+
+  benchNs("trends layout", 1000, [&] {
+    composeTrends();
+    paintSlots();
+    s_panel.present(0, 0, s_panel.width(), s_panel.height());
+  });
+}
+
+static void test_json_decode()
+{
+  MetricsSample s;
+  BufferSource check(METRICS_JSON, sizeof(METRICS_JSON) - 1);
+  MetricsJsonParser<BufferSource> parser(check);
+  TEST_ASSERT_TRUE(parser.parse(s));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 15.2f, s.cpu_pct);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 52.5f, s.ram_pct);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.2f, s.disk_pct);
+  TEST_ASSERT_EQUAL_UINT32(86400, s.uptime_s);
+  TEST_ASSERT_EQUAL_UINT32(1759665600u, s.unix_s);
+  TEST_ASSERT_EQUAL_STRING("2025-10-05T12:00:00.123456", s.timestamp);
+
+  benchNs("json /metrics", 20000, [&] {
+    BufferSource in(METRICS_JSON, sizeof(METRICS_JSON) - 1);
+    MetricsJsonParser<BufferSource> p(in);
+    s_sink = p.parse(s) ? s.uptime_s : 0;
+  });
+  benchNs("json sse compact", 50000, [&] {
+    BufferSource in(METRICS_SSE_JSON, sizeof(METRICS_SSE_JSON) - 1);
+    MetricsJsonParser<BufferSource> p(in);
+    s_sink = p.parse(s) ? s.uptime_s : 0;
+  });
+}
+
+static void test_binary_decode()
+{
+  MetricsSample s = {};
+  TEST_ASSERT_TRUE(decodeMetricsBinary(METRICS_BIN, sizeof(METRICS_BIN), s));
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 15.2f, s.cpu_pct);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 52.5f, s.ram_pct);
+  TEST_ASSERT_EQUAL_UINT32(86400, s.uptime_s);
+  TEST_ASSERT_EQUAL_UINT32(1759665600u, s.unix_s);
+  TEST_ASSERT_EQUAL_STRING("2025-10-05T14:00:00", s.timestamp);
+
+  HistoryBinHeader h;
+  TEST_ASSERT_TRUE(decodeHistoryHeader(HISTORY_BIN_HEADER, sizeof(HISTORY_BIN_HEADER), h));
+  TEST_ASSERT_EQUAL_UINT32(150, h.count);
+  decodeHistoryRecord(HISTORY_BIN_RECORD, s);
+  TEST_ASSERT_TRUE(s.backfill);
+  TEST_ASSERT_EQUAL_UINT32(1759665600u, s.unix_s);
+
+  benchNs("binary /metrics.bin", 200000, [&] {
+    s_sink = decodeMetricsBinary(METRICS_BIN, sizeof(METRICS_BIN), s) ? s.uptime_s : 0;
+  });
+  benchNs("binary history record", 1000000, [&] {
+    decodeHistoryRecord(HISTORY_BIN_RECORD, s);
+    s_sink = s.unix_s;
+  });
+}
+
+static void test_history_rings()
+{
+  uint32_t i = 0;
+  MetricSeries series;
+  benchNs("TieredSeries::push", 1000000, [&] {
+    series.push(wobble(i, 50.0f), 1000 + i * 2);
+    ++i;
+  });
+  TEST_ASSERT_EQUAL_UINT32(HIST_SIZE, series.raw().size());
+  TEST_ASSERT_EQUAL_UINT32(60, series.minutes().size());
+
+  TrendEnvelope env(TREND_COLUMN_S);
+  i = 0;
+  benchNs("ColumnEnvelope::add", 1000000, [&] {
+    env.add((uint8_t)(i * 7), 1000 + i * 2);
+    ++i;
+  });
+  TEST_ASSERT_EQUAL_UINT32(300, env.size());
+
+  RingSeries<uint32_t, 64> ring;
+  uint32_t out[64];
+  benchNs("RingSeries push", 1000000, [&] { ring.push(i++); });
+  benchNs("RingSeries read 64", 100000, [&] { s_sink = (uint32_t)ring.read(out, 64) + out[0]; });
+  TEST_ASSERT_EQUAL_UINT32(i - 1, ring.newest());
+}
+
+// Built-in logo: RLE decoded in bands and pushed as drawBootImage() does
+static void test_boot_rle()
+{
+  static uint16_t band[LOGO_RGB565_WIDTH * BOOT_BAND_ROWS];
+  auto draw = [&] {
+    LogoRleCursor cur;
+    for (int row = 0; row < LOGO_RGB565_HEIGHT; row += BOOT_BAND_ROWS) {
+      int rows = LOGO_RGB565_HEIGHT - row;
+      if (rows > BOOT_BAND_ROWS) rows = BOOT_BAND_ROWS;
+      decodeLogoRle(g_logo_rle, g_logo_rle_len, cur, band, (size_t)LOGO_RGB565_WIDTH * rows);
+      s_panel.pushImageDMA(0, row, LOGO_RGB565_WIDTH, rows, band);
+    }
+    TEST_ASSERT_EQUAL_size_t(g_logo_rle_len, cur.pos);
+  };
+  benchNs("boot logo rle", 500, draw);
+  s_panel.resetCounters();
+  draw();
+  TEST_ASSERT_EQUAL_UINT64((uint64_t)LOGO_RGB565_WIDTH * LOGO_RGB565_HEIGHT * 2, s_panel.bytesPushed());
+  reportBytes("boot logo rle", s_panel.bytesPushed(), s_panel.pushes());
+}
+
+// User boot image path: the source PNG through PNGdec into the same bands,
+// decimated like the firmware when it's larger than the panel
+static uint16_t s_png_bands[2][BOOT_BAND_W * BOOT_BAND_ROWS];
+
+static void test_boot_png()
+{
+  FILE* f = fopen(SENTINEL_BENCH_LOGO, "rb");
+  if (!f) TEST_IGNORE_MESSAGE("logo_png.png not found");
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + n);
+  fclose(f);
+
+  PNG* png = new (std::nothrow) PNG;
+  TEST_ASSERT_NOT_NULL(png);
+  std::vector<uint16_t> line;
+  PngBandSink<MockPanel> s = {};
+  auto decode = [&] {
+    TEST_ASSERT_EQUAL_INT(PNG_SUCCESS, png->openRAM(data.data(), (int)data.size(), drawPngBandLine<MockPanel>));
+    s.canvas = &s_panel;
+    s.png = png;
+    s.bands[0] = s_png_bands[0];
+    s.bands[1] = s_png_bands[1];
+    s.band_rows = BOOT_BAND_ROWS;
+    s.band_w = BOOT_BAND_W;
+    TEST_ASSERT_TRUE(pngBandLayout(s, png->getWidth(), png->getHeight(), s_panel.width(), s_panel.height()));
+    line.resize((size_t)png->getWidth());
+    s.line = s.step > 1 ? line.data() : nullptr;
+    TEST_ASSERT_EQUAL_INT(PNG_SUCCESS, png->decode(&s, 0));
+    flushPngBand(s);
+    TEST_ASSERT_EQUAL_INT(s.dh, s.out_row);
+    png->close();
+  };
+  benchNs("boot logo png", 50, decode);
+  s_panel.resetCounters();
+  decode();
+  TEST_ASSERT_EQUAL_UINT64((uint64_t)s.dw * s.dh * 2, s_panel.bytesPushed());
+  reportBytes("boot logo png", s_panel.bytesPushed(), s_panel.pushes());
+  delete png;
+}
+
+// Uncompressed RGB PNG whose pixels encode their own column and row, so the
+// decimated output can be checked pixel by pixel
+static uint16_t positionPixel(int x, int y)
+{
+  return (uint16_t)(((x & 31) << 11) | (((x >> 5) & 63) << 5) | (y & 31));
+}
+
+static void putBe32(std::vector<uint8_t>& out, uint32_t v)
+{
+  for (int shift = 24; shift >= 0; shift -= 8) out.push_back((uint8_t)(v >> shift));
+}
+
+static uint32_t crc32(const uint8_t* p, size_t n)
+{
+  uint32_t crc = 0xFFFFFFFFu;
+  while (n--) {
+    crc ^= *p++;
+    for (int k = 0; k < 8; ++k) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static void pngChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data)
+{
+  putBe32(out, (uint32_t)data.size());
+  size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  putBe32(out, crc32(&out[start], out.size() - start));
+}
+
+static std::vector<uint8_t> positionPng(int w, int h)
+{
+  // Scanlines with filter 0, then a zlib stream of stored deflate blocks
+  std::vector<uint8_t> raw;
+  for (int y = 0; y < h; ++y) {
+    raw.push_back(0);
+    for (int x = 0; x < w; ++x) {
+      uint16_t v = positionPixel(x, y);
+      raw.push_back((uint8_t)((v >> 11) << 3));
+      raw.push_back((uint8_t)(((v >> 5) & 63) << 2));
+      raw.push_back((uint8_t)((v & 31) << 3));
+    }
+  }
+  std::vector<uint8_t> z = { 0x78, 0x01 };
+  for (size_t pos = 0;;) {
+    size_t n = raw.size() - pos < 65535 ? raw.size() - pos : 65535;
+    bool last = pos + n == raw.size();
+    z.push_back(last ? 1 : 0);
+    z.push_back((uint8_t)n); z.push_back((uint8_t)(n >> 8));
+    z.push_back((uint8_t)~n); z.push_back((uint8_t)(~n >> 8));
+    z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+    pos += n;
+    if (last) break;
+  }
+  uint32_t a = 1, b = 0;
+  for (uint8_t c : raw) { a = (a + c) % 65521; b = (b + a) % 65521; }
+  putBe32(z, (b << 16) | a);
+
+  std::vector<uint8_t> ihdr;
+  putBe32(ihdr, (uint32_t)w);
+  putBe32(ihdr, (uint32_t)h);
+  ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 }); // 8-bit RGB, not interlaced
+  std::vector<uint8_t> out = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  pngChunk(out, "IHDR", ihdr);
+  pngChunk(out, "IDAT", z);
+  pngChunk(out, "IEND", {});
+  return out;
+}
+
+// Every scaled row arrives once, pixels come from every step-th column and
+// row, and nothing is written past dw pixels per row
+static void checkPngDecimation(int w, int h, int step)
+{
+  std::vector<uint8_t> data = positionPng(w, h);
+  PNG* png = new (std::nothrow) PNG;
+  TEST_ASSERT_NOT_NULL(png);
+  TEST_ASSERT_EQUAL_INT(PNG_SUCCESS, png->openRAM(data.data(), (int)data.size(), drawPngBandLine<MockPanel>));
+
+  const uint16_t CANARY = 0xA5A5;
+  std::vector<uint16_t> bands[2];
+  for (auto& b : bands) b.assign((size_t)BOOT_BAND_W * BOOT_BAND_ROWS, CANARY);
+  std::vector<uint16_t> line((size_t)w);
+  PngBandSink<MockPanel> s = {};
+  s.canvas = &s_panel;
+  s.png = png;
+  s.bands[0] = bands[0].data();
+  s.bands[1] = bands[1].data();
+  s.band_rows = BOOT_BAND_ROWS;
+  s.band_w = BOOT_BAND_W;
+  TEST_ASSERT_TRUE(pngBandLayout(s, w, h, s_panel.width(), s_panel.height()));
+  TEST_ASSERT_EQUAL_INT(step, s.step);
+  TEST_ASSERT_EQUAL_INT((w + step - 1) / step, s.dw);
+  TEST_ASSERT_EQUAL_INT((h + step - 1) / step, s.dh);
+  s.line = line.data();
+
+  s_panel.resetCounters();
+  TEST_ASSERT_EQUAL_INT(PNG_SUCCESS, png->decode(&s, 0));
+  flushPngBand(s);
+  png->close();
+  delete png;
+  TEST_ASSERT_EQUAL_INT(s.dh, s.out_row);
+  TEST_ASSERT_EQUAL_UINT64((uint64_t)s.dw * s.dh * 2, s_panel.bytesPushed());
+
+  int wrong = 0;
+  for (int row = 0; row < s.dh; ++row) {
+    for (int i = 0; i < s.dw; ++i) {
+      uint16_t v = positionPixel(i * step, row * step);
+      if (s_panel.pixel(s.x + i, s.y + row) != (uint16_t)((v >> 8) | (v << 8))) ++wrong;
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(0, wrong);
+  for (auto& b : bands) {
+    for (size_t i = (size_t)s.dw * BOOT_BAND_ROWS; i < b.size(); ++i) TEST_ASSERT_EQUAL_HEX16(CANARY, b[i]);
+  }
+}
+
+static void test_png_decimation()
+{
+  checkPngDecimation(640, 480, 2);
+  checkPngDecimation(1001, 333, 4);
+  checkPngDecimation(641, 241, 3);
+}
+
+int main(int, char**)
+{
+  fillHistory();
+  UNITY_BEGIN();
+  RUN_TEST(test_chart_plot);
+  RUN_TEST(test_trend_plot);
+  RUN_TEST(test_layouts);
+  RUN_TEST(test_json_decode);
+  RUN_TEST(test_binary_decode);
+  RUN_TEST(test_history_rings);
+  RUN_TEST(test_boot_rle);
+  RUN_TEST(test_boot_png);
+  RUN_TEST(test_png_decimation);
+  return UNITY_END();
+}